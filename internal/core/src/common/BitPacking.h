@@ -0,0 +1,128 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+
+// Bit packing of unsigned integers of a fixed width, in blocks of 64 values.
+// A block of width w takes exactly w words, so the block i of a packed array
+// starts at word i * w, the last block is padded with zeros.
+constexpr size_t kBitPackBlockSize = 64;
+
+inline int
+BitWidth(uint64_t max_value) {
+    return max_value == 0 ? 0 : 64 - __builtin_clzll(max_value);
+}
+
+inline size_t
+BitPackedWords(size_t num_values, int width) {
+    return (num_values + kBitPackBlockSize - 1) / kBitPackBlockSize * width;
+}
+
+inline std::vector<uint64_t>
+BitPack(const uint64_t* values, size_t num_values, int width) {
+    std::vector<uint64_t> packed(BitPackedWords(num_values, width), 0);
+    if (width == 0) {
+        return packed;
+    }
+    for (size_t i = 0; i < num_values; ++i) {
+        auto bit = i * width;
+        auto word = bit / 64;
+        auto shift = bit % 64;
+        packed[word] |= values[i] << shift;
+        if (shift + width > 64) {
+            packed[word + 1] |= values[i] >> (64 - shift);
+        }
+    }
+    return packed;
+}
+
+// value i of a packed array of the given width
+inline uint64_t
+BitUnpackOne(const uint64_t* packed, int width, size_t i) {
+    if (width == 0) {
+        return 0;
+    }
+    auto bit = i * width;
+    auto word = bit / 64;
+    auto shift = bit % 64;
+    auto value = packed[word] >> shift;
+    if (shift + width > 64) {
+        value |= packed[word + 1] << (64 - shift);
+    }
+    return width == 64 ? value : value & ((uint64_t(1) << width) - 1);
+}
+
+namespace internal {
+
+template <int W, size_t I>
+inline void
+UnpackValue(const uint64_t* in, uint64_t* out) {
+    constexpr size_t bit = I * W;
+    constexpr size_t word = bit / 64;
+    constexpr size_t shift = bit % 64;
+    constexpr uint64_t mask = W == 64 ? ~uint64_t(0) : (uint64_t(1) << W) - 1;
+    uint64_t value = in[word] >> shift;
+    if constexpr (shift + W > 64) {
+        value |= in[word + 1] << (64 - shift);
+    }
+    out[I] = value & mask;
+}
+
+// fully unrolled, all the shifts are constants so that the compiler
+// vectorizes the block
+template <int W, size_t... I>
+inline void
+UnpackBlockImpl(const uint64_t* in, uint64_t* out, std::index_sequence<I...>) {
+    if constexpr (W == 0) {
+        ((out[I] = 0), ...);
+    } else {
+        (UnpackValue<W, I>(in, out), ...);
+    }
+}
+
+template <int W>
+void
+UnpackBlock(const uint64_t* in, uint64_t* out) {
+    UnpackBlockImpl<W>(in, out, std::make_index_sequence<kBitPackBlockSize>{});
+}
+
+using UnpackBlockFunc = void (*)(const uint64_t*, uint64_t*);
+
+template <int... W>
+constexpr std::array<UnpackBlockFunc, sizeof...(W)>
+MakeUnpackBlockFuncs(std::integer_sequence<int, W...>) {
+    return {&UnpackBlock<W>...};
+}
+
+}  // namespace internal
+
+// the kernel unpacking a block of the given width into 64 values
+inline internal::UnpackBlockFunc
+GetUnpackBlockFunc(int width) {
+    static constexpr auto funcs = internal::MakeUnpackBlockFuncs(
+        std::make_integer_sequence<int, 65>{});
+    return funcs[width];
+}
+
+}  // namespace milvus
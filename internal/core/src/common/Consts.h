@@ -46,6 +46,11 @@ const int64_t DEFAULT_LOW_PRIORITY_THREAD_CORE_COEFFICIENT = 1;
 
 const int64_t DEFAULT_INDEX_FILE_SLICE_SIZE = 4 << 20;  // bytes
 
+// remote objects of at least this size are read by concurrent range GETs
+const int64_t DEFAULT_MULTIPART_READ_THRESHOLD = 16 << 20;  // bytes
+const int64_t DEFAULT_MULTIPART_READ_PART_SIZE = 8 << 20;   // bytes
+const int64_t DEFAULT_MULTIPART_READ_PARALLELISM = 8;
+
 const int DEFAULT_CPU_NUM = 1;
 
 constexpr const char* RADIUS = knowhere::meta::RADIUS;
@@ -92,6 +92,18 @@ class Json {
         return *this;
     }
 
+    Json&
+    operator=(Json&& json) noexcept {
+        if (json.own_data_.has_value()) {
+            own_data_ = std::move(json.own_data_);
+            data_ = own_data_.value();
+        } else {
+            own_data_.reset();
+            data_ = json.data_;
+        }
+        return *this;
+    }
+
     operator std::string_view() const {
         return data_;
     }
@@ -0,0 +1,58 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "common/Metrics.h"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "knowhere/prometheus_client.h"
+
+namespace milvus::metrics {
+
+namespace {
+std::mutex families_mutex;
+std::unordered_map<std::string, prometheus::Family<prometheus::Counter>*>
+    counter_families;
+std::unordered_map<std::string, prometheus::Family<prometheus::Gauge>*>
+    gauge_families;
+}  // namespace
+
+prometheus::Counter&
+GetCounter(const std::string& name,
+           const std::string& help,
+           const prometheus::Labels& labels) {
+    std::lock_guard lck(families_mutex);
+    auto iter = counter_families.find(name);
+    if (iter == counter_families.end()) {
+        auto& family =
+            prometheus::BuildCounter().Name(name).Help(help).Register(
+                knowhere::prometheusClient->GetRegistry());
+        iter = counter_families.emplace(name, &family).first;
+    }
+    return iter->second->Add(labels);
+}
+
+prometheus::Gauge&
+GetGauge(const std::string& name,
+         const std::string& help,
+         const prometheus::Labels& labels) {
+    std::lock_guard lck(families_mutex);
+    auto iter = gauge_families.find(name);
+    if (iter == gauge_families.end()) {
+        auto& family = prometheus::BuildGauge().Name(name).Help(help).Register(
+            knowhere::prometheusClient->GetRegistry());
+        iter = gauge_families.emplace(name, &family).first;
+    }
+    return iter->second->Add(labels);
+}
+
+}  // namespace milvus::metrics
@@ -0,0 +1,37 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <string>
+
+#include <prometheus/counter.h>
+#include <prometheus/gauge.h>
+#include <prometheus/labels.h>
+
+namespace milvus::metrics {
+
+// Metrics of segcore are registered on the knowhere prometheus registry,
+// which is exported to the Go side through GetKnowhereMetrics().
+// Families are created lazily on first use, callers should keep the
+// returned reference (e.g. in a function-local static) instead of looking
+// it up on every hot path call.
+prometheus::Counter&
+GetCounter(const std::string& name,
+           const std::string& help,
+           const prometheus::Labels& labels = {});
+
+prometheus::Gauge&
+GetGauge(const std::string& name,
+         const std::string& help,
+         const prometheus::Labels& labels = {});
+
+}  // namespace milvus::metrics
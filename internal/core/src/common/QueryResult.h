@@ -66,6 +66,11 @@ struct SearchResult {
 
     // used for reduce, filter invalid pk, get real topks count
     std::vector<size_t> topk_per_nq_prefix_sum_;
+
+    // results of each vector field of a hybrid search fused by rank, the
+    // rank of a result in a field is known only after the results of all
+    // segments are reduced, distances_ of them are the larger the better
+    std::vector<SearchResult> field_results_;
 };
 
 using SearchResultPtr = std::shared_ptr<SearchResult>;
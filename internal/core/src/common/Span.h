@@ -34,6 +34,20 @@ class SpanBase {
         : data_(data), row_count_(row_count), element_sizeof_(element_sizeof) {
     }
 
+    // rows of variable length, the row i takes the bytes
+    // [offsets[i], offsets[i + 1]) of data, an offset is of offset_sizeof
+    // bytes
+    explicit SpanBase(const void* data,
+                      const void* offsets,
+                      int64_t offset_sizeof,
+                      int64_t row_count)
+        : data_(data),
+          offsets_(offsets),
+          offset_sizeof_(offset_sizeof),
+          row_count_(row_count),
+          element_sizeof_(0) {
+    }
+
     int64_t
     row_count() const {
         return row_count_;
@@ -49,20 +63,37 @@ class SpanBase {
         return data_;
     }
 
+    const void*
+    offsets() const {
+        return offsets_;
+    }
+
+    int64_t
+    offset_sizeof() const {
+        return offset_sizeof_;
+    }
+
  private:
     const void* data_;
+    const void* offsets_{nullptr};
+    int64_t offset_sizeof_{0};
     int64_t row_count_;
     int64_t element_sizeof_;
 };
 
+// the types viewing the rows of a variable length column
+template <typename T>
+constexpr bool IsVariableView =
+    std::is_same_v<T, std::string_view> || std::is_same_v<T, Json>;
+
 template <typename T, typename Enable = void>
 class Span;
 
 // TODO: refine Span to support T=FloatVector
 template <typename T>
-class Span<
-    T,
-    typename std::enable_if_t<IsScalar<T> || std::is_same_v<T, PkType>>> {
+class Span<T,
+           typename std::enable_if_t<(IsScalar<T> && !IsVariableView<T>) ||
+                                     std::is_same_v<T, PkType>>> {
  public:
     using embedded_type = T;
     explicit Span(const T* data, int64_t row_count)
@@ -107,6 +138,70 @@ class Span<
     const int64_t row_count_;
 };
 
+// Span of the rows of a variable length column, either an array of views or
+// the bytes and the offsets of the rows, in which case a view of a row is
+// only built when accessed
+template <typename T>
+class Span<T, typename std::enable_if_t<IsVariableView<T>>> {
+ public:
+    using embedded_type = T;
+    explicit Span(const T* views, int64_t row_count)
+        : views_(views), row_count_(row_count) {
+    }
+
+    explicit Span(const SpanBase& base) : row_count_(base.row_count()) {
+        if (base.offsets() == nullptr) {
+            assert(base.element_sizeof() == sizeof(T));
+            views_ = reinterpret_cast<const T*>(base.data());
+        } else {
+            assert(base.offset_sizeof() == sizeof(uint32_t) ||
+                   base.offset_sizeof() == sizeof(uint64_t));
+            data_ = reinterpret_cast<const char*>(base.data());
+            offsets_ = base.offsets();
+            offset_sizeof_ = base.offset_sizeof();
+        }
+    }
+
+    operator SpanBase() const {
+        if (views_ != nullptr) {
+            return SpanBase(views_, row_count_, sizeof(T));
+        }
+        return SpanBase(data_, offsets_, offset_sizeof_, row_count_);
+    }
+
+    T
+    operator[](int64_t offset) const {
+        if (views_ != nullptr) {
+            return views_[offset];
+        }
+        if (offset_sizeof_ == sizeof(uint32_t)) {
+            return Row<uint32_t>(offset);
+        }
+        return Row<uint64_t>(offset);
+    }
+
+    int64_t
+    row_count() const {
+        return row_count_;
+    }
+
+ private:
+    template <typename OffsetType>
+    T
+    Row(int64_t offset) const {
+        auto offsets = reinterpret_cast<const OffsetType*>(offsets_);
+        return T(data_ + offsets[offset],
+                 offsets[offset + 1] - offsets[offset]);
+    }
+
+ private:
+    const T* views_{nullptr};
+    const char* data_{nullptr};
+    const void* offsets_{nullptr};
+    int64_t offset_sizeof_{0};
+    const int64_t row_count_;
+};
+
 template <typename VectorType>
 class Span<
     VectorType,
@@ -0,0 +1,439 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "common/type_c.h"
+#include "common/Slice.h"
+#include "common/Utils.h"
+#include "index/Meta.h"
+#include "index/Utils.h"
+
+namespace milvus::index {
+
+namespace bitmap {
+
+template <typename T>
+inline void
+WriteValue(std::vector<uint8_t>& buf, const T& value) {
+    auto pos = buf.size();
+    if constexpr (std::is_same_v<T, std::string>) {
+        uint64_t len = value.size();
+        buf.resize(pos + sizeof(uint64_t) + len);
+        memcpy(buf.data() + pos, &len, sizeof(uint64_t));
+        memcpy(buf.data() + pos + sizeof(uint64_t), value.data(), len);
+    } else {
+        buf.resize(pos + sizeof(T));
+        memcpy(buf.data() + pos, &value, sizeof(T));
+    }
+}
+
+// read a value from data, returns the bytes consumed
+template <typename T>
+inline size_t
+ReadValue(const uint8_t* data, size_t size, T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        uint64_t len = 0;
+        AssertInfo(size >= sizeof(uint64_t), "bitmap index data is truncated");
+        memcpy(&len, data, sizeof(uint64_t));
+        AssertInfo(size - sizeof(uint64_t) >= len,
+                   "bitmap index data is truncated");
+        value.assign(reinterpret_cast<const char*>(data + sizeof(uint64_t)),
+                     len);
+        return sizeof(uint64_t) + len;
+    } else {
+        AssertInfo(size >= sizeof(T), "bitmap index data is truncated");
+        memcpy(&value, data, sizeof(T));
+        return sizeof(T);
+    }
+}
+
+}  // namespace bitmap
+
+template <typename T>
+inline BitmapIndex<T>::BitmapIndex(storage::FileManagerImplPtr file_manager)
+    : is_built_(false), num_rows_(0) {
+    if (file_manager != nullptr) {
+        file_manager_ = std::dynamic_pointer_cast<storage::MemFileManagerImpl>(
+            file_manager);
+    }
+}
+
+template <typename T>
+inline int64_t
+BitmapIndex<T>::cardinality_limit(const Config& config) const {
+    auto value = GetIntParamFromConfig(
+        config, BITMAP_CARDINALITY_LIMIT, DEFAULT_BITMAP_CARDINALITY_LIMIT);
+    AssertInfo(value > 0,
+               fmt::format("{} must be positive", BITMAP_CARDINALITY_LIMIT));
+    return value;
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::CheckCardinality(size_t cardinality, int64_t limit) const {
+    if (cardinality > static_cast<size_t>(limit)) {
+        PanicCodeInfo(ErrorCodeEnum::IllegalArgument,
+                      fmt::format("too many distinct values to build a bitmap "
+                                  "index, {} while the {} is {}",
+                                  cardinality,
+                                  BITMAP_CARDINALITY_LIMIT,
+                                  limit));
+    }
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::BuildFromOffsets(
+    std::vector<std::pair<T, std::vector<uint32_t>>>& groups) {
+    values_.clear();
+    bitmaps_.clear();
+    values_.reserve(groups.size());
+    bitmaps_.reserve(groups.size());
+    for (auto& [value, offsets] : groups) {
+        values_.push_back(std::move(value));
+        bitmaps_.emplace_back(std::move(offsets), num_rows_);
+    }
+    is_built_ = true;
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::Build(const Config& config) {
+    if (is_built_)
+        return;
+    config_ = config;
+    auto insert_files =
+        GetValueFromConfig<std::vector<std::string>>(config, "insert_files");
+    AssertInfo(insert_files.has_value(),
+               "insert file paths is empty when build index");
+    auto field_datas =
+        file_manager_->CacheRawDataToMemory(insert_files.value());
+
+    std::map<T, std::vector<uint32_t>> groups;
+    uint32_t offset = 0;
+    for (auto data : field_datas) {
+        auto slice_num = data->get_num_rows();
+        for (size_t i = 0; i < slice_num; ++i) {
+            auto value = reinterpret_cast<const T*>(data->RawValue(i));
+            groups[*value].push_back(offset++);
+        }
+    }
+    if (offset == 0) {
+        throw std::invalid_argument("BitmapIndex cannot build null values!");
+    }
+    // the distinct values of all the slices
+    CheckCardinality(groups.size(), cardinality_limit(config));
+
+    num_rows_ = offset;
+    std::vector<std::pair<T, std::vector<uint32_t>>> sorted(
+        std::make_move_iterator(groups.begin()),
+        std::make_move_iterator(groups.end()));
+    BuildFromOffsets(sorted);
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::Build(size_t n, const T* values) {
+    if (is_built_)
+        return;
+    if (n == 0) {
+        throw std::invalid_argument("BitmapIndex cannot build null values!");
+    }
+
+    std::map<T, std::vector<uint32_t>> groups;
+    for (size_t i = 0; i < n; ++i) {
+        groups[values[i]].push_back(i);
+    }
+    CheckCardinality(groups.size(), cardinality_limit(config_));
+
+    num_rows_ = n;
+    std::vector<std::pair<T, std::vector<uint32_t>>> sorted(
+        std::make_move_iterator(groups.begin()),
+        std::make_move_iterator(groups.end()));
+    BuildFromOffsets(sorted);
+}
+
+template <typename T>
+inline BinarySet
+BitmapIndex<T>::Serialize(const Config& config) {
+    AssertInfo(is_built_, "index has not been built");
+
+    std::vector<uint8_t> buf;
+    uint64_t header[2] = {num_rows_, values_.size()};
+    buf.resize(sizeof(header));
+    memcpy(buf.data(), header, sizeof(header));
+    for (size_t i = 0; i < values_.size(); ++i) {
+        bitmap::WriteValue<T>(buf, values_[i]);
+        bitmaps_[i].Serialize(buf);
+    }
+
+    std::shared_ptr<uint8_t[]> index_data(new uint8_t[buf.size()]);
+    memcpy(index_data.get(), buf.data(), buf.size());
+
+    BinarySet res_set;
+    res_set.Append(BITMAP_INDEX_DATA, index_data, buf.size());
+
+    milvus::Disassemble(res_set);
+
+    return res_set;
+}
+
+template <typename T>
+inline BinarySet
+BitmapIndex<T>::Upload(const Config& config) {
+    auto binary_set = Serialize(config);
+    file_manager_->AddFile(binary_set);
+
+    auto remote_paths_to_size = file_manager_->GetRemotePathsToFileSize();
+    BinarySet ret;
+    for (auto& file : remote_paths_to_size) {
+        ret.Append(file.first, nullptr, file.second);
+    }
+
+    return ret;
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::LoadWithoutAssemble(const BinarySet& index_binary,
+                                    const Config& config) {
+    auto index_data = index_binary.GetByName(BITMAP_INDEX_DATA);
+    AssertInfo(index_data != nullptr, "bitmap index data not found");
+    auto data = index_data->data.get();
+    size_t size = index_data->size;
+
+    uint64_t header[2];
+    AssertInfo(size >= sizeof(header), "bitmap index data is truncated");
+    memcpy(header, data, sizeof(header));
+    size_t pos = sizeof(header);
+
+    num_rows_ = header[0];
+    values_.clear();
+    values_.reserve(header[1]);
+    bitmaps_.resize(header[1]);
+    for (size_t i = 0; i < bitmaps_.size(); ++i) {
+        T value;
+        pos += bitmap::ReadValue(data + pos, size - pos, value);
+        values_.push_back(std::move(value));
+        pos += bitmaps_[i].Deserialize(data + pos, size - pos, num_rows_);
+    }
+    is_built_ = true;
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::Load(const BinarySet& index_binary, const Config& config) {
+    milvus::Assemble(const_cast<BinarySet&>(index_binary));
+    LoadWithoutAssemble(index_binary, config);
+}
+
+template <typename T>
+inline void
+BitmapIndex<T>::Load(const Config& config) {
+    auto index_files =
+        GetValueFromConfig<std::vector<std::string>>(config, "index_files");
+    AssertInfo(index_files.has_value(),
+               "index file paths is empty when load bitmap index");
+    auto index_datas = file_manager_->LoadIndexToMemory(index_files.value());
+    AssembleIndexDatas(index_datas);
+    BinarySet binary_set;
+    for (auto& [key, data] : index_datas) {
+        auto size = data->Size();
+        auto deleter = [&](uint8_t*) {};  // avoid repeated deconstruction
+        auto buf = std::shared_ptr<uint8_t[]>(
+            (uint8_t*)const_cast<void*>(data->Data()), deleter);
+        binary_set.Append(key, buf, size);
+    }
+
+    LoadWithoutAssemble(binary_set, config);
+}
+
+template <typename T>
+inline TargetBitmap
+BitmapIndex<T>::Union(size_t begin, size_t end) const {
+    TargetBitmap bitset(num_rows_);
+    for (auto i = begin; i < end; ++i) {
+        bitmaps_[i].Apply(bitset, true);
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::In(const size_t n, const T* values) {
+    AssertInfo(is_built_, "index has not been built");
+    TargetBitmap bitset(num_rows_);
+    for (size_t i = 0; i < n; ++i) {
+        auto it = std::lower_bound(values_.begin(), values_.end(), values[i]);
+        if (it != values_.end() && *it == values[i]) {
+            bitmaps_[it - values_.begin()].Apply(bitset, true);
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::NotIn(const size_t n, const T* values) {
+    AssertInfo(is_built_, "index has not been built");
+    TargetBitmap bitset(num_rows_, true);
+    for (size_t i = 0; i < n; ++i) {
+        auto it = std::lower_bound(values_.begin(), values_.end(), values[i]);
+        if (it != values_.end() && *it == values[i]) {
+            bitmaps_[it - values_.begin()].Apply(bitset, false);
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::Range(const T value, const OpType op) {
+    AssertInfo(is_built_, "index has not been built");
+    auto begin = values_.begin();
+    auto end = values_.end();
+    switch (op) {
+        case OpType::LessThan:
+            end = std::lower_bound(values_.begin(), values_.end(), value);
+            break;
+        case OpType::LessEqual:
+            end = std::upper_bound(values_.begin(), values_.end(), value);
+            break;
+        case OpType::GreaterThan:
+            begin = std::upper_bound(values_.begin(), values_.end(), value);
+            break;
+        case OpType::GreaterEqual:
+            begin = std::lower_bound(values_.begin(), values_.end(), value);
+            break;
+        default:
+            throw std::invalid_argument(std::string("Invalid OperatorType: ") +
+                                        std::to_string((int)op) + "!");
+    }
+    return Union(begin - values_.begin(), end - values_.begin());
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::Range(T lower_bound_value,
+                      bool lb_inclusive,
+                      T upper_bound_value,
+                      bool ub_inclusive) {
+    AssertInfo(is_built_, "index has not been built");
+    if (lower_bound_value > upper_bound_value ||
+        (lower_bound_value == upper_bound_value &&
+         !(lb_inclusive && ub_inclusive))) {
+        return TargetBitmap(num_rows_);
+    }
+    auto begin =
+        lb_inclusive
+            ? std::lower_bound(
+                  values_.begin(), values_.end(), lower_bound_value)
+            : std::upper_bound(
+                  values_.begin(), values_.end(), lower_bound_value);
+    auto end = ub_inclusive
+                   ? std::upper_bound(
+                         values_.begin(), values_.end(), upper_bound_value)
+                   : std::lower_bound(
+                         values_.begin(), values_.end(), upper_bound_value);
+    if (begin >= end) {
+        return TargetBitmap(num_rows_);
+    }
+    return Union(begin - values_.begin(), end - values_.begin());
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::PrefixMatch(const std::string_view prefix) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        AssertInfo(is_built_, "index has not been built");
+        // the values of a prefix are contiguous in the sorted values
+        auto begin = std::lower_bound(
+            values_.begin(), values_.end(), prefix, [](auto& a, auto& b) {
+                return std::string_view(a) < b;
+            });
+        auto end = begin;
+        while (end != values_.end() &&
+               std::string_view(*end).substr(0, prefix.size()) == prefix) {
+            ++end;
+        }
+        return Union(begin - values_.begin(), end - values_.begin());
+    } else {
+        PanicInfo("prefix match is only supported on string fields");
+    }
+}
+
+template <typename T>
+template <typename Pred>
+inline TargetBitmap
+BitmapIndex<T>::UnionIf(Pred pred) const {
+    TargetBitmap res(num_rows_);
+    for (size_t i = 0; i < values_.size(); ++i) {
+        if (pred(values_[i])) {
+            bitmaps_[i].Apply(res, true);
+        }
+    }
+    return res;
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::PostfixMatch(const std::string_view postfix) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        AssertInfo(is_built_, "index has not been built");
+        return UnionIf([&](const std::string& value) {
+            return milvus::PostfixMatch(value, postfix);
+        });
+    } else {
+        PanicInfo("postfix match is only supported on string fields");
+    }
+}
+
+template <typename T>
+inline const TargetBitmap
+BitmapIndex<T>::InfixMatch(const std::string_view infix) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        AssertInfo(is_built_, "index has not been built");
+        return UnionIf([&](const std::string& value) {
+            return milvus::InfixMatch(value, infix);
+        });
+    } else {
+        PanicInfo("infix match is only supported on string fields");
+    }
+}
+
+template <typename T>
+inline T
+BitmapIndex<T>::Reverse_Lookup(size_t offset) const {
+    AssertInfo(offset < num_rows_, "out of range of total count");
+    AssertInfo(is_built_, "index has not been built");
+
+    for (size_t i = 0; i < bitmaps_.size(); ++i) {
+        if (bitmaps_[i].Contains(offset)) {
+            return values_[i];
+        }
+    }
+    PanicInfo("offset not found in bitmap index");
+}
+}  // namespace milvus::index
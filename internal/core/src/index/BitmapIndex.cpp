@@ -0,0 +1,131 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/BitmapIndex.h"
+
+#include <cstring>
+
+namespace milvus::index {
+
+namespace {
+constexpr size_t kWordBits = 64;
+
+template <typename V>
+void
+Put(std::vector<uint8_t>& buf, const V* data, size_t n) {
+    auto pos = buf.size();
+    buf.resize(pos + n * sizeof(V));
+    memcpy(buf.data() + pos, data, n * sizeof(V));
+}
+}  // namespace
+
+RowBitmap::RowBitmap(std::vector<uint32_t> offsets, size_t num_rows)
+    : cardinality_(offsets.size()) {
+    // an offset takes 32 bits while a dense bitmap takes a bit of every row
+    dense_ = offsets.size() * 32 > num_rows;
+    if (!dense_) {
+        offsets_ = std::move(offsets);
+        return;
+    }
+    words_.resize((num_rows + kWordBits - 1) / kWordBits, 0);
+    for (auto offset : offsets) {
+        words_[offset / kWordBits] |= uint64_t(1) << (offset % kWordBits);
+    }
+}
+
+bool
+RowBitmap::Contains(size_t offset) const {
+    if (dense_) {
+        return offset / kWordBits < words_.size() &&
+               (words_[offset / kWordBits] >> (offset % kWordBits)) & 1;
+    }
+    return std::binary_search(offsets_.begin(), offsets_.end(), offset);
+}
+
+void
+RowBitmap::Apply(TargetBitmap& res, bool value) const {
+    auto data = res.data();
+    if (!dense_) {
+        for (auto offset : offsets_) {
+            data[offset] = value;
+        }
+        return;
+    }
+    auto num_rows = res.size();
+    for (size_t w = 0; w < words_.size(); ++w) {
+        auto word = words_[w];
+        if (word == 0) {
+            continue;
+        }
+        auto begin = w * kWordBits;
+        auto n = std::min(kWordBits, num_rows - begin);
+        // branch free so that the full words vectorize
+        if (value) {
+            for (size_t i = 0; i < n; ++i) {
+                data[begin + i] |= bool((word >> i) & 1);
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                data[begin + i] &= !((word >> i) & 1);
+            }
+        }
+    }
+}
+
+void
+RowBitmap::Serialize(std::vector<uint8_t>& buf) const {
+    uint8_t dense = dense_;
+    uint64_t cardinality = cardinality_;
+    uint64_t size = dense_ ? words_.size() : offsets_.size();
+    Put(buf, &dense, 1);
+    Put(buf, &cardinality, 1);
+    Put(buf, &size, 1);
+    if (dense_) {
+        Put(buf, words_.data(), words_.size());
+    } else {
+        Put(buf, offsets_.data(), offsets_.size());
+    }
+}
+
+size_t
+RowBitmap::Deserialize(const uint8_t* data, size_t size, size_t num_rows) {
+    constexpr size_t header_size = 1 + 2 * sizeof(uint64_t);
+    AssertInfo(size >= header_size, "bitmap index data is truncated");
+    uint64_t cardinality = 0;
+    uint64_t n = 0;
+    dense_ = data[0] != 0;
+    memcpy(&cardinality, data + 1, sizeof(uint64_t));
+    memcpy(&n, data + 1 + sizeof(uint64_t), sizeof(uint64_t));
+    cardinality_ = cardinality;
+
+    auto payload = data + header_size;
+    auto payload_size =
+        n * (dense_ ? sizeof(uint64_t) : sizeof(uint32_t));
+    AssertInfo(size - header_size >= payload_size,
+               "bitmap index data is truncated");
+    if (dense_) {
+        AssertInfo(n == (num_rows + kWordBits - 1) / kWordBits,
+                   "bitmap index data is corrupted");
+        words_.resize(n);
+        memcpy(words_.data(), payload, payload_size);
+    } else {
+        offsets_.resize(n);
+        memcpy(offsets_.data(), payload, payload_size);
+    }
+    return header_size + payload_size;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,204 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "index/ScalarIndex.h"
+#include "index/StringIndex.h"
+#include "storage/MemFileManagerImpl.h"
+
+namespace milvus::index {
+
+// The rows holding one value of a bitmap index. A sparse bitmap keeps the
+// sorted offsets of its rows, a dense one keeps a bit of every row, the
+// bitmap takes whichever form is smaller.
+class RowBitmap {
+ public:
+    RowBitmap() = default;
+
+    RowBitmap(std::vector<uint32_t> offsets, size_t num_rows);
+
+    bool
+    IsDense() const {
+        return dense_;
+    }
+
+    size_t
+    Cardinality() const {
+        return cardinality_;
+    }
+
+    bool
+    Contains(size_t offset) const;
+
+    // set res[i] to value for all the rows i of the bitmap
+    void
+    Apply(TargetBitmap& res, bool value) const;
+
+    size_t
+    ByteSize() const {
+        return offsets_.size() * sizeof(uint32_t) +
+               words_.size() * sizeof(uint64_t);
+    }
+
+    void
+    Serialize(std::vector<uint8_t>& buf) const;
+
+    // read a bitmap from data, returns the bytes consumed
+    size_t
+    Deserialize(const uint8_t* data, size_t size, size_t num_rows);
+
+ private:
+    bool dense_{false};
+    size_t cardinality_{0};
+    std::vector<uint32_t> offsets_;
+    std::vector<uint64_t> words_;
+};
+
+template <typename T>
+using BitmapIndexBase = std::
+    conditional_t<std::is_same_v<T, std::string>, StringIndex, ScalarIndex<T>>;
+
+// BitmapIndex keeps a bitmap of the rows for every distinct value of a field,
+// it suits the fields of few distinct values such as BOOL. In, NotIn and
+// Range OR the bitmaps of the matched values. Building fails if the field
+// has more distinct values than the bitmap_cardinality_limit.
+template <typename T>
+class BitmapIndex : public BitmapIndexBase<T> {
+ public:
+    explicit BitmapIndex(storage::FileManagerImplPtr file_manager = nullptr);
+
+    BinarySet
+    Serialize(const Config& config) override;
+
+    void
+    Load(const BinarySet& index_binary, const Config& config = {}) override;
+
+    void
+    Load(const Config& config = {}) override;
+
+    int64_t
+    Count() override {
+        return num_rows_;
+    }
+
+    void
+    Build(size_t n, const T* values) override;
+
+    void
+    Build(const Config& config = {}) override;
+
+    const TargetBitmap
+    In(size_t n, const T* values) override;
+
+    const TargetBitmap
+    NotIn(size_t n, const T* values) override;
+
+    const TargetBitmap
+    Range(T value, OpType op) override;
+
+    const TargetBitmap
+    Range(T lower_bound_value,
+          bool lb_inclusive,
+          T upper_bound_value,
+          bool ub_inclusive) override;
+
+    // only for the string fields
+    const TargetBitmap
+    PrefixMatch(const std::string_view prefix);
+
+    const TargetBitmap
+    PostfixMatch(const std::string_view postfix);
+
+    const TargetBitmap
+    InfixMatch(const std::string_view infix);
+
+    T
+    Reverse_Lookup(size_t offset) const override;
+
+    int64_t
+    Size() override {
+        return num_rows_;
+    }
+
+    BinarySet
+    Upload(const Config& config = {}) override;
+
+ public:
+    bool
+    IsBuilt() const {
+        return is_built_;
+    }
+
+    size_t
+    Cardinality() const {
+        return values_.size();
+    }
+
+    void
+    LoadWithoutAssemble(const BinarySet& binary_set, const Config& config);
+
+ private:
+    int64_t
+    cardinality_limit(const Config& config) const;
+
+    // panics if there are more distinct values than the limit
+    void
+    CheckCardinality(size_t cardinality, int64_t limit) const;
+
+    // build the bitmaps from the row offsets of every value, sorted by value
+    void
+    BuildFromOffsets(std::vector<std::pair<T, std::vector<uint32_t>>>& groups);
+
+    // OR the bitmaps in [begin, end) of values_
+    TargetBitmap
+    Union(size_t begin, size_t end) const;
+
+    // OR the bitmaps of the values satisfying pred
+    template <typename Pred>
+    TargetBitmap
+    UnionIf(Pred pred) const;
+
+ private:
+    bool is_built_;
+    Config config_;
+    size_t num_rows_;
+    std::vector<T> values_;  // sorted distinct values
+    std::vector<RowBitmap> bitmaps_;
+    std::shared_ptr<storage::MemFileManagerImpl> file_manager_;
+};
+
+template <typename T>
+using BitmapIndexPtr = std::unique_ptr<BitmapIndex<T>>;
+
+}  // namespace milvus::index
+
+#include "index/BitmapIndex-inl.h"
+
+namespace milvus::index {
+template <typename T>
+inline BitmapIndexPtr<T>
+CreateBitmapIndex(storage::FileManagerImplPtr file_manager = nullptr) {
+    return std::make_unique<BitmapIndex<T>>(file_manager);
+}
+}  // namespace milvus::index
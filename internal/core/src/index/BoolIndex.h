@@ -18,14 +18,14 @@
 
 #include <vector>
 #include <memory>
-#include "index/ScalarIndexSort.h"
+#include "index/BitmapIndex.h"
 
 namespace milvus::index {
 
-using BoolIndexPtr = std::shared_ptr<ScalarIndexSort<bool>>;
+using BoolIndexPtr = std::shared_ptr<BitmapIndex<bool>>;
 
 inline BoolIndexPtr
 CreateBoolIndex(storage::FileManagerImplPtr file_manager = nullptr) {
-    return std::make_unique<ScalarIndexSort<bool>>(file_manager);
+    return std::make_unique<BitmapIndex<bool>>(file_manager);
 }
 }  // namespace milvus::index
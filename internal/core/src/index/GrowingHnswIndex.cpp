@@ -0,0 +1,143 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/GrowingHnswIndex.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include "common/Consts.h"
+#include "common/RangeSearchHelper.h"
+#include "common/Utils.h"
+#include "index/Utils.h"
+
+namespace milvus::index {
+
+GrowingHnswIndex::GrowingHnswIndex(int64_t dim,
+                                   const MetricType& metric_type,
+                                   int64_t M,
+                                   int64_t ef_construction)
+    : VectorIndex(knowhere::IndexEnum::INDEX_HNSW, metric_type),
+      graph_(dim, metric_type, M, ef_construction) {
+    SetDim(dim);
+}
+
+void
+GrowingHnswIndex::Add(int64_t offset, int64_t n, const float* vectors) {
+    auto dim = GetDim();
+    for (int64_t i = 0; i < n; ++i) {
+        graph_.Add(offset + i, vectors + i * dim);
+    }
+}
+
+void
+GrowingHnswIndex::BuildWithDataset(const DatasetPtr& dataset,
+                                   const Config& config) {
+    AssertInfo(graph_.Count() == 0, "growing hnsw index is built already");
+    AddWithDataset(dataset, config);
+}
+
+void
+GrowingHnswIndex::AddWithDataset(const DatasetPtr& dataset,
+                                 const Config& config) {
+    AssertInfo(dataset->GetDim() == GetDim(),
+               "dim of dataset doesn't match the growing hnsw index");
+    Add(graph_.Size(),
+        dataset->GetRows(),
+        static_cast<const float*>(dataset->GetTensor()));
+}
+
+std::unique_ptr<SearchResult>
+GrowingHnswIndex::Query(const DatasetPtr dataset,
+                        const SearchInfo& search_info,
+                        const BitsetView& bitset) {
+    auto num_queries = dataset->GetRows();
+    auto topk = search_info.topk_;
+    auto& conf = search_info.search_params_;
+    auto ef =
+        GetIntParamFromConfig(conf, knowhere::indexparam::EF, kDefaultEf);
+    auto num_rows =
+        bitset.empty() ? graph_.InsertedPrefix() : int64_t(bitset.size());
+    auto queries = static_cast<const float*>(dataset->GetTensor());
+
+    auto result = std::make_unique<SearchResult>();
+    result->total_nq_ = num_queries;
+    result->unity_topK_ = topk;
+    result->seg_offsets_.resize(num_queries * topk);
+    result->distances_.resize(num_queries * topk);
+    for (int64_t i = 0; i < num_queries; ++i) {
+        graph_.Search(queries + i * GetDim(),
+                      topk,
+                      ef,
+                      num_rows,
+                      bitset,
+                      result->distances_.data() + i * topk,
+                      result->seg_offsets_.data() + i * topk);
+    }
+
+    // range search keeps the topk results in the range
+    if (conf.contains(RADIUS)) {
+        auto radius = conf[RADIUS].get<float>();
+        auto positive = PositivelyRelated(GetMetricType());
+        std::optional<float> range_filter;
+        if (conf.contains(RANGE_FILTER)) {
+            range_filter = conf[RANGE_FILTER].get<float>();
+            CheckRangeSearchParam(
+                radius, range_filter.value(), GetMetricType());
+        }
+        auto in_range = [&](float dist) {
+            if (positive) {
+                return dist > radius &&
+                       (!range_filter.has_value() || dist <= *range_filter);
+            }
+            return dist < radius &&
+                   (!range_filter.has_value() || dist >= *range_filter);
+        };
+        auto missing = (positive ? -1 : 1) * std::numeric_limits<float>::max();
+        for (int64_t i = 0; i < num_queries; ++i) {
+            auto offsets = result->seg_offsets_.data() + i * topk;
+            auto distances = result->distances_.data() + i * topk;
+            int64_t kept = 0;
+            for (int64_t j = 0; j < topk; ++j) {
+                if (offsets[j] != -1 && in_range(distances[j])) {
+                    offsets[kept] = offsets[j];
+                    distances[kept++] = distances[j];
+                }
+            }
+            std::fill(offsets + kept, offsets + topk, -1);
+            std::fill(distances + kept, distances + topk, missing);
+        }
+    }
+    return result;
+}
+
+std::vector<uint8_t>
+GrowingHnswIndex::GetVector(const DatasetPtr dataset) const {
+    auto rows = dataset->GetRows();
+    auto ids = dataset->GetIds();
+    auto row_size = GetDim() * sizeof(float);
+    std::vector<uint8_t> raw_data(rows * row_size);
+    for (int64_t i = 0; i < rows; ++i) {
+        std::memcpy(
+            raw_data.data() + i * row_size, graph_.GetVector(ids[i]), row_size);
+    }
+    return raw_data;
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,103 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "index/HnswGraph.h"
+#include "index/VectorIndex.h"
+
+namespace milvus::index {
+
+// GrowingHnswIndex is the vector index of a growing segment, an HNSW graph
+// that the rows are inserted into as the segment grows. It needs no
+// training, so it covers the segment from the first row on, holds the raw
+// vectors and is searched while rows are inserted. A search returns only the
+// rows covered by its bitset, i.e. the rows visible at its timestamp.
+class GrowingHnswIndex : public VectorIndex {
+ public:
+    GrowingHnswIndex(int64_t dim,
+                     const MetricType& metric_type,
+                     int64_t M = HnswGraph::kDefaultM,
+                     int64_t ef_construction =
+                         HnswGraph::kDefaultEfConstruction);
+
+    // insert the rows [offset, offset + n), concurrent with the other
+    // inserts and the searches
+    void
+    Add(int64_t offset, int64_t n, const float* vectors);
+
+    BinarySet
+    Serialize(const Config& config) override {
+        PanicInfo("growing hnsw index can't be serialized");
+    }
+
+    void
+    Load(const BinarySet& binary_set, const Config& config = {}) override {
+        PanicInfo("growing hnsw index can't be loaded");
+    }
+
+    void
+    Load(const Config& config = {}) override {
+        PanicInfo("growing hnsw index can't be loaded");
+    }
+
+    void
+    BuildWithDataset(const DatasetPtr& dataset,
+                     const Config& config = {}) override;
+
+    void
+    Build(const Config& config = {}) override {
+        PanicInfo("growing hnsw index is built by adding rows");
+    }
+
+    // append the rows after the inserted ones
+    void
+    AddWithDataset(const DatasetPtr& dataset, const Config& config) override;
+
+    int64_t
+    Count() override {
+        return graph_.Count();
+    }
+
+    std::unique_ptr<SearchResult>
+    Query(const DatasetPtr dataset,
+          const SearchInfo& search_info,
+          const BitsetView& bitset) override;
+
+    const bool
+    HasRawData() const override {
+        return true;
+    }
+
+    std::vector<uint8_t>
+    GetVector(const DatasetPtr dataset) const override;
+
+    BinarySet
+    Upload(const Config& config = {}) override {
+        PanicInfo("growing hnsw index can't be uploaded");
+    }
+
+ public:
+    static constexpr int64_t kDefaultEf = 64;
+
+ private:
+    HnswGraph graph_;
+};
+
+}  // namespace milvus::index
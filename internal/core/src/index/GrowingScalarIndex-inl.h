@@ -0,0 +1,303 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <utility>
+
+#include "common/Utils.h"
+
+namespace milvus::index {
+
+template <typename T>
+inline GrowingScalarIndex<T>::GrowingScalarIndex(size_t tail_size)
+    : tail_size_(tail_size) {
+    AssertInfo(tail_size_ > 0, "tail size of growing index must be positive");
+}
+
+template <typename T>
+inline void
+GrowingScalarIndex<T>::Append(int64_t offset, size_t n, const T* values) {
+    AssertInfo(offset >= 0 &&
+                   offset + int64_t(n) <= std::numeric_limits<int32_t>::max(),
+               "too many rows for a growing scalar index");
+    std::unique_lock lck(mutex_);
+    for (size_t i = 0; i < n; ++i) {
+        tail_keys_.push_back(values[i]);
+        tail_offsets_.push_back(int32_t(offset + i));
+        if (tail_keys_.size() >= tail_size_) {
+            FlushTail();
+        }
+    }
+    num_rows_ = std::max(num_rows_, offset + int64_t(n));
+}
+
+template <typename T>
+inline void
+GrowingScalarIndex<T>::FlushTail() {
+    std::vector<size_t> order(tail_keys_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return tail_keys_[a] < tail_keys_[b] ||
+               (tail_keys_[a] == tail_keys_[b] &&
+                tail_offsets_[a] < tail_offsets_[b]);
+    });
+    Run run;
+    run.keys.reserve(order.size());
+    run.offsets.reserve(order.size());
+    for (auto i : order) {
+        run.keys.push_back(tail_keys_[i]);
+        run.offsets.push_back(tail_offsets_[i]);
+    }
+    tail_keys_.clear();
+    tail_offsets_.clear();
+
+    runs_.push_back(std::move(run));
+    while (runs_.size() >= 2 &&
+           runs_[runs_.size() - 2].keys.size() <= runs_.back().keys.size()) {
+        auto merged = Merge(runs_[runs_.size() - 2], runs_.back());
+        runs_.pop_back();
+        runs_.back() = std::move(merged);
+    }
+}
+
+template <typename T>
+inline typename GrowingScalarIndex<T>::Run
+GrowingScalarIndex<T>::Merge(const Run& a, const Run& b) {
+    Run res;
+    auto n = a.keys.size() + b.keys.size();
+    res.keys.reserve(n);
+    res.offsets.reserve(n);
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.keys.size() || j < b.keys.size()) {
+        bool take_a =
+            j == b.keys.size() ||
+            (i < a.keys.size() &&
+             (a.keys[i] < b.keys[j] ||
+              (a.keys[i] == b.keys[j] && a.offsets[i] < b.offsets[j])));
+        if (take_a) {
+            res.keys.push_back(a.keys[i]);
+            res.offsets.push_back(a.offsets[i++]);
+        } else {
+            res.keys.push_back(b.keys[j]);
+            res.offsets.push_back(b.offsets[j++]);
+        }
+    }
+    return res;
+}
+
+template <typename T>
+inline TargetBitmap
+GrowingScalarIndex<T>::RangeImpl(const std::optional<T>& lower,
+                                 bool lower_inclusive,
+                                 const std::optional<T>& upper,
+                                 bool upper_inclusive) const {
+    std::shared_lock lck(mutex_);
+    TargetBitmap bitset(num_rows_);
+    for (const auto& run : runs_) {
+        auto begin = run.keys.begin();
+        auto end = run.keys.end();
+        if (lower.has_value()) {
+            begin = lower_inclusive
+                        ? std::lower_bound(begin, end, lower.value())
+                        : std::upper_bound(begin, end, lower.value());
+        }
+        if (upper.has_value()) {
+            end = upper_inclusive
+                      ? std::upper_bound(begin, end, upper.value())
+                      : std::lower_bound(begin, end, upper.value());
+        }
+        for (auto i = begin - run.keys.begin(); i < end - run.keys.begin();
+             ++i) {
+            bitset[run.offsets[i]] = true;
+        }
+    }
+    for (size_t i = 0; i < tail_keys_.size(); ++i) {
+        const T& key = tail_keys_[i];
+        bool hit = true;
+        if (lower.has_value()) {
+            hit = lower_inclusive ? lower.value() <= key : lower.value() < key;
+        }
+        if (hit && upper.has_value()) {
+            hit = upper_inclusive ? key <= upper.value() : key < upper.value();
+        }
+        if (hit) {
+            bitset[tail_offsets_[i]] = true;
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+template <typename Pred>
+inline TargetBitmap
+GrowingScalarIndex<T>::MatchIf(Pred pred) const {
+    std::shared_lock lck(mutex_);
+    TargetBitmap bitset(num_rows_);
+    for (const auto& run : runs_) {
+        bool hit = false;
+        for (size_t i = 0; i < run.keys.size(); ++i) {
+            if (i == 0 || run.keys[i] != run.keys[i - 1]) {
+                hit = pred(run.keys[i]);
+            }
+            if (hit) {
+                bitset[run.offsets[i]] = true;
+            }
+        }
+    }
+    for (size_t i = 0; i < tail_keys_.size(); ++i) {
+        if (pred(tail_keys_[i])) {
+            bitset[tail_offsets_[i]] = true;
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::In(size_t n, const T* values) {
+    std::vector<T> terms(values, values + n);
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+
+    std::shared_lock lck(mutex_);
+    TargetBitmap bitset(num_rows_);
+    for (const auto& run : runs_) {
+        auto begin = run.keys.begin();
+        for (const auto& term : terms) {
+            // the terms are sorted, so the search goes on from the last one
+            auto [lo, hi] = std::equal_range(begin, run.keys.end(), term);
+            for (auto i = lo - run.keys.begin(); i < hi - run.keys.begin();
+                 ++i) {
+                bitset[run.offsets[i]] = true;
+            }
+            begin = hi;
+        }
+    }
+    for (size_t i = 0; i < tail_keys_.size(); ++i) {
+        if (std::binary_search(terms.begin(), terms.end(), tail_keys_[i])) {
+            bitset[tail_offsets_[i]] = true;
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::NotIn(size_t n, const T* values) {
+    auto bitset = In(n, values);
+    for (size_t i = 0; i < bitset.size(); ++i) {
+        bitset[i] = !bitset[i];
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::Range(T value, OpType op) {
+    switch (op) {
+        case OpType::LessThan:
+            return RangeImpl(std::nullopt, false, value, false);
+        case OpType::LessEqual:
+            return RangeImpl(std::nullopt, false, value, true);
+        case OpType::GreaterThan:
+            return RangeImpl(value, false, std::nullopt, false);
+        case OpType::GreaterEqual:
+            return RangeImpl(value, true, std::nullopt, false);
+        default:
+            throw std::invalid_argument(std::string("Invalid OperatorType: ") +
+                                        std::to_string((int)op) + "!");
+    }
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::Range(T lower_bound_value,
+                             bool lb_inclusive,
+                             T upper_bound_value,
+                             bool ub_inclusive) {
+    if (upper_bound_value < lower_bound_value ||
+        (lower_bound_value == upper_bound_value &&
+         !(lb_inclusive && ub_inclusive))) {
+        return TargetBitmap(Count());
+    }
+    return RangeImpl(
+        lower_bound_value, lb_inclusive, upper_bound_value, ub_inclusive);
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::PrefixMatch(const std::string_view prefix) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        std::shared_lock lck(mutex_);
+        TargetBitmap bitset(num_rows_);
+        for (const auto& run : runs_) {
+            // the keys of a prefix are contiguous in a run
+            auto it = std::lower_bound(
+                run.keys.begin(),
+                run.keys.end(),
+                prefix,
+                [](const std::string& key, std::string_view prefix) {
+                    return std::string_view(key) < prefix;
+                });
+            size_t i = it - run.keys.begin();
+            for (; i < run.keys.size() &&
+                   milvus::PrefixMatch(run.keys[i], prefix);
+                 ++i) {
+                bitset[run.offsets[i]] = true;
+            }
+        }
+        for (size_t i = 0; i < tail_keys_.size(); ++i) {
+            if (milvus::PrefixMatch(tail_keys_[i], prefix)) {
+                bitset[tail_offsets_[i]] = true;
+            }
+        }
+        return bitset;
+    } else {
+        PanicInfo("prefix match is only supported on string fields");
+    }
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::PostfixMatch(const std::string_view postfix) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return MatchIf([&](const std::string& key) {
+            return milvus::PostfixMatch(key, postfix);
+        });
+    } else {
+        PanicInfo("postfix match is only supported on string fields");
+    }
+}
+
+template <typename T>
+inline const TargetBitmap
+GrowingScalarIndex<T>::InfixMatch(const std::string_view infix) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return MatchIf([&](const std::string& key) {
+            return milvus::InfixMatch(key, infix);
+        });
+    } else {
+        PanicInfo("infix match is only supported on string fields");
+    }
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,192 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "index/ScalarIndex.h"
+#include "index/StringIndex.h"
+
+namespace milvus::index {
+
+// the string matches as declared by StringIndex, so that those of
+// GrowingScalarIndex override them whatever the type of its field
+template <typename T>
+class GrowingNonStringIndex : public ScalarIndex<T> {
+ public:
+    virtual const TargetBitmap
+    PrefixMatch(const std::string_view prefix) = 0;
+
+    virtual const TargetBitmap
+    PostfixMatch(const std::string_view postfix) = 0;
+
+    virtual const TargetBitmap
+    InfixMatch(const std::string_view infix) = 0;
+};
+
+template <typename T>
+using GrowingScalarIndexBase =
+    std::conditional_t<std::is_same_v<T, std::string>,
+                       StringIndex,
+                       GrowingNonStringIndex<T>>;
+
+// GrowingScalarIndex is the scalar index of a growing segment, maintained as
+// rows are inserted. New rows go to an unsorted tail, a full tail is sorted
+// into a run and runs of the same size are merged, so that there are
+// O(log n) sorted runs and a row is merged O(log n) times. Queries binary
+// search every run and scan the tail, they cover all the inserted rows.
+// Appends and queries may run concurrently.
+template <typename T>
+class GrowingScalarIndex : public GrowingScalarIndexBase<T> {
+ public:
+    explicit GrowingScalarIndex(size_t tail_size = kDefaultTailSize);
+
+    // index the rows [offset, offset + n), the rows of concurrent inserts
+    // may be appended in any order
+    void
+    Append(int64_t offset, size_t n, const T* values);
+
+    BinarySet
+    Serialize(const Config& config) override {
+        PanicInfo("growing scalar index can't be serialized");
+    }
+
+    void
+    Load(const BinarySet& index_binary, const Config& config = {}) override {
+        PanicInfo("growing scalar index can't be loaded");
+    }
+
+    void
+    Load(const Config& config = {}) override {
+        PanicInfo("growing scalar index can't be loaded");
+    }
+
+    BinarySet
+    Upload(const Config& config = {}) override {
+        PanicInfo("growing scalar index can't be uploaded");
+    }
+
+    int64_t
+    Count() override {
+        std::shared_lock lck(mutex_);
+        return num_rows_;
+    }
+
+    int64_t
+    Size() override {
+        return Count();
+    }
+
+    void
+    Build(size_t n, const T* values) override {
+        Append(0, n, values);
+    }
+
+    void
+    Build(const Config& config = {}) override {
+        PanicInfo("growing scalar index is built by appending rows");
+    }
+
+    const TargetBitmap
+    In(size_t n, const T* values) override;
+
+    const TargetBitmap
+    NotIn(size_t n, const T* values) override;
+
+    const TargetBitmap
+    Range(T value, OpType op) override;
+
+    const TargetBitmap
+    Range(T lower_bound_value,
+          bool lb_inclusive,
+          T upper_bound_value,
+          bool ub_inclusive) override;
+
+    // only for the string fields
+    const TargetBitmap
+    PrefixMatch(const std::string_view prefix) override;
+
+    const TargetBitmap
+    PostfixMatch(const std::string_view postfix) override;
+
+    const TargetBitmap
+    InfixMatch(const std::string_view infix) override;
+
+    T
+    Reverse_Lookup(size_t offset) const override {
+        PanicInfo("growing scalar index doesn't keep the rows in order");
+    }
+
+ public:
+    size_t
+    NumRuns() const {
+        std::shared_lock lck(mutex_);
+        return runs_.size();
+    }
+
+ private:
+    static constexpr size_t kDefaultTailSize = 4096;
+
+    // keys sorted, the offsets of a key ascending
+    struct Run {
+        std::vector<T> keys;
+        std::vector<int32_t> offsets;
+    };
+
+    // sort the tail into a run and merge the runs of the same size, the
+    // caller must hold the unique lock
+    void
+    FlushTail();
+
+    static Run
+    Merge(const Run& a, const Run& b);
+
+    // the rows of the keys in the range, a missing bound leaves that side
+    // open
+    TargetBitmap
+    RangeImpl(const std::optional<T>& lower,
+              bool lower_inclusive,
+              const std::optional<T>& upper,
+              bool upper_inclusive) const;
+
+    // the rows whose key satisfies pred, pred runs once per distinct key of
+    // a run
+    template <typename Pred>
+    TargetBitmap
+    MatchIf(Pred pred) const;
+
+ private:
+    const size_t tail_size_;
+    mutable std::shared_mutex mutex_;
+    int64_t num_rows_ = 0;
+    std::vector<Run> runs_;  // sizes descending
+    std::vector<T> tail_keys_;
+    std::vector<int32_t> tail_offsets_;
+};
+
+template <typename T>
+using GrowingScalarIndexPtr = std::unique_ptr<GrowingScalarIndex<T>>;
+
+}  // namespace milvus::index
+
+#include "index/GrowingScalarIndex-inl.h"
@@ -0,0 +1,547 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/HnswGraph.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+
+#include "common/Utils.h"
+#include "exceptions/EasyAssert.h"
+
+namespace milvus::index {
+
+namespace {
+// the nodes are kept in blocks of 256 rows, allocated as the rows come in,
+// 4096 blocks a directory, and 2048 directories cover all the int32 offsets,
+// so that the blocks never move and are found without a lock; small blocks
+// keep the memory of a small segment of a high dim small
+constexpr int64_t kBlockBits = 8;
+constexpr int64_t kBlockSize = int64_t(1) << kBlockBits;
+constexpr int64_t kDirectoryBits = 12;
+constexpr int64_t kDirectorySize = int64_t(1) << kDirectoryBits;
+constexpr int64_t kMaxRows = int64_t(1) << 31;
+constexpr int64_t kNumDirectories =
+    kMaxRows >> (kBlockBits + kDirectoryBits);
+constexpr int32_t kMaxLevel = 16;
+
+uint64_t
+SplitMix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+float
+L2Sqr(const float* a, const float* b, int64_t dim) {
+    float sum[4] = {0, 0, 0, 0};
+    int64_t i = 0;
+    for (; i + 4 <= dim; i += 4) {
+        for (int j = 0; j < 4; ++j) {
+            auto d = a[i + j] - b[i + j];
+            sum[j] += d * d;
+        }
+    }
+    for (; i < dim; ++i) {
+        auto d = a[i] - b[i];
+        sum[0] += d * d;
+    }
+    return sum[0] + sum[1] + sum[2] + sum[3];
+}
+
+float
+InnerProduct(const float* a, const float* b, int64_t dim) {
+    float sum[4] = {0, 0, 0, 0};
+    int64_t i = 0;
+    for (; i + 4 <= dim; i += 4) {
+        for (int j = 0; j < 4; ++j) {
+            sum[j] += a[i + j] * b[i + j];
+        }
+    }
+    for (; i < dim; ++i) {
+        sum[0] += a[i] * b[i];
+    }
+    return sum[0] + sum[1] + sum[2] + sum[3];
+}
+
+// the nodes visited by a search, reset by bumping the epoch
+class VisitedSet {
+ public:
+    void
+    Reset() {
+        if (++epoch_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    // true if offset was visited already, marks it visited
+    bool
+    Visit(int64_t offset) {
+        if (offset >= int64_t(tags_.size())) {
+            tags_.resize(std::max(offset + 1, int64_t(tags_.size()) * 2));
+        }
+        if (tags_[offset] == epoch_) {
+            return true;
+        }
+        tags_[offset] = epoch_;
+        return false;
+    }
+
+ private:
+    std::vector<uint32_t> tags_;
+    uint32_t epoch_ = 0;
+};
+
+VisitedSet&
+GetVisitedSet() {
+    thread_local VisitedSet visited;
+    visited.Reset();
+    return visited;
+}
+}  // namespace
+
+struct HnswGraph::Block {
+    explicit Block(int64_t dim)
+        : vectors(new float[kBlockSize * dim]), nodes(new Node[kBlockSize]) {
+    }
+
+    std::unique_ptr<float[]> vectors;
+    std::unique_ptr<Node[]> nodes;
+};
+
+struct HnswGraph::Directory {
+    ~Directory() {
+        for (auto& block : blocks) {
+            delete block.load();
+        }
+    }
+
+    std::atomic<Block*> blocks[kDirectorySize] = {};
+};
+
+HnswGraph::HnswGraph(int64_t dim,
+                     const MetricType& metric_type,
+                     int64_t M,
+                     int64_t ef_construction)
+    : dim_(dim),
+      is_ip_(IsMetricType(metric_type, knowhere::metric::IP)),
+      is_cosine_(IsMetricType(metric_type, knowhere::metric::COSINE)),
+      M_(M),
+      ef_construction_(std::max(ef_construction, M)),
+      level_mult_(1 / std::log(double(std::max(M, int64_t(2))))),
+      directories_(new std::atomic<Directory*>[kNumDirectories]()) {
+    AssertInfo(dim_ > 0, "dim of hnsw graph must be positive");
+    AssertInfo(M_ > 0, "M of hnsw graph must be positive");
+    AssertInfo(is_ip_ || is_cosine_ ||
+                   IsMetricType(metric_type, knowhere::metric::L2),
+               "hnsw graph doesn't support metric type " + metric_type);
+}
+
+HnswGraph::~HnswGraph() {
+    for (int64_t i = 0; i < kNumDirectories; ++i) {
+        delete directories_[i].load();
+    }
+}
+
+void
+HnswGraph::Reserve(int64_t offset) {
+    auto& directory = directories_[offset >> (kBlockBits + kDirectoryBits)];
+    auto dir = directory.load(std::memory_order_acquire);
+    if (dir == nullptr) {
+        auto fresh = new Directory();
+        if (directory.compare_exchange_strong(dir, fresh)) {
+            dir = fresh;
+        } else {
+            delete fresh;
+        }
+    }
+    auto& entry = dir->blocks[(offset >> kBlockBits) & (kDirectorySize - 1)];
+    auto block = entry.load(std::memory_order_acquire);
+    if (block == nullptr) {
+        auto fresh = new Block(dim_);
+        if (!entry.compare_exchange_strong(block, fresh)) {
+            delete fresh;
+        }
+    }
+}
+
+HnswGraph::Block*
+HnswGraph::BlockOf(int64_t offset) const {
+    auto dir = directories_[offset >> (kBlockBits + kDirectoryBits)].load(
+        std::memory_order_acquire);
+    if (dir == nullptr) {
+        return nullptr;
+    }
+    return dir->blocks[(offset >> kBlockBits) & (kDirectorySize - 1)].load(
+        std::memory_order_acquire);
+}
+
+HnswGraph::Node&
+HnswGraph::node(int64_t offset) const {
+    return BlockOf(offset)->nodes[offset & (kBlockSize - 1)];
+}
+
+const float*
+HnswGraph::GetVector(int64_t offset) const {
+    return BlockOf(offset)->vectors.get() + (offset & (kBlockSize - 1)) * dim_;
+}
+
+float
+HnswGraph::Norm(const float* vector) const {
+    auto norm = std::sqrt(InnerProduct(vector, vector, dim_));
+    // a zero vector is as far from all the others
+    return norm > 0 ? norm : 1;
+}
+
+float
+HnswGraph::Distance(const float* query,
+                    float query_norm,
+                    int64_t offset) const {
+    auto vector = GetVector(offset);
+    if (is_ip_) {
+        return -InnerProduct(query, vector, dim_);
+    }
+    if (is_cosine_) {
+        return -InnerProduct(query, vector, dim_) /
+               (query_norm * node(offset).norm);
+    }
+    return L2Sqr(query, vector, dim_);
+}
+
+float
+HnswGraph::Distance(int64_t a, int64_t b) const {
+    return Distance(GetVector(a), node(a).norm, b);
+}
+
+int32_t
+HnswGraph::RandomLevel(int64_t offset) const {
+    // the level of a row only depends on its offset, so concurrent inserts
+    // don't share a random engine
+    auto u = double((SplitMix64(offset) >> 11) + 1) * 0x1.0p-53;
+    return std::min(int32_t(-std::log(u) * level_mult_), kMaxLevel);
+}
+
+std::vector<int32_t>
+HnswGraph::Neighbors(int64_t offset, int32_t level) const {
+    auto& n = node(offset);
+    std::lock_guard lck(n.mutex);
+    if (level >= int32_t(n.links.size())) {
+        return {};
+    }
+    return n.links[level];
+}
+
+template <typename Keep>
+std::vector<HnswGraph::Candidate>
+HnswGraph::SearchLevel(const float* query,
+                       float query_norm,
+                       const std::vector<Candidate>& entry,
+                       int64_t ef,
+                       int32_t level,
+                       Keep keep) const {
+    auto& visited = GetVisitedSet();
+    // the nearest candidate on top
+    std::priority_queue<Candidate,
+                        std::vector<Candidate>,
+                        std::greater<Candidate>>
+        candidates;
+    // the farthest result on top
+    std::priority_queue<Candidate> results;
+    for (auto& e : entry) {
+        visited.Visit(e.second);
+        candidates.push(e);
+        if (keep(e.second)) {
+            results.push(e);
+        }
+    }
+    auto bound = [&] {
+        return results.empty() ? std::numeric_limits<float>::max()
+                               : results.top().first;
+    };
+    while (!candidates.empty()) {
+        auto current = candidates.top();
+        if (current.first > bound() && int64_t(results.size()) >= ef) {
+            break;
+        }
+        candidates.pop();
+        for (auto neighbor : Neighbors(current.second, level)) {
+            if (visited.Visit(neighbor)) {
+                continue;
+            }
+            auto dist = Distance(query, query_norm, neighbor);
+            if (int64_t(results.size()) < ef || dist < bound()) {
+                candidates.emplace(dist, neighbor);
+                if (keep(neighbor)) {
+                    results.emplace(dist, neighbor);
+                    if (int64_t(results.size()) > ef) {
+                        results.pop();
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<Candidate> res(results.size());
+    for (auto i = int64_t(res.size()) - 1; i >= 0; --i) {
+        res[i] = results.top();
+        results.pop();
+    }
+    return res;
+}
+
+HnswGraph::Candidate
+HnswGraph::Descend(const float* query,
+                   float query_norm,
+                   Candidate entry,
+                   int32_t top_level,
+                   int32_t level) const {
+    for (auto lc = top_level; lc > level; --lc) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto neighbor : Neighbors(entry.second, lc)) {
+                auto dist = Distance(query, query_norm, neighbor);
+                if (dist < entry.first) {
+                    entry = {dist, neighbor};
+                    changed = true;
+                }
+            }
+        }
+    }
+    return entry;
+}
+
+std::vector<int32_t>
+HnswGraph::SelectNeighbors(const std::vector<Candidate>& candidates,
+                           int64_t max_links) const {
+    std::vector<int32_t> selected;
+    selected.reserve(std::min(int64_t(candidates.size()), max_links));
+    if (int64_t(candidates.size()) <= max_links) {
+        for (auto& c : candidates) {
+            selected.push_back(c.second);
+        }
+        return selected;
+    }
+    for (auto& [dist, offset] : candidates) {
+        if (int64_t(selected.size()) >= max_links) {
+            break;
+        }
+        bool diverse = std::none_of(
+            selected.begin(), selected.end(), [&, offset = offset](auto s) {
+                return Distance(offset, s) < dist;
+            });
+        if (diverse) {
+            selected.push_back(offset);
+        }
+    }
+    return selected;
+}
+
+void
+HnswGraph::Link(int64_t neighbor, int64_t offset, int32_t level) {
+    auto& n = node(neighbor);
+    std::lock_guard lck(n.mutex);
+    auto& links = n.links[level];
+    if (std::find(links.begin(), links.end(), offset) != links.end()) {
+        return;
+    }
+    if (int64_t(links.size()) < MaxLinks(level)) {
+        links.push_back(offset);
+        return;
+    }
+    std::vector<Candidate> candidates;
+    candidates.reserve(links.size() + 1);
+    candidates.emplace_back(Distance(neighbor, offset), offset);
+    for (auto link : links) {
+        candidates.emplace_back(Distance(neighbor, link), link);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    links = SelectNeighbors(candidates, MaxLinks(level));
+}
+
+void
+HnswGraph::Add(int64_t offset, const float* vector) {
+    AssertInfo(offset >= 0 && offset < kMaxRows,
+               "offset out of range of hnsw graph");
+    Reserve(offset);
+    auto& n = node(offset);
+    std::copy_n(vector, dim_, const_cast<float*>(GetVector(offset)));
+    auto level = RandomLevel(offset);
+    {
+        std::lock_guard lck(n.mutex);
+        AssertInfo(n.level < 0, "row is inserted into hnsw graph twice");
+        n.level = level;
+        n.norm = is_cosine_ ? Norm(vector) : 1;
+        n.links.resize(level + 1);
+    }
+
+    // a node above the top level changes the entry point, such inserts
+    // hold the entry mutex all along
+    std::unique_lock entry_lck(entry_mutex_);
+    auto top_level = max_level_.load();
+    if (level <= top_level) {
+        entry_lck.unlock();
+    }
+    auto entry_point = entry_point_.load();
+    if (entry_point >= 0) {
+        Candidate entry{Distance(vector, n.norm, entry_point), entry_point};
+        entry = Descend(vector, n.norm, entry, top_level, level);
+        for (auto lc = std::min(level, top_level); lc >= 0; --lc) {
+            auto candidates = SearchLevel(
+                vector, n.norm, {entry}, ef_construction_, lc, [=](auto id) {
+                    return id != offset;
+                });
+            auto neighbors = SelectNeighbors(candidates, M_);
+            {
+                std::lock_guard lck(n.mutex);
+                // keep the links of the concurrent inserts if there is room
+                auto& links = n.links[lc];
+                for (auto link : links) {
+                    if (int64_t(neighbors.size()) < MaxLinks(lc) &&
+                        std::find(neighbors.begin(), neighbors.end(), link) ==
+                            neighbors.end()) {
+                        neighbors.push_back(link);
+                    }
+                }
+                links = neighbors;
+            }
+            for (auto neighbor : neighbors) {
+                Link(neighbor, offset, lc);
+            }
+            if (!candidates.empty()) {
+                entry = candidates.front();
+            }
+        }
+    }
+    if (level > top_level) {
+        entry_point_.store(offset);
+        max_level_.store(level);
+    }
+
+    n.inserted.store(true, std::memory_order_release);
+    count_.fetch_add(1);
+    auto size = size_.load();
+    while (size < offset + 1 &&
+           !size_.compare_exchange_weak(size, offset + 1)) {
+    }
+    AdvancePrefix();
+}
+
+void
+HnswGraph::AdvancePrefix() {
+    std::lock_guard lck(prefix_mutex_);
+    auto prefix = prefix_.load();
+    while (prefix < kMaxRows) {
+        auto block = BlockOf(prefix);
+        if (block == nullptr ||
+            !block->nodes[prefix & (kBlockSize - 1)].inserted.load(
+                std::memory_order_acquire)) {
+            break;
+        }
+        ++prefix;
+    }
+    prefix_.store(prefix, std::memory_order_release);
+}
+
+void
+HnswGraph::BruteForce(const float* query,
+                      float query_norm,
+                      int64_t topk,
+                      int64_t num_rows,
+                      const BitsetView& bitset,
+                      std::vector<Candidate>& results) const {
+    std::priority_queue<Candidate> heap;
+    for (int64_t offset = 0; offset < num_rows; ++offset) {
+        if (!bitset.empty() && bitset.test(offset)) {
+            continue;
+        }
+        auto dist = Distance(query, query_norm, offset);
+        if (int64_t(heap.size()) < topk || dist < heap.top().first) {
+            heap.emplace(dist, offset);
+            if (int64_t(heap.size()) > topk) {
+                heap.pop();
+            }
+        }
+    }
+    results.resize(heap.size());
+    for (auto i = int64_t(results.size()) - 1; i >= 0; --i) {
+        results[i] = heap.top();
+        heap.pop();
+    }
+}
+
+void
+HnswGraph::Search(const float* query,
+                  int64_t topk,
+                  int64_t ef,
+                  int64_t num_rows,
+                  const BitsetView& bitset,
+                  float* distances,
+                  int64_t* offsets) const {
+    // the rows above the prefix may be allocated but not inserted yet
+    num_rows = std::min(num_rows, InsertedPrefix());
+    if (!bitset.empty()) {
+        num_rows = std::min(num_rows, int64_t(bitset.size()));
+    }
+    ef = std::max(ef, topk);
+    auto query_norm = is_cosine_ ? Norm(query) : 1;
+
+    std::vector<Candidate> results;
+    auto entry_point = entry_point_.load();
+    if (entry_point >= 0 && num_rows > 0) {
+        auto num_kept = num_rows;
+        if (!bitset.empty()) {
+            num_kept -= std::min(int64_t(bitset.count()), num_rows);
+        }
+        if (num_kept <= ef * kBruteForceRatio) {
+            // the rows below num_rows are all inserted
+            BruteForce(query, query_norm, topk, num_rows, bitset, results);
+        } else {
+            int32_t top_level;
+            {
+                auto& entry_node = node(entry_point);
+                std::lock_guard lck(entry_node.mutex);
+                top_level = entry_node.level;
+            }
+            Candidate entry{Distance(query, query_norm, entry_point),
+                            entry_point};
+            entry = Descend(query, query_norm, entry, top_level, 0);
+            results = SearchLevel(
+                query, query_norm, {entry}, ef, 0, [&](auto offset) {
+                    return offset < num_rows &&
+                           (bitset.empty() || !bitset.test(offset));
+                });
+        }
+    }
+
+    auto sign = is_ip_ || is_cosine_ ? -1.0f : 1.0f;
+    auto missing = sign * std::numeric_limits<float>::max();
+    for (int64_t i = 0; i < topk; ++i) {
+        if (i < int64_t(results.size())) {
+            distances[i] = sign * results[i].first;
+            offsets[i] = results[i].second;
+        } else {
+            distances[i] = missing;
+            offsets[i] = -1;
+        }
+    }
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,218 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+
+namespace milvus::index {
+
+// HnswGraph is a hierarchical navigable small world graph over float
+// vectors, built by inserting the rows one by one. The row offsets are the
+// node ids, rows may be inserted in any order and by many threads at once,
+// while other threads search. A node is linked into the graph only after its
+// vector and links are set, and the links of a node are read and written
+// under its mutex, so a search only ever sees fully inserted nodes.
+//
+// A search is limited to the rows below num_rows and below the inserted
+// prefix, the rows inserted after the snapshot of the search or ahead of a
+// row still being inserted are traversed but never returned.
+class HnswGraph {
+ public:
+    HnswGraph(int64_t dim,
+              const MetricType& metric_type,
+              int64_t M = kDefaultM,
+              int64_t ef_construction = kDefaultEfConstruction);
+
+    ~HnswGraph();
+
+    HnswGraph(const HnswGraph&) = delete;
+    HnswGraph&
+    operator=(const HnswGraph&) = delete;
+
+    // insert the vector of row offset, concurrent with the other inserts
+    // and searches
+    void
+    Add(int64_t offset, const float* vector);
+
+    // the topk nearest rows of query among the rows below num_rows not
+    // filtered out by bitset, the missing results have offset -1;
+    // distances are those of the metric, ordered from the most similar
+    void
+    Search(const float* query,
+           int64_t topk,
+           int64_t ef,
+           int64_t num_rows,
+           const BitsetView& bitset,
+           float* distances,
+           int64_t* offsets) const;
+
+    // the vector of an inserted row
+    const float*
+    GetVector(int64_t offset) const;
+
+    // count of the inserted rows
+    int64_t
+    Count() const {
+        return count_.load();
+    }
+
+    // the rows below it are all inserted, the rows are inserted in any
+    // order, so there may be inserted rows above it
+    int64_t
+    InsertedPrefix() const {
+        return prefix_.load(std::memory_order_acquire);
+    }
+
+    // the largest inserted offset plus one
+    int64_t
+    Size() const {
+        return size_.load();
+    }
+
+    int64_t
+    Dim() const {
+        return dim_;
+    }
+
+ public:
+    static constexpr int64_t kDefaultM = 16;
+    static constexpr int64_t kDefaultEfConstruction = 200;
+    // the filter keeps so few rows that they are compared one by one
+    static constexpr int64_t kBruteForceRatio = 16;
+
+ private:
+    struct Node {
+        std::mutex mutex;
+        int32_t level = -1;
+        float norm = 1;  // of the vector, only for cosine
+        std::vector<std::vector<int32_t>> links;
+        // set once the node is linked into the graph
+        std::atomic<bool> inserted = false;
+    };
+
+    struct Block;
+    struct Directory;
+
+    // a candidate of a search, the distance first
+    using Candidate = std::pair<float, int32_t>;
+
+    // the block of offset, nullptr if not allocated yet
+    Block*
+    BlockOf(int64_t offset) const;
+
+    Node&
+    node(int64_t offset) const;
+
+    // allocate the block of offset if missing
+    void
+    Reserve(int64_t offset);
+
+    // move the inserted prefix over the rows inserted right above it
+    void
+    AdvancePrefix();
+
+    // the internal distance, smaller is closer for every metric
+    float
+    Distance(const float* query, float query_norm, int64_t offset) const;
+
+    float
+    Distance(int64_t a, int64_t b) const;
+
+    float
+    Norm(const float* vector) const;
+
+    int32_t
+    RandomLevel(int64_t offset) const;
+
+    std::vector<int32_t>
+    Neighbors(int64_t offset, int32_t level) const;
+
+    // the ef nearest nodes of level among the ones reachable from entry,
+    // sorted from the nearest; only the nodes accepted by keep are returned
+    template <typename Keep>
+    std::vector<Candidate>
+    SearchLevel(const float* query,
+                float query_norm,
+                const std::vector<Candidate>& entry,
+                int64_t ef,
+                int32_t level,
+                Keep keep) const;
+
+    // the nearest node of the top levels down to level, by greedy search
+    Candidate
+    Descend(const float* query,
+            float query_norm,
+            Candidate entry,
+            int32_t top_level,
+            int32_t level) const;
+
+    // keep the candidates not closer to a kept one than to the base, at
+    // most max_links of them; candidates sorted from the nearest
+    std::vector<int32_t>
+    SelectNeighbors(const std::vector<Candidate>& candidates,
+                    int64_t max_links) const;
+
+    // link offset to neighbor at level, shrinking the links of neighbor if
+    // they exceed the limit
+    void
+    Link(int64_t neighbor, int64_t offset, int32_t level);
+
+    int64_t
+    MaxLinks(int32_t level) const {
+        return level == 0 ? 2 * M_ : M_;
+    }
+
+    void
+    BruteForce(const float* query,
+               float query_norm,
+               int64_t topk,
+               int64_t num_rows,
+               const BitsetView& bitset,
+               std::vector<Candidate>& results) const;
+
+ private:
+    const int64_t dim_;
+    const bool is_ip_;
+    const bool is_cosine_;
+    const int64_t M_;
+    const int64_t ef_construction_;
+    const double level_mult_;
+
+    std::unique_ptr<std::atomic<Directory*>[]> directories_;
+
+    // the entry point and the top level of the graph, the top level only
+    // grows under entry_mutex_
+    std::mutex entry_mutex_;
+    std::atomic<int64_t> entry_point_ = -1;
+    std::atomic<int32_t> max_level_ = -1;
+
+    std::atomic<int64_t> count_ = 0;
+    std::atomic<int64_t> size_ = 0;
+
+    // only moved under prefix_mutex_
+    std::mutex prefix_mutex_;
+    std::atomic<int64_t> prefix_ = 0;
+};
+
+}  // namespace milvus::index
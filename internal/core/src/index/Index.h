@@ -58,7 +58,7 @@ class IndexBase {
     virtual BinarySet
     Upload(const Config& config = {}) = 0;
 
-    bool
+    virtual bool
     IsMmapSupported() const {
         return index_type_ == knowhere::IndexEnum::INDEX_HNSW ||
                //    index_type_ == knowhere::IndexEnum::INDEX_FAISS_IVFFLAT ||    IVF_FLAT is not supported as it doesn't stores the vectors
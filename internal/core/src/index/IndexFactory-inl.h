@@ -15,9 +15,12 @@
 // limitations under the License.
 
 #include <string>
+#include "index/BitmapIndex.h"
 #include "index/ScalarIndexSort.h"
 #include "index/StringIndexMarisa.h"
+#include "index/StringIndexTrigram.h"
 #include "index/BoolIndex.h"
+#include "index/ZoneMapIndex.h"
 
 namespace milvus::index {
 
@@ -25,6 +28,14 @@ template <typename T>
 inline ScalarIndexPtr<T>
 IndexFactory::CreateScalarIndex(const IndexType& index_type,
                                 storage::FileManagerImplPtr file_manager) {
+    if (index_type == BITMAP) {
+        return CreateBitmapIndex<T>(file_manager);
+    }
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        if (index_type == ZONE_MAP) {
+            return CreateZoneMapIndex<T>(file_manager);
+        }
+    }
     return CreateScalarIndexSort<T>(file_manager);
 }
 
@@ -38,6 +49,12 @@ template <>
 inline ScalarIndexPtr<std::string>
 IndexFactory::CreateScalarIndex(const IndexType& index_type,
                                 storage::FileManagerImplPtr file_manager) {
+    if (index_type == BITMAP) {
+        return CreateBitmapIndex<std::string>(file_manager);
+    }
+    if (index_type == TRIGRAM) {
+        return CreateStringIndexTrigram(file_manager);
+    }
 #if defined(__linux__) || defined(__APPLE__)
     return CreateStringIndexMarisa(file_manager);
 #else
@@ -0,0 +1,253 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+#include "exceptions/EasyAssert.h"
+#include "fmt/core.h"
+#include "index/Index.h"
+#include "index/Utils.h"
+#include "utils/File.h"
+
+namespace milvus::index {
+
+// IndexLayout is the serialized layout of an index queried in place: a
+// header page and the arrays of the index, every array at a page boundary.
+// A layout loaded into memory or mapped from a file is used as it is, with
+// neither a copy of the arrays nor a pass rebuilding them.
+struct IndexLayout {
+    static constexpr size_t kPageSize = 4096;
+    static constexpr uint64_t kMagic = 0x54554f59414c5849;  // "IXLAYOUT"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kMaxSections = 16;
+
+    struct Header {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t num_sections;
+        uint64_t offsets[kMaxSections];
+        uint64_t sizes[kMaxSections];
+    };
+    static_assert(sizeof(Header) <= kPageSize);
+
+    static size_t
+    PageAlign(size_t size) {
+        return (size + kPageSize - 1) / kPageSize * kPageSize;
+    }
+
+    // whether data begins with a layout header
+    static bool
+    IsLayout(const void* data, size_t size) {
+        uint64_t magic;
+        if (size < sizeof(Header)) {
+            return false;
+        }
+        std::memcpy(&magic, data, sizeof(magic));
+        return magic == kMagic;
+    }
+};
+
+// IndexLayoutWriter puts the arrays of an index in a layout, the arrays must
+// live until Serialize
+class IndexLayoutWriter {
+ public:
+    template <typename T>
+    void
+    AddSection(const T* data, size_t count) {
+        AssertInfo(sections_.size() < IndexLayout::kMaxSections,
+                   "too many sections of an index layout");
+        sections_.emplace_back(data, count * sizeof(T));
+    }
+
+    // the layout and its size
+    std::pair<std::shared_ptr<uint8_t[]>, size_t>
+    Serialize() const {
+        IndexLayout::Header header{};
+        header.magic = IndexLayout::kMagic;
+        header.version = IndexLayout::kVersion;
+        header.num_sections = sections_.size();
+        size_t size = IndexLayout::kPageSize;
+        for (size_t i = 0; i < sections_.size(); ++i) {
+            header.offsets[i] = size;
+            header.sizes[i] = sections_[i].second;
+            size += IndexLayout::PageAlign(sections_[i].second);
+        }
+
+        std::shared_ptr<uint8_t[]> data(new uint8_t[size]());
+        std::memcpy(data.get(), &header, sizeof(header));
+        for (size_t i = 0; i < sections_.size(); ++i) {
+            if (sections_[i].second > 0) {
+                std::memcpy(data.get() + header.offsets[i],
+                            sections_[i].first,
+                            sections_[i].second);
+            }
+        }
+        return {data, size};
+    }
+
+ private:
+    std::vector<std::pair<const void*, size_t>> sections_;
+};
+
+// IndexLayoutReader gets the arrays of a layout in place, the data must
+// live as long as the arrays are used
+class IndexLayoutReader {
+ public:
+    IndexLayoutReader(const uint8_t* data, size_t size) : data_(data) {
+        AssertInfo(IndexLayout::IsLayout(data, size),
+                   "not the layout of an index");
+        std::memcpy(&header_, data, sizeof(header_));
+        AssertInfo(header_.version == IndexLayout::kVersion,
+                   fmt::format("unknown index layout version {}",
+                               header_.version));
+        AssertInfo(header_.num_sections <= IndexLayout::kMaxSections,
+                   "too many sections of an index layout");
+        for (size_t i = 0; i < header_.num_sections; ++i) {
+            AssertInfo(header_.offsets[i] + header_.sizes[i] <= size,
+                       "index layout is truncated");
+        }
+    }
+
+    size_t
+    NumSections() const {
+        return header_.num_sections;
+    }
+
+    // the count of the elements of section i
+    template <typename T>
+    size_t
+    Count(size_t i) const {
+        AssertInfo(i < header_.num_sections, "missing index layout section");
+        AssertInfo(header_.sizes[i] % sizeof(T) == 0,
+                   "index layout section of an unexpected type");
+        return header_.sizes[i] / sizeof(T);
+    }
+
+    // the array of section i, of count elements
+    template <typename T>
+    const T*
+    Section(size_t i, size_t count) const {
+        AssertInfo(Count<T>(i) == count,
+                   fmt::format("index layout section {} has {} elements, "
+                               "expected {}",
+                               i,
+                               Count<T>(i),
+                               count));
+        return reinterpret_cast<const T*>(data_ + header_.offsets[i]);
+    }
+
+    const void*
+    Bytes(size_t i) const {
+        AssertInfo(i < header_.num_sections, "missing index layout section");
+        return data_ + header_.offsets[i];
+    }
+
+ private:
+    const uint8_t* data_;
+    IndexLayout::Header header_;
+};
+
+// MmapIndexFile is an index layout loaded into the file of kMmapFilepath and
+// mapped read only. The file is unlinked once mapped, the mapping lives as
+// long as the MmapIndexFile.
+class MmapIndexFile {
+ public:
+    static std::shared_ptr<MmapIndexFile>
+    Load(storage::MemFileManagerImpl* file_manager, const Config& config) {
+        auto filepath = GetValueFromConfig<std::string>(config, kMmapFilepath);
+        AssertInfo(filepath.has_value(),
+                   "mmap filepath is empty when load index");
+        auto index_files =
+            GetValueFromConfig<std::vector<std::string>>(config, "index_files");
+        AssertInfo(index_files.has_value(),
+                   "index file paths is empty when load index");
+
+        std::filesystem::create_directories(
+            std::filesystem::path(filepath.value()).parent_path());
+        auto file = File::Open(filepath.value(), O_CREAT | O_TRUNC | O_RDWR);
+        LoadIndexFilesToFile(file_manager, index_files.value(), file);
+        auto size = lseek(file.Descriptor(), 0, SEEK_END);
+        AssertInfo(size > 0,
+                   fmt::format("empty mmap index file {}", filepath.value()));
+        auto data = mmap(
+            nullptr, size, PROT_READ, MAP_PRIVATE, file.Descriptor(), 0);
+        AssertInfo(data != MAP_FAILED,
+                   fmt::format("failed to map index file {}: {}",
+                               filepath.value(),
+                               strerror(errno)));
+        file.Close();
+        auto mapped = std::shared_ptr<MmapIndexFile>(
+            new MmapIndexFile(static_cast<uint8_t*>(data), size));
+
+        auto ok = unlink(filepath->data());
+        AssertInfo(ok == 0,
+                   fmt::format("failed to unlink mmap index file {}: {}",
+                               filepath.value(),
+                               strerror(errno)));
+        return mapped;
+    }
+
+    MmapIndexFile(const MmapIndexFile&) = delete;
+    MmapIndexFile&
+    operator=(const MmapIndexFile&) = delete;
+
+    ~MmapIndexFile() {
+        munmap(data_, size_);
+    }
+
+    const uint8_t*
+    Data() const {
+        return data_;
+    }
+
+    size_t
+    Size() const {
+        return size_;
+    }
+
+ private:
+    MmapIndexFile(uint8_t* data, size_t size) : data_(data), size_(size) {
+    }
+
+    uint8_t* data_;
+    size_t size_;
+};
+
+// whether one of the index files is of the binary name, sliced or not
+inline bool
+HasIndexFile(const std::vector<std::string>& index_files,
+             const std::string& name) {
+    for (auto& file : index_files) {
+        auto file_name = file.substr(file.find_last_of('/') + 1);
+        if (file_name == name || file_name.rfind(name + "_", 0) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace milvus::index
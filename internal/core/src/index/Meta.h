@@ -26,9 +26,16 @@ constexpr const char* LOWER_BOUND_INCLUSIVE = "lower_bound_inclusive";
 constexpr const char* UPPER_BOUND_VALUE = "upper_bound_value";
 constexpr const char* UPPER_BOUND_INCLUSIVE = "upper_bound_inclusive";
 constexpr const char* PREFIX_VALUE = "prefix_value";
+constexpr const char* MATCH_VALUE = "match_value";
 // below configurations will be persistent, do not edit them.
 constexpr const char* MARISA_TRIE_INDEX = "marisa_trie_index";
 constexpr const char* MARISA_STR_IDS = "marisa_trie_str_ids";
+constexpr const char* MARISA_INDEX_LAYOUT = "marisa_index_layout";
+constexpr const char* SORT_INDEX_LAYOUT = "sort_index_layout";
+constexpr const char* BITMAP_INDEX_DATA = "bitmap_index_data";
+constexpr const char* TRIGRAM_INDEX_KEYS = "trigram_index_keys";
+constexpr const char* TRIGRAM_INDEX_KEY_IDS = "trigram_index_key_ids";
+constexpr const char* ZONE_MAP_INDEX_LAYOUT = "zone_map_index_layout";
 
 constexpr const char* INDEX_TYPE = "index_type";
 constexpr const char* METRIC_TYPE = "metric_type";
@@ -36,6 +43,23 @@ constexpr const char* METRIC_TYPE = "metric_type";
 // scalar index type
 constexpr const char* ASCENDING_SORT = "STL_SORT";
 constexpr const char* MARISA_TRIE = "Trie";
+constexpr const char* BITMAP = "BITMAP";
+constexpr const char* TRIGRAM = "TRIGRAM";
+constexpr const char* ZONE_MAP = "ZONE_MAP";
+
+// bitmap index params
+constexpr const char* BITMAP_CARDINALITY_LIMIT = "bitmap_cardinality_limit";
+constexpr int64_t DEFAULT_BITMAP_CARDINALITY_LIMIT = 1000;
+
+// zone map index params, the rows of a block and whether every block gets a
+// Bloom filter for In
+constexpr const char* ZONE_MAP_BLOCK_ROWS = "zone_map_block_rows";
+constexpr int64_t DEFAULT_ZONE_MAP_BLOCK_ROWS = 1024;
+constexpr const char* ZONE_MAP_BLOOM_FILTER = "zone_map_bloom_filter";
+
+// sort index build params, the memory the build takes on top of the index,
+// the rows beyond it are sorted in runs spilled to the local disk
+constexpr const char* SORT_BUILD_MEMORY_BUDGET = "sort_build_memory_budget_mb";
 
 // index meta
 constexpr const char* COLLECTION_ID = "collection_id";
@@ -15,7 +15,10 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 #include <pb/schema.pb.h>
 #include <vector>
@@ -25,13 +28,16 @@
 #include "common/Utils.h"
 #include "common/Slice.h"
 #include "index/Utils.h"
+#include "storage/LocalChunkManagerSingleton.h"
+#include "storage/ThreadPools.h"
+#include "storage/Util.h"
 
 namespace milvus::index {
 
 template <typename T>
 inline ScalarIndexSort<T>::ScalarIndexSort(
     storage::FileManagerImplPtr file_manager)
-    : is_built_(false), data_() {
+    : is_built_(false) {
     if (file_manager != nullptr) {
         file_manager_ = std::dynamic_pointer_cast<storage::MemFileManagerImpl>(
             file_manager);
@@ -47,36 +53,40 @@ ScalarIndexSort<T>::Build(const Config& config) {
         GetValueFromConfig<std::vector<std::string>>(config, "insert_files");
     AssertInfo(insert_files.has_value(),
                "insert file paths is empty when build index");
-    auto field_datas =
-        file_manager_->CacheRawDataToMemory(insert_files.value());
+    auto budget = memory_budget(config);
+    SortBuilder<Key> builder(budget, budget > 0 ? spill_dir() : "");
 
-    int64_t total_num_rows = 0;
-    for (auto data : field_datas) {
-        total_num_rows += data->get_num_rows();
+    // the loaded data is taken in while the following files are loaded, so
+    // only a few files are in memory at once
+    auto parallel_degree =
+        int64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+    auto channel = std::make_shared<storage::FieldDataChannel>(parallel_degree);
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::MIDDLE);
+    auto load_future = pool.Submit([&]() {
+        file_manager_->LoadRawDataToChannel(
+            insert_files.value(), channel, parallel_degree);
+    });
+    storage::FieldDataPtr field_data;
+    try {
+        while (channel->pop(field_data)) {
+            builder.Add(field_data->get_num_rows(),
+                        static_cast<const Key*>(field_data->Data()));
+        }
+    } catch (...) {
+        // the loader refers to the locals here, unblock it and wait
+        while (channel->pop(field_data)) {
+        }
+        load_future.wait();
+        throw;
     }
-    if (total_num_rows == 0) {
+    load_future.get();
+
+    if (builder.NumRows() == 0) {
         // todo: throw an exception
         throw std::invalid_argument(
             "ScalarIndexSort cannot build null values!");
     }
-
-    data_.reserve(total_num_rows);
-    int64_t offset = 0;
-    for (auto data : field_datas) {
-        auto slice_num = data->get_num_rows();
-        for (size_t i = 0; i < slice_num; ++i) {
-            auto value = reinterpret_cast<const T*>(data->RawValue(i));
-            data_.emplace_back(IndexStructure(*value, offset));
-            offset++;
-        }
-    }
-
-    std::sort(data_.begin(), data_.end());
-    idx_to_offsets_.resize(total_num_rows);
-    for (size_t i = 0; i < total_num_rows; ++i) {
-        idx_to_offsets_[data_[i].idx_] = i;
-    }
-    is_built_ = true;
+    BuildFromBuilder(builder);
 }
 
 template <typename T>
@@ -89,39 +99,232 @@ ScalarIndexSort<T>::Build(size_t n, const T* values) {
         throw std::invalid_argument(
             "ScalarIndexSort cannot build null values!");
     }
-    data_.reserve(n);
-    idx_to_offsets_.resize(n);
-    T* p = const_cast<T*>(values);
-    for (size_t i = 0; i < n; ++i) {
-        data_.emplace_back(IndexStructure(*p++, i));
-    }
-    std::sort(data_.begin(), data_.end());
-    for (size_t i = 0; i < data_.size(); ++i) {
-        idx_to_offsets_[data_[i].idx_] = i;
+    SortBuilder<Key> builder;
+    builder.Add(n, reinterpret_cast<const Key*>(values));
+    BuildFromBuilder(builder);
+}
+
+template <typename T>
+inline void
+ScalarIndexSort<T>::BuildFromBuilder(SortBuilder<Key>& builder) {
+    // the rows of a key are in ascending order
+    builder.Finish(keys_buf_, offsets_buf_);
+    idx_to_offsets_buf_.resize(keys_buf_.size());
+    for (size_t i = 0; i < offsets_buf_.size(); ++i) {
+        idx_to_offsets_buf_[offsets_buf_[i]] = i;
     }
+    BuildDirectory();
+    UseBuffers();
     is_built_ = true;
 }
 
+template <typename T>
+inline void
+ScalarIndexSort<T>::UseBuffers() {
+    num_rows_ = keys_buf_.size();
+    keys_ = keys_buf_.data();
+    offsets_ = offsets_buf_.data();
+    idx_to_offsets_ = idx_to_offsets_buf_.data();
+    num_blocks_ = directory_buf_.size() - 1;
+    directory_ = directory_buf_.data();
+    directory_blocks_ = directory_blocks_buf_.data();
+    layout_.reset();
+}
+
+template <typename T>
+inline void
+ScalarIndexSort<T>::UseLayout(const uint8_t* data, size_t size) {
+    IndexLayoutReader reader(data, size);
+    num_rows_ = reader.Count<Key>(0);
+    keys_ = reader.Section<Key>(0, num_rows_);
+    offsets_ = reader.Section<int32_t>(1, num_rows_);
+    idx_to_offsets_ = reader.Section<int32_t>(2, num_rows_);
+    num_blocks_ = (num_rows_ + kBlockSize - 1) / kBlockSize;
+    directory_ = reader.Section<Key>(3, num_blocks_ + 1);
+    directory_blocks_ = reader.Section<uint32_t>(4, num_blocks_ + 1);
+
+    keys_buf_ = std::vector<Key>();
+    offsets_buf_ = std::vector<int32_t>();
+    idx_to_offsets_buf_ = std::vector<int32_t>();
+    directory_buf_ = std::vector<Key>();
+    directory_blocks_buf_ = std::vector<uint32_t>();
+}
+
+template <typename T>
+inline int64_t
+ScalarIndexSort<T>::memory_budget(const Config& config) const {
+    auto value = GetIntParamFromConfig(config, SORT_BUILD_MEMORY_BUDGET, 0);
+    AssertInfo(
+        value >= 0,
+        fmt::format("{} must not be negative", SORT_BUILD_MEMORY_BUDGET));
+    return value << 20;
+}
+
+template <typename T>
+inline std::string
+ScalarIndexSort<T>::spill_dir() const {
+    auto local_chunk_manager =
+        storage::LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto index_meta = file_manager_->GetIndexMeta();
+    return storage::GenIndexPathPrefix(local_chunk_manager,
+                                       index_meta.build_id,
+                                       index_meta.index_version) +
+           "sort_runs";
+}
+
+template <typename T>
+inline void
+ScalarIndexSort<T>::BuildDirectory() {
+    auto num_blocks = (keys_buf_.size() + kBlockSize - 1) / kBlockSize;
+    directory_buf_.assign(num_blocks + 1, Key());
+    directory_blocks_buf_.assign(num_blocks + 1, 0);
+
+    // an in-order walk of the implicit tree visits the blocks in order
+    size_t block = 0;
+    std::function<void(size_t)> fill = [&](size_t k) {
+        if (k > num_blocks) {
+            return;
+        }
+        fill(2 * k);
+        directory_buf_[k] = keys_buf_[block * kBlockSize];
+        directory_blocks_buf_[k] = block++;
+        fill(2 * k + 1);
+    };
+    fill(1);
+}
+
+template <typename T>
+template <typename GoRight>
+inline size_t
+ScalarIndexSort<T>::SearchDirectory(GoRight go_right) const {
+    size_t k = 1;
+    while (k <= num_blocks_) {
+        __builtin_prefetch(directory_ + 16 * k);
+        k = 2 * k + go_right(directory_[k]);
+    }
+    // drop the trailing right turns to get back to the last left turn
+    k >>= __builtin_ffsll(~k);
+    return k == 0 ? num_blocks_ : directory_blocks_[k];
+}
+
+template <typename T>
+inline size_t
+ScalarIndexSort<T>::LowerBound(const T& value) const {
+    if (num_rows_ == 0) {
+        return 0;
+    }
+    // the first key of the block before is less than value, the first key
+    // of the block found is not
+    auto block = SearchDirectory([&](const Key& key) { return key < value; });
+    auto begin = block == 0 ? 0 : (block - 1) * kBlockSize + 1;
+    auto end = std::min(block * kBlockSize, num_rows_);
+    return std::lower_bound(keys_ + begin, keys_ + end, value) - keys_;
+}
+
+template <typename T>
+inline size_t
+ScalarIndexSort<T>::UpperBound(const T& value) const {
+    if (num_rows_ == 0) {
+        return 0;
+    }
+    auto block =
+        SearchDirectory([&](const Key& key) { return !(value < key); });
+    auto begin = block == 0 ? 0 : (block - 1) * kBlockSize + 1;
+    auto end = std::min(block * kBlockSize, num_rows_);
+    return std::upper_bound(keys_ + begin, keys_ + end, value) - keys_;
+}
+
+template <typename T>
+inline void
+ScalarIndexSort<T>::SetRows(TargetBitmap& bitset,
+                            size_t begin,
+                            size_t end,
+                            bool value) const {
+    auto data = bitset.data();
+    for (auto i = begin; i < end;) {
+        auto row = offsets_[i];
+        auto j = i + 1;
+        while (j < end && offsets_[j] == offsets_[j - 1] + 1) {
+            ++j;
+        }
+        std::fill(data + row, data + row + (j - i), value);
+        i = j;
+    }
+}
+
+template <typename T>
+inline std::vector<std::pair<size_t, size_t>>
+ScalarIndexSort<T>::EqualRanges(size_t n, const T* values) const {
+    std::vector<T> terms(values, values + n);
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+
+    std::vector<std::pair<size_t, size_t>> ranges;
+    ranges.reserve(terms.size());
+    if (terms.size() < num_rows_ / kBlockSize) {
+        // few terms, search each of them through the directory
+        for (const auto& term : terms) {
+            auto lb = LowerBound(term);
+            auto ub = UpperBound(term);
+            if (lb < ub) {
+                ranges.emplace_back(lb, ub);
+            }
+        }
+        return ranges;
+    }
+
+    // many terms, one merge pass over the keys, galloping from the end of
+    // the previous term
+    auto gallop = [&](size_t from, auto less) {
+        size_t lo = from;
+        size_t hi = from;
+        size_t step = 1;
+        while (hi < num_rows_ && less(keys_[hi])) {
+            lo = hi + 1;
+            hi += step;
+            step *= 2;
+        }
+        hi = std::min(hi, num_rows_);
+        return std::partition_point(keys_ + lo, keys_ + hi, less) - keys_;
+    };
+    size_t pos = 0;
+    for (const auto& term : terms) {
+        auto lb = gallop(pos, [&](const Key& key) { return key < term; });
+        auto ub = gallop(lb, [&](const Key& key) { return !(term < key); });
+        if (lb < ub) {
+            ranges.emplace_back(lb, ub);
+        }
+        pos = ub;
+        if (pos == num_rows_) {
+            break;
+        }
+    }
+    return ranges;
+}
+
 template <typename T>
 inline BinarySet
 ScalarIndexSort<T>::Serialize(const Config& config) {
     AssertInfo(is_built_, "index has not been built");
+    if constexpr (!std::is_trivially_copyable_v<T>) {
+        PanicInfo(
+            "ScalarIndexSort can't serialize non trivially copyable keys");
+    } else {
+        IndexLayoutWriter writer;
+        writer.AddSection(keys_, num_rows_);
+        writer.AddSection(offsets_, num_rows_);
+        writer.AddSection(idx_to_offsets_, num_rows_);
+        writer.AddSection(directory_, num_blocks_ + 1);
+        writer.AddSection(directory_blocks_, num_blocks_ + 1);
+        auto [layout, size] = writer.Serialize();
 
-    auto index_data_size = data_.size() * sizeof(IndexStructure<T>);
-    std::shared_ptr<uint8_t[]> index_data(new uint8_t[index_data_size]);
-    memcpy(index_data.get(), data_.data(), index_data_size);
-
-    std::shared_ptr<uint8_t[]> index_length(new uint8_t[sizeof(size_t)]);
-    auto index_size = data_.size();
-    memcpy(index_length.get(), &index_size, sizeof(size_t));
-
-    BinarySet res_set;
-    res_set.Append("index_data", index_data, index_data_size);
-    res_set.Append("index_length", index_length, sizeof(size_t));
+        BinarySet res_set;
+        res_set.Append(SORT_INDEX_LAYOUT, layout, size);
 
-    milvus::Disassemble(res_set);
+        milvus::Disassemble(res_set);
 
-    return res_set;
+        return res_set;
+    }
 }
 
 template <typename T>
@@ -143,18 +346,37 @@ template <typename T>
 inline void
 ScalarIndexSort<T>::LoadWithoutAssemble(const BinarySet& index_binary,
                                         const Config& config) {
-    size_t index_size;
-    auto index_length = index_binary.GetByName("index_length");
-    memcpy(&index_size, index_length->data.get(), (size_t)index_length->size);
-
-    auto index_data = index_binary.GetByName("index_data");
-    data_.resize(index_size);
-    idx_to_offsets_.resize(index_size);
-    memcpy(data_.data(), index_data->data.get(), (size_t)index_data->size);
-    for (size_t i = 0; i < data_.size(); ++i) {
-        idx_to_offsets_[data_[i].idx_] = i;
+    if constexpr (!std::is_trivially_copyable_v<T>) {
+        PanicInfo("ScalarIndexSort can't load non trivially copyable keys");
+    } else if (index_binary.Contains(SORT_INDEX_LAYOUT)) {
+        // in place, the layout is kept alive by the index
+        auto layout = index_binary.GetByName(SORT_INDEX_LAYOUT);
+        UseLayout(layout->data.get(), layout->size);
+        layout_ = layout->data;
+        is_built_ = true;
+    } else {
+        // the array of IndexStructure<T> of the former format
+        size_t index_size;
+        auto index_length = index_binary.GetByName("index_length");
+        memcpy(
+            &index_size, index_length->data.get(), (size_t)index_length->size);
+
+        auto index_data = index_binary.GetByName("index_data");
+        std::vector<IndexStructure<T>> data(index_size);
+        memcpy(data.data(), index_data->data.get(), (size_t)index_data->size);
+
+        keys_buf_.resize(index_size);
+        offsets_buf_.resize(index_size);
+        idx_to_offsets_buf_.resize(index_size);
+        for (size_t i = 0; i < index_size; ++i) {
+            keys_buf_[i] = data[i].a_;
+            offsets_buf_[i] = data[i].idx_;
+            idx_to_offsets_buf_[data[i].idx_] = i;
+        }
+        BuildDirectory();
+        UseBuffers();
+        is_built_ = true;
     }
-    is_built_ = true;
 }
 
 template <typename T>
@@ -171,12 +393,22 @@ ScalarIndexSort<T>::Load(const Config& config) {
         GetValueFromConfig<std::vector<std::string>>(config, "index_files");
     AssertInfo(index_files.has_value(),
                "index file paths is empty when load disk ann index");
+    if (config.contains(kMmapFilepath) &&
+        !HasIndexFile(index_files.value(), "index_length")) {
+        auto file = MmapIndexFile::Load(file_manager_.get(), config);
+        UseLayout(file->Data(), file->Size());
+        layout_ = file;
+        is_built_ = true;
+        return;
+    }
+
     auto index_datas = file_manager_->LoadIndexToMemory(index_files.value());
     AssembleIndexDatas(index_datas);
     BinarySet binary_set;
     for (auto& [key, data] : index_datas) {
         auto size = data->Size();
-        auto deleter = [&](uint8_t*) {};  // avoid repeated deconstruction
+        // the buffer holds the field data, a layout is used in place
+        auto deleter = [data = data](uint8_t*) {};
         auto buf = std::shared_ptr<uint8_t[]>(
             (uint8_t*)const_cast<void*>(data->Data()), deleter);
         binary_set.Append(key, buf, size);
@@ -189,20 +421,9 @@ template <typename T>
 inline const TargetBitmap
 ScalarIndexSort<T>::In(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
-    TargetBitmap bitset(data_.size());
-    for (size_t i = 0; i < n; ++i) {
-        auto lb = std::lower_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(*(values + i)));
-        auto ub = std::upper_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(*(values + i)));
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != *(values + i)) {
-                std::cout << "error happens in ScalarIndexSort<T>::In, "
-                             "experted value is: "
-                          << *(values + i) << ", but real value is: " << lb->a_;
-            }
-            bitset[lb->idx_] = true;
-        }
+    TargetBitmap bitset(num_rows_);
+    for (auto [begin, end] : EqualRanges(n, values)) {
+        SetRows(bitset, begin, end, true);
     }
     return bitset;
 }
@@ -211,20 +432,9 @@ template <typename T>
 inline const TargetBitmap
 ScalarIndexSort<T>::NotIn(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
-    TargetBitmap bitset(data_.size(), true);
-    for (size_t i = 0; i < n; ++i) {
-        auto lb = std::lower_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(*(values + i)));
-        auto ub = std::upper_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(*(values + i)));
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != *(values + i)) {
-                std::cout << "error happens in ScalarIndexSort<T>::NotIn, "
-                             "experted value is: "
-                          << *(values + i) << ", but real value is: " << lb->a_;
-            }
-            bitset[lb->idx_] = false;
-        }
+    TargetBitmap bitset(num_rows_, true);
+    for (auto [begin, end] : EqualRanges(n, values)) {
+        SetRows(bitset, begin, end, false);
     }
     return bitset;
 }
@@ -233,33 +443,27 @@ template <typename T>
 inline const TargetBitmap
 ScalarIndexSort<T>::Range(const T value, const OpType op) {
     AssertInfo(is_built_, "index has not been built");
-    TargetBitmap bitset(data_.size());
-    auto lb = data_.begin();
-    auto ub = data_.end();
+    TargetBitmap bitset(num_rows_);
+    size_t lb = 0;
+    size_t ub = num_rows_;
     switch (op) {
         case OpType::LessThan:
-            ub = std::lower_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+            ub = LowerBound(value);
             break;
         case OpType::LessEqual:
-            ub = std::upper_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+            ub = UpperBound(value);
             break;
         case OpType::GreaterThan:
-            lb = std::upper_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+            lb = UpperBound(value);
             break;
         case OpType::GreaterEqual:
-            lb = std::lower_bound(
-                data_.begin(), data_.end(), IndexStructure<T>(value));
+            lb = LowerBound(value);
             break;
         default:
             throw std::invalid_argument(std::string("Invalid OperatorType: ") +
                                         std::to_string((int)op) + "!");
     }
-    for (; lb < ub; ++lb) {
-        bitset[lb->idx_] = true;
-    }
+    SetRows(bitset, lb, ub, true);
     return bitset;
 }
 
@@ -270,41 +474,27 @@ ScalarIndexSort<T>::Range(T lower_bound_value,
                           T upper_bound_value,
                           bool ub_inclusive) {
     AssertInfo(is_built_, "index has not been built");
-    TargetBitmap bitset(data_.size());
+    TargetBitmap bitset(num_rows_);
     if (lower_bound_value > upper_bound_value ||
         (lower_bound_value == upper_bound_value &&
          !(lb_inclusive && ub_inclusive))) {
         return bitset;
     }
-    auto lb = data_.begin();
-    auto ub = data_.end();
-    if (lb_inclusive) {
-        lb = std::lower_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(lower_bound_value));
-    } else {
-        lb = std::upper_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(lower_bound_value));
-    }
-    if (ub_inclusive) {
-        ub = std::upper_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(upper_bound_value));
-    } else {
-        ub = std::lower_bound(
-            data_.begin(), data_.end(), IndexStructure<T>(upper_bound_value));
-    }
-    for (; lb < ub; ++lb) {
-        bitset[lb->idx_] = true;
-    }
+    auto lb = lb_inclusive ? LowerBound(lower_bound_value)
+                           : UpperBound(lower_bound_value);
+    auto ub = ub_inclusive ? UpperBound(upper_bound_value)
+                           : LowerBound(upper_bound_value);
+    SetRows(bitset, lb, ub, true);
     return bitset;
 }
 
 template <typename T>
 inline T
 ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
-    AssertInfo(idx < idx_to_offsets_.size(), "out of range of total count");
+    AssertInfo(idx < num_rows_, "out of range of total count");
     AssertInfo(is_built_, "index has not been built");
 
     auto offset = idx_to_offsets_[idx];
-    return data_[offset].a_;
+    return keys_[offset];
 }
 }  // namespace milvus::index
@@ -18,20 +18,32 @@
 
 #include <algorithm>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <string>
 #include <map>
 
+#include "index/IndexLayout.h"
 #include "index/IndexStructure.h"
 #include "index/ScalarIndex.h"
+#include "index/SortBuilder.h"
 #include "storage/MemFileManagerImpl.h"
 
 namespace milvus::index {
 
+// ScalarIndexSort keeps the sorted keys and the row offsets of the keys in
+// two separate arrays, searches go through a small directory of every
+// kBlockSize-th key laid out in Eytzinger (BFS) order so that the top levels
+// of the search stay in cache. All the arrays are serialized as an
+// IndexLayout, which is queried in place once loaded or mapped; the array of
+// IndexStructure<T> of the former format is still loaded.
 template <typename T>
 class ScalarIndexSort : public ScalarIndex<T> {
  public:
+    // bool keys are stored as bytes, so that every array is contiguous
+    using Key = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+
     explicit ScalarIndexSort(
         storage::FileManagerImplPtr file_manager = nullptr);
 
@@ -46,7 +58,12 @@ class ScalarIndexSort : public ScalarIndex<T> {
 
     int64_t
     Count() override {
-        return data_.size();
+        return num_rows_;
+    }
+
+    bool
+    IsMmapSupported() const override {
+        return std::is_trivially_copyable_v<T>;
     }
 
     void
@@ -75,16 +92,27 @@ class ScalarIndexSort : public ScalarIndex<T> {
 
     int64_t
     Size() override {
-        return (int64_t)data_.size();
+        return (int64_t)num_rows_;
     }
 
     BinarySet
     Upload(const Config& config = {}) override;
 
  public:
-    const std::vector<IndexStructure<T>>&
-    GetData() {
-        return data_;
+    // the sorted keys, NumKeys() of them
+    const Key*
+    GetKeys() const {
+        return keys_;
+    }
+
+    size_t
+    NumKeys() const {
+        return num_rows_;
+    }
+
+    const int32_t*
+    GetOffsets() const {
+        return offsets_;
     }
 
     bool
@@ -95,11 +123,76 @@ class ScalarIndexSort : public ScalarIndex<T> {
     void
     LoadWithoutAssemble(const BinarySet& binary_set, const Config& config);
 
+    // first position of keys_ not less than value
+    size_t
+    LowerBound(const T& value) const;
+
+    // first position of keys_ greater than value
+    size_t
+    UpperBound(const T& value) const;
+
+ protected:
+    // set the rows of the keys in [begin, end) to value, consecutive row
+    // offsets are set as one run
+    void
+    SetRows(TargetBitmap& bitset, size_t begin, size_t end, bool value) const;
+
  private:
+    void
+    BuildFromBuilder(SortBuilder<Key>& builder);
+
+    // point the arrays at the vectors of a build or a former format load
+    void
+    UseBuffers();
+
+    // point the arrays at a serialized layout
+    void
+    UseLayout(const uint8_t* data, size_t size);
+
+    // in bytes, 0 for no budget
+    int64_t
+    memory_budget(const Config& config) const;
+
+    // the local dir the sort runs of a build are spilled to
+    std::string
+    spill_dir() const;
+
+    void
+    BuildDirectory();
+
+    // the first block whose first key doesn't satisfy go_right(key)
+    template <typename GoRight>
+    size_t
+    SearchDirectory(GoRight go_right) const;
+
+    // the equal ranges of the sorted distinct terms, as [begin, end) pairs
+    std::vector<std::pair<size_t, size_t>>
+    EqualRanges(size_t n, const T* values) const;
+
+ private:
+    static constexpr size_t kBlockSize = 16;
+
     bool is_built_;
     Config config_;
-    std::vector<int32_t> idx_to_offsets_;  // used to retrieve.
-    std::vector<IndexStructure<T>> data_;
+    // the arrays of the index, in the vectors below or in the serialized
+    // layout held by layout_
+    size_t num_rows_ = 0;
+    const int32_t* idx_to_offsets_ = nullptr;  // used to retrieve.
+    const Key* keys_ = nullptr;                // sorted keys
+    const int32_t* offsets_ = nullptr;         // row offset of keys_[i]
+    // the first key of every block in Eytzinger order, 1-based, and the
+    // block of every directory entry
+    size_t num_blocks_ = 0;
+    const Key* directory_ = nullptr;
+    const uint32_t* directory_blocks_ = nullptr;
+
+    std::vector<int32_t> idx_to_offsets_buf_;
+    std::vector<Key> keys_buf_;
+    std::vector<int32_t> offsets_buf_;
+    std::vector<Key> directory_buf_;
+    std::vector<uint32_t> directory_blocks_buf_;
+    // a loaded layout or a mapped file
+    std::shared_ptr<const void> layout_;
     std::shared_ptr<storage::MemFileManagerImpl> file_manager_;
 };
 
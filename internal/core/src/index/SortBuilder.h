@@ -0,0 +1,496 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/Common.h"
+#include "exceptions/EasyAssert.h"
+#include "fmt/core.h"
+#include "storage/ThreadPools.h"
+#include "utils/File.h"
+
+namespace milvus::index {
+
+namespace sort_detail {
+
+// the rows a sort task takes at least
+constexpr size_t kMinSortRowsPerTask = 64 << 10;
+
+// integer and floating keys are radix sorted, the others merge sorted
+template <typename T>
+constexpr bool kRadixSortable =
+    std::is_integral_v<T> || std::is_floating_point_v<T>;
+
+// the unsigned integer of the same order as the key
+template <typename T>
+inline auto
+RadixKey(T key) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return uint8_t(key);
+    } else if constexpr (std::is_integral_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        constexpr U sign = std::is_signed_v<T> ? U(1) << (sizeof(T) * 8 - 1)
+                                               : U(0);
+        return U(U(key) ^ sign);
+    } else {
+        using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        U bits;
+        std::memcpy(&bits, &key, sizeof(T));
+        // negative values in reverse order, below the positive ones
+        return (bits & sign) ? U(~bits) : U(bits | sign);
+    }
+}
+
+// run f(0), ..., f(num_tasks - 1), the first by the caller and the others by
+// the MIDDLE pool; waits for all of them before rethrowing the first error
+template <typename F>
+inline void
+ParallelFor(size_t num_tasks, F f) {
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (size_t i = 1; i < num_tasks; ++i) {
+        futures.emplace_back(pool.Submit([&f, i]() { f(i); }));
+    }
+    std::exception_ptr error;
+    try {
+        if (num_tasks > 0) {
+            f(0);
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// stable LSD radix sort of the n keys and their rows by bytes, the passes
+// of the bytes equal for all the keys are skipped
+template <typename T>
+inline void
+RadixSort(
+    T* keys, int32_t* rows, T* tmp_keys, int32_t* tmp_rows, size_t n) {
+    constexpr size_t kPasses = sizeof(RadixKey(T()));
+    std::vector<std::array<size_t, 256>> counts(kPasses);
+    for (size_t i = 0; i < n; ++i) {
+        auto key = RadixKey(keys[i]);
+        for (size_t pass = 0; pass < kPasses; ++pass) {
+            ++counts[pass][(key >> (pass * 8)) & 0xff];
+        }
+    }
+
+    auto src_keys = keys;
+    auto src_rows = rows;
+    auto dst_keys = tmp_keys;
+    auto dst_rows = tmp_rows;
+    for (size_t pass = 0; pass < kPasses; ++pass) {
+        auto& count = counts[pass];
+        auto first = (RadixKey(src_keys[0]) >> (pass * 8)) & 0xff;
+        if (count[first] == n) {
+            continue;
+        }
+        size_t pos = 0;
+        for (auto& c : count) {
+            auto size = c;
+            c = pos;
+            pos += size;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            auto digit = (RadixKey(src_keys[i]) >> (pass * 8)) & 0xff;
+            auto to = count[digit]++;
+            dst_keys[to] = src_keys[i];
+            dst_rows[to] = src_rows[i];
+        }
+        std::swap(src_keys, dst_keys);
+        std::swap(src_rows, dst_rows);
+    }
+    if (src_keys != keys) {
+        std::copy(src_keys, src_keys + n, keys);
+        std::copy(src_rows, src_rows + n, rows);
+    }
+}
+
+// stable sort of the n keys and their rows by comparisons
+template <typename T>
+inline void
+ComparisonSort(
+    T* keys, int32_t* rows, T* tmp_keys, int32_t* tmp_rows, size_t n) {
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return keys[a] < keys[b];
+    });
+    for (size_t i = 0; i < n; ++i) {
+        tmp_keys[i] = std::move(keys[order[i]]);
+        tmp_rows[i] = rows[order[i]];
+    }
+    std::move(tmp_keys, tmp_keys + n, keys);
+    std::copy(tmp_rows, tmp_rows + n, rows);
+}
+
+// merge the sorted [begin, mid) and [mid, end) into out, the left ones first
+// among the equal keys
+template <typename T>
+inline void
+Merge(T* keys,
+      int32_t* rows,
+      size_t begin,
+      size_t mid,
+      size_t end,
+      T* out_keys,
+      int32_t* out_rows) {
+    auto i = begin;
+    auto j = mid;
+    auto k = begin;
+    while (i < mid && j < end) {
+        auto from = keys[j] < keys[i] ? j++ : i++;
+        out_keys[k] = std::move(keys[from]);
+        out_rows[k++] = rows[from];
+    }
+    for (; i < mid; ++i, ++k) {
+        out_keys[k] = std::move(keys[i]);
+        out_rows[k] = rows[i];
+    }
+    for (; j < end; ++j, ++k) {
+        out_keys[k] = std::move(keys[j]);
+        out_rows[k] = rows[j];
+    }
+}
+
+// the chunks of the rows sorted at once and merged pairwise in rounds
+template <typename T>
+inline void
+ChunkedSort(std::vector<T>& keys, std::vector<int32_t>& rows) {
+    auto n = keys.size();
+    auto num_tasks = std::max<size_t>(
+        1, std::min<size_t>(CPU_NUM, n / kMinSortRowsPerTask));
+    std::vector<size_t> bounds(num_tasks + 1);
+    for (size_t i = 0; i <= num_tasks; ++i) {
+        bounds[i] = n * i / num_tasks;
+    }
+
+    std::vector<T> tmp_keys(n);
+    std::vector<int32_t> tmp_rows(n);
+    ParallelFor(num_tasks, [&](size_t task) {
+        auto begin = bounds[task];
+        auto size = bounds[task + 1] - begin;
+        if constexpr (kRadixSortable<T>) {
+            RadixSort(keys.data() + begin,
+                      rows.data() + begin,
+                      tmp_keys.data() + begin,
+                      tmp_rows.data() + begin,
+                      size);
+        } else {
+            ComparisonSort(keys.data() + begin,
+                           rows.data() + begin,
+                           tmp_keys.data() + begin,
+                           tmp_rows.data() + begin,
+                           size);
+        }
+    });
+
+    // every round halves the sorted chunks, from keys to tmp_keys and back
+    while (bounds.size() > 2) {
+        auto num_merges = (bounds.size() - 1) / 2;
+        ParallelFor(num_merges + 1, [&](size_t task) {
+            if (task < num_merges) {
+                Merge(keys.data(),
+                      rows.data(),
+                      bounds[2 * task],
+                      bounds[2 * task + 1],
+                      bounds[2 * task + 2],
+                      tmp_keys.data(),
+                      tmp_rows.data());
+            } else if ((bounds.size() - 1) % 2 == 1) {
+                // the odd chunk out is moved as it is
+                auto begin = bounds[bounds.size() - 2];
+                auto end = bounds.back();
+                std::move(keys.begin() + begin,
+                          keys.begin() + end,
+                          tmp_keys.begin() + begin);
+                std::copy(rows.begin() + begin,
+                          rows.begin() + end,
+                          tmp_rows.begin() + begin);
+            }
+        });
+        std::vector<size_t> merged;
+        for (size_t i = 0; i < bounds.size(); i += 2) {
+            merged.push_back(bounds[i]);
+        }
+        if (merged.back() != n) {
+            merged.push_back(n);
+        }
+        bounds = std::move(merged);
+        keys.swap(tmp_keys);
+        rows.swap(tmp_rows);
+    }
+}
+
+}  // namespace sort_detail
+
+// ParallelSort sorts the keys and their rows by key, stable. The rows are cut
+// into a chunk per task, the chunks are sorted at once, radix sorted for
+// integer and floating keys, and merged pairwise in parallel rounds.
+template <typename T>
+inline void
+ParallelSort(std::vector<T>& keys, std::vector<int32_t>& rows) {
+    AssertInfo(keys.size() == rows.size(),
+               "keys and rows to sort differ in size");
+    auto n = keys.size();
+    if (n == 0) {
+        return;
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+        // the rows of false, then the rows of true
+        std::vector<int32_t> sorted;
+        sorted.reserve(n);
+        for (auto key : {false, true}) {
+            for (size_t i = 0; i < n; ++i) {
+                if (keys[i] == key) {
+                    sorted.push_back(rows[i]);
+                }
+            }
+        }
+        auto num_false = std::count(keys.begin(), keys.end(), false);
+        std::fill(keys.begin(), keys.begin() + num_false, false);
+        std::fill(keys.begin() + num_false, keys.end(), true);
+        rows = std::move(sorted);
+    } else {
+        sort_detail::ChunkedSort(keys, rows);
+    }
+}
+
+// SortBuilder sorts the keys of the rows added in row order. Without a memory
+// budget the rows are kept and sorted by ParallelSort at the end. With a
+// budget, every run of rows taking the budget is sorted and spilled to a file
+// under spill_dir, and the runs are merged into the result at the end, so
+// the build needs the budget on top of the sorted result only.
+template <typename T>
+class SortBuilder {
+ public:
+    // the memory budget is in bytes, 0 for none
+    explicit SortBuilder(int64_t memory_budget = 0, std::string spill_dir = "")
+        : memory_budget_(memory_budget), spill_dir_(std::move(spill_dir)) {
+        AssertInfo(memory_budget_ == 0 || !spill_dir_.empty(),
+                   "a sort build with a memory budget needs a spill dir");
+    }
+
+    SortBuilder(const SortBuilder&) = delete;
+    SortBuilder&
+    operator=(const SortBuilder&) = delete;
+
+    ~SortBuilder() {
+        if (!runs_.empty()) {
+            std::error_code ec;
+            std::filesystem::remove_all(spill_dir_, ec);
+        }
+    }
+
+    void
+    Add(size_t n, const T* values) {
+        for (size_t i = 0; i < n; ++i) {
+            keys_.push_back(values[i]);
+            rows_.push_back(int32_t(num_rows_++));
+            run_bytes_ += RowBytes(values[i]);
+            if (memory_budget_ > 0 && run_bytes_ >= memory_budget_) {
+                SpillRun();
+            }
+        }
+    }
+
+    int64_t
+    NumRows() const {
+        return num_rows_;
+    }
+
+    // the sorted keys and their row offsets, the rows of a key ascending
+    void
+    Finish(std::vector<T>& keys, std::vector<int32_t>& offsets) {
+        if (runs_.empty()) {
+            ParallelSort(keys_, rows_);
+            keys = std::move(keys_);
+            offsets = std::move(rows_);
+            return;
+        }
+        if (!keys_.empty()) {
+            SpillRun();
+        }
+        MergeRuns(keys, offsets);
+    }
+
+ private:
+    // the memory a row takes while its run is sorted
+    static int64_t
+    RowBytes(const T& value) {
+        int64_t bytes = 2 * (sizeof(T) + sizeof(int32_t));
+        if constexpr (std::is_same_v<T, std::string>) {
+            bytes += value.size();
+        }
+        return bytes;
+    }
+
+    void
+    SpillRun() {
+        ParallelSort(keys_, rows_);
+        if (runs_.empty()) {
+            std::filesystem::create_directories(spill_dir_);
+        }
+        auto path = fmt::format("{}/run_{}", spill_dir_, runs_.size());
+        auto file = File::Open(path, O_CREAT | O_TRUNC | O_WRONLY);
+        BufferedWriter writer(file);
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            writer.Write(&rows_[i], sizeof(int32_t));
+            if constexpr (std::is_same_v<T, std::string>) {
+                auto size = uint32_t(keys_[i].size());
+                writer.Write(&size, sizeof(size));
+                writer.Write(keys_[i].data(), size);
+            } else {
+                T key = keys_[i];
+                writer.Write(&key, sizeof(T));
+            }
+        }
+        writer.Flush();
+        runs_.push_back(path);
+
+        keys_ = std::vector<T>();
+        rows_ = std::vector<int32_t>();
+        run_bytes_ = 0;
+    }
+
+    // a sorted run read back from its file
+    class RunReader {
+     public:
+        explicit RunReader(const std::string& path)
+            : path_(path), in_(path, std::ios::binary) {
+            AssertInfo(in_.is_open(),
+                       fmt::format("failed to open sort run {}", path_));
+            Next();
+        }
+
+        bool
+        Valid() const {
+            return valid_;
+        }
+
+        void
+        Next() {
+            valid_ = bool(in_.read(reinterpret_cast<char*>(&row_),
+                                   sizeof(int32_t)));
+            if (!valid_) {
+                AssertInfo(in_.eof(),
+                           fmt::format("failed to read sort run {}", path_));
+                return;
+            }
+            if constexpr (std::is_same_v<T, std::string>) {
+                uint32_t size;
+                in_.read(reinterpret_cast<char*>(&size), sizeof(size));
+                key_.resize(size);
+                in_.read(key_.data(), size);
+            } else {
+                in_.read(reinterpret_cast<char*>(&key_), sizeof(T));
+            }
+            AssertInfo(bool(in_),
+                       fmt::format("truncated sort run {}", path_));
+        }
+
+        T key_;
+        int32_t row_;
+
+     private:
+        std::string path_;
+        std::ifstream in_;
+        bool valid_ = false;
+    };
+
+    void
+    MergeRuns(std::vector<T>& keys, std::vector<int32_t>& offsets) {
+        std::vector<std::unique_ptr<RunReader>> readers;
+        for (auto& path : runs_) {
+            readers.push_back(std::make_unique<RunReader>(path));
+        }
+        // the earlier run first among the equal keys, its rows are smaller
+        auto greater = [&](size_t a, size_t b) {
+            auto& ka = readers[a]->key_;
+            auto& kb = readers[b]->key_;
+            return kb < ka || (!(ka < kb) && a > b);
+        };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(greater)>
+            heap(greater);
+        for (size_t i = 0; i < readers.size(); ++i) {
+            if (readers[i]->Valid()) {
+                heap.push(i);
+            }
+        }
+
+        keys.clear();
+        offsets.clear();
+        keys.reserve(num_rows_);
+        offsets.reserve(num_rows_);
+        while (!heap.empty()) {
+            auto i = heap.top();
+            heap.pop();
+            keys.push_back(std::move(readers[i]->key_));
+            offsets.push_back(readers[i]->row_);
+            readers[i]->Next();
+            if (readers[i]->Valid()) {
+                heap.push(i);
+            }
+        }
+        AssertInfo(int64_t(keys.size()) == num_rows_,
+                   fmt::format("merged {} rows of {} from the sort runs",
+                               keys.size(),
+                               num_rows_));
+    }
+
+ private:
+    const int64_t memory_budget_;
+    const std::string spill_dir_;
+    std::vector<T> keys_;
+    std::vector<int32_t> rows_;
+    int64_t run_bytes_ = 0;
+    int64_t num_rows_ = 0;
+    std::vector<std::string> runs_;
+};
+
+}  // namespace milvus::index
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include "common/Utils.h"
 #include "index/Meta.h"
 #include "index/ScalarIndex.h"
 
@@ -36,11 +37,46 @@ class StringIndex : public ScalarIndex<std::string> {
             auto prefix = dataset->Get<std::string>(PREFIX_VALUE);
             return PrefixMatch(prefix);
         }
+        if (op == OpType::PostfixMatch) {
+            auto postfix = dataset->Get<std::string>(MATCH_VALUE);
+            return PostfixMatch(postfix);
+        }
+        if (op == OpType::InfixMatch) {
+            auto infix = dataset->Get<std::string>(MATCH_VALUE);
+            return InfixMatch(infix);
+        }
         return ScalarIndex<std::string>::Query(dataset);
     }
 
     virtual const TargetBitmap
     PrefixMatch(const std::string_view prefix) = 0;
+
+    virtual const TargetBitmap
+    PostfixMatch(const std::string_view postfix) {
+        return MatchRows([&](std::string_view value) {
+            return milvus::PostfixMatch(value, postfix);
+        });
+    }
+
+    virtual const TargetBitmap
+    InfixMatch(const std::string_view infix) {
+        return MatchRows([&](std::string_view value) {
+            return milvus::InfixMatch(value, infix);
+        });
+    }
+
+ protected:
+    // rows whose value satisfies pred, looks up the value of every row
+    template <typename Pred>
+    TargetBitmap
+    MatchRows(Pred pred) {
+        auto n = Count();
+        TargetBitmap bitset(n);
+        for (int64_t i = 0; i < n; ++i) {
+            bitset[i] = pred(Reverse_Lookup(i));
+        }
+        return bitset;
+    }
 };
 using StringIndexPtr = std::unique_ptr<StringIndex>;
 }  // namespace milvus::index
@@ -21,6 +21,10 @@
 #include <stdio.h>
 #include <fcntl.h>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 #include "index/StringIndexMarisa.h"
 #include "index/Utils.h"
 #include "index/Index.h"
@@ -84,7 +88,7 @@ StringIndexMarisa::Build(const Config& config) {
     trie_.build(keyset);
 
     // fill str_ids_
-    str_ids_.resize(total_num_rows);
+    str_ids_buf_.resize(total_num_rows);
     int64_t offset = 0;
     for (auto data : field_datas) {
         auto slice_num = data->get_num_rows();
@@ -92,7 +96,7 @@ StringIndexMarisa::Build(const Config& config) {
             auto str_id =
                 lookup(*static_cast<const std::string*>(data->RawValue(i)));
             AssertInfo(valid_str_id(str_id), "invalid marisa key");
-            str_ids_[offset++] = str_id;
+            str_ids_buf_[offset++] = str_id;
         }
     }
 
@@ -146,13 +150,17 @@ StringIndexMarisa::Serialize(const Config& config) {
                               std::to_string(status));
     }
 
-    auto str_ids_len = str_ids_.size() * sizeof(size_t);
-    std::shared_ptr<uint8_t[]> str_ids(new uint8_t[str_ids_len]);
-    memcpy(str_ids.get(), str_ids_.data(), str_ids_len);
+    IndexLayoutWriter writer;
+    writer.AddSection(index_data.get(), size);
+    writer.AddSection(str_ids_, num_rows_);
+    writer.AddSection(str_id_ranks_, num_keys_);
+    writer.AddSection(ranked_str_ids_, num_keys_);
+    writer.AddSection(rank_row_offsets_, num_keys_ + 1);
+    writer.AddSection(rank_rows_, num_rows_);
+    auto [layout, layout_size] = writer.Serialize();
 
     BinarySet res_set;
-    res_set.Append(MARISA_TRIE_INDEX, index_data, size);
-    res_set.Append(MARISA_STR_IDS, str_ids, str_ids_len);
+    res_set.Append(MARISA_INDEX_LAYOUT, layout, layout_size);
 
     Disassemble(res_set);
 
@@ -176,6 +184,15 @@ StringIndexMarisa::Upload(const Config& config) {
 void
 StringIndexMarisa::LoadWithoutAssemble(const BinarySet& set,
                                        const Config& config) {
+    if (set.Contains(MARISA_INDEX_LAYOUT)) {
+        // in place, the layout is kept alive by the index
+        auto layout = set.GetByName(MARISA_INDEX_LAYOUT);
+        use_layout(layout->data.get(), layout->size);
+        layout_ = layout->data;
+        return;
+    }
+
+    // the trie and the str_ids of the former format
     auto uuid = boost::uuids::random_generator()();
     auto uuid_string = boost::uuids::to_string(uuid);
     auto file = std::string("/tmp/") + uuid_string;
@@ -202,8 +219,8 @@ StringIndexMarisa::LoadWithoutAssemble(const BinarySet& set,
 
     auto str_ids = set.GetByName(MARISA_STR_IDS);
     auto str_ids_len = str_ids->size;
-    str_ids_.resize(str_ids_len / sizeof(size_t));
-    memcpy(str_ids_.data(), str_ids->data.get(), str_ids_len);
+    str_ids_buf_.resize(str_ids_len / sizeof(size_t));
+    memcpy(str_ids_buf_.data(), str_ids->data.get(), str_ids_len);
 
     fill_offsets();
 }
@@ -220,12 +237,21 @@ StringIndexMarisa::Load(const Config& config) {
         GetValueFromConfig<std::vector<std::string>>(config, "index_files");
     AssertInfo(index_files.has_value(),
                "index file paths is empty when load index");
+    if (config.contains(kMmapFilepath) &&
+        !HasIndexFile(index_files.value(), MARISA_STR_IDS)) {
+        auto file = MmapIndexFile::Load(file_manager_.get(), config);
+        use_layout(file->Data(), file->Size());
+        layout_ = file;
+        return;
+    }
+
     auto index_datas = file_manager_->LoadIndexToMemory(index_files.value());
     AssembleIndexDatas(index_datas);
     BinarySet binary_set;
     for (auto& [key, data] : index_datas) {
         auto size = data->Size();
-        auto deleter = [&](uint8_t*) {};  // avoid repeated deconstruction
+        // the buffer holds the field data, a layout is used in place
+        auto deleter = [data = data](uint8_t*) {};
         auto buf = std::shared_ptr<uint8_t[]>(
             (uint8_t*)const_cast<void*>(data->Data()), deleter);
         binary_set.Append(key, buf, size);
@@ -236,15 +262,12 @@ StringIndexMarisa::Load(const Config& config) {
 
 const TargetBitmap
 StringIndexMarisa::In(size_t n, const std::string* values) {
-    TargetBitmap bitset(str_ids_.size());
+    TargetBitmap bitset(num_rows_);
     for (size_t i = 0; i < n; i++) {
         auto str = values[i];
         auto str_id = lookup(str);
         if (valid_str_id(str_id)) {
-            auto offsets = str_ids_to_offsets_[str_id];
-            for (auto offset : offsets) {
-                bitset[offset] = true;
-            }
+            set_rows_of_rank(bitset, str_id_ranks_[str_id], true);
         }
     }
     return bitset;
@@ -252,15 +275,12 @@ StringIndexMarisa::In(size_t n, const std::string* values) {
 
 const TargetBitmap
 StringIndexMarisa::NotIn(size_t n, const std::string* values) {
-    TargetBitmap bitset(str_ids_.size(), true);
+    TargetBitmap bitset(num_rows_, true);
     for (size_t i = 0; i < n; i++) {
         auto str = values[i];
         auto str_id = lookup(str);
         if (valid_str_id(str_id)) {
-            auto offsets = str_ids_to_offsets_[str_id];
-            for (auto offset : offsets) {
-                bitset[offset] = false;
-            }
+            set_rows_of_rank(bitset, str_id_ranks_[str_id], false);
         }
     }
     return bitset;
@@ -268,37 +288,31 @@ StringIndexMarisa::NotIn(size_t n, const std::string* values) {
 
 const TargetBitmap
 StringIndexMarisa::Range(std::string value, OpType op) {
-    auto count = Count();
-    TargetBitmap bitset(count);
-    marisa::Agent agent;
-    for (size_t offset = 0; offset < count; ++offset) {
-        agent.set_query(str_ids_[offset]);
-        trie_.reverse_lookup(agent);
-        std::string raw_data(agent.key().ptr(), agent.key().length());
-        bool set = false;
-        switch (op) {
-            case OpType::LessThan:
-                set = raw_data.compare(value) < 0;
-                break;
-            case OpType::LessEqual:
-                set = raw_data.compare(value) <= 0;
-                break;
-            case OpType::GreaterThan:
-                set = raw_data.compare(value) > 0;
-                break;
-            case OpType::GreaterEqual:
-                set = raw_data.compare(value) >= 0;
-                break;
-            default:
-                throw std::invalid_argument(
-                    std::string("Invalid OperatorType: ") +
-                    std::to_string((int)op) + "!");
-        }
-        if (set) {
-            bitset[offset] = true;
-        }
+    size_t begin = 0;
+    size_t end = num_keys_;
+    switch (op) {
+        case OpType::LessThan:
+            end = rank_partition_point(
+                [&](std::string_view key) { return key < value; });
+            break;
+        case OpType::LessEqual:
+            end = rank_partition_point(
+                [&](std::string_view key) { return key <= value; });
+            break;
+        case OpType::GreaterThan:
+            begin = rank_partition_point(
+                [&](std::string_view key) { return key <= value; });
+            break;
+        case OpType::GreaterEqual:
+            begin = rank_partition_point(
+                [&](std::string_view key) { return key < value; });
+            break;
+        default:
+            throw std::invalid_argument(
+                std::string("Invalid OperatorType: ") +
+                std::to_string((int)op) + "!");
     }
-    return bitset;
+    return rank_range(begin, end);
 }
 
 const TargetBitmap
@@ -306,69 +320,197 @@ StringIndexMarisa::Range(std::string lower_bound_value,
                          bool lb_inclusive,
                          std::string upper_bound_value,
                          bool ub_inclusive) {
-    auto count = Count();
-    TargetBitmap bitset(count);
     if (lower_bound_value.compare(upper_bound_value) > 0 ||
         (lower_bound_value.compare(upper_bound_value) == 0 &&
          !(lb_inclusive && ub_inclusive))) {
-        return bitset;
+        return TargetBitmap(Count());
     }
-    marisa::Agent agent;
-    for (size_t offset = 0; offset < count; ++offset) {
-        agent.set_query(str_ids_[offset]);
-        trie_.reverse_lookup(agent);
-        std::string raw_data(agent.key().ptr(), agent.key().length());
-        bool set = true;
-        if (lb_inclusive) {
-            set &= raw_data.compare(lower_bound_value) >= 0;
-        } else {
-            set &= raw_data.compare(lower_bound_value) > 0;
-        }
-        if (ub_inclusive) {
-            set &= raw_data.compare(upper_bound_value) <= 0;
-        } else {
-            set &= raw_data.compare(upper_bound_value) < 0;
-        }
-        if (set) {
-            bitset[offset] = true;
-        }
-    }
-    return bitset;
+    auto begin = rank_partition_point([&](std::string_view key) {
+        return lb_inclusive ? key < lower_bound_value
+                            : key <= lower_bound_value;
+    });
+    auto end = rank_partition_point([&](std::string_view key) {
+        return ub_inclusive ? key <= upper_bound_value
+                            : key < upper_bound_value;
+    });
+    return rank_range(begin, std::max(begin, end));
 }
 
 const TargetBitmap
 StringIndexMarisa::PrefixMatch(std::string_view prefix) {
-    TargetBitmap bitset(str_ids_.size());
-    auto matched = prefix_match(prefix);
-    for (const auto str_id : matched) {
-        auto offsets = str_ids_to_offsets_[str_id];
-        for (auto offset : offsets) {
-            bitset[offset] = true;
-        }
-    }
-    return bitset;
+    // the keys of a prefix are contiguous in lexicographic order
+    auto begin = rank_partition_point(
+        [&](std::string_view key) { return key < prefix; });
+    auto end = rank_partition_point([&](std::string_view key) {
+        return key < prefix || milvus::PrefixMatch(key, prefix);
+    });
+    return rank_range(begin, end);
+}
+
+const TargetBitmap
+StringIndexMarisa::PostfixMatch(std::string_view postfix) {
+    return match_keys([&](std::string_view key) {
+        return milvus::PostfixMatch(key, postfix);
+    });
+}
+
+const TargetBitmap
+StringIndexMarisa::InfixMatch(std::string_view infix) {
+    return match_keys(
+        [&](std::string_view key) { return milvus::InfixMatch(key, infix); });
 }
 
 void
 StringIndexMarisa::fill_str_ids(size_t n, const std::string* values) {
-    str_ids_.resize(n);
+    str_ids_buf_.resize(n);
     for (size_t i = 0; i < n; i++) {
         auto str = values[i];
         auto str_id = lookup(str);
         AssertInfo(valid_str_id(str_id), "invalid marisa key");
-        str_ids_[i] = str_id;
+        str_ids_buf_[i] = str_id;
     }
 }
 
 void
 StringIndexMarisa::fill_offsets() {
-    for (size_t offset = 0; offset < str_ids_.size(); offset++) {
-        auto str_id = str_ids_[offset];
-        if (str_ids_to_offsets_.find(str_id) == str_ids_to_offsets_.end()) {
-            str_ids_to_offsets_[str_id] = std::vector<size_t>{};
+    auto num_keys = trie_.num_keys();
+    AssertInfo(str_ids_buf_.size() <= std::numeric_limits<uint32_t>::max(),
+               "too many rows for a marisa index");
+
+    // rank the keys
+    std::vector<std::string> keys(num_keys);
+    marisa::Agent agent;
+    for (size_t str_id = 0; str_id < num_keys; ++str_id) {
+        keys[str_id] = key_of(str_id, agent);
+    }
+    ranked_str_ids_buf_.resize(num_keys);
+    std::iota(ranked_str_ids_buf_.begin(), ranked_str_ids_buf_.end(), 0);
+    std::sort(ranked_str_ids_buf_.begin(),
+              ranked_str_ids_buf_.end(),
+              [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+    str_id_ranks_buf_.resize(num_keys);
+    for (size_t rank = 0; rank < num_keys; ++rank) {
+        str_id_ranks_buf_[ranked_str_ids_buf_[rank]] = rank;
+    }
+
+    // group the rows by rank, a counting sort keeps the rows of a rank in
+    // ascending order
+    rank_row_offsets_buf_.assign(num_keys + 1, 0);
+    for (auto str_id : str_ids_buf_) {
+        ++rank_row_offsets_buf_[str_id_ranks_buf_[str_id] + 1];
+    }
+    for (size_t rank = 0; rank < num_keys; ++rank) {
+        rank_row_offsets_buf_[rank + 1] += rank_row_offsets_buf_[rank];
+    }
+    rank_rows_buf_.resize(str_ids_buf_.size());
+    std::vector<size_t> next(rank_row_offsets_buf_.begin(),
+                             rank_row_offsets_buf_.end() - 1);
+    for (size_t offset = 0; offset < str_ids_buf_.size(); offset++) {
+        auto rank = str_id_ranks_buf_[str_ids_buf_[offset]];
+        rank_rows_buf_[next[rank]++] = offset;
+    }
+    use_buffers();
+}
+
+void
+StringIndexMarisa::use_buffers() {
+    num_rows_ = str_ids_buf_.size();
+    num_keys_ = ranked_str_ids_buf_.size();
+    str_ids_ = str_ids_buf_.data();
+    str_id_ranks_ = str_id_ranks_buf_.data();
+    ranked_str_ids_ = ranked_str_ids_buf_.data();
+    rank_row_offsets_ = rank_row_offsets_buf_.data();
+    rank_rows_ = rank_rows_buf_.data();
+    layout_.reset();
+}
+
+void
+StringIndexMarisa::use_layout(const uint8_t* data, size_t size) {
+    IndexLayoutReader reader(data, size);
+    trie_.map(reader.Bytes(0), reader.Count<uint8_t>(0));
+    num_keys_ = trie_.num_keys();
+    num_rows_ = reader.Count<size_t>(1);
+    str_ids_ = reader.Section<size_t>(1, num_rows_);
+    str_id_ranks_ = reader.Section<uint32_t>(2, num_keys_);
+    ranked_str_ids_ = reader.Section<size_t>(3, num_keys_);
+    rank_row_offsets_ = reader.Section<size_t>(4, num_keys_ + 1);
+    rank_rows_ = reader.Section<uint32_t>(5, num_rows_);
+
+    str_ids_buf_ = std::vector<size_t>();
+    str_id_ranks_buf_ = std::vector<uint32_t>();
+    ranked_str_ids_buf_ = std::vector<size_t>();
+    rank_row_offsets_buf_ = std::vector<size_t>();
+    rank_rows_buf_ = std::vector<uint32_t>();
+}
+
+std::string_view
+StringIndexMarisa::key_of(size_t str_id, marisa::Agent& agent) const {
+    agent.set_query(str_id);
+    trie_.reverse_lookup(agent);
+    return std::string_view(agent.key().ptr(), agent.key().length());
+}
+
+template <typename Pred>
+size_t
+StringIndexMarisa::rank_partition_point(Pred pred) const {
+    marisa::Agent agent;
+    size_t lo = 0;
+    size_t hi = num_keys_;
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        if (pred(key_of(ranked_str_ids_[mid], agent))) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+TargetBitmap
+StringIndexMarisa::rank_range(size_t begin, size_t end) const {
+    TargetBitmap bitset(num_rows_);
+    if (begin >= end) {
+        return bitset;
+    }
+    auto num_rows = rank_row_offsets_[end] - rank_row_offsets_[begin];
+    if (num_rows * 8 < num_rows_) {
+        // few rows, set them from the postings
+        for (auto rank = begin; rank < end; ++rank) {
+            set_rows_of_rank(bitset, rank, true);
+        }
+        return bitset;
+    }
+    // compare the rank of every row
+    auto data = bitset.data();
+    for (size_t offset = 0; offset < num_rows_; ++offset) {
+        auto rank = str_id_ranks_[str_ids_[offset]];
+        data[offset] = rank >= begin && rank < end;
+    }
+    return bitset;
+}
+
+void
+StringIndexMarisa::set_rows_of_rank(TargetBitmap& bitset,
+                                    size_t rank,
+                                    bool value) const {
+    for (auto i = rank_row_offsets_[rank]; i < rank_row_offsets_[rank + 1];
+         ++i) {
+        bitset[rank_rows_[i]] = value;
+    }
+}
+
+template <typename Pred>
+TargetBitmap
+StringIndexMarisa::match_keys(Pred pred) const {
+    TargetBitmap bitset(num_rows_);
+    marisa::Agent agent;
+    for (size_t rank = 0; rank < num_keys_; ++rank) {
+        if (pred(key_of(ranked_str_ids_[rank], agent))) {
+            set_rows_of_rank(bitset, rank, true);
         }
-        str_ids_to_offsets_[str_id].push_back(offset);
     }
+    return bitset;
 }
 
 size_t
@@ -383,20 +525,9 @@ StringIndexMarisa::lookup(const std::string_view str) {
     return MARISA_INVALID_KEY_ID;
 }
 
-std::vector<size_t>
-StringIndexMarisa::prefix_match(const std::string_view prefix) {
-    std::vector<size_t> ret;
-    marisa::Agent agent;
-    agent.set_query(prefix.data());
-    while (trie_.predictive_search(agent)) {
-        ret.push_back(agent.key().id());
-    }
-    return ret;
-}
-
 std::string
 StringIndexMarisa::Reverse_Lookup(size_t offset) const {
-    AssertInfo(offset < str_ids_.size(), "out of range of total count");
+    AssertInfo(offset < num_rows_, "out of range of total count");
     marisa::Agent agent;
     agent.set_query(str_ids_[offset]);
     trie_.reverse_lookup(agent);
@@ -21,10 +21,12 @@
 #include <marisa.h>
 #include "index/StringIndex.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 #include <memory>
 #include "storage/MemFileManagerImpl.h"
+#include "index/IndexLayout.h"
 
 namespace milvus::index {
 
@@ -47,7 +49,12 @@ class StringIndexMarisa : public StringIndex {
 
     int64_t
     Count() override {
-        return str_ids_.size();
+        return num_rows_;
+    }
+
+    bool
+    IsMmapSupported() const override {
+        return true;
     }
 
     void
@@ -74,6 +81,12 @@ class StringIndexMarisa : public StringIndex {
     const TargetBitmap
     PrefixMatch(const std::string_view prefix) override;
 
+    const TargetBitmap
+    PostfixMatch(const std::string_view postfix) override;
+
+    const TargetBitmap
+    InfixMatch(const std::string_view infix) override;
+
     std::string
     Reverse_Lookup(size_t offset) const override;
 
@@ -84,15 +97,42 @@ class StringIndexMarisa : public StringIndex {
     void
     fill_str_ids(size_t n, const std::string* values);
 
+    // rank the keys lexicographically and group the rows by rank
     void
     fill_offsets();
 
+    std::string_view
+    key_of(size_t str_id, marisa::Agent& agent) const;
+
+    // the first rank whose key doesn't satisfy pred, pred must be true for a
+    // prefix of the ranks
+    template <typename Pred>
+    size_t
+    rank_partition_point(Pred pred) const;
+
+    // the rows of the keys of rank in [begin, end)
+    TargetBitmap
+    rank_range(size_t begin, size_t end) const;
+
+    void
+    set_rows_of_rank(TargetBitmap& bitset, size_t rank, bool value) const;
+
+    // the rows of the keys satisfying pred, pred runs once per key
+    template <typename Pred>
+    TargetBitmap
+    match_keys(Pred pred) const;
+
     // get str_id by str, if str not found, -1 was returned.
     size_t
     lookup(const std::string_view str);
 
-    std::vector<size_t>
-    prefix_match(const std::string_view prefix);
+    // point the arrays at the vectors of a build or a former format load
+    void
+    use_buffers();
+
+    // map the trie and point the arrays at a serialized layout
+    void
+    use_layout(const uint8_t* data, size_t size);
 
     void
     LoadWithoutAssemble(const BinarySet& binary_set, const Config& config);
@@ -100,8 +140,25 @@ class StringIndexMarisa : public StringIndex {
  private:
     Config config_;
     marisa::Trie trie_;
-    std::vector<size_t> str_ids_;  // used to retrieve.
-    std::map<size_t, std::vector<size_t>> str_ids_to_offsets_;
+    // the arrays of the index, in the vectors below or in the serialized
+    // layout held by layout_
+    size_t num_rows_ = 0;
+    size_t num_keys_ = 0;
+    const size_t* str_ids_ = nullptr;         // used to retrieve.
+    const uint32_t* str_id_ranks_ = nullptr;  // lexicographic rank of str_id
+    const size_t* ranked_str_ids_ = nullptr;  // str_ids in lexicographic order
+    // rows of every rank as CSR, the rows of rank r are
+    // rank_rows_[rank_row_offsets_[r], rank_row_offsets_[r + 1])
+    const size_t* rank_row_offsets_ = nullptr;
+    const uint32_t* rank_rows_ = nullptr;
+
+    std::vector<size_t> str_ids_buf_;
+    std::vector<uint32_t> str_id_ranks_buf_;
+    std::vector<size_t> ranked_str_ids_buf_;
+    std::vector<size_t> rank_row_offsets_buf_;
+    std::vector<uint32_t> rank_rows_buf_;
+    // a loaded layout or a mapped file, the trie is mapped from it too
+    std::shared_ptr<const void> layout_;
     bool built_ = false;
     std::shared_ptr<storage::MemFileManagerImpl> file_manager_;
 };
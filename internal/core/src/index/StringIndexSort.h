@@ -34,24 +34,57 @@ class StringIndexSort : public ScalarIndexSort<std::string> {
             auto prefix = dataset->Get<std::string>(PREFIX_VALUE);
             return PrefixMatch(prefix);
         }
+        if (op == OpType::PostfixMatch) {
+            auto postfix = dataset->Get<std::string>(MATCH_VALUE);
+            return MatchKeys([&](const std::string& key) {
+                return milvus::PostfixMatch(key, postfix);
+            });
+        }
+        if (op == OpType::InfixMatch) {
+            auto infix = dataset->Get<std::string>(MATCH_VALUE);
+            return MatchKeys([&](const std::string& key) {
+                return milvus::InfixMatch(key, infix);
+            });
+        }
         return ScalarIndex<std::string>::Query(dataset);
     }
 
     const TargetBitmap
     PrefixMatch(std::string_view prefix) {
-        auto data = GetData();
-        TargetBitmap bitset(data.size());
+        auto keys = GetKeys();
+        auto num_keys = NumKeys();
+        TargetBitmap bitset(num_keys);
         auto it = std::lower_bound(
-            data.begin(),
-            data.end(),
+            keys,
+            keys + num_keys,
             prefix,
-            [](const IndexStructure<std::string>& value,
-               std::string_view prefix) { return value.a_ < prefix; });
-        for (; it != data.end(); ++it) {
-            if (!milvus::PrefixMatch(it->a_, prefix)) {
-                break;
+            [](const std::string& value, std::string_view prefix) {
+                return value < prefix;
+            });
+        size_t begin = it - keys;
+        auto end = begin;
+        while (end < num_keys && milvus::PrefixMatch(keys[end], prefix)) {
+            ++end;
+        }
+        SetRows(bitset, begin, end, true);
+        return bitset;
+    }
+
+ private:
+    // the rows of the keys satisfying pred, pred runs once per distinct key
+    template <typename Pred>
+    TargetBitmap
+    MatchKeys(Pred pred) const {
+        auto keys = GetKeys();
+        auto num_keys = NumKeys();
+        TargetBitmap bitset(num_keys);
+        size_t begin = 0;
+        while (begin < num_keys) {
+            auto end = UpperBound(keys[begin]);
+            if (pred(keys[begin])) {
+                SetRows(bitset, begin, end, true);
             }
-            bitset[it->idx_] = true;
+            begin = end;
         }
         return bitset;
     }
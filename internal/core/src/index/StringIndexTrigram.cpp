@@ -0,0 +1,487 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/StringIndexTrigram.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "common/Slice.h"
+#include "common/Utils.h"
+#include "index/Utils.h"
+
+namespace milvus::index {
+
+namespace {
+constexpr size_t kTrigramSize = 3;
+
+// the distinct trigrams of str, sorted
+std::vector<uint32_t>
+Trigrams(std::string_view str) {
+    std::vector<uint32_t> trigrams;
+    if (str.size() < kTrigramSize) {
+        return trigrams;
+    }
+    trigrams.reserve(str.size() - kTrigramSize + 1);
+    for (size_t i = 0; i + kTrigramSize <= str.size(); ++i) {
+        trigrams.push_back(uint32_t(uint8_t(str[i])) << 16 |
+                           uint32_t(uint8_t(str[i + 1])) << 8 |
+                           uint32_t(uint8_t(str[i + 2])));
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()),
+                   trigrams.end());
+    return trigrams;
+}
+}  // namespace
+
+StringIndexTrigram::StringIndexTrigram(
+    storage::FileManagerImplPtr file_manager) {
+    if (file_manager != nullptr) {
+        file_manager_ = std::dynamic_pointer_cast<storage::MemFileManagerImpl>(
+            file_manager);
+    }
+}
+
+void
+StringIndexTrigram::Build(const Config& config) {
+    if (built_) {
+        throw std::runtime_error("index has been built");
+    }
+
+    auto insert_files =
+        GetValueFromConfig<std::vector<std::string>>(config, "insert_files");
+    AssertInfo(insert_files.has_value(),
+               "insert file paths is empty when build index");
+    auto field_datas =
+        file_manager_->CacheRawDataToMemory(insert_files.value());
+
+    // the field datas outlive the build, view their values
+    std::vector<std::string_view> values;
+    for (auto data : field_datas) {
+        auto slice_num = data->get_num_rows();
+        for (size_t i = 0; i < slice_num; ++i) {
+            values.emplace_back(
+                *static_cast<const std::string*>(data->RawValue(i)));
+        }
+    }
+    config_ = config;
+    BuildFromValues(values);
+}
+
+void
+StringIndexTrigram::Build(size_t n, const std::string* values) {
+    if (built_) {
+        throw std::runtime_error("index has been built");
+    }
+
+    std::vector<std::string_view> views(values, values + n);
+    BuildFromValues(views);
+}
+
+void
+StringIndexTrigram::BuildFromValues(
+    const std::vector<std::string_view>& values) {
+    AssertInfo(values.size() <= std::numeric_limits<uint32_t>::max(),
+               "too many rows for a trigram index");
+    std::vector<std::string_view> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    keys_.assign(sorted.begin(), sorted.end());
+
+    key_ids_.resize(values.size());
+    for (size_t offset = 0; offset < values.size(); ++offset) {
+        key_ids_[offset] = lower_bound(values[offset]);
+    }
+
+    fill_postings();
+    built_ = true;
+}
+
+void
+StringIndexTrigram::fill_postings() {
+    auto num_keys = keys_.size();
+
+    // group the rows by key, a counting sort keeps the rows of a key in
+    // ascending order
+    key_row_offsets_.assign(num_keys + 1, 0);
+    for (auto key_id : key_ids_) {
+        AssertInfo(key_id < num_keys, "trigram index data is corrupted");
+        ++key_row_offsets_[key_id + 1];
+    }
+    for (size_t k = 0; k < num_keys; ++k) {
+        key_row_offsets_[k + 1] += key_row_offsets_[k];
+    }
+    key_rows_.resize(key_ids_.size());
+    std::vector<size_t> next(key_row_offsets_.begin(),
+                             key_row_offsets_.end() - 1);
+    for (size_t offset = 0; offset < key_ids_.size(); ++offset) {
+        key_rows_[next[key_ids_[offset]]++] = offset;
+    }
+
+    // a stable sort by trigram keeps the keys of a trigram ascending
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    for (size_t k = 0; k < num_keys; ++k) {
+        for (auto trigram : Trigrams(keys_[k])) {
+            pairs.emplace_back(trigram, k);
+        }
+    }
+    std::stable_sort(pairs.begin(), pairs.end(), [](auto& a, auto& b) {
+        return a.first < b.first;
+    });
+    trigrams_.clear();
+    trigram_offsets_.clear();
+    trigram_keys_.resize(pairs.size());
+    for (size_t i = 0; i < pairs.size(); ++i) {
+        if (trigrams_.empty() || trigrams_.back() != pairs[i].first) {
+            trigrams_.push_back(pairs[i].first);
+            trigram_offsets_.push_back(i);
+        }
+        trigram_keys_[i] = pairs[i].second;
+    }
+    trigram_offsets_.push_back(pairs.size());
+}
+
+BinarySet
+StringIndexTrigram::Serialize(const Config& config) {
+    AssertInfo(built_, "index has not been built");
+
+    // [num_keys][end offset of every key][bytes of the keys]
+    uint64_t num_keys = keys_.size();
+    std::vector<uint64_t> ends(num_keys);
+    uint64_t total = 0;
+    for (size_t k = 0; k < num_keys; ++k) {
+        total += keys_[k].size();
+        ends[k] = total;
+    }
+    auto keys_len = sizeof(uint64_t) * (num_keys + 1) + total;
+    std::shared_ptr<uint8_t[]> keys_data(new uint8_t[keys_len]);
+    auto pos = keys_data.get();
+    memcpy(pos, &num_keys, sizeof(uint64_t));
+    pos += sizeof(uint64_t);
+    memcpy(pos, ends.data(), sizeof(uint64_t) * num_keys);
+    pos += sizeof(uint64_t) * num_keys;
+    for (auto& key : keys_) {
+        memcpy(pos, key.data(), key.size());
+        pos += key.size();
+    }
+
+    auto key_ids_len = key_ids_.size() * sizeof(uint32_t);
+    std::shared_ptr<uint8_t[]> key_ids_data(new uint8_t[key_ids_len]);
+    memcpy(key_ids_data.get(), key_ids_.data(), key_ids_len);
+
+    BinarySet res_set;
+    res_set.Append(TRIGRAM_INDEX_KEYS, keys_data, keys_len);
+    res_set.Append(TRIGRAM_INDEX_KEY_IDS, key_ids_data, key_ids_len);
+
+    Disassemble(res_set);
+
+    return res_set;
+}
+
+BinarySet
+StringIndexTrigram::Upload(const Config& config) {
+    auto binary_set = Serialize(config);
+    file_manager_->AddFile(binary_set);
+
+    auto remote_paths_to_size = file_manager_->GetRemotePathsToFileSize();
+    BinarySet ret;
+    for (auto& file : remote_paths_to_size) {
+        ret.Append(file.first, nullptr, file.second);
+    }
+
+    return ret;
+}
+
+void
+StringIndexTrigram::LoadWithoutAssemble(const BinarySet& set,
+                                        const Config& config) {
+    auto keys_data = set.GetByName(TRIGRAM_INDEX_KEYS);
+    auto key_ids_data = set.GetByName(TRIGRAM_INDEX_KEY_IDS);
+    AssertInfo(keys_data != nullptr && key_ids_data != nullptr,
+               "trigram index data not found");
+
+    auto data = keys_data->data.get();
+    size_t size = keys_data->size;
+    uint64_t num_keys = 0;
+    AssertInfo(size >= sizeof(uint64_t), "trigram index data is truncated");
+    memcpy(&num_keys, data, sizeof(uint64_t));
+    AssertInfo((size - sizeof(uint64_t)) / sizeof(uint64_t) >= num_keys,
+               "trigram index data is truncated");
+    std::vector<uint64_t> ends(num_keys);
+    memcpy(ends.data(), data + sizeof(uint64_t), sizeof(uint64_t) * num_keys);
+    auto bytes = reinterpret_cast<const char*>(data) +
+                 sizeof(uint64_t) * (num_keys + 1);
+    auto bytes_len = size - sizeof(uint64_t) * (num_keys + 1);
+    keys_.resize(num_keys);
+    uint64_t begin = 0;
+    for (size_t k = 0; k < num_keys; ++k) {
+        AssertInfo(begin <= ends[k] && ends[k] <= bytes_len,
+                   "trigram index data is corrupted");
+        keys_[k].assign(bytes + begin, ends[k] - begin);
+        begin = ends[k];
+    }
+
+    key_ids_.resize(key_ids_data->size / sizeof(uint32_t));
+    memcpy(key_ids_.data(), key_ids_data->data.get(), key_ids_data->size);
+
+    fill_postings();
+    built_ = true;
+}
+
+void
+StringIndexTrigram::Load(const BinarySet& set, const Config& config) {
+    milvus::Assemble(const_cast<BinarySet&>(set));
+    LoadWithoutAssemble(set, config);
+}
+
+void
+StringIndexTrigram::Load(const Config& config) {
+    auto index_files =
+        GetValueFromConfig<std::vector<std::string>>(config, "index_files");
+    AssertInfo(index_files.has_value(),
+               "index file paths is empty when load trigram index");
+    auto index_datas = file_manager_->LoadIndexToMemory(index_files.value());
+    AssembleIndexDatas(index_datas);
+    BinarySet binary_set;
+    for (auto& [key, data] : index_datas) {
+        auto size = data->Size();
+        auto deleter = [&](uint8_t*) {};  // avoid repeated deconstruction
+        auto buf = std::shared_ptr<uint8_t[]>(
+            (uint8_t*)const_cast<void*>(data->Data()), deleter);
+        binary_set.Append(key, buf, size);
+    }
+
+    LoadWithoutAssemble(binary_set, config);
+}
+
+const TargetBitmap
+StringIndexTrigram::In(size_t n, const std::string* values) {
+    TargetBitmap bitset(key_ids_.size());
+    for (size_t i = 0; i < n; i++) {
+        auto k = lower_bound(values[i]);
+        if (k < keys_.size() && keys_[k] == values[i]) {
+            set_rows_of_key(bitset, k, true);
+        }
+    }
+    return bitset;
+}
+
+const TargetBitmap
+StringIndexTrigram::NotIn(size_t n, const std::string* values) {
+    TargetBitmap bitset(key_ids_.size(), true);
+    for (size_t i = 0; i < n; i++) {
+        auto k = lower_bound(values[i]);
+        if (k < keys_.size() && keys_[k] == values[i]) {
+            set_rows_of_key(bitset, k, false);
+        }
+    }
+    return bitset;
+}
+
+const TargetBitmap
+StringIndexTrigram::Range(std::string value, OpType op) {
+    size_t begin = 0;
+    size_t end = keys_.size();
+    switch (op) {
+        case OpType::LessThan:
+            end = lower_bound(value);
+            break;
+        case OpType::LessEqual:
+            end = upper_bound(value);
+            break;
+        case OpType::GreaterThan:
+            begin = upper_bound(value);
+            break;
+        case OpType::GreaterEqual:
+            begin = lower_bound(value);
+            break;
+        default:
+            throw std::invalid_argument(
+                std::string("Invalid OperatorType: ") +
+                std::to_string((int)op) + "!");
+    }
+    return key_range(begin, end);
+}
+
+const TargetBitmap
+StringIndexTrigram::Range(std::string lower_bound_value,
+                          bool lb_inclusive,
+                          std::string upper_bound_value,
+                          bool ub_inclusive) {
+    auto begin = lb_inclusive ? lower_bound(lower_bound_value)
+                              : upper_bound(lower_bound_value);
+    auto end = ub_inclusive ? upper_bound(upper_bound_value)
+                            : lower_bound(upper_bound_value);
+    return key_range(begin, std::max(begin, end));
+}
+
+const TargetBitmap
+StringIndexTrigram::PrefixMatch(std::string_view prefix) {
+    // the keys of a prefix are contiguous in the sorted keys
+    auto begin = lower_bound(prefix);
+    auto end = std::partition_point(keys_.begin() + begin,
+                                    keys_.end(),
+                                    [&](const std::string& key) {
+                                        return milvus::PrefixMatch(key,
+                                                                   prefix);
+                                    }) -
+               keys_.begin();
+    return key_range(begin, end);
+}
+
+const TargetBitmap
+StringIndexTrigram::PostfixMatch(std::string_view postfix) {
+    return match_candidates(postfix, [&](std::string_view key) {
+        return milvus::PostfixMatch(key, postfix);
+    });
+}
+
+const TargetBitmap
+StringIndexTrigram::InfixMatch(std::string_view infix) {
+    return match_candidates(infix, [&](std::string_view key) {
+        return milvus::InfixMatch(key, infix);
+    });
+}
+
+std::optional<std::vector<uint32_t>>
+StringIndexTrigram::Candidates(std::string_view pattern) const {
+    auto trigrams = Trigrams(pattern);
+    if (trigrams.empty()) {
+        return std::nullopt;
+    }
+
+    // the postings of every trigram, a missing trigram matches nothing
+    std::vector<std::pair<const uint32_t*, const uint32_t*>> postings;
+    for (auto trigram : trigrams) {
+        auto it = std::lower_bound(trigrams_.begin(), trigrams_.end(), trigram);
+        if (it == trigrams_.end() || *it != trigram) {
+            return std::vector<uint32_t>{};
+        }
+        auto i = it - trigrams_.begin();
+        postings.emplace_back(trigram_keys_.data() + trigram_offsets_[i],
+                              trigram_keys_.data() + trigram_offsets_[i + 1]);
+    }
+
+    // intersect from the shortest postings, probing the longer ones
+    std::sort(postings.begin(), postings.end(), [](auto& a, auto& b) {
+        return a.second - a.first < b.second - b.first;
+    });
+    std::vector<uint32_t> candidates(postings[0].first, postings[0].second);
+    for (size_t i = 1; i < postings.size() && !candidates.empty(); ++i) {
+        auto [first, last] = postings[i];
+        size_t n = 0;
+        for (auto key_id : candidates) {
+            first = std::lower_bound(first, last, key_id);
+            if (first == last) {
+                break;
+            }
+            if (*first == key_id) {
+                candidates[n++] = key_id;
+            }
+        }
+        candidates.resize(n);
+    }
+    return candidates;
+}
+
+template <typename Pred>
+TargetBitmap
+StringIndexTrigram::match_candidates(std::string_view pattern,
+                                     Pred pred) const {
+    TargetBitmap bitset(key_ids_.size());
+    auto candidates = Candidates(pattern);
+    if (!candidates.has_value()) {
+        for (size_t k = 0; k < keys_.size(); ++k) {
+            if (pred(keys_[k])) {
+                set_rows_of_key(bitset, k, true);
+            }
+        }
+        return bitset;
+    }
+    // the trigrams only narrow the keys, verify the pattern on every one
+    for (auto k : candidates.value()) {
+        if (pred(keys_[k])) {
+            set_rows_of_key(bitset, k, true);
+        }
+    }
+    return bitset;
+}
+
+TargetBitmap
+StringIndexTrigram::key_range(size_t begin, size_t end) const {
+    TargetBitmap bitset(key_ids_.size());
+    if (begin >= end) {
+        return bitset;
+    }
+    auto num_rows = key_row_offsets_[end] - key_row_offsets_[begin];
+    if (num_rows * 8 < key_ids_.size()) {
+        // few rows, set them from the postings
+        for (auto k = begin; k < end; ++k) {
+            set_rows_of_key(bitset, k, true);
+        }
+        return bitset;
+    }
+    // compare the key of every row
+    auto data = bitset.data();
+    for (size_t offset = 0; offset < key_ids_.size(); ++offset) {
+        auto k = key_ids_[offset];
+        data[offset] = k >= begin && k < end;
+    }
+    return bitset;
+}
+
+void
+StringIndexTrigram::set_rows_of_key(TargetBitmap& bitset,
+                                    size_t key_id,
+                                    bool value) const {
+    for (auto i = key_row_offsets_[key_id]; i < key_row_offsets_[key_id + 1];
+         ++i) {
+        bitset[key_rows_[i]] = value;
+    }
+}
+
+size_t
+StringIndexTrigram::lower_bound(std::string_view value) const {
+    return std::lower_bound(keys_.begin(),
+                            keys_.end(),
+                            value,
+                            [](const std::string& key, std::string_view v) {
+                                return std::string_view(key) < v;
+                            }) -
+           keys_.begin();
+}
+
+size_t
+StringIndexTrigram::upper_bound(std::string_view value) const {
+    return std::upper_bound(keys_.begin(),
+                            keys_.end(),
+                            value,
+                            [](std::string_view v, const std::string& key) {
+                                return v < std::string_view(key);
+                            }) -
+           keys_.begin();
+}
+
+std::string
+StringIndexTrigram::Reverse_Lookup(size_t offset) const {
+    AssertInfo(offset < key_ids_.size(), "out of range of total count");
+    return keys_[key_ids_[offset]];
+}
+
+}  // namespace milvus::index
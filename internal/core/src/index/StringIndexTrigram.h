@@ -0,0 +1,156 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "index/StringIndex.h"
+#include "storage/MemFileManagerImpl.h"
+
+namespace milvus::index {
+
+// StringIndexTrigram keeps the sorted distinct keys of a string field and an
+// inverted index from every trigram (3 consecutive bytes) to the keys
+// containing it. Infix and postfix match intersect the postings of the
+// trigrams of the pattern, and only verify the keys left; patterns shorter
+// than a trigram verify every distinct key. In, Range and PrefixMatch search
+// the sorted keys.
+class StringIndexTrigram : public StringIndex {
+ public:
+    explicit StringIndexTrigram(
+        storage::FileManagerImplPtr file_manager = nullptr);
+
+    int64_t
+    Size() override {
+        return keys_.size();
+    }
+
+    BinarySet
+    Serialize(const Config& config) override;
+
+    void
+    Load(const BinarySet& set, const Config& config = {}) override;
+
+    void
+    Load(const Config& config = {}) override;
+
+    int64_t
+    Count() override {
+        return key_ids_.size();
+    }
+
+    void
+    Build(size_t n, const std::string* values) override;
+
+    void
+    Build(const Config& config = {}) override;
+
+    const TargetBitmap
+    In(size_t n, const std::string* values) override;
+
+    const TargetBitmap
+    NotIn(size_t n, const std::string* values) override;
+
+    const TargetBitmap
+    Range(std::string value, OpType op) override;
+
+    const TargetBitmap
+    Range(std::string lower_bound_value,
+          bool lb_inclusive,
+          std::string upper_bound_value,
+          bool ub_inclusive) override;
+
+    const TargetBitmap
+    PrefixMatch(const std::string_view prefix) override;
+
+    const TargetBitmap
+    PostfixMatch(const std::string_view postfix) override;
+
+    const TargetBitmap
+    InfixMatch(const std::string_view infix) override;
+
+    std::string
+    Reverse_Lookup(size_t offset) const override;
+
+    BinarySet
+    Upload(const Config& config = {}) override;
+
+ public:
+    // ids of the keys holding all the trigrams of pattern, nullopt if the
+    // pattern is shorter than a trigram
+    std::optional<std::vector<uint32_t>>
+    Candidates(std::string_view pattern) const;
+
+    void
+    LoadWithoutAssemble(const BinarySet& binary_set, const Config& config);
+
+ private:
+    void
+    BuildFromValues(const std::vector<std::string_view>& values);
+
+    // group the rows by key and build the trigram postings
+    void
+    fill_postings();
+
+    // the rows of the keys satisfying pred among the candidates of pattern
+    template <typename Pred>
+    TargetBitmap
+    match_candidates(std::string_view pattern, Pred pred) const;
+
+    // the rows of the keys in [begin, end)
+    TargetBitmap
+    key_range(size_t begin, size_t end) const;
+
+    void
+    set_rows_of_key(TargetBitmap& bitset, size_t key_id, bool value) const;
+
+    size_t
+    lower_bound(std::string_view value) const;
+
+    size_t
+    upper_bound(std::string_view value) const;
+
+ private:
+    Config config_;
+    bool built_ = false;
+    std::vector<std::string> keys_;  // sorted distinct keys
+    std::vector<uint32_t> key_ids_;  // key of every row
+    // rows of every key as CSR, the rows of key k are
+    // key_rows_[key_row_offsets_[k], key_row_offsets_[k + 1])
+    std::vector<size_t> key_row_offsets_;
+    std::vector<uint32_t> key_rows_;
+    // sorted distinct trigrams and the ascending ids of the keys holding
+    // them, the keys of trigrams_[i] are
+    // trigram_keys_[trigram_offsets_[i], trigram_offsets_[i + 1])
+    std::vector<uint32_t> trigrams_;
+    std::vector<size_t> trigram_offsets_;
+    std::vector<uint32_t> trigram_keys_;
+    std::shared_ptr<storage::MemFileManagerImpl> file_manager_;
+};
+
+using StringIndexTrigramPtr = std::unique_ptr<StringIndexTrigram>;
+
+inline StringIndexPtr
+CreateStringIndexTrigram(storage::FileManagerImplPtr file_manager = nullptr) {
+    return std::make_unique<StringIndexTrigram>(file_manager);
+}
+
+}  // namespace milvus::index
@@ -21,6 +21,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <functional>
 #include <iostream>
@@ -31,8 +32,11 @@
 #include <unistd.h>
 #include "exceptions/EasyAssert.h"
 #include "knowhere/comp/index_param.h"
+#include "common/Common.h"
 #include "common/Slice.h"
+#include "log/Log.h"
 #include "storage/FieldData.h"
+#include "storage/MemFileManagerImpl.h"
 #include "storage/Util.h"
 #include "utils/File.h"
 
@@ -278,4 +282,87 @@ AssembleIndexDatas(
     }
 }
 
+void
+LoadIndexFilesToFile(storage::MemFileManagerImpl* file_manager,
+                     const std::vector<std::string>& index_files,
+                     File& file) {
+    std::unordered_set<std::string> pending_index_files(index_files.begin(),
+                                                        index_files.end());
+
+    LOG_SEGCORE_INFO_ << "load index files: " << index_files.size();
+
+    auto parallel_degree =
+        static_cast<uint64_t>(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+
+    // try to read slice meta first
+    std::string slice_meta_filepath;
+    for (auto& file : pending_index_files) {
+        auto file_name = file.substr(file.find_last_of('/') + 1);
+        if (file_name == INDEX_FILE_SLICE_META) {
+            slice_meta_filepath = file;
+            pending_index_files.erase(file);
+            break;
+        }
+    }
+
+    LOG_SEGCORE_INFO_ << "load with slice meta: "
+                      << !slice_meta_filepath.empty();
+
+    if (!slice_meta_filepath
+             .empty()) {  // load with the slice meta info, then we can load batch by batch
+        std::string index_file_prefix = slice_meta_filepath.substr(
+            0, slice_meta_filepath.find_last_of('/') + 1);
+        std::vector<std::string> batch{};
+        batch.reserve(parallel_degree);
+
+        auto result = file_manager->LoadIndexToMemory({slice_meta_filepath});
+        auto raw_slice_meta = result[INDEX_FILE_SLICE_META];
+        Config meta_data = Config::parse(
+            std::string(static_cast<const char*>(raw_slice_meta->Data()),
+                        raw_slice_meta->Size()));
+
+        for (auto& item : meta_data[META]) {
+            std::string prefix = item[NAME];
+            int slice_num = item[SLICE_NUM];
+            auto total_len = static_cast<size_t>(item[TOTAL_LEN]);
+
+            auto HandleBatch = [&](int index) {
+                auto batch_data = file_manager->LoadIndexToMemory(batch);
+                for (int j = index - batch.size() + 1; j <= index; j++) {
+                    std::string file_name = GenSlicedFileName(prefix, j);
+                    AssertInfo(batch_data.find(file_name) != batch_data.end(),
+                               "lost index slice data");
+                    auto data = batch_data[file_name];
+                    auto written = file.Write(data->Data(), data->Size());
+                    AssertInfo(
+                        written == data->Size(),
+                        fmt::format("failed to write index data to disk: {}",
+                                    strerror(errno)));
+                }
+                for (auto& file : batch) {
+                    pending_index_files.erase(file);
+                }
+                batch.clear();
+            };
+
+            for (auto i = 0; i < slice_num; ++i) {
+                std::string file_name = GenSlicedFileName(prefix, i);
+                batch.push_back(index_file_prefix + file_name);
+                if (batch.size() >= parallel_degree) {
+                    HandleBatch(i);
+                }
+            }
+            if (batch.size() > 0) {
+                HandleBatch(slice_num - 1);
+            }
+        }
+    } else {
+        auto result = file_manager->LoadIndexToMemory(std::vector<std::string>(
+            pending_index_files.begin(), pending_index_files.end()));
+        for (auto& [_, index_data] : result) {
+            file.Write(index_data->Data(), index_data->Size());
+        }
+    }
+}
+
 }  // namespace milvus::index
@@ -32,6 +32,14 @@
 #include "storage/Types.h"
 #include "storage/FieldData.h"
 
+namespace milvus {
+class File;
+}  // namespace milvus
+
+namespace milvus::storage {
+class MemFileManagerImpl;
+}  // namespace milvus::storage
+
 namespace milvus::index {
 
 size_t
@@ -85,6 +93,19 @@ GetValueFromConfig(const Config& cfg, const std::string& key) {
     return std::nullopt;
 }
 
+// index params come as strings from the proxy, or as numbers
+inline int64_t
+GetIntParamFromConfig(const Config& cfg,
+                      const std::string& key,
+                      int64_t default_value) {
+    if (!cfg.contains(key)) {
+        return default_value;
+    }
+    auto& value = cfg.at(key);
+    return value.is_string() ? std::stoll(value.get<std::string>())
+                             : value.get<int64_t>();
+}
+
 template <typename T>
 inline void
 SetValueToConfig(Config& cfg, const std::string& key, const T value) {
@@ -113,6 +134,13 @@ ParseConfigFromIndexParams(
 void
 AssembleIndexDatas(std::map<std::string, storage::FieldDataPtr>& index_datas);
 
+// write the data of index_files to file, the slices of a sliced binary in
+// order and a batch at a time, so that the index isn't held in memory
+void
+LoadIndexFilesToFile(storage::MemFileManagerImpl* file_manager,
+                     const std::vector<std::string>& index_files,
+                     File& file);
+
 void
 AssembleIndexDatas(
     std::map<std::string, storage::FieldDataChannelPtr>& index_datas,
@@ -24,6 +24,7 @@
 
 #include "knowhere/factory.h"
 #include "index/Index.h"
+#include "index/VectorIterator.h"
 #include "common/Types.h"
 #include "common/BitsetView.h"
 #include "common/QueryResult.h"
@@ -56,6 +57,23 @@ class VectorIndex : public IndexBase {
           const SearchInfo& search_info,
           const BitsetView& bitset) = 0;
 
+    // iterate the results of a single query from the most similar one,
+    // the data of dataset and bitset must outlive the iterator
+    virtual VectorIteratorPtr
+    Iterator(const DatasetPtr dataset,
+             const SearchInfo& search_info,
+             const BitsetView& bitset) {
+        AssertInfo(dataset->GetRows() == 1,
+                   "search iterator supports only one query");
+        auto max_count = Count() - static_cast<int64_t>(bitset.count());
+        return std::make_unique<RangeSearchIterator>(
+            search_info,
+            max_count,
+            [this, dataset, bitset](const SearchInfo& info) {
+                return Query(dataset, info, bitset);
+            });
+    }
+
     virtual const bool
     HasRawData() const = 0;
 
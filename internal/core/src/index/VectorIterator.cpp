@@ -0,0 +1,157 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index/VectorIterator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "common/Consts.h"
+#include "common/Utils.h"
+#include "exceptions/EasyAssert.h"
+
+namespace milvus::index {
+
+namespace {
+// lower bounds of the first band width, relative to the distance and
+// absolute, in case all results of the first batch have the same distance
+const float kMinRelativeWidth = 1e-2;
+const float kMinWidth = 1e-4;
+// give up after the band is doubled so many times without any result,
+// an approximate index may never return some of the rows
+const int kMaxEmptyRounds = 32;
+}  // namespace
+
+RangeSearchIterator::RangeSearchIterator(const SearchInfo& search_info,
+                                         int64_t max_count,
+                                         SearchFunc search)
+    : search_info_(search_info),
+      search_(std::move(search)),
+      positively_related_(PositivelyRelated(search_info.metric_type_)),
+      max_count_(max_count),
+      exhausted_(max_count <= 0) {
+    // rounded distances can't be used as band boundaries
+    search_info_.round_decimal_ = -1;
+    search_info_.search_params_.erase(RADIUS);
+    search_info_.search_params_.erase(RANGE_FILTER);
+}
+
+std::vector<std::pair<int64_t, float>>
+RangeSearchIterator::Search(int64_t topk, std::optional<float> radius) {
+    auto search_info = search_info_;
+    search_info.topk_ = topk;
+    if (radius.has_value()) {
+        search_info.search_params_[RADIUS] = radius.value();
+        search_info.search_params_[RANGE_FILTER] = frontier_;
+    }
+    auto result = search_(search_info);
+    AssertInfo(result->seg_offsets_.size() >= topk &&
+                   result->distances_.size() >= topk,
+               "size of iterator search result is less than topk");
+
+    std::vector<std::pair<int64_t, float>> results;
+    results.reserve(topk);
+    for (int64_t i = 0; i < topk; ++i) {
+        if (result->seg_offsets_[i] != INVALID_SEG_OFFSET) {
+            results.emplace_back(result->seg_offsets_[i],
+                                 result->distances_[i]);
+        }
+    }
+    std::stable_sort(
+        results.begin(), results.end(), [this](auto& lhs, auto& rhs) {
+            return positively_related_ ? lhs.second > rhs.second
+                                       : lhs.second < rhs.second;
+        });
+    return results;
+}
+
+void
+RangeSearchIterator::Emit(const std::pair<int64_t, float>& result,
+                          std::vector<std::pair<int64_t, float>>& batch) {
+    if (returned_ == 0 || result.second != frontier_) {
+        frontier_ = result.second;
+        frontier_offsets_.clear();
+    }
+    frontier_offsets_.insert(result.first);
+    batch.push_back(result);
+    ++returned_;
+}
+
+std::vector<std::pair<int64_t, float>>
+RangeSearchIterator::Next(int64_t batch_size) {
+    std::vector<std::pair<int64_t, float>> batch;
+    if (exhausted_ || batch_size <= 0) {
+        return batch;
+    }
+
+    if (!started_) {
+        started_ = true;
+        for (auto& result : Search(batch_size, std::nullopt)) {
+            Emit(result, batch);
+        }
+        if (batch.empty()) {
+            exhausted_ = true;
+            return batch;
+        }
+        width_ = std::max({std::abs(batch.back().second - batch[0].second),
+                           std::abs(frontier_) * kMinRelativeWidth,
+                           kMinWidth});
+        exhausted_ = returned_ >= max_count_;
+        return batch;
+    }
+
+    int empty_rounds = 0;
+    while (batch.size() < batch_size && !exhausted_) {
+        auto need = batch_size - static_cast<int64_t>(batch.size());
+        auto radius =
+            positively_related_ ? frontier_ - width_ : frontier_ + width_;
+        // the returned results at frontier may take some slots
+        auto topk = need + static_cast<int64_t>(frontier_offsets_.size());
+        auto results = Search(topk, radius);
+        bool truncated = results.size() == topk;
+
+        int64_t emitted = 0;
+        for (auto& result : results) {
+            if (emitted == need) {
+                break;
+            }
+            if (result.second == frontier_ &&
+                frontier_offsets_.count(result.first) > 0) {
+                continue;
+            }
+            Emit(result, batch);
+            ++emitted;
+        }
+
+        // results dropped from the frontier leave results in the band, then
+        // the next search starts again at the last emitted distance
+        if (!truncated && emitted < need) {
+            // the band is exhausted, the next one starts at its end
+            frontier_ = radius;
+            frontier_offsets_.clear();
+            if (emitted == 0) {
+                width_ *= 2;
+                exhausted_ = ++empty_rounds > kMaxEmptyRounds;
+            } else {
+                empty_rounds = 0;
+            }
+        }
+        exhausted_ = exhausted_ || returned_ >= max_count_;
+    }
+    return batch;
+}
+
+}  // namespace milvus::index
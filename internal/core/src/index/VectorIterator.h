@@ -0,0 +1,104 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/QueryInfo.h"
+#include "common/QueryResult.h"
+
+namespace milvus::index {
+
+// Yields the results of a single query from the most similar one, batch by
+// batch. The state is kept across calls, so paging through the results
+// doesn't search again for the ones already returned.
+class VectorIterator {
+ public:
+    virtual ~VectorIterator() = default;
+
+    virtual bool
+    HasNext() const = 0;
+
+    // return at most batch_size (offset, distance) pairs following the ones
+    // returned by previous calls, less than batch_size only if exhausted
+    virtual std::vector<std::pair<int64_t, float>>
+    Next(int64_t batch_size) = 0;
+};
+
+using VectorIteratorPtr = std::unique_ptr<VectorIterator>;
+
+// VectorIterator on top of a search function of a single query.
+// The first batch comes from a plain top-k search, the following ones from
+// range searches of a band starting at the distance of the last returned
+// result. The band is widened while it's empty, and results of a band are
+// truncated to the batch, so a batch costs about one range search once the
+// band width fits the density of the results.
+// Range search is inclusive at the starting side of the band, results at
+// exactly that distance are deduplicated by offset.
+class RangeSearchIterator : public VectorIterator {
+ public:
+    // return the results of the single query, search_info carries topk and
+    // radius/range_filter for range search
+    using SearchFunc =
+        std::function<std::unique_ptr<SearchResult>(const SearchInfo&)>;
+
+    // max_count is the number of rows not filtered out, no more results
+    // than it can be returned
+    RangeSearchIterator(const SearchInfo& search_info,
+                        int64_t max_count,
+                        SearchFunc search);
+
+    bool
+    HasNext() const override {
+        return !exhausted_;
+    }
+
+    std::vector<std::pair<int64_t, float>>
+    Next(int64_t batch_size) override;
+
+ private:
+    // valid results sorted from the most similar one
+    std::vector<std::pair<int64_t, float>>
+    Search(int64_t topk, std::optional<float> radius);
+
+    void
+    Emit(const std::pair<int64_t, float>& result,
+         std::vector<std::pair<int64_t, float>>& batch);
+
+ private:
+    SearchInfo search_info_;
+    SearchFunc search_;
+    bool positively_related_;
+    int64_t max_count_;
+
+    bool started_ = false;
+    bool exhausted_ = false;
+    int64_t returned_ = 0;
+    // distance of the last returned result, or the end of the last
+    // exhausted band
+    float frontier_ = 0;
+    float width_ = 0;
+    // returned offsets whose distance equals frontier_
+    std::unordered_set<int64_t> frontier_offsets_;
+};
+
+}  // namespace milvus::index
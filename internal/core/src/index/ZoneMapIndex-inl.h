@@ -0,0 +1,512 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "common/Slice.h"
+#include "common/Utils.h"
+#include "index/Meta.h"
+#include "index/Utils.h"
+
+namespace milvus::index {
+
+namespace zone_map {
+
+// the statistics of a block against a predicate: no row, some rows or all
+// the rows of the block may match
+enum class BlockMatch { None, Some, All };
+
+// All if all, otherwise None if none, otherwise Some
+inline BlockMatch
+Match(bool all, bool none) {
+    return all ? BlockMatch::All : none ? BlockMatch::None : BlockMatch::Some;
+}
+
+// bits of a Bloom filter per row of a block and probes per value, a false
+// positive rate of about 1%
+constexpr size_t kBloomBitsPerRow = 10;
+constexpr size_t kBloomProbes = 7;
+
+template <typename T>
+inline uint64_t
+HashValue(T value) {
+    if (value == T(0)) {
+        // -0.0 equals 0.0
+        value = T(0);
+    }
+    uint64_t h = 0;
+    memcpy(&h, &value, sizeof(T));
+    // the finalizer of splitmix64
+    h += 0x9e3779b97f4a7c15ULL;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+}
+
+// the bits probed for hash in a Bloom filter of num_bits, by double hashing
+template <typename Visit>
+inline bool
+ForEachProbe(uint64_t hash, size_t num_bits, Visit visit) {
+    auto h1 = hash;
+    auto h2 = (hash >> 32) | 1;
+    for (size_t i = 0; i < kBloomProbes; ++i) {
+        if (!visit((h1 + i * h2) % num_bits)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace zone_map
+
+template <typename T>
+inline ZoneMapIndex<T>::ZoneMapIndex(storage::FileManagerImplPtr file_manager)
+    : is_built_(false) {
+    if (file_manager != nullptr) {
+        file_manager_ = std::dynamic_pointer_cast<storage::MemFileManagerImpl>(
+            file_manager);
+    }
+}
+
+template <typename T>
+inline int64_t
+ZoneMapIndex<T>::block_rows(const Config& config) const {
+    auto value = GetIntParamFromConfig(
+        config, ZONE_MAP_BLOCK_ROWS, DEFAULT_ZONE_MAP_BLOCK_ROWS);
+    AssertInfo(value > 0,
+               fmt::format("{} must be positive", ZONE_MAP_BLOCK_ROWS));
+    return value;
+}
+
+template <typename T>
+inline bool
+ZoneMapIndex<T>::bloom_filter(const Config& config) const {
+    if (!config.contains(ZONE_MAP_BLOOM_FILTER)) {
+        return false;
+    }
+    auto& bloom = config.at(ZONE_MAP_BLOOM_FILTER);
+    if (bloom.is_string()) {
+        auto value = bloom.get<std::string>();
+        AssertInfo(value == "true" || value == "false",
+                   fmt::format("{} must be true or false, got {}",
+                               ZONE_MAP_BLOOM_FILTER,
+                               value));
+        return value == "true";
+    }
+    return bloom.get<bool>();
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::Build(const Config& config) {
+    if (is_built_)
+        return;
+    config_ = config;
+    auto insert_files =
+        GetValueFromConfig<std::vector<std::string>>(config, "insert_files");
+    AssertInfo(insert_files.has_value(),
+               "insert file paths is empty when build index");
+    auto field_datas =
+        file_manager_->CacheRawDataToMemory(insert_files.value());
+
+    int64_t total_num_rows = 0;
+    for (auto& data : field_datas) {
+        total_num_rows += data->get_num_rows();
+    }
+    if (total_num_rows == 0) {
+        throw std::invalid_argument("ZoneMapIndex cannot build null values!");
+    }
+
+    std::vector<T> values(total_num_rows);
+    size_t offset = 0;
+    for (auto& data : field_datas) {
+        auto slice_num = data->get_num_rows();
+        memcpy(values.data() + offset, data->Data(), slice_num * sizeof(T));
+        offset += slice_num;
+    }
+    BuildFromValues(
+        std::move(values), block_rows(config), bloom_filter(config));
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::Build(size_t n, const T* values) {
+    if (is_built_)
+        return;
+    if (n == 0) {
+        throw std::invalid_argument("ZoneMapIndex cannot build null values!");
+    }
+    BuildFromValues(std::vector<T>(values, values + n),
+                    block_rows(config_),
+                    bloom_filter(config_));
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::BuildFromValues(std::vector<T>&& values,
+                                 size_t block_rows,
+                                 bool bloom_filter) {
+    auto num_rows = values.size();
+    auto num_blocks = (num_rows + block_rows - 1) / block_rows;
+    auto bloom_words =
+        bloom_filter ? (block_rows * zone_map::kBloomBitsPerRow + 63) / 64 : 0;
+    values_buf_ = std::move(values);
+    mins_buf_.resize(num_blocks);
+    maxs_buf_.resize(num_blocks);
+    blooms_buf_.assign(num_blocks * bloom_words, 0);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        auto begin = block * block_rows;
+        auto end = std::min(begin + block_rows, num_rows);
+        auto min = values_buf_[begin];
+        auto max = values_buf_[begin];
+        bool has_nan = false;
+        for (auto i = begin; i < end; ++i) {
+            auto v = values_buf_[i];
+            has_nan |= v != v;
+            min = v < min ? v : min;
+            max = v > max ? v : max;
+        }
+        // every comparison with a NaN is false, a block of NaN statistics
+        // is neither pruned nor matched as a whole
+        mins_buf_[block] = has_nan ? std::numeric_limits<T>::quiet_NaN() : min;
+        maxs_buf_[block] = has_nan ? std::numeric_limits<T>::quiet_NaN() : max;
+
+        if (bloom_words > 0) {
+            auto bloom = blooms_buf_.data() + block * bloom_words;
+            auto set_bit = [&](size_t bit) {
+                bloom[bit / 64] |= uint64_t(1) << (bit % 64);
+                return true;
+            };
+            for (auto i = begin; i < end; ++i) {
+                zone_map::ForEachProbe(zone_map::HashValue(values_buf_[i]),
+                                       bloom_words * 64,
+                                       set_bit);
+            }
+        }
+    }
+    block_rows_ = block_rows;
+    bloom_words_ = bloom_words;
+    UseBuffers();
+    is_built_ = true;
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::UseBuffers() {
+    num_rows_ = values_buf_.size();
+    num_blocks_ = mins_buf_.size();
+    values_ = values_buf_.data();
+    mins_ = mins_buf_.data();
+    maxs_ = maxs_buf_.data();
+    blooms_ = blooms_buf_.data();
+    layout_.reset();
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::UseLayout(const uint8_t* data, size_t size) {
+    IndexLayoutReader reader(data, size);
+    // num_rows, block_rows and bloom_words
+    auto meta = reader.Section<uint64_t>(0, 3);
+    num_rows_ = meta[0];
+    block_rows_ = meta[1];
+    bloom_words_ = meta[2];
+    AssertInfo(block_rows_ > 0, "zone map index layout is corrupted");
+    num_blocks_ = (num_rows_ + block_rows_ - 1) / block_rows_;
+    values_ = reader.Section<T>(1, num_rows_);
+    mins_ = reader.Section<T>(2, num_blocks_);
+    maxs_ = reader.Section<T>(3, num_blocks_);
+    blooms_ = reader.Section<uint64_t>(4, num_blocks_ * bloom_words_);
+
+    values_buf_ = std::vector<T>();
+    mins_buf_ = std::vector<T>();
+    maxs_buf_ = std::vector<T>();
+    blooms_buf_ = std::vector<uint64_t>();
+}
+
+template <typename T>
+inline BinarySet
+ZoneMapIndex<T>::Serialize(const Config& config) {
+    AssertInfo(is_built_, "index has not been built");
+    uint64_t meta[3] = {num_rows_, block_rows_, bloom_words_};
+    IndexLayoutWriter writer;
+    writer.AddSection(meta, 3);
+    writer.AddSection(values_, num_rows_);
+    writer.AddSection(mins_, num_blocks_);
+    writer.AddSection(maxs_, num_blocks_);
+    writer.AddSection(blooms_, num_blocks_ * bloom_words_);
+    auto [layout, size] = writer.Serialize();
+
+    BinarySet res_set;
+    res_set.Append(ZONE_MAP_INDEX_LAYOUT, layout, size);
+
+    milvus::Disassemble(res_set);
+
+    return res_set;
+}
+
+template <typename T>
+inline BinarySet
+ZoneMapIndex<T>::Upload(const Config& config) {
+    auto binary_set = Serialize(config);
+    file_manager_->AddFile(binary_set);
+
+    auto remote_paths_to_size = file_manager_->GetRemotePathsToFileSize();
+    BinarySet ret;
+    for (auto& file : remote_paths_to_size) {
+        ret.Append(file.first, nullptr, file.second);
+    }
+
+    return ret;
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::Load(const BinarySet& index_binary, const Config& config) {
+    milvus::Assemble(const_cast<BinarySet&>(index_binary));
+    // in place, the layout is kept alive by the index
+    auto layout = index_binary.GetByName(ZONE_MAP_INDEX_LAYOUT);
+    AssertInfo(layout != nullptr, "zone map index layout not found");
+    UseLayout(layout->data.get(), layout->size);
+    layout_ = layout->data;
+    is_built_ = true;
+}
+
+template <typename T>
+inline void
+ZoneMapIndex<T>::Load(const Config& config) {
+    auto index_files =
+        GetValueFromConfig<std::vector<std::string>>(config, "index_files");
+    AssertInfo(index_files.has_value(),
+               "index file paths is empty when load zone map index");
+    if (config.contains(kMmapFilepath)) {
+        auto file = MmapIndexFile::Load(file_manager_.get(), config);
+        UseLayout(file->Data(), file->Size());
+        layout_ = file;
+        is_built_ = true;
+        return;
+    }
+
+    auto index_datas = file_manager_->LoadIndexToMemory(index_files.value());
+    AssembleIndexDatas(index_datas);
+    BinarySet binary_set;
+    for (auto& [key, data] : index_datas) {
+        auto size = data->Size();
+        // the buffer holds the field data, the layout is used in place
+        auto deleter = [data = data](uint8_t*) {};
+        auto buf = std::shared_ptr<uint8_t[]>(
+            (uint8_t*)const_cast<void*>(data->Data()), deleter);
+        binary_set.Append(key, buf, size);
+    }
+
+    Load(binary_set, config);
+}
+
+template <typename T>
+inline bool
+ZoneMapIndex<T>::BloomMayContain(size_t block, const T& value) const {
+    if (bloom_words_ == 0) {
+        return true;
+    }
+    auto bloom = blooms_ + block * bloom_words_;
+    return zone_map::ForEachProbe(
+        zone_map::HashValue(value), bloom_words_ * 64, [&](size_t bit) {
+            return (bloom[bit / 64] >> (bit % 64)) & 1;
+        });
+}
+
+template <typename T>
+template <typename BlockMatch, typename RowMatch>
+inline TargetBitmap
+ZoneMapIndex<T>::Filter(BlockMatch block_match, RowMatch row_match) const {
+    TargetBitmap bitset(num_rows_);
+    auto data = bitset.data();
+    for (size_t block = 0; block < num_blocks_; ++block) {
+        auto begin = block * block_rows_;
+        auto end = std::min(begin + block_rows_, num_rows_);
+        switch (block_match(mins_[block], maxs_[block])) {
+            case zone_map::BlockMatch::None:
+                break;
+            case zone_map::BlockMatch::All:
+                std::fill(data + begin, data + end, true);
+                break;
+            case zone_map::BlockMatch::Some:
+                for (auto i = begin; i < end; ++i) {
+                    data[i] = row_match(values_[i]);
+                }
+                break;
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+inline std::vector<T>
+ZoneMapIndex<T>::SortedTerms(size_t n, const T* values) {
+    // NaN matches no value
+    std::vector<T> terms;
+    terms.reserve(n);
+    std::copy_if(values, values + n, std::back_inserter(terms), [](T v) {
+        return v == v;
+    });
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+    return terms;
+}
+
+template <typename T>
+inline std::vector<size_t>
+ZoneMapIndex<T>::CandidateBlocks(const std::vector<T>& terms) const {
+    std::vector<size_t> candidates;
+    for (size_t block = 0; block < num_blocks_; ++block) {
+        if (mins_[block] != mins_[block]) {
+            // the statistics of a block holding a NaN prune nothing
+            candidates.push_back(block);
+            continue;
+        }
+        auto lo = std::lower_bound(terms.begin(), terms.end(), mins_[block]);
+        auto hi = std::upper_bound(lo, terms.end(), maxs_[block]);
+        auto candidate = std::any_of(lo, hi, [&](const T& term) {
+            return BloomMayContain(block, term);
+        });
+        if (candidate) {
+            candidates.push_back(block);
+        }
+    }
+    return candidates;
+}
+
+template <typename T>
+inline std::vector<size_t>
+ZoneMapIndex<T>::InCandidates(size_t n, const T* values) const {
+    return CandidateBlocks(SortedTerms(n, values));
+}
+
+template <typename T>
+inline const TargetBitmap
+ZoneMapIndex<T>::In(const size_t n, const T* values) {
+    AssertInfo(is_built_, "index has not been built");
+    auto terms = SortedTerms(n, values);
+    TargetBitmap bitset(num_rows_);
+    auto data = bitset.data();
+    for (auto block : CandidateBlocks(terms)) {
+        auto begin = block * block_rows_;
+        auto end = std::min(begin + block_rows_, num_rows_);
+        for (auto i = begin; i < end; ++i) {
+            // not binary_search, which takes a NaN as equal to any term
+            auto it =
+                std::lower_bound(terms.begin(), terms.end(), values_[i]);
+            data[i] = it != terms.end() && *it == values_[i];
+        }
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+ZoneMapIndex<T>::NotIn(const size_t n, const T* values) {
+    auto bitset = In(n, values);
+    auto data = bitset.data();
+    for (size_t i = 0; i < num_rows_; ++i) {
+        data[i] = !data[i];
+    }
+    return bitset;
+}
+
+template <typename T>
+inline const TargetBitmap
+ZoneMapIndex<T>::Range(const T value, const OpType op) {
+    AssertInfo(is_built_, "index has not been built");
+    switch (op) {
+        case OpType::LessThan:
+            return Filter(
+                [&](T min, T max) {
+                    return zone_map::Match(max < value, min >= value);
+                },
+                [&](T v) { return v < value; });
+        case OpType::LessEqual:
+            return Filter(
+                [&](T min, T max) {
+                    return zone_map::Match(max <= value, min > value);
+                },
+                [&](T v) { return v <= value; });
+        case OpType::GreaterThan:
+            return Filter(
+                [&](T min, T max) {
+                    return zone_map::Match(min > value, max <= value);
+                },
+                [&](T v) { return v > value; });
+        case OpType::GreaterEqual:
+            return Filter(
+                [&](T min, T max) {
+                    return zone_map::Match(min >= value, max < value);
+                },
+                [&](T v) { return v >= value; });
+        default:
+            throw std::invalid_argument(std::string("Invalid OperatorType: ") +
+                                        std::to_string((int)op) + "!");
+    }
+}
+
+template <typename T>
+inline const TargetBitmap
+ZoneMapIndex<T>::Range(T lower_bound_value,
+                       bool lb_inclusive,
+                       T upper_bound_value,
+                       bool ub_inclusive) {
+    AssertInfo(is_built_, "index has not been built");
+    if (lower_bound_value > upper_bound_value ||
+        (lower_bound_value == upper_bound_value &&
+         !(lb_inclusive && ub_inclusive))) {
+        return TargetBitmap(num_rows_);
+    }
+    auto above = [&](T v) {
+        return lb_inclusive ? v >= lower_bound_value : v > lower_bound_value;
+    };
+    auto below = [&](T v) {
+        return ub_inclusive ? v <= upper_bound_value : v < upper_bound_value;
+    };
+    return Filter(
+        [&](T min, T max) {
+            // the range is convex, the block is in it when its bounds are
+            auto before = lb_inclusive ? max < lower_bound_value
+                                       : max <= lower_bound_value;
+            auto after = ub_inclusive ? min > upper_bound_value
+                                      : min >= upper_bound_value;
+            return zone_map::Match(above(min) && below(max), before || after);
+        },
+        [&](T v) { return above(v) && below(v); });
+}
+
+template <typename T>
+inline T
+ZoneMapIndex<T>::Reverse_Lookup(size_t offset) const {
+    AssertInfo(offset < num_rows_, "out of range of total count");
+    AssertInfo(is_built_, "index has not been built");
+    return values_[offset];
+}
+
+}  // namespace milvus::index
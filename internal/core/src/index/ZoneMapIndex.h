@@ -0,0 +1,197 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "index/IndexLayout.h"
+#include "index/ScalarIndex.h"
+#include "storage/MemFileManagerImpl.h"
+
+namespace milvus::index {
+
+// ZoneMapIndex is a sparse index of a numeric field of a sealed segment. It
+// keeps the raw column in row order, split into blocks of rows with the min
+// and max of every block and, optionally, a Bloom filter of every block.
+// Range and In take the blocks whose statistics may match as candidates and
+// verify their rows against the raw column; the blocks entirely in a range
+// match without a check. It costs little more than the raw column and suits
+// high cardinality fields whose rows are clustered by value, such as the
+// fields growing with the insert time. The Bloom filters prune the blocks of
+// In whether the rows are clustered or not.
+template <typename T>
+class ZoneMapIndex : public ScalarIndex<T> {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                  "ZoneMapIndex only supports numeric fields");
+
+ public:
+    explicit ZoneMapIndex(storage::FileManagerImplPtr file_manager = nullptr);
+
+    // the block rows and the Bloom filters come from config
+    void
+    BuildWithRawData(size_t n,
+                     const void* values,
+                     const Config& config = {}) override {
+        config_ = config;
+        ScalarIndex<T>::BuildWithRawData(n, values, config);
+    }
+
+    BinarySet
+    Serialize(const Config& config) override;
+
+    void
+    Load(const BinarySet& index_binary, const Config& config = {}) override;
+
+    void
+    Load(const Config& config = {}) override;
+
+    int64_t
+    Count() override {
+        return num_rows_;
+    }
+
+    void
+    Build(size_t n, const T* values) override;
+
+    void
+    Build(const Config& config = {}) override;
+
+    const TargetBitmap
+    In(size_t n, const T* values) override;
+
+    const TargetBitmap
+    NotIn(size_t n, const T* values) override;
+
+    const TargetBitmap
+    Range(T value, OpType op) override;
+
+    const TargetBitmap
+    Range(T lower_bound_value,
+          bool lb_inclusive,
+          T upper_bound_value,
+          bool ub_inclusive) override;
+
+    T
+    Reverse_Lookup(size_t offset) const override;
+
+    int64_t
+    Size() override {
+        return num_rows_;
+    }
+
+    BinarySet
+    Upload(const Config& config = {}) override;
+
+    bool
+    IsMmapSupported() const override {
+        return true;
+    }
+
+ public:
+    size_t
+    NumBlocks() const {
+        return num_blocks_;
+    }
+
+    bool
+    HasBloomFilter() const {
+        return bloom_words_ > 0;
+    }
+
+    // the blocks which may hold rows of the values, sorted
+    std::vector<size_t>
+    InCandidates(size_t n, const T* values) const;
+
+ private:
+    int64_t
+    block_rows(const Config& config) const;
+
+    bool
+    bloom_filter(const Config& config) const;
+
+    // split the values into blocks and compute their statistics
+    void
+    BuildFromValues(std::vector<T>&& values,
+                    size_t block_rows,
+                    bool bloom_filter);
+
+    // point the arrays at the vectors of a build
+    void
+    UseBuffers();
+
+    // point the arrays at a serialized layout
+    void
+    UseLayout(const uint8_t* data, size_t size);
+
+    // the values without NaN, sorted and distinct
+    static std::vector<T>
+    SortedTerms(size_t n, const T* values);
+
+    // the blocks which may hold rows of the sorted terms
+    std::vector<size_t>
+    CandidateBlocks(const std::vector<T>& terms) const;
+
+    // whether the Bloom filter of block may contain value
+    bool
+    BloomMayContain(size_t block, const T& value) const;
+
+    // the rows of the blocks where block_match is All, and the rows
+    // satisfying row_match of those where it is Some
+    template <typename BlockMatch, typename RowMatch>
+    TargetBitmap
+    Filter(BlockMatch block_match, RowMatch row_match) const;
+
+ private:
+    bool is_built_;
+    Config config_;
+    // the arrays of the index, in the vectors below or in the serialized
+    // layout held by layout_
+    size_t num_rows_ = 0;
+    size_t block_rows_ = 0;
+    size_t num_blocks_ = 0;
+    size_t bloom_words_ = 0;            // 64 bit words of a Bloom filter
+    const T* values_ = nullptr;         // raw column in row order
+    const T* mins_ = nullptr;           // min of every block
+    const T* maxs_ = nullptr;           // max of every block
+    const uint64_t* blooms_ = nullptr;  // bloom_words_ of every block
+
+    std::vector<T> values_buf_;
+    std::vector<T> mins_buf_;
+    std::vector<T> maxs_buf_;
+    std::vector<uint64_t> blooms_buf_;
+    // a loaded layout or a mapped file
+    std::shared_ptr<const void> layout_;
+    std::shared_ptr<storage::MemFileManagerImpl> file_manager_;
+};
+
+template <typename T>
+using ZoneMapIndexPtr = std::unique_ptr<ZoneMapIndex<T>>;
+
+}  // namespace milvus::index
+
+#include "index/ZoneMapIndex-inl.h"
+
+namespace milvus::index {
+template <typename T>
+inline ZoneMapIndexPtr<T>
+CreateZoneMapIndex(storage::FileManagerImplPtr file_manager = nullptr) {
+    return std::make_unique<ZoneMapIndex<T>>(file_manager);
+}
+}  // namespace milvus::index
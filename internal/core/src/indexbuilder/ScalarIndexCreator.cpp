@@ -35,7 +35,7 @@ void
 ScalarIndexCreator::Build(const milvus::DatasetPtr& dataset) {
     auto size = dataset->GetRows();
     auto data = dataset->GetTensor();
-    index_->BuildWithRawData(size, data);
+    index_->BuildWithRawData(size, data, config_);
 }
 
 void
@@ -55,8 +55,9 @@ ScalarIndexCreator::Load(const milvus::BinarySet& binary_set) {
 
 std::string
 ScalarIndexCreator::index_type() {
-    // TODO
-    return "sort";
+    auto index_type =
+        index::GetValueFromConfig<std::string>(config_, index::INDEX_TYPE);
+    return index_type.value_or("sort");
 }
 
 BinarySet
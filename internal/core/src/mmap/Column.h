@@ -20,6 +20,7 @@
 #include <cstddef>
 #include <cstring>
 #include <filesystem>
+#include <limits>
 
 #include "common/FieldMeta.h"
 #include "common/Span.h"
@@ -61,7 +62,16 @@ class ColumnBase {
     }
 
     // mmap mode ctor
-    ColumnBase(const File& file, size_t size, const FieldMeta& field_meta) {
+    ColumnBase(const File& file, size_t size, const FieldMeta& field_meta)
+        : ColumnBase(file, 0, size, field_meta) {
+    }
+
+    // mmap mode ctor, maps size bytes from offset of the file,
+    // offset must be page aligned
+    ColumnBase(const File& file,
+               size_t offset,
+               size_t size,
+               const FieldMeta& field_meta) {
         padding_ = field_meta.get_data_type() == DataType::JSON
                        ? simdjson::SIMDJSON_PADDING
                        : 0;
@@ -73,7 +83,11 @@ class ColumnBase {
                                         PROT_READ,
                                         mmap_flags,
                                         file.Descriptor(),
-                                        0));
+                                        offset));
+        AssertInfo(data_ != MAP_FAILED,
+                   fmt::format("failed to map file at offset {}, err: {}",
+                               offset,
+                               strerror(errno)));
     }
 
     virtual ~ColumnBase() {
@@ -121,6 +135,9 @@ class ColumnBase {
     }
 
  protected:
+    // for the columns keeping no raw data until asked
+    ColumnBase() = default;
+
     // only for memory mode, not mmap
     void
     Expand(size_t size) {
@@ -169,6 +186,14 @@ class Column : public ColumnBase {
           num_rows_(size / field_meta.get_sizeof()) {
     }
 
+    Column(const File& file,
+           size_t offset,
+           size_t size,
+           const FieldMeta& field_meta)
+        : ColumnBase(file, offset, size, field_meta),
+          num_rows_(size / field_meta.get_sizeof()) {
+    }
+
     Column(Column&& column) noexcept
         : ColumnBase(std::move(column)), num_rows_(column.num_rows_) {
         column.num_rows_ = 0;
@@ -206,44 +231,59 @@ class VariableColumn : public ColumnBase {
         : ColumnBase(file, size, field_meta) {
     }
 
+    VariableColumn(const File& file,
+                   size_t offset,
+                   size_t size,
+                   const FieldMeta& field_meta)
+        : ColumnBase(file, offset, size, field_meta) {
+    }
+
     VariableColumn(VariableColumn&& column) noexcept
         : ColumnBase(std::move(column)),
+          num_rows_(column.num_rows_),
           indices_(std::move(column.indices_)),
-          views_(std::move(column.views_)) {
+          offsets32_(std::move(column.offsets32_)),
+          offsets64_(std::move(column.offsets64_)),
+          offset_sizeof_(column.offset_sizeof_) {
+        column.num_rows_ = 0;
     }
 
     ~VariableColumn() override = default;
 
     size_t
     NumRows() const override {
-        return indices_.size();
+        return num_rows_;
     }
 
     SpanBase
     Span() const override {
-        return SpanBase(views_.data(), views_.size(), sizeof(ViewType));
-    }
-
-    [[nodiscard]] const std::vector<ViewType>&
-    Views() const {
-        return views_;
+        return offset_sizeof_ == sizeof(uint32_t)
+                   ? SpanBase(data_,
+                              offsets32_.data(),
+                              sizeof(uint32_t),
+                              num_rows_)
+                   : SpanBase(data_,
+                              offsets64_.data(),
+                              sizeof(uint64_t),
+                              num_rows_);
     }
 
     ViewType
     operator[](const int i) const {
-        return views_[i];
+        auto begin = Offset(i);
+        return ViewType(data_ + begin, Offset(i + 1) - begin);
     }
 
     std::string_view
     RawAt(const int i) const {
-        size_t len = (i == indices_.size() - 1) ? len_ - indices_.back()
-                                                : indices_[i + 1] - indices_[i];
-        return std::string_view(data_ + indices_[i], len);
+        auto begin = Offset(i);
+        return std::string_view(data_ + begin, Offset(i + 1) - begin);
     }
 
     void
     Append(const char* data, size_t size) {
         indices_.emplace_back(len_);
+        ++num_rows_;
         ColumnBase::Append(data, size);
     }
 
@@ -252,24 +292,42 @@ class VariableColumn : public ColumnBase {
         if (!indices.empty()) {
             indices_ = std::move(indices);
         }
-        ConstructViews();
+        ConstructOffsets();
     }
 
  protected:
+    // the offsets of the rows followed by the end of the data, kept in 32
+    // bits unless the data is larger than 4GB
     void
-    ConstructViews() {
-        views_.reserve(indices_.size());
-        for (size_t i = 0; i < indices_.size() - 1; i++) {
-            views_.emplace_back(data_ + indices_[i],
-                                indices_[i + 1] - indices_[i]);
+    ConstructOffsets() {
+        num_rows_ = indices_.size();
+        if (len_ <= std::numeric_limits<uint32_t>::max()) {
+            offset_sizeof_ = sizeof(uint32_t);
+            offsets32_.reserve(num_rows_ + 1);
+            offsets32_.assign(indices_.begin(), indices_.end());
+            offsets32_.push_back(len_);
+        } else {
+            offset_sizeof_ = sizeof(uint64_t);
+            offsets64_ = std::move(indices_);
+            offsets64_.push_back(len_);
         }
-        views_.emplace_back(data_ + indices_.back(), len_ - indices_.back());
+        std::vector<uint64_t>().swap(indices_);
+    }
+
+    size_t
+    Offset(size_t i) const {
+        return offset_sizeof_ == sizeof(uint32_t) ? offsets32_[i]
+                                                  : offsets64_[i];
     }
 
  private:
+    size_t num_rows_{0};
+
+    // build only
     std::vector<uint64_t> indices_{};
 
-    // Compatible with current Span type
-    std::vector<ViewType> views_{};
+    std::vector<uint32_t> offsets32_{};
+    std::vector<uint64_t> offsets64_{};
+    size_t offset_sizeof_{0};
 };
 }  // namespace milvus
@@ -0,0 +1,373 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/FieldMeta.h"
+#include "exceptions/EasyAssert.h"
+#include "fmt/core.h"
+#include "mmap/Column.h"
+#include "mmap/Utils.h"
+#include "utils/File.h"
+
+namespace milvus {
+
+// A column file keeps a sealed column in the layout it's mapped with, so a
+// later load of the segment maps it directly instead of downloading and
+// decoding the binlogs again:
+//
+//   [header][data][padding][offsets of the rows]
+//
+// The header takes the first page, the data and the offsets of the rows
+// start at page boundaries, the offsets only exist for variable length
+// types. The data is followed by the padding simdjson needs to read JSON.
+//
+// A column which isn't kept is written without the header and the offsets,
+// its data at offset 0, and the file is unlinked once mapped.
+constexpr size_t kColumnFilePageSize = BufferedWriter::kAlignment;
+constexpr const char* kColumnFileExtension = ".col";
+constexpr uint64_t kColumnFileMagic = 0x4c4f4353564c494dULL;  // "MILVSCOL"
+constexpr uint32_t kColumnFileVersion = 1;
+
+struct ColumnFileHeader {
+    uint64_t magic;
+    uint32_t version;
+    int32_t data_type;
+    // fingerprint of the binlogs the column is built from
+    uint64_t fingerprint;
+    uint64_t num_rows;
+    uint64_t data_size;
+    // 0 for fixed width types
+    uint64_t offsets_offset;
+    // zone map, min and max of the numeric types
+    uint8_t has_zone_map;
+    int64_t min_int;
+    int64_t max_int;
+    double min_float;
+    double max_float;
+};
+static_assert(sizeof(ColumnFileHeader) <= kColumnFilePageSize);
+
+inline size_t
+AlignToColumnFilePage(size_t size) {
+    return (size + kColumnFilePageSize - 1) / kColumnFilePageSize *
+           kColumnFilePageSize;
+}
+
+// the page size of the system, tests override it
+inline size_t&
+SystemPageSize() {
+    static size_t page_size = sysconf(_SC_PAGESIZE);
+    return page_size;
+}
+
+// column files are mapped at page offsets, only usable when the page size
+// of the system divides the one of the layout
+inline bool
+ColumnFileSupported() {
+    return kColumnFilePageSize % SystemPageSize() == 0;
+}
+
+// fingerprint of the binlogs of a field, binlog paths are unique and the
+// binlogs never change, so a column file with the same fingerprint holds
+// the same data. 0 means no binlogs, such a column file is never reused
+inline uint64_t
+ColumnFileFingerprint(std::vector<std::string> insert_files) {
+    if (insert_files.empty()) {
+        return 0;
+    }
+    std::sort(insert_files.begin(), insert_files.end());
+    // FNV-1a, stable across builds unlike std::hash
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (auto& file : insert_files) {
+        for (unsigned char c : file) {
+            hash = (hash ^ c) * 0x100000001b3ULL;
+        }
+        hash = (hash ^ '\n') * 0x100000001b3ULL;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+class ColumnFileWriter {
+ public:
+    // without the header, only the data is written, at offset 0
+    ColumnFileWriter(File& file,
+                     DataType data_type,
+                     uint64_t fingerprint,
+                     bool with_header = true)
+        : file_(file),
+          writer_(file),
+          data_type_(data_type),
+          data_offset_(with_header ? kColumnFilePageSize : 0) {
+        std::memset(&header_, 0, sizeof(header_));
+        header_.magic = kColumnFileMagic;
+        header_.version = kColumnFileVersion;
+        header_.data_type = static_cast<int32_t>(data_type);
+        header_.fingerprint = fingerprint;
+        header_.min_int = std::numeric_limits<int64_t>::max();
+        header_.max_int = std::numeric_limits<int64_t>::min();
+        header_.min_float = std::numeric_limits<double>::infinity();
+        header_.max_float = -std::numeric_limits<double>::infinity();
+        WritePadding(data_offset_);
+    }
+
+    void
+    Write(const storage::FieldDataPtr& data) {
+        switch (data_type_) {
+            case DataType::INT8:
+                UpdateZoneMap<int8_t>(data);
+                break;
+            case DataType::INT16:
+                UpdateZoneMap<int16_t>(data);
+                break;
+            case DataType::INT32:
+                UpdateZoneMap<int32_t>(data);
+                break;
+            case DataType::INT64:
+                UpdateZoneMap<int64_t>(data);
+                break;
+            case DataType::FLOAT:
+                UpdateZoneMap<float>(data);
+                break;
+            case DataType::DOUBLE:
+                UpdateZoneMap<double>(data);
+                break;
+            default:
+                break;
+        }
+        WriteFieldData(writer_, data_type_, data, indices_);
+        header_.num_rows += data->get_num_rows();
+    }
+
+    // write the offsets and the header, the file is synced when returned
+    const ColumnFileHeader&
+    Finish() {
+        header_.data_size = writer_.Offset() - data_offset_;
+        if (data_offset_ == 0) {
+            writer_.Flush();
+            return header_;
+        }
+        auto end = writer_.Offset() + (datatype_is_variable(data_type_)
+                                           ? simdjson::SIMDJSON_PADDING
+                                           : 0);
+        WritePadding(AlignToColumnFilePage(end) - writer_.Offset());
+        if (datatype_is_variable(data_type_)) {
+            header_.offsets_offset = writer_.Offset();
+            writer_.Write(indices_.data(), indices_.size() * sizeof(uint64_t));
+        }
+        writer_.Flush();
+
+        auto written =
+            pwrite(file_.Descriptor(), &header_, sizeof(header_), 0);
+        AssertInfo(written == static_cast<ssize_t>(sizeof(header_)),
+                   fmt::format("failed to write column file header: {}",
+                               strerror(errno)));
+        AssertInfo(fdatasync(file_.Descriptor()) == 0,
+                   fmt::format("failed to sync column file: {}",
+                               strerror(errno)));
+        return header_;
+    }
+
+    // the offsets of the rows of variable length types
+    std::vector<uint64_t>
+    TakeIndices() {
+        return std::move(indices_);
+    }
+
+    size_t
+    DataOffset() const {
+        return data_offset_;
+    }
+
+ private:
+    template <typename T>
+    void
+    UpdateZoneMap(const storage::FieldDataPtr& data) {
+        auto values = static_cast<const T*>(data->Data());
+        auto num_rows = data->get_num_rows();
+        if (num_rows == 0) {
+            return;
+        }
+        auto [min, max] = std::minmax_element(values, values + num_rows);
+        header_.has_zone_map = 1;
+        if constexpr (std::is_integral_v<T>) {
+            header_.min_int = std::min<int64_t>(header_.min_int, *min);
+            header_.max_int = std::max<int64_t>(header_.max_int, *max);
+        } else {
+            header_.min_float = std::min<double>(header_.min_float, *min);
+            header_.max_float = std::max<double>(header_.max_float, *max);
+        }
+    }
+
+    void
+    WritePadding(size_t size) {
+        static const std::vector<char> zeros(kColumnFilePageSize, 0);
+        while (size > 0) {
+            auto n = std::min(size, zeros.size());
+            writer_.Write(zeros.data(), n);
+            size -= n;
+        }
+    }
+
+    File& file_;
+    BufferedWriter writer_;
+    DataType data_type_;
+    size_t data_offset_;
+    ColumnFileHeader header_;
+    std::vector<uint64_t> indices_;
+};
+
+// read the header of a column file, nullopt if the file isn't a complete
+// column file of the given binlogs
+inline std::optional<ColumnFileHeader>
+ReadColumnFileHeader(const File& file,
+                     DataType data_type,
+                     uint64_t fingerprint,
+                     size_t num_rows) {
+    ColumnFileHeader header;
+    auto n = pread(file.Descriptor(), &header, sizeof(header), 0);
+    if (n != static_cast<ssize_t>(sizeof(header)) ||
+        header.magic != kColumnFileMagic ||
+        header.version != kColumnFileVersion ||
+        header.data_type != static_cast<int32_t>(data_type) ||
+        fingerprint == 0 || header.fingerprint != fingerprint ||
+        header.num_rows != num_rows) {
+        return std::nullopt;
+    }
+
+    struct stat st;
+    if (fstat(file.Descriptor(), &st) != 0) {
+        return std::nullopt;
+    }
+    uint64_t expected_size = kColumnFilePageSize + header.data_size;
+    if (datatype_is_variable(data_type)) {
+        if (header.offsets_offset < expected_size) {
+            return std::nullopt;
+        }
+        expected_size =
+            header.offsets_offset + header.num_rows * sizeof(uint64_t);
+    }
+    if (static_cast<uint64_t>(st.st_size) < expected_size) {
+        return std::nullopt;
+    }
+    return header;
+}
+
+// map the column of a column file, the offsets of the rows are read from the
+// file if not given
+inline std::shared_ptr<ColumnBase>
+MapColumnFile(const File& file,
+              const ColumnFileHeader& header,
+              const FieldMeta& field_meta,
+              std::vector<uint64_t> indices = {},
+              size_t data_offset = kColumnFilePageSize) {
+    auto data_type = field_meta.get_data_type();
+    if (!datatype_is_variable(data_type)) {
+        return std::make_shared<Column>(
+            file, data_offset, header.data_size, field_meta);
+    }
+
+    if (indices.empty() && header.num_rows > 0) {
+        indices.resize(header.num_rows);
+        auto size = header.num_rows * sizeof(uint64_t);
+        auto n = pread(
+            file.Descriptor(), indices.data(), size, header.offsets_offset);
+        AssertInfo(n == static_cast<ssize_t>(size),
+                   fmt::format("failed to read the offsets of column file: {}",
+                               strerror(errno)));
+    }
+    switch (data_type) {
+        case DataType::STRING:
+        case DataType::VARCHAR: {
+            auto column = std::make_shared<VariableColumn<std::string>>(
+                file, data_offset, header.data_size, field_meta);
+            column->Seal(std::move(indices));
+            return column;
+        }
+        case DataType::JSON: {
+            auto column = std::make_shared<VariableColumn<milvus::Json>>(
+                file, data_offset, header.data_size, field_meta);
+            column->Seal(std::move(indices));
+            return column;
+        }
+        default:
+            PanicInfo(fmt::format("not supported data type {}",
+                                  datatype_name(data_type)));
+    }
+}
+
+// remove the column files under mmap_dir, the least recently used first,
+// until they take no more than capacity bytes. A mapped column outlives its
+// file, removing the file only drops it from the cache
+inline void
+GcColumnFiles(const std::filesystem::path& mmap_dir, int64_t capacity) {
+    namespace fs = std::filesystem;
+    struct Entry {
+        fs::file_time_type time;
+        uintmax_t size;
+        fs::path path;
+    };
+    std::vector<Entry> entries;
+    uintmax_t total = 0;
+    std::error_code ec;
+    for (auto& segment_dir : fs::directory_iterator(mmap_dir, ec)) {
+        if (!segment_dir.is_directory(ec)) {
+            continue;
+        }
+        for (auto& entry : fs::directory_iterator(segment_dir.path(), ec)) {
+            if (!entry.is_regular_file(ec) ||
+                entry.path().extension() != kColumnFileExtension) {
+                continue;
+            }
+            auto size = entry.file_size(ec);
+            auto time = entry.last_write_time(ec);
+            if (ec) {
+                continue;
+            }
+            entries.push_back({time, size, entry.path()});
+            total += size;
+        }
+    }
+    if (total <= static_cast<uintmax_t>(capacity)) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](auto& a, auto& b) {
+        return a.time < b.time;
+    });
+    for (auto& entry : entries) {
+        if (total <= static_cast<uintmax_t>(capacity)) {
+            break;
+        }
+        if (fs::remove(entry.path, ec)) {
+            total -= entry.size;
+            // the segment dir is only removed once empty
+            fs::remove(entry.path.parent_path(), ec);
+        }
+    }
+}
+
+}  // namespace milvus
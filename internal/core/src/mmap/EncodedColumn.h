@@ -0,0 +1,760 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "common/BitPacking.h"
+#include "common/Consts.h"
+#include "common/FieldMeta.h"
+#include "common/Types.h"
+#include "exceptions/EasyAssert.h"
+#include "mmap/Column.h"
+
+namespace milvus {
+
+enum class ColumnEncoding {
+    // offsets from the min value, bit packed
+    FrameOfReference,
+    // non-decreasing values, the value at the start of each block and the
+    // bit packed differences between neighbours
+    Delta,
+    // sorted distinct values, and the bit packed codes of the rows
+    Dictionary,
+};
+
+// the codes of the rows of an encoded column, bit packed
+class PackedCodes {
+ public:
+    PackedCodes() = default;
+
+    PackedCodes(const std::vector<uint64_t>& codes, int width)
+        : num_rows_(codes.size()),
+          width_(width),
+          packed_(BitPack(codes.data(), codes.size(), width)) {
+    }
+
+    size_t
+    Size() const {
+        return packed_.size() * sizeof(uint64_t);
+    }
+
+    uint64_t
+    operator[](size_t i) const {
+        return BitUnpackOne(packed_.data(), width_, i);
+    }
+
+    void
+    UnpackBlock(size_t block, uint64_t* codes) const {
+        GetUnpackBlockFunc(width_)(packed_.data() + block * width_, codes);
+    }
+
+    // call func(first row, codes, number of rows) on each block
+    template <typename Func>
+    void
+    ForEachBlock(Func&& func) const {
+        auto unpack = GetUnpackBlockFunc(width_);
+        uint64_t codes[kBitPackBlockSize];
+        for (size_t begin = 0; begin < num_rows_; begin += kBitPackBlockSize) {
+            unpack(packed_.data() + begin / kBitPackBlockSize * width_, codes);
+            func(begin, codes, std::min(kBitPackBlockSize, num_rows_ - begin));
+        }
+    }
+
+    // rows of lower <= code <= upper
+    void
+    Match(TargetBitmap& res, uint64_t lower, uint64_t upper) const {
+        auto span = upper - lower;
+        ForEachBlock([&](size_t begin, const uint64_t* codes, size_t len) {
+            auto out = res.data() + begin;
+            for (size_t j = 0; j < len; ++j) {
+                out[j] = codes[j] - lower <= span;
+            }
+        });
+    }
+
+    // rows of a code hit
+    void
+    Match(TargetBitmap& res, const std::vector<uint8_t>& hit) const {
+        ForEachBlock([&](size_t begin, const uint64_t* codes, size_t len) {
+            auto out = res.data() + begin;
+            for (size_t j = 0; j < len; ++j) {
+                out[j] = hit[codes[j]];
+            }
+        });
+    }
+
+ private:
+    size_t num_rows_{0};
+    int width_{0};
+    std::vector<uint64_t> packed_;
+};
+
+class EncodedColumnBase : public ColumnBase {
+ public:
+    virtual ColumnEncoding
+    Encoding() const = 0;
+
+    // bytes taken by the encoded column, without the decoded copy
+    virtual size_t
+    EncodedSize() const = 0;
+
+    // bytes of the raw copy Span() builds and keeps, 0 until it's called
+    size_t
+    DecodedSize() const {
+        return decoded_size_.load();
+    }
+
+ protected:
+    mutable std::atomic<size_t> decoded_size_{0};
+};
+
+// EncodedColumn keeps an integer column of a sealed segment compressed. Range
+// and term predicates are evaluated on the encoded data a block of 64 rows at
+// a time, and single rows are decoded for the output. Span() is only for the
+// consumers that need the raw values, it decodes the whole column once and
+// keeps the copy, counted by DecodedSize().
+template <typename T>
+class EncodedColumn : public EncodedColumnBase {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+
+ public:
+    // the column is only encoded if that takes at most this ratio of the raw
+    // size, as it costs some CPU to filter and decode
+    static constexpr double kMaxEncodedRatio = 0.75;
+    static constexpr size_t kMaxDictionarySize = 1 << 16;
+
+    // encode the values with the encoding taking the least memory,
+    // nullptr if no encoding is worth it
+    static std::shared_ptr<EncodedColumn<T>>
+    Encode(const T* values, size_t num_rows) {
+        if (num_rows == 0) {
+            return nullptr;
+        }
+
+        auto [min_it, max_it] = std::minmax_element(values, values + num_rows);
+        T min = *min_it;
+        T max = *max_it;
+        bool sorted = true;
+        uint64_t max_delta = 0;
+        for (size_t i = 1; i < num_rows; ++i) {
+            if (values[i] < values[i - 1]) {
+                sorted = false;
+                break;
+            }
+            max_delta = std::max(max_delta, Diff(values[i], values[i - 1]));
+        }
+        std::unordered_set<T> distinct;
+        for (size_t i = 0; i < num_rows; ++i) {
+            distinct.insert(values[i]);
+            if (distinct.size() > kMaxDictionarySize) {
+                break;
+            }
+        }
+
+        auto num_blocks =
+            (num_rows + kBitPackBlockSize - 1) / kBitPackBlockSize;
+        auto for_width = BitWidth(Diff(max, min));
+        size_t best_size = BitPackedWords(num_rows, for_width) * 8;
+        auto best = ColumnEncoding::FrameOfReference;
+        if (sorted) {
+            auto size = BitPackedWords(num_rows, BitWidth(max_delta)) * 8 +
+                        num_blocks * sizeof(T);
+            if (size < best_size) {
+                best_size = size;
+                best = ColumnEncoding::Delta;
+            }
+        }
+        if (distinct.size() <= kMaxDictionarySize) {
+            auto size =
+                BitPackedWords(num_rows, BitWidth(distinct.size() - 1)) * 8 +
+                distinct.size() * sizeof(T);
+            if (size < best_size) {
+                best_size = size;
+                best = ColumnEncoding::Dictionary;
+            }
+        }
+        if (best_size > kMaxEncodedRatio * num_rows * sizeof(T)) {
+            return nullptr;
+        }
+
+        auto column = std::shared_ptr<EncodedColumn<T>>(new EncodedColumn<T>());
+        column->encoding_ = best;
+        column->num_rows_ = num_rows;
+        column->min_ = min;
+        column->max_ = max;
+        std::vector<uint64_t> codes(num_rows);
+        int width = 0;
+        switch (best) {
+            case ColumnEncoding::FrameOfReference: {
+                for (size_t i = 0; i < num_rows; ++i) {
+                    codes[i] = Diff(values[i], min);
+                }
+                width = for_width;
+                break;
+            }
+            case ColumnEncoding::Delta: {
+                column->block_bases_.resize(num_blocks);
+                for (size_t i = 0; i < num_rows; ++i) {
+                    if (i % kBitPackBlockSize == 0) {
+                        column->block_bases_[i / kBitPackBlockSize] = values[i];
+                        codes[i] = 0;
+                    } else {
+                        codes[i] = Diff(values[i], values[i - 1]);
+                    }
+                }
+                width = BitWidth(max_delta);
+                break;
+            }
+            case ColumnEncoding::Dictionary: {
+                column->dictionary_.assign(distinct.begin(), distinct.end());
+                auto& dict = column->dictionary_;
+                std::sort(dict.begin(), dict.end());
+                for (size_t i = 0; i < num_rows; ++i) {
+                    codes[i] = std::lower_bound(
+                                   dict.begin(), dict.end(), values[i]) -
+                               dict.begin();
+                }
+                width = BitWidth(dict.size() - 1);
+                break;
+            }
+        }
+        column->codes_ = PackedCodes(codes, width);
+        return column;
+    }
+
+    size_t
+    NumRows() const override {
+        return num_rows_;
+    }
+
+    SpanBase
+    Span() const override {
+        std::call_once(decoded_, [this]() {
+            auto self = const_cast<EncodedColumn<T>*>(this);
+            self->Expand(num_rows_ * sizeof(T));
+            Decode(reinterpret_cast<T*>(self->data_));
+            self->len_ = num_rows_ * sizeof(T);
+            decoded_size_ = num_rows_ * sizeof(T);
+        });
+        return SpanBase(data_, num_rows_, sizeof(T));
+    }
+
+    ColumnEncoding
+    Encoding() const override {
+        return encoding_;
+    }
+
+    size_t
+    EncodedSize() const override {
+        return codes_.Size() + block_bases_.size() * sizeof(T) +
+               dictionary_.size() * sizeof(T);
+    }
+
+    T
+    ValueAt(size_t i) const {
+        switch (encoding_) {
+            case ColumnEncoding::FrameOfReference:
+                return Add(min_, codes_[i]);
+            case ColumnEncoding::Dictionary:
+                return dictionary_[codes_[i]];
+            case ColumnEncoding::Delta: {
+                auto block = i / kBitPackBlockSize;
+                T value = block_bases_[block];
+                for (auto j = block * kBitPackBlockSize + 1; j <= i; ++j) {
+                    value = Add(value, codes_[j]);
+                }
+                return value;
+            }
+        }
+        PanicInfo("unknown column encoding");
+    }
+
+    // decode the rows at the offsets, skips INVALID_SEG_OFFSET
+    void
+    BulkValueAt(const int64_t* seg_offsets, int64_t count, T* dst) const {
+        for (int64_t i = 0; i < count; ++i) {
+            auto offset = seg_offsets[i];
+            if (offset != INVALID_SEG_OFFSET) {
+                dst[i] = ValueAt(offset);
+            }
+        }
+    }
+
+    void
+    Decode(T* out) const {
+        codes_.ForEachBlock(
+            [&](size_t begin, const uint64_t* codes, size_t len) {
+                DecodeBlock(begin, codes, len, out + begin);
+            });
+    }
+
+    // rows of lower <= value <= upper
+    TargetBitmap
+    InRange(T lower, T upper) const {
+        TargetBitmap res(num_rows_, false);
+        if (lower > upper || upper < min_ || lower > max_) {
+            return res;
+        }
+        lower = std::max(lower, min_);
+        upper = std::min(upper, max_);
+
+        switch (encoding_) {
+            case ColumnEncoding::FrameOfReference: {
+                codes_.Match(res, Diff(lower, min_), Diff(upper, min_));
+                break;
+            }
+            case ColumnEncoding::Dictionary: {
+                auto begin = std::lower_bound(
+                    dictionary_.begin(), dictionary_.end(), lower);
+                auto end = std::upper_bound(begin, dictionary_.end(), upper);
+                if (begin != end) {
+                    codes_.Match(res,
+                                 begin - dictionary_.begin(),
+                                 end - dictionary_.begin() - 1);
+                }
+                break;
+            }
+            case ColumnEncoding::Delta: {
+                // the values are sorted, the matches are contiguous
+                std::fill(res.begin() + LowerBound(lower),
+                          res.begin() + UpperBound(upper),
+                          true);
+                break;
+            }
+        }
+        return res;
+    }
+
+    // rows of a value in values
+    TargetBitmap
+    In(const T* values, size_t n) const {
+        TargetBitmap res(num_rows_, false);
+        switch (encoding_) {
+            case ColumnEncoding::Delta: {
+                for (size_t i = 0; i < n; ++i) {
+                    std::fill(res.begin() + LowerBound(values[i]),
+                              res.begin() + UpperBound(values[i]),
+                              true);
+                }
+                break;
+            }
+            case ColumnEncoding::Dictionary: {
+                std::vector<uint8_t> hit(dictionary_.size(), 0);
+                for (size_t i = 0; i < n; ++i) {
+                    auto it = std::lower_bound(
+                        dictionary_.begin(), dictionary_.end(), values[i]);
+                    if (it != dictionary_.end() && *it == values[i]) {
+                        hit[it - dictionary_.begin()] = 1;
+                    }
+                }
+                codes_.Match(res, hit);
+                break;
+            }
+            case ColumnEncoding::FrameOfReference: {
+                std::vector<uint64_t> codes;
+                for (size_t i = 0; i < n; ++i) {
+                    if (min_ <= values[i] && values[i] <= max_) {
+                        codes.push_back(Diff(values[i], min_));
+                    }
+                }
+                if (codes.empty()) {
+                    break;
+                }
+                if (Diff(max_, min_) < kMaxDictionarySize) {
+                    std::vector<uint8_t> hit(Diff(max_, min_) + 1, 0);
+                    for (auto code : codes) {
+                        hit[code] = 1;
+                    }
+                    codes_.Match(res, hit);
+                } else {
+                    std::sort(codes.begin(), codes.end());
+                    codes_.ForEachBlock(
+                        [&](size_t begin, const uint64_t* block, size_t len) {
+                            for (size_t j = 0; j < len; ++j) {
+                                res[begin + j] = std::binary_search(
+                                    codes.begin(), codes.end(), block[j]);
+                            }
+                        });
+                }
+                break;
+            }
+        }
+        return res;
+    }
+
+ private:
+    EncodedColumn() = default;
+
+    // a - b of a >= b, without overflow
+    static uint64_t
+    Diff(T a, T b) {
+        return static_cast<uint64_t>(static_cast<int64_t>(a)) -
+               static_cast<uint64_t>(static_cast<int64_t>(b));
+    }
+
+    static T
+    Add(T a, uint64_t b) {
+        return static_cast<T>(static_cast<uint64_t>(static_cast<int64_t>(a)) +
+                              b);
+    }
+
+    void
+    DecodeBlock(size_t begin,
+                const uint64_t* codes,
+                size_t len,
+                T* out) const {
+        switch (encoding_) {
+            case ColumnEncoding::FrameOfReference:
+                for (size_t j = 0; j < len; ++j) {
+                    out[j] = Add(min_, codes[j]);
+                }
+                break;
+            case ColumnEncoding::Dictionary:
+                for (size_t j = 0; j < len; ++j) {
+                    out[j] = dictionary_[codes[j]];
+                }
+                break;
+            case ColumnEncoding::Delta: {
+                T value = block_bases_[begin / kBitPackBlockSize];
+                for (size_t j = 0; j < len; ++j) {
+                    value = Add(value, codes[j]);
+                    out[j] = value;
+                }
+                break;
+            }
+        }
+    }
+
+    // number of rows less than value, or not greater than value if upper,
+    // only for the delta encoding where the values are sorted
+    size_t
+    Bound(T value, bool upper) const {
+        auto before = [&](T v) { return upper ? v <= value : v < value; };
+        // the blocks starting before the bound
+        auto blocks = std::partition_point(
+                          block_bases_.begin(), block_bases_.end(), before) -
+                      block_bases_.begin();
+        if (blocks == 0) {
+            return 0;
+        }
+        auto begin = (blocks - 1) * kBitPackBlockSize;
+        auto len = std::min(kBitPackBlockSize, num_rows_ - begin);
+        uint64_t codes[kBitPackBlockSize];
+        T decoded[kBitPackBlockSize];
+        codes_.UnpackBlock(blocks - 1, codes);
+        DecodeBlock(begin, codes, len, decoded);
+        return begin +
+               (std::partition_point(decoded, decoded + len, before) - decoded);
+    }
+
+    size_t
+    LowerBound(T value) const {
+        return Bound(value, false);
+    }
+
+    size_t
+    UpperBound(T value) const {
+        return Bound(value, true);
+    }
+
+ private:
+    ColumnEncoding encoding_{ColumnEncoding::FrameOfReference};
+    size_t num_rows_{0};
+    T min_{};
+    T max_{};
+    PackedCodes codes_;
+    std::vector<T> block_bases_;
+    std::vector<T> dictionary_;
+
+    mutable std::once_flag decoded_;
+};
+
+// EncodedStringColumn keeps a low cardinality string column of a sealed
+// segment as the sorted distinct values and the bit packed codes of the rows.
+// A predicate is resolved once against the dictionary into a range or a set of
+// codes, which is then matched on the codes a block at a time. Span() builds
+// the views of the rows, pointing into the dictionary, on first access and
+// keeps them, counted by DecodedSize().
+class EncodedStringColumn : public EncodedColumnBase {
+ public:
+    static constexpr double kMaxEncodedRatio = 0.75;
+    static constexpr size_t kMaxDictionarySize = 1 << 16;
+
+    // nullptr if the column has too many distinct values to be worth it
+    static std::shared_ptr<EncodedStringColumn>
+    Encode(const VariableColumn<std::string>& column) {
+        auto num_rows = column.NumRows();
+        if (num_rows == 0) {
+            return nullptr;
+        }
+
+        std::unordered_set<std::string_view> distinct;
+        size_t raw_size = 0;
+        for (size_t i = 0; i < num_rows; ++i) {
+            auto value = column.RawAt(i);
+            raw_size += value.size();
+            distinct.insert(value);
+            if (distinct.size() > kMaxDictionarySize) {
+                return nullptr;
+            }
+        }
+        std::vector<std::string_view> sorted(distinct.begin(), distinct.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        size_t dictionary_size = 0;
+        for (auto& value : sorted) {
+            dictionary_size += value.size();
+        }
+        auto width = BitWidth(sorted.size() - 1);
+        // the raw column keeps an offset and a view besides the bytes of a row
+        auto raw =
+            raw_size + num_rows * (sizeof(uint64_t) + sizeof(std::string_view));
+        auto encoded = dictionary_size +
+                       sorted.size() * sizeof(std::string_view) +
+                       BitPackedWords(num_rows, width) * sizeof(uint64_t);
+        if (encoded > kMaxEncodedRatio * raw) {
+            return nullptr;
+        }
+
+        auto result =
+            std::shared_ptr<EncodedStringColumn>(new EncodedStringColumn());
+        result->num_rows_ = num_rows;
+        auto& data = result->dictionary_data_;
+        data.reserve(dictionary_size);
+        std::vector<size_t> offsets;
+        offsets.reserve(sorted.size());
+        for (auto& value : sorted) {
+            offsets.push_back(data.size());
+            data.append(value);
+        }
+        // the views are taken once the bytes don't move anymore
+        result->dictionary_.reserve(sorted.size());
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            result->dictionary_.emplace_back(data.data() + offsets[i],
+                                             sorted[i].size());
+        }
+
+        std::vector<uint64_t> codes(num_rows);
+        for (size_t i = 0; i < num_rows; ++i) {
+            codes[i] = std::lower_bound(
+                           sorted.begin(), sorted.end(), column.RawAt(i)) -
+                       sorted.begin();
+        }
+        result->codes_ = PackedCodes(codes, width);
+        return result;
+    }
+
+    size_t
+    NumRows() const override {
+        return num_rows_;
+    }
+
+    SpanBase
+    Span() const override {
+        std::call_once(views_built_, [this]() {
+            auto self = const_cast<EncodedStringColumn*>(this);
+            self->views_.resize(num_rows_);
+            codes_.ForEachBlock(
+                [&](size_t begin, const uint64_t* codes, size_t len) {
+                    for (size_t j = 0; j < len; ++j) {
+                        self->views_[begin + j] = dictionary_[codes[j]];
+                    }
+                });
+            decoded_size_ = num_rows_ * sizeof(std::string_view);
+        });
+        return SpanBase(views_.data(), num_rows_, sizeof(std::string_view));
+    }
+
+    ColumnEncoding
+    Encoding() const override {
+        return ColumnEncoding::Dictionary;
+    }
+
+    size_t
+    EncodedSize() const override {
+        return codes_.Size() + dictionary_data_.size() +
+               dictionary_.size() * sizeof(std::string_view);
+    }
+
+    std::string_view
+    ValueAt(size_t i) const {
+        return dictionary_[codes_[i]];
+    }
+
+    // decode the rows at the offsets, skips INVALID_SEG_OFFSET
+    void
+    BulkValueAt(const int64_t* seg_offsets,
+                int64_t count,
+                std::string* dst) const {
+        for (int64_t i = 0; i < count; ++i) {
+            auto offset = seg_offsets[i];
+            if (offset != INVALID_SEG_OFFSET) {
+                dst[i] = std::string(ValueAt(offset));
+            }
+        }
+    }
+
+    // rows in the range, a missing bound means the range is unbounded on
+    // that side
+    TargetBitmap
+    Range(std::optional<std::string_view> lower,
+          bool lower_inclusive,
+          std::optional<std::string_view> upper,
+          bool upper_inclusive) const {
+        size_t begin = 0;
+        size_t end = dictionary_.size();
+        if (lower.has_value()) {
+            begin = lower_inclusive ? LowerBound(lower.value())
+                                    : UpperBound(lower.value());
+        }
+        if (upper.has_value()) {
+            end = upper_inclusive ? UpperBound(upper.value())
+                                  : LowerBound(upper.value());
+        }
+        return MatchCodeRange(begin, end);
+    }
+
+    // rows of a value in values
+    TargetBitmap
+    In(const std::string* values, size_t n) const {
+        TargetBitmap res(num_rows_, false);
+        std::vector<uint8_t> hit(dictionary_.size(), 0);
+        bool any = false;
+        for (size_t i = 0; i < n; ++i) {
+            auto code = LowerBound(values[i]);
+            if (code < dictionary_.size() && dictionary_[code] == values[i]) {
+                hit[code] = 1;
+                any = true;
+            }
+        }
+        if (any) {
+            codes_.Match(res, hit);
+        }
+        return res;
+    }
+
+    // rows starting with prefix, which are contiguous in the dictionary
+    TargetBitmap
+    PrefixMatch(std::string_view prefix) const {
+        auto begin = LowerBound(prefix);
+        auto end = std::partition_point(dictionary_.begin() + begin,
+                                        dictionary_.end(),
+                                        [&](std::string_view value) {
+                                            return value.substr(
+                                                       0, prefix.size()) ==
+                                                   prefix;
+                                        }) -
+                   dictionary_.begin();
+        return MatchCodeRange(begin, end);
+    }
+
+    // rows whose value satisfies pred, pred runs once per distinct value
+    template <typename Pred>
+    TargetBitmap
+    MatchIf(Pred pred) const {
+        TargetBitmap res(num_rows_, false);
+        std::vector<uint8_t> hit(dictionary_.size(), 0);
+        bool any = false;
+        for (size_t code = 0; code < dictionary_.size(); ++code) {
+            if (pred(dictionary_[code])) {
+                hit[code] = 1;
+                any = true;
+            }
+        }
+        if (any) {
+            codes_.Match(res, hit);
+        }
+        return res;
+    }
+
+ private:
+    EncodedStringColumn() = default;
+
+    // rows of a code in [begin, end)
+    TargetBitmap
+    MatchCodeRange(size_t begin, size_t end) const {
+        TargetBitmap res(num_rows_, false);
+        if (begin < end) {
+            codes_.Match(res, begin, end - 1);
+        }
+        return res;
+    }
+
+    // code of the first value not less than value
+    size_t
+    LowerBound(std::string_view value) const {
+        return std::lower_bound(dictionary_.begin(), dictionary_.end(), value) -
+               dictionary_.begin();
+    }
+
+    // code of the first value greater than value
+    size_t
+    UpperBound(std::string_view value) const {
+        return std::upper_bound(dictionary_.begin(), dictionary_.end(), value) -
+               dictionary_.begin();
+    }
+
+ private:
+    size_t num_rows_{0};
+    std::string dictionary_data_;
+    std::vector<std::string_view> dictionary_;
+    PackedCodes codes_;
+
+    mutable std::once_flag views_built_;
+    std::vector<std::string_view> views_;
+};
+
+// encode a column of an integer or a string field, nullptr if the type
+// isn't supported or no encoding is worth it
+inline std::shared_ptr<ColumnBase>
+EncodeColumn(const ColumnBase& column, DataType data_type) {
+    switch (data_type) {
+        case DataType::INT8:
+            return EncodedColumn<int8_t>::Encode(
+                reinterpret_cast<const int8_t*>(column.Data()),
+                column.NumRows());
+        case DataType::INT16:
+            return EncodedColumn<int16_t>::Encode(
+                reinterpret_cast<const int16_t*>(column.Data()),
+                column.NumRows());
+        case DataType::INT32:
+            return EncodedColumn<int32_t>::Encode(
+                reinterpret_cast<const int32_t*>(column.Data()),
+                column.NumRows());
+        case DataType::INT64:
+            return EncodedColumn<int64_t>::Encode(
+                reinterpret_cast<const int64_t*>(column.Data()),
+                column.NumRows());
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return EncodedStringColumn::Encode(
+                static_cast<const VariableColumn<std::string>&>(column));
+        default:
+            return nullptr;
+    }
+}
+
+}  // namespace milvus
@@ -84,5 +84,8 @@ struct FieldDataInfo {
     size_t row_count;
     std::string mmap_dir_path;
     storage::FieldDataChannelPtr channel;
+    // binlogs of the field, the column file mapped under mmap_dir_path is
+    // kept and reused by later loads of the same binlogs if not empty
+    std::vector<std::string> insert_files;
 };
 }  // namespace milvus
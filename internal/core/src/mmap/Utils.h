@@ -77,23 +77,22 @@ FillField(DataType data_type, const storage::FieldDataPtr data, void* dst) {
     return dest;
 }
 
-inline size_t
-WriteFieldData(File& file,
+// write the field data through the writer, and append the offset of each
+// row into indices for the variable length types
+inline void
+WriteFieldData(BufferedWriter& writer,
                DataType data_type,
-               const storage::FieldDataPtr& data) {
-    size_t total_written{0};
+               const storage::FieldDataPtr& data,
+               std::vector<uint64_t>& indices) {
     if (datatype_is_variable(data_type)) {
         switch (data_type) {
             case DataType::VARCHAR:
             case DataType::STRING: {
-                for (auto i = 0; i < data->get_num_rows(); ++i) {
+                for (ssize_t i = 0; i < data->get_num_rows(); ++i) {
                     auto str =
                         static_cast<const std::string*>(data->RawValue(i));
-                    ssize_t written = file.Write(str->data(), str->size());
-                    if (written < str->size()) {
-                        break;
-                    }
-                    total_written += written;
+                    indices.push_back(writer.Offset());
+                    writer.Write(str->data(), str->size());
                 }
                 break;
             }
@@ -101,12 +100,8 @@ WriteFieldData(File& file,
                 for (ssize_t i = 0; i < data->get_num_rows(); ++i) {
                     auto padded_string =
                         static_cast<const Json*>(data->RawValue(i))->data();
-                    ssize_t written =
-                        file.Write(padded_string.data(), padded_string.size());
-                    if (written < padded_string.size()) {
-                        break;
-                    }
-                    total_written += written;
+                    indices.push_back(writer.Offset());
+                    writer.Write(padded_string.data(), padded_string.size());
                 }
                 break;
             }
@@ -115,9 +110,7 @@ WriteFieldData(File& file,
                                       datatype_name(data_type)));
         }
     } else {
-        total_written += file.Write(data->Data(), data->Size());
+        writer.Write(data->Data(), data->Size());
     }
-
-    return total_written;
 }
 }  // namespace milvus
@@ -320,6 +320,25 @@ struct VectorANNSDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VectorANNSDefaultTypeInternal _VectorANNS_default_instance_;
+PROTOBUF_CONSTEXPR HybridVectorANNS::HybridVectorANNS(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.anns_)*/{}
+  , /*decltype(_impl_.weights_)*/{}
+  , /*decltype(_impl_.predicates_)*/nullptr
+  , /*decltype(_impl_.rrf_k_)*/int64_t{0}
+  , /*decltype(_impl_.topk_)*/int64_t{0}
+  , /*decltype(_impl_.round_decimal_)*/int64_t{0}
+  , /*decltype(_impl_.fusion_type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HybridVectorANNSDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HybridVectorANNSDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HybridVectorANNSDefaultTypeInternal() {}
+  union {
+    HybridVectorANNS _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HybridVectorANNSDefaultTypeInternal _HybridVectorANNS_default_instance_;
 PROTOBUF_CONSTEXPR QueryPlanNode::QueryPlanNode(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.predicates_)*/nullptr
@@ -354,8 +373,8 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 }  // namespace plan
 }  // namespace proto
 }  // namespace milvus
-static ::_pb::Metadata file_level_metadata_plan_2eproto[22];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_plan_2eproto[5];
+static ::_pb::Metadata file_level_metadata_plan_2eproto[23];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_plan_2eproto[6];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_plan_2eproto = nullptr;
 
 const uint32_t TableStruct_plan_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -554,6 +573,19 @@ const uint32_t TableStruct_plan_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::VectorANNS, _impl_.query_info_),
   PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::VectorANNS, _impl_.placeholder_tag_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.anns_),
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.predicates_),
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.fusion_type_),
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.weights_),
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.rrf_k_),
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.topk_),
+  PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::HybridVectorANNS, _impl_.round_decimal_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::QueryPlanNode, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -571,6 +603,7 @@ const uint32_t TableStruct_plan_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::PlanNode, _impl_.output_field_ids_),
   PROTOBUF_FIELD_OFFSET(::milvus::proto::plan::PlanNode, _impl_.node_),
 };
@@ -595,8 +628,9 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 157, -1, -1, sizeof(::milvus::proto::plan::AlwaysTrueExpr)},
   { 163, -1, -1, sizeof(::milvus::proto::plan::Expr)},
   { 183, -1, -1, sizeof(::milvus::proto::plan::VectorANNS)},
-  { 194, -1, -1, sizeof(::milvus::proto::plan::QueryPlanNode)},
-  { 203, -1, -1, sizeof(::milvus::proto::plan::PlanNode)},
+  { 194, -1, -1, sizeof(::milvus::proto::plan::HybridVectorANNS)},
+  { 207, -1, -1, sizeof(::milvus::proto::plan::QueryPlanNode)},
+  { 216, -1, -1, sizeof(::milvus::proto::plan::PlanNode)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -620,6 +654,7 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::milvus::proto::plan::_AlwaysTrueExpr_default_instance_._instance,
   &::milvus::proto::plan::_Expr_default_instance_._instance,
   &::milvus::proto::plan::_VectorANNS_default_instance_._instance,
+  &::milvus::proto::plan::_HybridVectorANNS_default_instance_._instance,
   &::milvus::proto::plan::_QueryPlanNode_default_instance_._instance,
   &::milvus::proto::plan::_PlanNode_default_instance_._instance,
 };
@@ -715,31 +750,40 @@ const char descriptor_table_protodef_plan_2eproto[] PROTOBUF_SECTION_VARIABLE(pr
   "(\010\022\020\n\010field_id\030\002 \001(\003\022+\n\npredicates\030\003 \001(\013"
   "2\027.milvus.proto.plan.Expr\0220\n\nquery_info\030"
   "\004 \001(\0132\034.milvus.proto.plan.QueryInfo\022\027\n\017p"
-  "laceholder_tag\030\005 \001(\t\"]\n\rQueryPlanNode\022+\n"
-  "\npredicates\030\001 \001(\0132\027.milvus.proto.plan.Ex"
-  "pr\022\020\n\010is_count\030\002 \001(\010\022\r\n\005limit\030\003 \001(\003\"\304\001\n\010"
-  "PlanNode\0224\n\013vector_anns\030\001 \001(\0132\035.milvus.p"
-  "roto.plan.VectorANNSH\000\022-\n\npredicates\030\002 \001"
-  "(\0132\027.milvus.proto.plan.ExprH\000\0221\n\005query\030\004"
-  " \001(\0132 .milvus.proto.plan.QueryPlanNodeH\000"
-  "\022\030\n\020output_field_ids\030\003 \003(\003B\006\n\004node*\272\001\n\006O"
-  "pType\022\013\n\007Invalid\020\000\022\017\n\013GreaterThan\020\001\022\020\n\014G"
-  "reaterEqual\020\002\022\014\n\010LessThan\020\003\022\r\n\tLessEqual"
-  "\020\004\022\t\n\005Equal\020\005\022\014\n\010NotEqual\020\006\022\017\n\013PrefixMat"
-  "ch\020\007\022\020\n\014PostfixMatch\020\010\022\t\n\005Match\020\t\022\t\n\005Ran"
-  "ge\020\n\022\006\n\002In\020\013\022\t\n\005NotIn\020\014*G\n\013ArithOpType\022\013"
-  "\n\007Unknown\020\000\022\007\n\003Add\020\001\022\007\n\003Sub\020\002\022\007\n\003Mul\020\003\022\007"
-  "\n\003Div\020\004\022\007\n\003Mod\020\005B3Z1github.com/milvus-io"
-  "/milvus/internal/proto/planpbb\006proto3"
+  "laceholder_tag\030\005 \001(\t\"\345\001\n\020HybridVectorANN"
+  "S\022+\n\004anns\030\001 \003(\0132\035.milvus.proto.plan.Vect"
+  "orANNS\022+\n\npredicates\030\002 \001(\0132\027.milvus.prot"
+  "o.plan.Expr\0222\n\013fusion_type\030\003 \001(\0162\035.milvu"
+  "s.proto.plan.FusionType\022\017\n\007weights\030\004 \003(\002"
+  "\022\r\n\005rrf_k\030\005 \001(\003\022\014\n\004topk\030\006 \001(\003\022\025\n\rround_d"
+  "ecimal\030\007 \001(\003\"]\n\rQueryPlanNode\022+\n\npredica"
+  "tes\030\001 \001(\0132\027.milvus.proto.plan.Expr\022\020\n\010is"
+  "_count\030\002 \001(\010\022\r\n\005limit\030\003 \001(\003\"\200\002\n\010PlanNode"
+  "\0224\n\013vector_anns\030\001 \001(\0132\035.milvus.proto.pla"
+  "n.VectorANNSH\000\022-\n\npredicates\030\002 \001(\0132\027.mil"
+  "vus.proto.plan.ExprH\000\0221\n\005query\030\004 \001(\0132 .m"
+  "ilvus.proto.plan.QueryPlanNodeH\000\022:\n\013hybr"
+  "id_anns\030\005 \001(\0132#.milvus.proto.plan.Hybrid"
+  "VectorANNSH\000\022\030\n\020output_field_ids\030\003 \003(\003B\006"
+  "\n\004node*\312\001\n\006OpType\022\013\n\007Invalid\020\000\022\017\n\013Greate"
+  "rThan\020\001\022\020\n\014GreaterEqual\020\002\022\014\n\010LessThan\020\003\022"
+  "\r\n\tLessEqual\020\004\022\t\n\005Equal\020\005\022\014\n\010NotEqual\020\006\022"
+  "\017\n\013PrefixMatch\020\007\022\020\n\014PostfixMatch\020\010\022\t\n\005Ma"
+  "tch\020\t\022\t\n\005Range\020\n\022\006\n\002In\020\013\022\t\n\005NotIn\020\014\022\016\n\nI"
+  "nfixMatch\020\r*G\n\013ArithOpType\022\013\n\007Unknown\020\000\022"
+  "\007\n\003Add\020\001\022\007\n\003Sub\020\002\022\007\n\003Mul\020\003\022\007\n\003Div\020\004\022\007\n\003M"
+  "od\020\005*&\n\nFusionType\022\017\n\013WeightedSum\020\000\022\007\n\003R"
+  "RF\020\001B3Z1github.com/milvus-io/milvus/inte"
+  "rnal/proto/planpbb\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_plan_2eproto_deps[1] = {
   &::descriptor_table_schema_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_plan_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_plan_2eproto = {
-    false, false, 4237, descriptor_table_protodef_plan_2eproto,
+    false, false, 4585, descriptor_table_protodef_plan_2eproto,
     "plan.proto",
-    &descriptor_table_plan_2eproto_once, descriptor_table_plan_2eproto_deps, 1, 22,
+    &descriptor_table_plan_2eproto_once, descriptor_table_plan_2eproto_deps, 1, 23,
     schemas, file_default_instances, TableStruct_plan_2eproto::offsets,
     file_level_metadata_plan_2eproto, file_level_enum_descriptors_plan_2eproto,
     file_level_service_descriptors_plan_2eproto,
@@ -841,6 +885,7 @@ bool OpType_IsValid(int value) {
     case 10:
     case 11:
     case 12:
+    case 13:
       return true;
     default:
       return false;
@@ -865,6 +910,20 @@ bool ArithOpType_IsValid(int value) {
   }
 }
 
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FusionType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_plan_2eproto);
+  return file_level_enum_descriptors_plan_2eproto[5];
+}
+bool FusionType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -6792,6 +6851,376 @@ void VectorANNS::InternalSwap(VectorANNS* other) {
 
 // ===================================================================
 
+class HybridVectorANNS::_Internal {
+ public:
+  static const ::milvus::proto::plan::Expr& predicates(const HybridVectorANNS* msg);
+};
+
+const ::milvus::proto::plan::Expr&
+HybridVectorANNS::_Internal::predicates(const HybridVectorANNS* msg) {
+  return *msg->_impl_.predicates_;
+}
+HybridVectorANNS::HybridVectorANNS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:milvus.proto.plan.HybridVectorANNS)
+}
+HybridVectorANNS::HybridVectorANNS(const HybridVectorANNS& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HybridVectorANNS* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.anns_){from._impl_.anns_}
+    , decltype(_impl_.weights_){from._impl_.weights_}
+    , decltype(_impl_.predicates_){nullptr}
+    , decltype(_impl_.rrf_k_){}
+    , decltype(_impl_.topk_){}
+    , decltype(_impl_.round_decimal_){}
+    , decltype(_impl_.fusion_type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_predicates()) {
+    _this->_impl_.predicates_ = new ::milvus::proto::plan::Expr(*from._impl_.predicates_);
+  }
+  ::memcpy(&_impl_.rrf_k_, &from._impl_.rrf_k_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fusion_type_) -
+    reinterpret_cast<char*>(&_impl_.rrf_k_)) + sizeof(_impl_.fusion_type_));
+  // @@protoc_insertion_point(copy_constructor:milvus.proto.plan.HybridVectorANNS)
+}
+
+inline void HybridVectorANNS::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.anns_){arena}
+    , decltype(_impl_.weights_){arena}
+    , decltype(_impl_.predicates_){nullptr}
+    , decltype(_impl_.rrf_k_){int64_t{0}}
+    , decltype(_impl_.topk_){int64_t{0}}
+    , decltype(_impl_.round_decimal_){int64_t{0}}
+    , decltype(_impl_.fusion_type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HybridVectorANNS::~HybridVectorANNS() {
+  // @@protoc_insertion_point(destructor:milvus.proto.plan.HybridVectorANNS)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HybridVectorANNS::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.anns_.~RepeatedPtrField();
+  _impl_.weights_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.predicates_;
+}
+
+void HybridVectorANNS::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HybridVectorANNS::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.proto.plan.HybridVectorANNS)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.anns_.Clear();
+  _impl_.weights_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.predicates_ != nullptr) {
+    delete _impl_.predicates_;
+  }
+  _impl_.predicates_ = nullptr;
+  ::memset(&_impl_.rrf_k_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.fusion_type_) -
+      reinterpret_cast<char*>(&_impl_.rrf_k_)) + sizeof(_impl_.fusion_type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HybridVectorANNS::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .milvus.proto.plan.VectorANNS anns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_anns(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .milvus.proto.plan.Expr predicates = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_predicates(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .milvus.proto.plan.FusionType fusion_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_fusion_type(static_cast<::milvus::proto::plan::FusionType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float weights = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_weights(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_weights(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 rrf_k = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.rrf_k_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 topk = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.topk_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 round_decimal = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.round_decimal_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HybridVectorANNS::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.proto.plan.HybridVectorANNS)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .milvus.proto.plan.VectorANNS anns = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_anns_size()); i < n; i++) {
+    const auto& repfield = this->_internal_anns(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .milvus.proto.plan.Expr predicates = 2;
+  if (this->_internal_has_predicates()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::predicates(this),
+        _Internal::predicates(this).GetCachedSize(), target, stream);
+  }
+
+  // .milvus.proto.plan.FusionType fusion_type = 3;
+  if (this->_internal_fusion_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_fusion_type(), target);
+  }
+
+  // repeated float weights = 4;
+  if (this->_internal_weights_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_weights(), target);
+  }
+
+  // int64 rrf_k = 5;
+  if (this->_internal_rrf_k() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_rrf_k(), target);
+  }
+
+  // int64 topk = 6;
+  if (this->_internal_topk() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_topk(), target);
+  }
+
+  // int64 round_decimal = 7;
+  if (this->_internal_round_decimal() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_round_decimal(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.proto.plan.HybridVectorANNS)
+  return target;
+}
+
+size_t HybridVectorANNS::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.proto.plan.HybridVectorANNS)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .milvus.proto.plan.VectorANNS anns = 1;
+  total_size += 1UL * this->_internal_anns_size();
+  for (const auto& msg : this->_impl_.anns_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated float weights = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_weights_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // .milvus.proto.plan.Expr predicates = 2;
+  if (this->_internal_has_predicates()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.predicates_);
+  }
+
+  // int64 rrf_k = 5;
+  if (this->_internal_rrf_k() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_rrf_k());
+  }
+
+  // int64 topk = 6;
+  if (this->_internal_topk() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_topk());
+  }
+
+  // int64 round_decimal = 7;
+  if (this->_internal_round_decimal() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_round_decimal());
+  }
+
+  // .milvus.proto.plan.FusionType fusion_type = 3;
+  if (this->_internal_fusion_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_fusion_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HybridVectorANNS::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HybridVectorANNS::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HybridVectorANNS::GetClassData() const { return &_class_data_; }
+
+
+void HybridVectorANNS::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HybridVectorANNS*>(&to_msg);
+  auto& from = static_cast<const HybridVectorANNS&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:milvus.proto.plan.HybridVectorANNS)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.anns_.MergeFrom(from._impl_.anns_);
+  _this->_impl_.weights_.MergeFrom(from._impl_.weights_);
+  if (from._internal_has_predicates()) {
+    _this->_internal_mutable_predicates()->::milvus::proto::plan::Expr::MergeFrom(
+        from._internal_predicates());
+  }
+  if (from._internal_rrf_k() != 0) {
+    _this->_internal_set_rrf_k(from._internal_rrf_k());
+  }
+  if (from._internal_topk() != 0) {
+    _this->_internal_set_topk(from._internal_topk());
+  }
+  if (from._internal_round_decimal() != 0) {
+    _this->_internal_set_round_decimal(from._internal_round_decimal());
+  }
+  if (from._internal_fusion_type() != 0) {
+    _this->_internal_set_fusion_type(from._internal_fusion_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HybridVectorANNS::CopyFrom(const HybridVectorANNS& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.proto.plan.HybridVectorANNS)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HybridVectorANNS::IsInitialized() const {
+  return true;
+}
+
+void HybridVectorANNS::InternalSwap(HybridVectorANNS* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.anns_.InternalSwap(&other->_impl_.anns_);
+  _impl_.weights_.InternalSwap(&other->_impl_.weights_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HybridVectorANNS, _impl_.fusion_type_)
+      + sizeof(HybridVectorANNS::_impl_.fusion_type_)
+      - PROTOBUF_FIELD_OFFSET(HybridVectorANNS, _impl_.predicates_)>(
+          reinterpret_cast<char*>(&_impl_.predicates_),
+          reinterpret_cast<char*>(&other->_impl_.predicates_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HybridVectorANNS::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plan_2eproto_getter, &descriptor_table_plan_2eproto_once,
+      file_level_metadata_plan_2eproto[20]);
+}
+
+// ===================================================================
+
 class QueryPlanNode::_Internal {
  public:
   static const ::milvus::proto::plan::Expr& predicates(const QueryPlanNode* msg);
@@ -7039,7 +7468,7 @@ void QueryPlanNode::InternalSwap(QueryPlanNode* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata QueryPlanNode::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_plan_2eproto_getter, &descriptor_table_plan_2eproto_once,
-      file_level_metadata_plan_2eproto[20]);
+      file_level_metadata_plan_2eproto[21]);
 }
 
 // ===================================================================
@@ -7049,6 +7478,7 @@ class PlanNode::_Internal {
   static const ::milvus::proto::plan::VectorANNS& vector_anns(const PlanNode* msg);
   static const ::milvus::proto::plan::Expr& predicates(const PlanNode* msg);
   static const ::milvus::proto::plan::QueryPlanNode& query(const PlanNode* msg);
+  static const ::milvus::proto::plan::HybridVectorANNS& hybrid_anns(const PlanNode* msg);
 };
 
 const ::milvus::proto::plan::VectorANNS&
@@ -7063,6 +7493,10 @@ const ::milvus::proto::plan::QueryPlanNode&
 PlanNode::_Internal::query(const PlanNode* msg) {
   return *msg->_impl_.node_.query_;
 }
+const ::milvus::proto::plan::HybridVectorANNS&
+PlanNode::_Internal::hybrid_anns(const PlanNode* msg) {
+  return *msg->_impl_.node_.hybrid_anns_;
+}
 void PlanNode::set_allocated_vector_anns(::milvus::proto::plan::VectorANNS* vector_anns) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_node();
@@ -7108,6 +7542,21 @@ void PlanNode::set_allocated_query(::milvus::proto::plan::QueryPlanNode* query)
   }
   // @@protoc_insertion_point(field_set_allocated:milvus.proto.plan.PlanNode.query)
 }
+void PlanNode::set_allocated_hybrid_anns(::milvus::proto::plan::HybridVectorANNS* hybrid_anns) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_node();
+  if (hybrid_anns) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hybrid_anns);
+    if (message_arena != submessage_arena) {
+      hybrid_anns = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hybrid_anns, submessage_arena);
+    }
+    set_has_hybrid_anns();
+    _impl_.node_.hybrid_anns_ = hybrid_anns;
+  }
+  // @@protoc_insertion_point(field_set_allocated:milvus.proto.plan.PlanNode.hybrid_anns)
+}
 PlanNode::PlanNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -7142,6 +7591,11 @@ PlanNode::PlanNode(const PlanNode& from)
           from._internal_query());
       break;
     }
+    case kHybridAnns: {
+      _this->_internal_mutable_hybrid_anns()->::milvus::proto::plan::HybridVectorANNS::MergeFrom(
+          from._internal_hybrid_anns());
+      break;
+    }
     case NODE_NOT_SET: {
       break;
     }
@@ -7205,6 +7659,12 @@ void PlanNode::clear_node() {
       }
       break;
     }
+    case kHybridAnns: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.node_.hybrid_anns_;
+      }
+      break;
+    }
     case NODE_NOT_SET: {
       break;
     }
@@ -7265,6 +7725,14 @@ const char* PlanNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // .milvus.proto.plan.HybridVectorANNS hybrid_anns = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hybrid_anns(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -7324,6 +7792,13 @@ uint8_t* PlanNode::_InternalSerialize(
         _Internal::query(this).GetCachedSize(), target, stream);
   }
 
+  // .milvus.proto.plan.HybridVectorANNS hybrid_anns = 5;
+  if (_internal_has_hybrid_anns()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::hybrid_anns(this),
+        _Internal::hybrid_anns(this).GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -7376,6 +7851,13 @@ size_t PlanNode::ByteSizeLong() const {
           *_impl_.node_.query_);
       break;
     }
+    // .milvus.proto.plan.HybridVectorANNS hybrid_anns = 5;
+    case kHybridAnns: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.node_.hybrid_anns_);
+      break;
+    }
     case NODE_NOT_SET: {
       break;
     }
@@ -7415,6 +7897,11 @@ void PlanNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTO
           from._internal_query());
       break;
     }
+    case kHybridAnns: {
+      _this->_internal_mutable_hybrid_anns()->::milvus::proto::plan::HybridVectorANNS::MergeFrom(
+          from._internal_hybrid_anns());
+      break;
+    }
     case NODE_NOT_SET: {
       break;
     }
@@ -7444,7 +7931,7 @@ void PlanNode::InternalSwap(PlanNode* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata PlanNode::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_plan_2eproto_getter, &descriptor_table_plan_2eproto_once,
-      file_level_metadata_plan_2eproto[21]);
+      file_level_metadata_plan_2eproto[22]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -7532,6 +8019,10 @@ template<> PROTOBUF_NOINLINE ::milvus::proto::plan::VectorANNS*
 Arena::CreateMaybeMessage< ::milvus::proto::plan::VectorANNS >(Arena* arena) {
   return Arena::CreateMessageInternal< ::milvus::proto::plan::VectorANNS >(arena);
 }
+template<> PROTOBUF_NOINLINE ::milvus::proto::plan::HybridVectorANNS*
+Arena::CreateMaybeMessage< ::milvus::proto::plan::HybridVectorANNS >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::milvus::proto::plan::HybridVectorANNS >(arena);
+}
 template<> PROTOBUF_NOINLINE ::milvus::proto::plan::QueryPlanNode*
 Arena::CreateMaybeMessage< ::milvus::proto::plan::QueryPlanNode >(Arena* arena) {
   return Arena::CreateMessageInternal< ::milvus::proto::plan::QueryPlanNode >(arena);
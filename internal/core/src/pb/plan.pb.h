@@ -89,6 +89,9 @@ extern ExprDefaultTypeInternal _Expr_default_instance_;
 class GenericValue;
 struct GenericValueDefaultTypeInternal;
 extern GenericValueDefaultTypeInternal _GenericValue_default_instance_;
+class HybridVectorANNS;
+struct HybridVectorANNSDefaultTypeInternal;
+extern HybridVectorANNSDefaultTypeInternal _HybridVectorANNS_default_instance_;
 class JSONContainsExpr;
 struct JSONContainsExprDefaultTypeInternal;
 extern JSONContainsExprDefaultTypeInternal _JSONContainsExpr_default_instance_;
@@ -133,6 +136,7 @@ template<> ::milvus::proto::plan::CompareExpr* Arena::CreateMaybeMessage<::milvu
 template<> ::milvus::proto::plan::ExistsExpr* Arena::CreateMaybeMessage<::milvus::proto::plan::ExistsExpr>(Arena*);
 template<> ::milvus::proto::plan::Expr* Arena::CreateMaybeMessage<::milvus::proto::plan::Expr>(Arena*);
 template<> ::milvus::proto::plan::GenericValue* Arena::CreateMaybeMessage<::milvus::proto::plan::GenericValue>(Arena*);
+template<> ::milvus::proto::plan::HybridVectorANNS* Arena::CreateMaybeMessage<::milvus::proto::plan::HybridVectorANNS>(Arena*);
 template<> ::milvus::proto::plan::JSONContainsExpr* Arena::CreateMaybeMessage<::milvus::proto::plan::JSONContainsExpr>(Arena*);
 template<> ::milvus::proto::plan::PlanNode* Arena::CreateMaybeMessage<::milvus::proto::plan::PlanNode>(Arena*);
 template<> ::milvus::proto::plan::QueryInfo* Arena::CreateMaybeMessage<::milvus::proto::plan::QueryInfo>(Arena*);
@@ -239,12 +243,13 @@ enum OpType : int {
   Range = 10,
   In = 11,
   NotIn = 12,
+  InfixMatch = 13,
   OpType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   OpType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool OpType_IsValid(int value);
 constexpr OpType OpType_MIN = Invalid;
-constexpr OpType OpType_MAX = NotIn;
+constexpr OpType OpType_MAX = InfixMatch;
 constexpr int OpType_ARRAYSIZE = OpType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OpType_descriptor();
@@ -290,6 +295,31 @@ inline bool ArithOpType_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ArithOpType>(
     ArithOpType_descriptor(), name, value);
 }
+enum FusionType : int {
+  WeightedSum = 0,
+  RRF = 1,
+  FusionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  FusionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool FusionType_IsValid(int value);
+constexpr FusionType FusionType_MIN = WeightedSum;
+constexpr FusionType FusionType_MAX = RRF;
+constexpr int FusionType_ARRAYSIZE = FusionType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FusionType_descriptor();
+template<typename T>
+inline const std::string& FusionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FusionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FusionType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FusionType_descriptor(), enum_t_value);
+}
+inline bool FusionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FusionType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FusionType>(
+    FusionType_descriptor(), name, value);
+}
 // ===================================================================
 
 class GenericValue final :
@@ -4387,6 +4417,251 @@ class VectorANNS final :
 };
 // -------------------------------------------------------------------
 
+class HybridVectorANNS final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.proto.plan.HybridVectorANNS) */ {
+ public:
+  inline HybridVectorANNS() : HybridVectorANNS(nullptr) {}
+  ~HybridVectorANNS() override;
+  explicit PROTOBUF_CONSTEXPR HybridVectorANNS(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HybridVectorANNS(const HybridVectorANNS& from);
+  HybridVectorANNS(HybridVectorANNS&& from) noexcept
+    : HybridVectorANNS() {
+    *this = ::std::move(from);
+  }
+
+  inline HybridVectorANNS& operator=(const HybridVectorANNS& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HybridVectorANNS& operator=(HybridVectorANNS&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HybridVectorANNS& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HybridVectorANNS* internal_default_instance() {
+    return reinterpret_cast<const HybridVectorANNS*>(
+               &_HybridVectorANNS_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(HybridVectorANNS& a, HybridVectorANNS& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HybridVectorANNS* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HybridVectorANNS* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HybridVectorANNS* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HybridVectorANNS>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HybridVectorANNS& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HybridVectorANNS& from) {
+    HybridVectorANNS::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HybridVectorANNS* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.proto.plan.HybridVectorANNS";
+  }
+  protected:
+  explicit HybridVectorANNS(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAnnsFieldNumber = 1,
+    kWeightsFieldNumber = 4,
+    kPredicatesFieldNumber = 2,
+    kRrfKFieldNumber = 5,
+    kTopkFieldNumber = 6,
+    kRoundDecimalFieldNumber = 7,
+    kFusionTypeFieldNumber = 3,
+  };
+  // repeated .milvus.proto.plan.VectorANNS anns = 1;
+  int anns_size() const;
+  private:
+  int _internal_anns_size() const;
+  public:
+  void clear_anns();
+  ::milvus::proto::plan::VectorANNS* mutable_anns(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::proto::plan::VectorANNS >*
+      mutable_anns();
+  private:
+  const ::milvus::proto::plan::VectorANNS& _internal_anns(int index) const;
+  ::milvus::proto::plan::VectorANNS* _internal_add_anns();
+  public:
+  const ::milvus::proto::plan::VectorANNS& anns(int index) const;
+  ::milvus::proto::plan::VectorANNS* add_anns();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::proto::plan::VectorANNS >&
+      anns() const;
+
+  // repeated float weights = 4;
+  int weights_size() const;
+  private:
+  int _internal_weights_size() const;
+  public:
+  void clear_weights();
+  private:
+  float _internal_weights(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_weights() const;
+  void _internal_add_weights(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_weights();
+  public:
+  float weights(int index) const;
+  void set_weights(int index, float value);
+  void add_weights(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      weights() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_weights();
+
+  // .milvus.proto.plan.Expr predicates = 2;
+  bool has_predicates() const;
+  private:
+  bool _internal_has_predicates() const;
+  public:
+  void clear_predicates();
+  const ::milvus::proto::plan::Expr& predicates() const;
+  PROTOBUF_NODISCARD ::milvus::proto::plan::Expr* release_predicates();
+  ::milvus::proto::plan::Expr* mutable_predicates();
+  void set_allocated_predicates(::milvus::proto::plan::Expr* predicates);
+  private:
+  const ::milvus::proto::plan::Expr& _internal_predicates() const;
+  ::milvus::proto::plan::Expr* _internal_mutable_predicates();
+  public:
+  void unsafe_arena_set_allocated_predicates(
+      ::milvus::proto::plan::Expr* predicates);
+  ::milvus::proto::plan::Expr* unsafe_arena_release_predicates();
+
+  // int64 rrf_k = 5;
+  void clear_rrf_k();
+  int64_t rrf_k() const;
+  void set_rrf_k(int64_t value);
+  private:
+  int64_t _internal_rrf_k() const;
+  void _internal_set_rrf_k(int64_t value);
+  public:
+
+  // int64 topk = 6;
+  void clear_topk();
+  int64_t topk() const;
+  void set_topk(int64_t value);
+  private:
+  int64_t _internal_topk() const;
+  void _internal_set_topk(int64_t value);
+  public:
+
+  // int64 round_decimal = 7;
+  void clear_round_decimal();
+  int64_t round_decimal() const;
+  void set_round_decimal(int64_t value);
+  private:
+  int64_t _internal_round_decimal() const;
+  void _internal_set_round_decimal(int64_t value);
+  public:
+
+  // .milvus.proto.plan.FusionType fusion_type = 3;
+  void clear_fusion_type();
+  ::milvus::proto::plan::FusionType fusion_type() const;
+  void set_fusion_type(::milvus::proto::plan::FusionType value);
+  private:
+  ::milvus::proto::plan::FusionType _internal_fusion_type() const;
+  void _internal_set_fusion_type(::milvus::proto::plan::FusionType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:milvus.proto.plan.HybridVectorANNS)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::proto::plan::VectorANNS > anns_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > weights_;
+    ::milvus::proto::plan::Expr* predicates_;
+    int64_t rrf_k_;
+    int64_t topk_;
+    int64_t round_decimal_;
+    int fusion_type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plan_2eproto;
+};
+// -------------------------------------------------------------------
+
 class QueryPlanNode final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.proto.plan.QueryPlanNode) */ {
  public:
@@ -4435,7 +4710,7 @@ class QueryPlanNode final :
                &_QueryPlanNode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    20;
+    21;
 
   friend void swap(QueryPlanNode& a, QueryPlanNode& b) {
     a.Swap(&b);
@@ -4613,6 +4888,7 @@ class PlanNode final :
     kVectorAnns = 1,
     kPredicates = 2,
     kQuery = 4,
+    kHybridAnns = 5,
     NODE_NOT_SET = 0,
   };
 
@@ -4621,7 +4897,7 @@ class PlanNode final :
                &_PlanNode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    22;
 
   friend void swap(PlanNode& a, PlanNode& b) {
     a.Swap(&b);
@@ -4698,6 +4974,7 @@ class PlanNode final :
     kVectorAnnsFieldNumber = 1,
     kPredicatesFieldNumber = 2,
     kQueryFieldNumber = 4,
+    kHybridAnnsFieldNumber = 5,
   };
   // repeated int64 output_field_ids = 3;
   int output_field_ids_size() const;
@@ -4775,6 +5052,24 @@ class PlanNode final :
       ::milvus::proto::plan::QueryPlanNode* query);
   ::milvus::proto::plan::QueryPlanNode* unsafe_arena_release_query();
 
+  // .milvus.proto.plan.HybridVectorANNS hybrid_anns = 5;
+  bool has_hybrid_anns() const;
+  private:
+  bool _internal_has_hybrid_anns() const;
+  public:
+  void clear_hybrid_anns();
+  const ::milvus::proto::plan::HybridVectorANNS& hybrid_anns() const;
+  PROTOBUF_NODISCARD ::milvus::proto::plan::HybridVectorANNS* release_hybrid_anns();
+  ::milvus::proto::plan::HybridVectorANNS* mutable_hybrid_anns();
+  void set_allocated_hybrid_anns(::milvus::proto::plan::HybridVectorANNS* hybrid_anns);
+  private:
+  const ::milvus::proto::plan::HybridVectorANNS& _internal_hybrid_anns() const;
+  ::milvus::proto::plan::HybridVectorANNS* _internal_mutable_hybrid_anns();
+  public:
+  void unsafe_arena_set_allocated_hybrid_anns(
+      ::milvus::proto::plan::HybridVectorANNS* hybrid_anns);
+  ::milvus::proto::plan::HybridVectorANNS* unsafe_arena_release_hybrid_anns();
+
   void clear_node();
   NodeCase node_case() const;
   // @@protoc_insertion_point(class_scope:milvus.proto.plan.PlanNode)
@@ -4783,6 +5078,7 @@ class PlanNode final :
   void set_has_vector_anns();
   void set_has_predicates();
   void set_has_query();
+  void set_has_hybrid_anns();
 
   inline bool has_node() const;
   inline void clear_has_node();
@@ -4799,6 +5095,7 @@ class PlanNode final :
       ::milvus::proto::plan::VectorANNS* vector_anns_;
       ::milvus::proto::plan::Expr* predicates_;
       ::milvus::proto::plan::QueryPlanNode* query_;
+      ::milvus::proto::plan::HybridVectorANNS* hybrid_anns_;
     } node_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     uint32_t _oneof_case_[1];
@@ -9106,6 +9403,267 @@ inline void VectorANNS::set_allocated_placeholder_tag(std::string* placeholder_t
 
 // -------------------------------------------------------------------
 
+// HybridVectorANNS
+
+// repeated .milvus.proto.plan.VectorANNS anns = 1;
+inline int HybridVectorANNS::_internal_anns_size() const {
+  return _impl_.anns_.size();
+}
+inline int HybridVectorANNS::anns_size() const {
+  return _internal_anns_size();
+}
+inline void HybridVectorANNS::clear_anns() {
+  _impl_.anns_.Clear();
+}
+inline ::milvus::proto::plan::VectorANNS* HybridVectorANNS::mutable_anns(int index) {
+  // @@protoc_insertion_point(field_mutable:milvus.proto.plan.HybridVectorANNS.anns)
+  return _impl_.anns_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::proto::plan::VectorANNS >*
+HybridVectorANNS::mutable_anns() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.proto.plan.HybridVectorANNS.anns)
+  return &_impl_.anns_;
+}
+inline const ::milvus::proto::plan::VectorANNS& HybridVectorANNS::_internal_anns(int index) const {
+  return _impl_.anns_.Get(index);
+}
+inline const ::milvus::proto::plan::VectorANNS& HybridVectorANNS::anns(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.anns)
+  return _internal_anns(index);
+}
+inline ::milvus::proto::plan::VectorANNS* HybridVectorANNS::_internal_add_anns() {
+  return _impl_.anns_.Add();
+}
+inline ::milvus::proto::plan::VectorANNS* HybridVectorANNS::add_anns() {
+  ::milvus::proto::plan::VectorANNS* _add = _internal_add_anns();
+  // @@protoc_insertion_point(field_add:milvus.proto.plan.HybridVectorANNS.anns)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::proto::plan::VectorANNS >&
+HybridVectorANNS::anns() const {
+  // @@protoc_insertion_point(field_list:milvus.proto.plan.HybridVectorANNS.anns)
+  return _impl_.anns_;
+}
+
+// .milvus.proto.plan.Expr predicates = 2;
+inline bool HybridVectorANNS::_internal_has_predicates() const {
+  return this != internal_default_instance() && _impl_.predicates_ != nullptr;
+}
+inline bool HybridVectorANNS::has_predicates() const {
+  return _internal_has_predicates();
+}
+inline void HybridVectorANNS::clear_predicates() {
+  if (GetArenaForAllocation() == nullptr && _impl_.predicates_ != nullptr) {
+    delete _impl_.predicates_;
+  }
+  _impl_.predicates_ = nullptr;
+}
+inline const ::milvus::proto::plan::Expr& HybridVectorANNS::_internal_predicates() const {
+  const ::milvus::proto::plan::Expr* p = _impl_.predicates_;
+  return p != nullptr ? *p : reinterpret_cast<const ::milvus::proto::plan::Expr&>(
+      ::milvus::proto::plan::_Expr_default_instance_);
+}
+inline const ::milvus::proto::plan::Expr& HybridVectorANNS::predicates() const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.predicates)
+  return _internal_predicates();
+}
+inline void HybridVectorANNS::unsafe_arena_set_allocated_predicates(
+    ::milvus::proto::plan::Expr* predicates) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.predicates_);
+  }
+  _impl_.predicates_ = predicates;
+  if (predicates) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:milvus.proto.plan.HybridVectorANNS.predicates)
+}
+inline ::milvus::proto::plan::Expr* HybridVectorANNS::release_predicates() {
+  
+  ::milvus::proto::plan::Expr* temp = _impl_.predicates_;
+  _impl_.predicates_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::milvus::proto::plan::Expr* HybridVectorANNS::unsafe_arena_release_predicates() {
+  // @@protoc_insertion_point(field_release:milvus.proto.plan.HybridVectorANNS.predicates)
+  
+  ::milvus::proto::plan::Expr* temp = _impl_.predicates_;
+  _impl_.predicates_ = nullptr;
+  return temp;
+}
+inline ::milvus::proto::plan::Expr* HybridVectorANNS::_internal_mutable_predicates() {
+  
+  if (_impl_.predicates_ == nullptr) {
+    auto* p = CreateMaybeMessage<::milvus::proto::plan::Expr>(GetArenaForAllocation());
+    _impl_.predicates_ = p;
+  }
+  return _impl_.predicates_;
+}
+inline ::milvus::proto::plan::Expr* HybridVectorANNS::mutable_predicates() {
+  ::milvus::proto::plan::Expr* _msg = _internal_mutable_predicates();
+  // @@protoc_insertion_point(field_mutable:milvus.proto.plan.HybridVectorANNS.predicates)
+  return _msg;
+}
+inline void HybridVectorANNS::set_allocated_predicates(::milvus::proto::plan::Expr* predicates) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.predicates_;
+  }
+  if (predicates) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(predicates);
+    if (message_arena != submessage_arena) {
+      predicates = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, predicates, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.predicates_ = predicates;
+  // @@protoc_insertion_point(field_set_allocated:milvus.proto.plan.HybridVectorANNS.predicates)
+}
+
+// .milvus.proto.plan.FusionType fusion_type = 3;
+inline void HybridVectorANNS::clear_fusion_type() {
+  _impl_.fusion_type_ = 0;
+}
+inline ::milvus::proto::plan::FusionType HybridVectorANNS::_internal_fusion_type() const {
+  return static_cast< ::milvus::proto::plan::FusionType >(_impl_.fusion_type_);
+}
+inline ::milvus::proto::plan::FusionType HybridVectorANNS::fusion_type() const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.fusion_type)
+  return _internal_fusion_type();
+}
+inline void HybridVectorANNS::_internal_set_fusion_type(::milvus::proto::plan::FusionType value) {
+  
+  _impl_.fusion_type_ = value;
+}
+inline void HybridVectorANNS::set_fusion_type(::milvus::proto::plan::FusionType value) {
+  _internal_set_fusion_type(value);
+  // @@protoc_insertion_point(field_set:milvus.proto.plan.HybridVectorANNS.fusion_type)
+}
+
+// repeated float weights = 4;
+inline int HybridVectorANNS::_internal_weights_size() const {
+  return _impl_.weights_.size();
+}
+inline int HybridVectorANNS::weights_size() const {
+  return _internal_weights_size();
+}
+inline void HybridVectorANNS::clear_weights() {
+  _impl_.weights_.Clear();
+}
+inline float HybridVectorANNS::_internal_weights(int index) const {
+  return _impl_.weights_.Get(index);
+}
+inline float HybridVectorANNS::weights(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.weights)
+  return _internal_weights(index);
+}
+inline void HybridVectorANNS::set_weights(int index, float value) {
+  _impl_.weights_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.proto.plan.HybridVectorANNS.weights)
+}
+inline void HybridVectorANNS::_internal_add_weights(float value) {
+  _impl_.weights_.Add(value);
+}
+inline void HybridVectorANNS::add_weights(float value) {
+  _internal_add_weights(value);
+  // @@protoc_insertion_point(field_add:milvus.proto.plan.HybridVectorANNS.weights)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HybridVectorANNS::_internal_weights() const {
+  return _impl_.weights_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+HybridVectorANNS::weights() const {
+  // @@protoc_insertion_point(field_list:milvus.proto.plan.HybridVectorANNS.weights)
+  return _internal_weights();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HybridVectorANNS::_internal_mutable_weights() {
+  return &_impl_.weights_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+HybridVectorANNS::mutable_weights() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.proto.plan.HybridVectorANNS.weights)
+  return _internal_mutable_weights();
+}
+
+// int64 rrf_k = 5;
+inline void HybridVectorANNS::clear_rrf_k() {
+  _impl_.rrf_k_ = int64_t{0};
+}
+inline int64_t HybridVectorANNS::_internal_rrf_k() const {
+  return _impl_.rrf_k_;
+}
+inline int64_t HybridVectorANNS::rrf_k() const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.rrf_k)
+  return _internal_rrf_k();
+}
+inline void HybridVectorANNS::_internal_set_rrf_k(int64_t value) {
+  
+  _impl_.rrf_k_ = value;
+}
+inline void HybridVectorANNS::set_rrf_k(int64_t value) {
+  _internal_set_rrf_k(value);
+  // @@protoc_insertion_point(field_set:milvus.proto.plan.HybridVectorANNS.rrf_k)
+}
+
+// int64 topk = 6;
+inline void HybridVectorANNS::clear_topk() {
+  _impl_.topk_ = int64_t{0};
+}
+inline int64_t HybridVectorANNS::_internal_topk() const {
+  return _impl_.topk_;
+}
+inline int64_t HybridVectorANNS::topk() const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.topk)
+  return _internal_topk();
+}
+inline void HybridVectorANNS::_internal_set_topk(int64_t value) {
+  
+  _impl_.topk_ = value;
+}
+inline void HybridVectorANNS::set_topk(int64_t value) {
+  _internal_set_topk(value);
+  // @@protoc_insertion_point(field_set:milvus.proto.plan.HybridVectorANNS.topk)
+}
+
+// int64 round_decimal = 7;
+inline void HybridVectorANNS::clear_round_decimal() {
+  _impl_.round_decimal_ = int64_t{0};
+}
+inline int64_t HybridVectorANNS::_internal_round_decimal() const {
+  return _impl_.round_decimal_;
+}
+inline int64_t HybridVectorANNS::round_decimal() const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.HybridVectorANNS.round_decimal)
+  return _internal_round_decimal();
+}
+inline void HybridVectorANNS::_internal_set_round_decimal(int64_t value) {
+  
+  _impl_.round_decimal_ = value;
+}
+inline void HybridVectorANNS::set_round_decimal(int64_t value) {
+  _internal_set_round_decimal(value);
+  // @@protoc_insertion_point(field_set:milvus.proto.plan.HybridVectorANNS.round_decimal)
+}
+
+// -------------------------------------------------------------------
+
 // QueryPlanNode
 
 // .milvus.proto.plan.Expr predicates = 1;
@@ -9464,6 +10022,80 @@ inline ::milvus::proto::plan::QueryPlanNode* PlanNode::mutable_query() {
   return _msg;
 }
 
+// .milvus.proto.plan.HybridVectorANNS hybrid_anns = 5;
+inline bool PlanNode::_internal_has_hybrid_anns() const {
+  return node_case() == kHybridAnns;
+}
+inline bool PlanNode::has_hybrid_anns() const {
+  return _internal_has_hybrid_anns();
+}
+inline void PlanNode::set_has_hybrid_anns() {
+  _impl_._oneof_case_[0] = kHybridAnns;
+}
+inline void PlanNode::clear_hybrid_anns() {
+  if (_internal_has_hybrid_anns()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.node_.hybrid_anns_;
+    }
+    clear_has_node();
+  }
+}
+inline ::milvus::proto::plan::HybridVectorANNS* PlanNode::release_hybrid_anns() {
+  // @@protoc_insertion_point(field_release:milvus.proto.plan.PlanNode.hybrid_anns)
+  if (_internal_has_hybrid_anns()) {
+    clear_has_node();
+    ::milvus::proto::plan::HybridVectorANNS* temp = _impl_.node_.hybrid_anns_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.node_.hybrid_anns_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::milvus::proto::plan::HybridVectorANNS& PlanNode::_internal_hybrid_anns() const {
+  return _internal_has_hybrid_anns()
+      ? *_impl_.node_.hybrid_anns_
+      : reinterpret_cast< ::milvus::proto::plan::HybridVectorANNS&>(::milvus::proto::plan::_HybridVectorANNS_default_instance_);
+}
+inline const ::milvus::proto::plan::HybridVectorANNS& PlanNode::hybrid_anns() const {
+  // @@protoc_insertion_point(field_get:milvus.proto.plan.PlanNode.hybrid_anns)
+  return _internal_hybrid_anns();
+}
+inline ::milvus::proto::plan::HybridVectorANNS* PlanNode::unsafe_arena_release_hybrid_anns() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:milvus.proto.plan.PlanNode.hybrid_anns)
+  if (_internal_has_hybrid_anns()) {
+    clear_has_node();
+    ::milvus::proto::plan::HybridVectorANNS* temp = _impl_.node_.hybrid_anns_;
+    _impl_.node_.hybrid_anns_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void PlanNode::unsafe_arena_set_allocated_hybrid_anns(::milvus::proto::plan::HybridVectorANNS* hybrid_anns) {
+  clear_node();
+  if (hybrid_anns) {
+    set_has_hybrid_anns();
+    _impl_.node_.hybrid_anns_ = hybrid_anns;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:milvus.proto.plan.PlanNode.hybrid_anns)
+}
+inline ::milvus::proto::plan::HybridVectorANNS* PlanNode::_internal_mutable_hybrid_anns() {
+  if (!_internal_has_hybrid_anns()) {
+    clear_node();
+    set_has_hybrid_anns();
+    _impl_.node_.hybrid_anns_ = CreateMaybeMessage< ::milvus::proto::plan::HybridVectorANNS >(GetArenaForAllocation());
+  }
+  return _impl_.node_.hybrid_anns_;
+}
+inline ::milvus::proto::plan::HybridVectorANNS* PlanNode::mutable_hybrid_anns() {
+  ::milvus::proto::plan::HybridVectorANNS* _msg = _internal_mutable_hybrid_anns();
+  // @@protoc_insertion_point(field_mutable:milvus.proto.plan.PlanNode.hybrid_anns)
+  return _msg;
+}
+
 // repeated int64 output_field_ids = 3;
 inline int PlanNode::_internal_output_field_ids_size() const {
   return _impl_.output_field_ids_.size();
@@ -9565,6 +10197,8 @@ inline PlanNode::NodeCase PlanNode::node_case() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -9599,6 +10233,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::milvus::proto::plan::ArithOpType>() {
   return ::milvus::proto::plan::ArithOpType_descriptor();
 }
+template <> struct is_proto_enum< ::milvus::proto::plan::FusionType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::milvus::proto::plan::FusionType>() {
+  return ::milvus::proto::plan::FusionType_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -69,7 +69,10 @@ CreateSearchPlanByExpr(const Schema& schema,
     // Note: serialized_expr_plan is of binary format
     proto::plan::PlanNode plan_node;
     plan_node.ParseFromArray(serialized_expr_plan, size);
-    return ProtoParser(schema).CreatePlan(plan_node);
+    auto plan = ProtoParser(schema).CreatePlan(plan_node);
+    plan->serialized_plan_.assign(
+        static_cast<const char*>(serialized_expr_plan), size);
+    return plan;
 }
 
 std::unique_ptr<RetrievePlan>
@@ -78,7 +81,10 @@ CreateRetrievePlanByExpr(const Schema& schema,
                          const int64_t size) {
     proto::plan::PlanNode plan_node;
     plan_node.ParseFromArray(serialized_expr_plan, size);
-    return ProtoParser(schema).CreateRetrievePlan(plan_node);
+    auto plan = ProtoParser(schema).CreateRetrievePlan(plan_node);
+    plan->serialized_plan_.assign(
+        static_cast<const char*>(serialized_expr_plan), size);
+    return plan;
 }
 
 int64_t
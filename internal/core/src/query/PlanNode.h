@@ -36,6 +36,9 @@ using PlanNodePtr = std::unique_ptr<PlanNode>;
 
 struct VectorPlanNode : PlanNode {
     std::optional<ExprPtr> predicate_;
+    // deterministic serialization of the predicate proto, empty if no
+    // predicate, used as key of filter bitset cache
+    std::string predicate_fingerprint_;
     SearchInfo search_info_;
     std::string placeholder_tag_;
 };
@@ -52,12 +55,37 @@ struct BinaryVectorANNS : VectorPlanNode {
     accept(PlanNodeVisitor&) override;
 };
 
+enum class FusionType {
+    WeightedSum,
+    RRF,
+};
+
+// Searches several vector fields with the shared predicate_ in one pass and
+// fuses the results of all fields into a single score, the larger the
+// better. search_info_ carries the topk and round_decimal of fused results.
+struct HybridVectorANNS : VectorPlanNode {
+ public:
+    void
+    accept(PlanNodeVisitor&) override;
+
+    // one per vector field, with its own search_info_ and placeholder_tag_,
+    // predicate_ of them is always empty
+    std::vector<std::unique_ptr<VectorPlanNode>> anns_;
+    FusionType fusion_type_ = FusionType::WeightedSum;
+    // weight of each field in anns_, used by WeightedSum
+    std::vector<float> weights_;
+    // score of a result ranked r (from 0) in a field is 1 / (rrf_k_ + r + 1)
+    int64_t rrf_k_ = 60;
+};
+
 struct RetrievePlanNode : PlanNode {
  public:
     void
     accept(PlanNodeVisitor&) override;
 
     std::optional<ExprPtr> predicate_;
+    // see VectorPlanNode::predicate_fingerprint_
+    std::string predicate_fingerprint_;
     bool is_count_;
     int64_t limit_;
 };
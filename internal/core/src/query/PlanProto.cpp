@@ -11,6 +11,8 @@
 
 #include "PlanProto.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/text_format.h>
 
 #include <cstdint>
@@ -160,11 +162,21 @@ ExtractBinaryArithOpEvalRangeExprImpl(
         getValue(expr_proto.value()));
 }
 
+// deterministic bytes of the predicate, used as filter bitset cache key
+static std::string
+ExprFingerprint(const planpb::Expr& expr_pb) {
+    std::string fingerprint;
+    {
+        google::protobuf::io::StringOutputStream stream(&fingerprint);
+        google::protobuf::io::CodedOutputStream output(&stream);
+        output.SetSerializationDeterministic(true);
+        expr_pb.SerializeToCodedStream(&output);
+    }
+    return fingerprint;
+}
+
 std::unique_ptr<VectorPlanNode>
-ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
-    // TODO: add more buffs
-    Assert(plan_node_proto.has_vector_anns());
-    auto& anns_proto = plan_node_proto.vector_anns();
+ProtoParser::VectorPlanNodeFromProto(const planpb::VectorANNS& anns_proto) {
     auto expr_opt = [&]() -> std::optional<ExprPtr> {
         if (!anns_proto.has_predicates()) {
             return std::nullopt;
@@ -193,10 +205,76 @@ ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
     }();
     plan_node->placeholder_tag_ = anns_proto.placeholder_tag();
     plan_node->predicate_ = std::move(expr_opt);
+    if (anns_proto.has_predicates()) {
+        plan_node->predicate_fingerprint_ =
+            ExprFingerprint(anns_proto.predicates());
+    }
     plan_node->search_info_ = std::move(search_info);
     return plan_node;
 }
 
+std::unique_ptr<VectorPlanNode>
+ProtoParser::HybridPlanNodeFromProto(
+    const planpb::HybridVectorANNS& hybrid_proto) {
+    AssertInfo(hybrid_proto.anns_size() > 0,
+               "hybrid search must have at least one vector field");
+    auto plan_node = std::make_unique<HybridVectorANNS>();
+    for (auto& anns_proto : hybrid_proto.anns()) {
+        auto anns = VectorPlanNodeFromProto(anns_proto);
+        // the predicates are shared by all fields
+        anns->predicate_ = std::nullopt;
+        anns->predicate_fingerprint_.clear();
+        plan_node->anns_.push_back(std::move(anns));
+    }
+
+    switch (hybrid_proto.fusion_type()) {
+        case planpb::FusionType::WeightedSum: {
+            AssertInfo(hybrid_proto.weights_size() == hybrid_proto.anns_size(),
+                       "number of weights not equal to number of vector "
+                       "fields in hybrid search");
+            plan_node->fusion_type_ = FusionType::WeightedSum;
+            plan_node->weights_.assign(hybrid_proto.weights().begin(),
+                                       hybrid_proto.weights().end());
+            break;
+        }
+        case planpb::FusionType::RRF: {
+            plan_node->fusion_type_ = FusionType::RRF;
+            if (hybrid_proto.rrf_k() > 0) {
+                plan_node->rrf_k_ = hybrid_proto.rrf_k();
+            }
+            break;
+        }
+        default:
+            PanicInfo("unsupported fusion type");
+    }
+
+    if (hybrid_proto.has_predicates()) {
+        plan_node->predicate_ = ParseExpr(hybrid_proto.predicates());
+        plan_node->predicate_fingerprint_ =
+            ExprFingerprint(hybrid_proto.predicates());
+    }
+
+    // fused scores are the larger the better, like IP
+    auto& first = plan_node->anns_.front();
+    plan_node->search_info_.field_id_ = first->search_info_.field_id_;
+    plan_node->search_info_.metric_type_ = knowhere::metric::IP;
+    plan_node->search_info_.topk_ = hybrid_proto.topk();
+    plan_node->search_info_.round_decimal_ = hybrid_proto.round_decimal();
+    plan_node->search_info_.search_params_ = json::object();
+    plan_node->placeholder_tag_ = first->placeholder_tag_;
+    return plan_node;
+}
+
+std::unique_ptr<VectorPlanNode>
+ProtoParser::PlanNodeFromProto(const planpb::PlanNode& plan_node_proto) {
+    // TODO: add more buffs
+    if (plan_node_proto.has_hybrid_anns()) {
+        return HybridPlanNodeFromProto(plan_node_proto.hybrid_anns());
+    }
+    Assert(plan_node_proto.has_vector_anns());
+    return VectorPlanNodeFromProto(plan_node_proto.vector_anns());
+}
+
 std::unique_ptr<RetrievePlanNode>
 ProtoParser::RetrievePlanNodeFromProto(
     const planpb::PlanNode& plan_node_proto) {
@@ -211,6 +289,7 @@ ProtoParser::RetrievePlanNodeFromProto(
                 return ParseExpr(predicate_proto);
             }();
             node->predicate_ = std::move(expr_opt);
+            node->predicate_fingerprint_ = ExprFingerprint(predicate_proto);
         } else {
             auto& query = plan_node_proto.query();
             if (query.has_predicates()) {
@@ -219,6 +298,7 @@ ProtoParser::RetrievePlanNodeFromProto(
                     return ParseExpr(predicate_proto);
                 }();
                 node->predicate_ = std::move(expr_opt);
+                node->predicate_fingerprint_ = ExprFingerprint(predicate_proto);
             }
             node->is_count_ = query.is_count();
             node->limit_ = query.limit();
@@ -238,7 +318,16 @@ ProtoParser::CreatePlan(const proto::plan::PlanNode& plan_node_proto) {
     ExtractInfoPlanNodeVisitor extractor(plan_info);
     plan_node->accept(extractor);
 
-    plan->tag2field_["$0"] = plan_node->search_info_.field_id_;
+    if (auto hybrid = dynamic_cast<HybridVectorANNS*>(plan_node.get())) {
+        for (auto& anns : hybrid->anns_) {
+            auto& tag = anns->placeholder_tag_;
+            AssertInfo(plan->tag2field_.count(tag) == 0,
+                       "duplicated placeholder tag " + tag);
+            plan->tag2field_[tag] = anns->search_info_.field_id_;
+        }
+    } else {
+        plan->tag2field_["$0"] = plan_node->search_info_.field_id_;
+    }
     plan->plan_node_ = std::move(plan_node);
     plan->extra_info_opt_ = std::move(plan_info);
 
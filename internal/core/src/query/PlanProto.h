@@ -60,6 +60,12 @@ class ProtoParser {
     ExprPtr
     ParseExpr(const proto::plan::Expr& expr_pb);
 
+    std::unique_ptr<VectorPlanNode>
+    VectorPlanNodeFromProto(const proto::plan::VectorANNS& anns_proto);
+
+    std::unique_ptr<VectorPlanNode>
+    HybridPlanNodeFromProto(const proto::plan::HybridVectorANNS& hybrid_proto);
+
     std::unique_ptr<VectorPlanNode>
     PlanNodeFromProto(const proto::plan::PlanNode& plan_node_proto);
 
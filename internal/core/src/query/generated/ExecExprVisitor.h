@@ -102,6 +102,27 @@ class ExecExprVisitor : public ExprVisitor {
                              IndexFunc index_func,
                              ElementFunc element_func) -> BitsetType;
 
+    // evaluate lower <= x <= upper, or the reverse, on the encoded column
+    // of the field, nullopt if the field isn't kept encoded
+    template <typename T>
+    auto
+    ExecEncodedRangeVisitorImpl(FieldId field_id,
+                                T lower,
+                                T upper,
+                                bool reverse) -> std::optional<BitsetType>;
+
+    template <typename T>
+    auto
+    ExecEncodedTermVisitorImpl(FieldId field_id, const std::vector<T>& terms)
+        -> std::optional<BitsetType>;
+
+    // evaluate func(column) on the encoded column of a string field, nullopt
+    // if the field isn't kept encoded
+    template <typename Func>
+    auto
+    ExecEncodedStringVisitorImpl(FieldId field_id, Func func)
+        -> std::optional<BitsetType>;
+
     template <typename T>
     auto
     ExecUnaryRangeVisitorDispatcherImpl(UnaryRangeExpr& expr_raw) -> BitsetType;
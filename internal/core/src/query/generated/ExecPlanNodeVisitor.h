@@ -27,6 +27,9 @@ class ExecPlanNodeVisitor : public PlanNodeVisitor {
     void
     visit(BinaryVectorANNS& node) override;
 
+    void
+    visit(HybridVectorANNS& node) override;
+
     void
     visit(RetrievePlanNode& node) override;
 
@@ -68,6 +71,11 @@ class ExecPlanNodeVisitor : public PlanNodeVisitor {
         return ret;
     }
 
+    // evaluate the filter of node with timestamps and deletions applied,
+    // `true` means filtered out
+    BitsetType
+    get_filter_bitset(VectorPlanNode& node, int64_t active_count);
+
     void
     SetExprCacheOffsets(std::vector<int64_t>&& offsets) {
         expr_cached_pk_id_offsets_ = std::move(offsets);
@@ -98,6 +106,23 @@ class ExecPlanNodeVisitor : public PlanNodeVisitor {
     void
     VectorVisitorImpl(VectorPlanNode& node);
 
+    // search the rows not filtered out by bitset, brute force on them if
+    // there are only a few
+    SearchResult
+    SearchWithBitset(SearchInfo& search_info,
+                     const void* src_data,
+                     int64_t num_queries,
+                     const BitsetType& bitset,
+                     int64_t active_count);
+
+    // evaluate predicate and mask the result with timestamps and deletions,
+    // `true` means filtered out. Served by the filter bitset cache of the
+    // segment if it has one.
+    BitsetType
+    ExecPredicate(const Expr& predicate,
+                  const std::string& fingerprint,
+                  int64_t active_count);
+
  private:
     const segcore::SegmentInterface& segment_;
     Timestamp timestamp_;
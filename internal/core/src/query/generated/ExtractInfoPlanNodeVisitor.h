@@ -24,6 +24,9 @@ class ExtractInfoPlanNodeVisitor : public PlanNodeVisitor {
     void
     visit(BinaryVectorANNS& node) override;
 
+    void
+    visit(HybridVectorANNS& node) override;
+
     void
     visit(RetrievePlanNode& node) override;
 
@@ -25,6 +25,11 @@ BinaryVectorANNS::accept(PlanNodeVisitor& visitor) {
     visitor.visit(*this);
 }
 
+void
+HybridVectorANNS::accept(PlanNodeVisitor& visitor) {
+    visitor.visit(*this);
+}
+
 void
 RetrievePlanNode::accept(PlanNodeVisitor& visitor) {
     visitor.visit(*this);
@@ -25,6 +25,9 @@ class PlanNodeVisitor {
     virtual void
     visit(BinaryVectorANNS&) = 0;
 
+    virtual void
+    visit(HybridVectorANNS&) = 0;
+
     virtual void
     visit(RetrievePlanNode&) = 0;
 };
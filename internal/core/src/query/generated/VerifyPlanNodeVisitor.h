@@ -27,6 +27,9 @@ class VerifyPlanNodeVisitor : public PlanNodeVisitor {
     void
     visit(BinaryVectorANNS& node) override;
 
+    void
+    visit(HybridVectorANNS& node) override;
+
     void
     visit(RetrievePlanNode& node) override;
 
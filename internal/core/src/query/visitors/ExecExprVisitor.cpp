@@ -35,6 +35,7 @@
 #include "segcore/SegmentGrowingImpl.h"
 #include "simdjson/error.h"
 #include "query/PlanProto.h"
+#include "mmap/EncodedColumn.h"
 #include "simd/hook.h"
 
 namespace milvus::query {
@@ -263,6 +264,68 @@ AssembleChunk(const std::vector<FixedVector<bool>>& results) {
     return assemble_result;
 }
 
+template <typename T>
+auto
+ExecExprVisitor::ExecEncodedRangeVisitorImpl(FieldId field_id,
+                                             T lower,
+                                             T upper,
+                                             bool reverse)
+    -> std::optional<BitsetType> {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        auto column = segment_.get_encoded_column(field_id);
+        if (column == nullptr) {
+            return std::nullopt;
+        }
+        auto res = static_cast<const EncodedColumn<T>*>(column.get())
+                       ->InRange(lower, upper);
+        if (reverse) {
+            for (auto& bit : res) {
+                bit = !bit;
+            }
+        }
+        auto final_result = AssembleChunk({res});
+        AssertInfo(final_result.size() == row_count_,
+                   "[ExecExprVisitor]Final result size not equal to row count");
+        return final_result;
+    }
+    return std::nullopt;
+}
+
+template <typename T>
+auto
+ExecExprVisitor::ExecEncodedTermVisitorImpl(FieldId field_id,
+                                            const std::vector<T>& terms)
+    -> std::optional<BitsetType> {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        auto column = segment_.get_encoded_column(field_id);
+        if (column == nullptr) {
+            return std::nullopt;
+        }
+        auto res = static_cast<const EncodedColumn<T>*>(column.get())
+                       ->In(terms.data(), terms.size());
+        auto final_result = AssembleChunk({res});
+        AssertInfo(final_result.size() == row_count_,
+                   "[ExecExprVisitor]Final result size not equal to row count");
+        return final_result;
+    }
+    return std::nullopt;
+}
+
+template <typename Func>
+auto
+ExecExprVisitor::ExecEncodedStringVisitorImpl(FieldId field_id, Func func)
+    -> std::optional<BitsetType> {
+    auto column = segment_.get_encoded_column(field_id);
+    if (column == nullptr) {
+        return std::nullopt;
+    }
+    auto res = func(*static_cast<const EncodedStringColumn*>(column.get()));
+    auto final_result = AssembleChunk({res});
+    AssertInfo(final_result.size() == row_count_,
+               "[ExecExprVisitor]Final result size not equal to row count");
+    return final_result;
+}
+
 template <typename T, typename IndexFunc, typename ElementFunc>
 auto
 ExecExprVisitor::ExecRangeVisitorImpl(FieldId field_id,
@@ -280,6 +343,23 @@ ExecExprVisitor::ExecRangeVisitorImpl(FieldId field_id,
         conditional_t<std::is_same_v<T, std::string_view>, std::string, T>
             IndexInnerType;
     using Index = index::ScalarIndex<IndexInnerType>;
+    if constexpr (!std::is_same_v<T, milvus::Json>) {
+        // the growing index covers all the rows, the rows inserted after
+        // row_count_ are cut off
+        auto growing_index = dynamic_cast<const Index*>(
+            segment_.get_growing_index(field_id));
+        if (growing_index != nullptr) {
+            auto data = index_func(const_cast<Index*>(growing_index));
+            AssertInfo(data.size() >= row_count_,
+                       "[ExecExprVisitor]Growing index lags behind row count");
+            data.resize(row_count_);
+            auto final_result = AssembleChunk({data});
+            AssertInfo(
+                final_result.size() == row_count_,
+                "[ExecExprVisitor]Final result size not equal to row count");
+            return final_result;
+        }
+    }
     for (auto chunk_id = 0; chunk_id < indexing_barrier; ++chunk_id) {
         const Index& indexing =
             segment_.chunk_scalar_index<IndexInnerType>(field_id, chunk_id);
@@ -296,10 +376,9 @@ ExecExprVisitor::ExecRangeVisitorImpl(FieldId field_id,
                              : size_per_chunk;
         FixedVector<bool> chunk_res(this_size);
         auto chunk = segment_.chunk_data<T>(field_id, chunk_id);
-        const T* data = chunk.data();
         // Can use CPU SIMD optimazation to speed up
         for (int index = 0; index < this_size; ++index) {
-            chunk_res[index] = element_func(data[index]);
+            chunk_res[index] = element_func(chunk[index]);
         }
         results.emplace_back(std::move(chunk_res));
     }
@@ -336,9 +415,8 @@ ExecExprVisitor::ExecDataRangeVisitorImpl(FieldId field_id,
                              : size_per_chunk;
         FixedVector<bool> result(this_size);
         auto chunk = segment_.chunk_data<T>(field_id, chunk_id);
-        const T* data = chunk.data();
         for (int index = 0; index < this_size; ++index) {
-            result[index] = element_func(data[index]);
+            result[index] = element_func(chunk[index]);
         }
         AssertInfo(result.size() == this_size,
                    "[ExecExprVisitor]Chunk result size not equal to "
@@ -385,6 +463,83 @@ ExecExprVisitor::ExecUnaryRangeVisitorDispatcherImpl(UnaryRangeExpr& expr_raw)
     auto op = expr.op_type_;
     auto val = IndexInnerType(expr.value_);
     auto field_id = expr.column_.field_id;
+
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        // as lower <= x <= upper, lower > upper matches nothing
+        constexpr auto min = std::numeric_limits<T>::min();
+        constexpr auto max = std::numeric_limits<T>::max();
+        std::optional<BitsetType> res;
+        switch (op) {
+            case OpType::Equal:
+                res = ExecEncodedRangeVisitorImpl<T>(field_id, val, val, false);
+                break;
+            case OpType::NotEqual:
+                res = ExecEncodedRangeVisitorImpl<T>(field_id, val, val, true);
+                break;
+            case OpType::GreaterEqual:
+                res = ExecEncodedRangeVisitorImpl<T>(field_id, val, max, false);
+                break;
+            case OpType::GreaterThan:
+                res = val == max ? ExecEncodedRangeVisitorImpl<T>(
+                                       field_id, max, min, false)
+                                 : ExecEncodedRangeVisitorImpl<T>(
+                                       field_id, val + 1, max, false);
+                break;
+            case OpType::LessEqual:
+                res = ExecEncodedRangeVisitorImpl<T>(field_id, min, val, false);
+                break;
+            case OpType::LessThan:
+                res = val == min ? ExecEncodedRangeVisitorImpl<T>(
+                                       field_id, max, min, false)
+                                 : ExecEncodedRangeVisitorImpl<T>(
+                                       field_id, min, val - 1, false);
+                break;
+            default:
+                break;
+        }
+        if (res.has_value()) {
+            return std::move(res.value());
+        }
+    }
+
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        auto res = ExecEncodedStringVisitorImpl(
+            field_id,
+            [&](const EncodedStringColumn& column) -> TargetBitmap {
+                switch (op) {
+                    case OpType::Equal:
+                        return column.In(&val, 1);
+                    case OpType::NotEqual: {
+                        auto matched = column.In(&val, 1);
+                        for (auto& bit : matched) {
+                            bit = !bit;
+                        }
+                        return matched;
+                    }
+                    case OpType::GreaterEqual:
+                        return column.Range(val, true, std::nullopt, false);
+                    case OpType::GreaterThan:
+                        return column.Range(val, false, std::nullopt, false);
+                    case OpType::LessEqual:
+                        return column.Range(std::nullopt, false, val, true);
+                    case OpType::LessThan:
+                        return column.Range(std::nullopt, false, val, false);
+                    case OpType::PrefixMatch:
+                        return column.PrefixMatch(val);
+                    case OpType::PostfixMatch:
+                    case OpType::InfixMatch:
+                        return column.MatchIf([&](std::string_view value) {
+                            return Match(value, val, op);
+                        });
+                    default:
+                        PanicInfo("unsupported range node");
+                }
+            });
+        if (res.has_value()) {
+            return std::move(res.value());
+        }
+    }
+
     switch (op) {
         case OpType::Equal: {
             auto index_func = [&](Index* index) { return index->In(1, &val); };
@@ -438,7 +593,19 @@ ExecExprVisitor::ExecUnaryRangeVisitorDispatcherImpl(UnaryRangeExpr& expr_raw)
             };
             return ExecRangeVisitorImpl<T>(field_id, index_func, elem_func);
         }
-        // TODO: PostfixMatch
+        case OpType::PostfixMatch:
+        case OpType::InfixMatch: {
+            auto index_func = [&](Index* index) {
+                auto dataset = std::make_unique<Dataset>();
+                dataset->Set(milvus::index::OPERATOR_TYPE, op);
+                dataset->Set(milvus::index::MATCH_VALUE, val);
+                return index->Query(std::move(dataset));
+            };
+            auto elem_func = [&](MayConstRef<T> x) {
+                return Match(x, val, op);
+            };
+            return ExecRangeVisitorImpl<T>(field_id, index_func, elem_func);
+        }
         default: {
             PanicInfo("unsupported range node");
         }
@@ -587,14 +754,15 @@ ExecExprVisitor::ExecUnaryRangeVisitorDispatcherJson(UnaryRangeExpr& expr_raw)
             return ExecRangeVisitorImpl<milvus::Json>(
                 field_id, index_func, elem_func);
         }
-        case OpType::PrefixMatch: {
+        case OpType::PrefixMatch:
+        case OpType::PostfixMatch:
+        case OpType::InfixMatch: {
             auto elem_func = [&](const milvus::Json& json) {
                 UnaryRangeJSONCompare(Match(ExprValueType(x.value()), val, op));
             };
             return ExecRangeVisitorImpl<milvus::Json>(
                 field_id, index_func, elem_func);
         }
-        // TODO: PostfixMatch
         default: {
             PanicInfo("unsupported range node");
         }
@@ -996,6 +1164,41 @@ ExecExprVisitor::ExecBinaryRangeVisitorDispatcher(BinaryRangeExpr& expr_raw)
         }
     }
 
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<bool, T>) {
+        // val1 and val2 are in the range of T here, as lower <= x <= upper,
+        // lower > upper matches nothing
+        constexpr auto min = std::numeric_limits<T>::min();
+        constexpr auto max = std::numeric_limits<T>::max();
+        T lower = static_cast<T>(val1);
+        T upper = static_cast<T>(val2);
+        bool empty = (!lower_inclusive && lower == max) ||
+                     (!upper_inclusive && upper == min);
+        if (!lower_inclusive && !empty) {
+            ++lower;
+        }
+        if (!upper_inclusive && !empty) {
+            --upper;
+        }
+        auto res = empty ? ExecEncodedRangeVisitorImpl<T>(
+                               expr.column_.field_id, max, min, false)
+                         : ExecEncodedRangeVisitorImpl<T>(
+                               expr.column_.field_id, lower, upper, false);
+        if (res.has_value()) {
+            return std::move(res.value());
+        }
+    }
+
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        auto res = ExecEncodedStringVisitorImpl(
+            expr.column_.field_id, [&](const EncodedStringColumn& column) {
+                return column.Range(
+                    val1, lower_inclusive, val2, upper_inclusive);
+            });
+        if (res.has_value()) {
+            return std::move(res.value());
+        }
+    }
+
     auto index_func = [=](Index* index) {
         return index->Range(val1, lower_inclusive, val2, upper_inclusive);
     };
@@ -1630,10 +1833,9 @@ ExecExprVisitor::ExecCompareExprDispatcher(CompareExpr& expr, Op op)
                                 return chunk_data[i];
                             };
                         } else {
-                            auto chunk_data = segment_
-                                                  .chunk_data<std::string_view>(
-                                                      field_id, chunk_id)
-                                                  .data();
+                            auto chunk_data =
+                                segment_.chunk_data<std::string_view>(
+                                    field_id, chunk_id);
                             return [chunk_data](int i) -> const number {
                                 return std::string(chunk_data[i]);
                             };
@@ -1796,6 +1998,22 @@ ExecExprVisitor::ExecTermVisitorImplTemplate(TermExpr& expr_raw) -> BitsetType {
     auto& expr = static_cast<TermExprImpl<IndexInnerType>&>(expr_raw);
     const auto& terms = expr.terms_;
     auto n = terms.size();
+
+    if constexpr (std::is_integral_v<T>) {
+        auto res = ExecEncodedTermVisitorImpl<T>(expr.column_.field_id, terms);
+        if (res.has_value()) {
+            return std::move(res.value());
+        }
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+        auto res = ExecEncodedStringVisitorImpl(
+            expr.column_.field_id, [&](const EncodedStringColumn& column) {
+                return column.In(terms.data(), n);
+            });
+        if (res.has_value()) {
+            return std::move(res.value());
+        }
+    }
+
     std::unordered_set<T> term_set(expr.terms_.begin(), expr.terms_.end());
 
     auto index_func = [&terms, n](Index* index) {
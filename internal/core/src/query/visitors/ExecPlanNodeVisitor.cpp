@@ -11,11 +11,15 @@
 
 #include "query/generated/ExecPlanNodeVisitor.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
 #include <utility>
 
 #include "query/PlanImpl.h"
 #include "query/SubSearchResult.h"
 #include "query/generated/ExecExprVisitor.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentGrowing.h"
 #include "utils/Json.h"
 #include "log/Log.h"
@@ -73,6 +77,76 @@ empty_search_result(int64_t num_queries, SearchInfo& search_info) {
     return final_result;
 }
 
+BitsetType
+ExecPlanNodeVisitor::ExecPredicate(const Expr& predicate,
+                                   const std::string& fingerprint,
+                                   int64_t active_count) {
+    auto segment =
+        dynamic_cast<const segcore::SegmentInternalInterface*>(&segment_);
+    AssertInfo(segment, "support SegmentSmallIndex Only");
+    auto cache = segment->get_filter_bitset_cache();
+    if (cache == nullptr || fingerprint.empty()) {
+        BitsetType bitset =
+            ExecExprVisitor(*segment, this, active_count, timestamp_)
+                .call_child(predicate);
+        bitset.flip();
+        segment->mask_with_timestamps(bitset, timestamp_);
+        segment->mask_with_delete(bitset, active_count, timestamp_);
+        return bitset;
+    }
+
+    auto key =
+        segment->get_filter_cache_key(fingerprint, active_count, timestamp_);
+    auto del_barrier = segment->get_delete_barrier(timestamp_);
+    auto entry =
+        cache->Get(key).value_or(segcore::FilterBitsetCache::Entry{});
+    if (entry.predicate == nullptr) {
+        entry.predicate = std::make_shared<const BitsetType>(
+            ExecExprVisitor(*segment, this, active_count, timestamp_)
+                .call_child(predicate));
+        entry.use_pk_index = expr_use_pk_index_;
+        entry.pk_offsets = std::make_shared<const std::vector<int64_t>>(
+            expr_cached_pk_id_offsets_);
+    } else {
+        // restore the side effects of term expr on pk
+        expr_use_pk_index_ = entry.use_pk_index;
+        expr_cached_pk_id_offsets_ = *entry.pk_offsets;
+    }
+    if (entry.masked != nullptr && entry.del_barrier == del_barrier) {
+        return *entry.masked;
+    }
+
+    BitsetType bitset = *entry.predicate;
+    bitset.flip();
+    segment->mask_with_timestamps(bitset, timestamp_);
+    segment->mask_with_delete(bitset, active_count, timestamp_);
+    // a concurrent delete may be applied or not, don't know which one
+    if (segment->get_delete_barrier(timestamp_) == del_barrier) {
+        entry.masked = std::make_shared<const BitsetType>(bitset);
+        entry.del_barrier = del_barrier;
+    }
+    cache->Put(key, std::move(entry));
+    return bitset;
+}
+
+BitsetType
+ExecPlanNodeVisitor::get_filter_bitset(VectorPlanNode& node,
+                                       int64_t active_count) {
+    if (node.predicate_.has_value()) {
+        return ExecPredicate(*node.predicate_.value(),
+                             node.predicate_fingerprint_,
+                             active_count);
+    }
+    auto segment =
+        dynamic_cast<const segcore::SegmentInternalInterface*>(&segment_);
+    AssertInfo(segment, "support SegmentSmallIndex Only");
+    BitsetType bitset(active_count, false);
+    segment->mask_with_timestamps(bitset, timestamp_);
+
+    segment->mask_with_delete(bitset, active_count, timestamp_);
+    return bitset;
+}
+
 template <typename VectorType>
 void
 ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
@@ -81,7 +155,6 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
     auto segment =
         dynamic_cast<const segcore::SegmentInternalInterface*>(&segment_);
     AssertInfo(segment, "support SegmentSmallIndex Only");
-    SearchResult search_result;
     auto& ph = placeholder_group_->at(0);
     auto src_data = ph.get_blob<EmbeddedType<VectorType>>();
     auto num_queries = ph.num_of_queries_;
@@ -97,18 +170,8 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
         return;
     }
 
-    std::unique_ptr<BitsetType> bitset_holder;
-    if (node.predicate_.has_value()) {
-        bitset_holder = std::make_unique<BitsetType>(
-            ExecExprVisitor(*segment, this, active_count, timestamp_)
-                .call_child(*node.predicate_.value()));
-        bitset_holder->flip();
-    } else {
-        bitset_holder = std::make_unique<BitsetType>(active_count, false);
-    }
-    segment->mask_with_timestamps(*bitset_holder, timestamp_);
-
-    segment->mask_with_delete(*bitset_holder, active_count, timestamp_);
+    auto bitset_holder =
+        std::make_unique<BitsetType>(get_filter_bitset(node, active_count));
 
     // if bitset_holder is all 1's, we got empty result
     if (bitset_holder->all()) {
@@ -116,15 +179,191 @@ ExecPlanNodeVisitor::VectorVisitorImpl(VectorPlanNode& node) {
             empty_search_result(num_queries, node.search_info_);
         return;
     }
-    BitsetView final_view = *bitset_holder;
-    segment->vector_search(node.search_info_,
+
+    search_result_opt_ = SearchWithBitset(node.search_info_,
+                                          src_data,
+                                          num_queries,
+                                          *bitset_holder,
+                                          active_count);
+}
+
+SearchResult
+ExecPlanNodeVisitor::SearchWithBitset(SearchInfo& search_info,
+                                      const void* src_data,
+                                      int64_t num_queries,
+                                      const BitsetType& bitset,
+                                      int64_t active_count) {
+    auto segment =
+        dynamic_cast<const segcore::SegmentInternalInterface*>(&segment_);
+    AssertInfo(segment, "support SegmentSmallIndex Only");
+    SearchResult search_result;
+
+    // a very selective filter leaves few rows, the index would traverse
+    // mostly filtered out nodes, brute force on the left ones is cheaper
+    // and gives exact results
+    auto left_count = bitset.size() - bitset.count();
+    auto ratio = segcore::SegcoreConfig::default_config()
+                     .get_brute_force_filter_ratio();
+    if (ratio > 0 && left_count <= active_count * ratio &&
+        segment->has_raw_data(search_info.field_id_)) {
+        std::vector<int64_t> offsets;
+        offsets.reserve(left_count);
+        auto left = ~bitset;
+        for (auto i = left.find_first(); i != BitsetType::npos;
+             i = left.find_next(i)) {
+            offsets.push_back(i);
+        }
+        segment->vector_search_on_offsets(
+            search_info, src_data, num_queries, offsets, search_result);
+        return search_result;
+    }
+
+    BitsetView final_view = bitset;
+    segment->vector_search(search_info,
                            src_data,
                            num_queries,
                            timestamp_,
                            final_view,
                            search_result);
+    return search_result;
+}
 
-    search_result_opt_ = std::move(search_result);
+// map distances of any metric into (0, 1], the larger the more similar,
+// so that the scores of different fields can be summed up
+static float
+normalize_score(const MetricType& metric_type, float distance) {
+    if (IsMetricType(metric_type, knowhere::metric::COSINE)) {
+        return (1 + distance) / 2;
+    }
+    if (PositivelyRelated(metric_type)) {
+        return 0.5 + std::atan(distance) / M_PI;
+    }
+    return 1.0 - 2 * std::atan(distance) / M_PI;
+}
+
+// fuse the results of each field of node into the top-k scores
+static SearchResult
+fuse_search_results(HybridVectorANNS& node,
+                    const std::vector<SearchResult>& field_results,
+                    int64_t num_queries) {
+    auto& info = node.search_info_;
+    SubSearchResult fused(
+        num_queries, info.topk_, info.metric_type_, info.round_decimal_);
+    std::unordered_map<int64_t, float> scores;
+    std::vector<std::pair<float, int64_t>> candidates;
+    for (int64_t q = 0; q < num_queries; ++q) {
+        scores.clear();
+        for (size_t i = 0; i < field_results.size(); ++i) {
+            auto& result = field_results[i];
+            auto& metric_type = node.anns_[i]->search_info_.metric_type_;
+            auto topk = result.unity_topK_;
+            int64_t rank = 0;
+            for (int64_t j = q * topk; j < (q + 1) * topk; ++j) {
+                auto offset = result.seg_offsets_[j];
+                if (offset == INVALID_SEG_OFFSET) {
+                    continue;
+                }
+                float score = 0;
+                if (node.fusion_type_ == FusionType::RRF) {
+                    score = 1.0 / (node.rrf_k_ + rank + 1);
+                } else {
+                    score = node.weights_[i] *
+                            normalize_score(metric_type,
+                                            result.distances_[j]);
+                }
+                scores[offset] += score;
+                ++rank;
+            }
+        }
+
+        candidates.clear();
+        for (auto& [offset, score] : scores) {
+            candidates.emplace_back(score, offset);
+        }
+        auto count = std::min<int64_t>(info.topk_, candidates.size());
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + count,
+                          candidates.end(),
+                          [](auto& lhs, auto& rhs) {
+                              return lhs.first > rhs.first ||
+                                     (lhs.first == rhs.first &&
+                                      lhs.second < rhs.second);
+                          });
+        for (int64_t j = 0; j < count; ++j) {
+            fused.get_distances()[q * info.topk_ + j] = candidates[j].first;
+            fused.get_seg_offsets()[q * info.topk_ + j] =
+                candidates[j].second;
+        }
+    }
+    fused.round_values();
+
+    SearchResult final_result;
+    final_result.total_nq_ = num_queries;
+    final_result.unity_topK_ = info.topk_;
+    final_result.seg_offsets_ = std::move(fused.mutable_seg_offsets());
+    final_result.distances_ = std::move(fused.mutable_distances());
+    return final_result;
+}
+
+void
+ExecPlanNodeVisitor::visit(HybridVectorANNS& node) {
+    assert(!search_result_opt_.has_value());
+    auto segment =
+        dynamic_cast<const segcore::SegmentInternalInterface*>(&segment_);
+    AssertInfo(segment, "support SegmentSmallIndex Only");
+    auto num_queries = placeholder_group_->at(0).num_of_queries_;
+    auto active_count = segment->get_active_count(timestamp_);
+    if (active_count == 0) {
+        search_result_opt_ =
+            empty_search_result(num_queries, node.search_info_);
+        return;
+    }
+
+    // the predicate, timestamps and deletions are applied once for all
+    // fields
+    auto bitset = get_filter_bitset(node, active_count);
+    if (bitset.all()) {
+        search_result_opt_ =
+            empty_search_result(num_queries, node.search_info_);
+        return;
+    }
+
+    std::vector<SearchResult> field_results;
+    field_results.reserve(node.anns_.size());
+    for (auto& anns : node.anns_) {
+        auto ph = std::find_if(
+            placeholder_group_->begin(),
+            placeholder_group_->end(),
+            [&](auto& placeholder) {
+                return placeholder.tag_ == anns->placeholder_tag_;
+            });
+        AssertInfo(ph != placeholder_group_->end(),
+                   "no placeholder of tag " + anns->placeholder_tag_);
+        AssertInfo(ph->num_of_queries_ == num_queries,
+                   "number of queries of all vector fields in hybrid search "
+                   "must be the same");
+        field_results.push_back(SearchWithBitset(anns->search_info_,
+                                                 ph->blob_.data(),
+                                                 num_queries,
+                                                 bitset,
+                                                 active_count));
+    }
+    search_result_opt_ =
+        fuse_search_results(node, field_results, num_queries);
+
+    // the ranks in this segment are not the ones among all segments, keep
+    // the results of fields for reduce to fuse them again
+    if (node.fusion_type_ == FusionType::RRF) {
+        for (size_t i = 0; i < field_results.size(); ++i) {
+            auto& metric_type = node.anns_[i]->search_info_.metric_type_;
+            if (!PositivelyRelated(metric_type)) {
+                for (auto& distance : field_results[i].distances_) {
+                    distance = -distance;
+                }
+            }
+        }
+        search_result_opt_->field_results_ = std::move(field_results);
+    }
 }
 
 std::unique_ptr<RetrieveResult>
@@ -166,15 +405,14 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
     }
 
     if (node.predicate_.has_value() && node.predicate_.value() != nullptr) {
-        bitset_holder =
-            ExecExprVisitor(*segment, this, active_count, timestamp_)
-                .call_child(*(node.predicate_.value()));
-        bitset_holder.flip();
-    }
-
-    segment->mask_with_timestamps(bitset_holder, timestamp_);
+        bitset_holder = ExecPredicate(*(node.predicate_.value()),
+                                      node.predicate_fingerprint_,
+                                      active_count);
+    } else {
+        segment->mask_with_timestamps(bitset_holder, timestamp_);
 
-    segment->mask_with_delete(bitset_holder, active_count, timestamp_);
+        segment->mask_with_delete(bitset_holder, active_count, timestamp_);
+    }
     // if bitset_holder is all 1's, we got empty result
     if (bitset_holder.all() && !node.is_count_) {
         retrieve_result_opt_ = std::move(retrieve_result);
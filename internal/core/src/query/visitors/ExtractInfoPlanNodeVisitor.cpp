@@ -47,6 +47,17 @@ ExtractInfoPlanNodeVisitor::visit(BinaryVectorANNS& node) {
     }
 }
 
+void
+ExtractInfoPlanNodeVisitor::visit(HybridVectorANNS& node) {
+    for (auto& anns : node.anns_) {
+        plan_info_.add_involved_field(anns->search_info_.field_id_);
+    }
+    if (node.predicate_.has_value()) {
+        ExtractInfoExprVisitor expr_visitor(plan_info_);
+        node.predicate_.value()->accept(expr_visitor);
+    }
+}
+
 void
 ExtractInfoPlanNodeVisitor::visit(RetrievePlanNode& node) {
     // Assert(node.predicate_.has_value());
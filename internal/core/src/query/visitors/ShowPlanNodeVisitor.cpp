@@ -96,6 +96,36 @@ ShowPlanNodeVisitor::visit(BinaryVectorANNS& node) {
     ret_ = json_body;
 }
 
+void
+ShowPlanNodeVisitor::visit(HybridVectorANNS& node) {
+    assert(!ret_);
+    auto& info = node.search_info_;
+    auto anns_json = Json::array();
+    for (auto& anns : node.anns_) {
+        anns_json.push_back(ShowPlanNodeVisitor().call_child(*anns));
+    }
+    auto fusion_type =
+        node.fusion_type_ == FusionType::RRF ? "RRF" : "WeightedSum";
+    Json json_body{
+        {"node_type", "HybridVectorANNS"},  //
+        {"fusion_type", fusion_type},       //
+        {"weights", node.weights_},         //
+        {"rrf_k", node.rrf_k_},             //
+        {"topk", info.topk_},               //
+        {"anns", anns_json},                //
+    };
+    if (node.predicate_.has_value()) {
+        ShowExprVisitor expr_show;
+        AssertInfo(node.predicate_.value(),
+                   "[ShowPlanNodeVisitor]Can't get value from node predict");
+        json_body["predicate"] =
+            expr_show.call_child(node.predicate_->operator*());
+    } else {
+        json_body["predicate"] = "None";
+    }
+    ret_ = json_body;
+}
+
 void
 ShowPlanNodeVisitor::visit(RetrievePlanNode& node) {
 }
@@ -67,6 +67,10 @@ void
 VerifyPlanNodeVisitor::visit(BinaryVectorANNS&) {
 }
 
+void
+VerifyPlanNodeVisitor::visit(HybridVectorANNS&) {
+}
+
 void
 VerifyPlanNodeVisitor::visit(RetrievePlanNode&) {
 }
@@ -9,14 +9,18 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <algorithm>
+#include <exception>
+#include <future>
 #include <string>
 #include <thread>
-#include "index/ScalarIndexSort.h"
-#include "index/StringIndexSort.h"
+#include <vector>
 
 #include "common/SystemProperty.h"
 #include "segcore/FieldIndexing.h"
+#include "index/Utils.h"
 #include "index/VectorMemNMIndex.h"
+#include "storage/ThreadPools.h"
 #include "IndexConfigGenerator.h"
 
 namespace milvus::segcore {
@@ -30,8 +34,24 @@ VectorFieldIndexing::VectorFieldIndexing(const FieldMeta& field_meta,
           segment_max_row_count, field_index_meta, segcore_config)),
       build(false),
       sync_with_index(false) {
-    index_ = std::make_unique<index::VectorMemIndex>(config_->GetIndexType(),
-                                                     config_->GetMetricType());
+    if (config_->GetIndexType() == knowhere::IndexEnum::INDEX_HNSW) {
+        // the graph needs no training, it takes the rows from the first on
+        auto conf = get_build_params();
+        index_ = std::make_unique<index::GrowingHnswIndex>(
+            field_meta_.get_dim(),
+            config_->GetMetricType(),
+            index::GetIntParamFromConfig(
+                conf, knowhere::indexparam::M, index::HnswGraph::kDefaultM),
+            index::GetIntParamFromConfig(
+                conf,
+                knowhere::indexparam::EFCONSTRUCTION,
+                index::HnswGraph::kDefaultEfConstruction));
+        build = true;
+        sync_with_index = true;
+    } else {
+        index_ = std::make_unique<index::VectorMemIndex>(
+            config_->GetIndexType(), config_->GetMetricType());
+    }
 }
 
 void
@@ -83,6 +103,16 @@ VectorFieldIndexing::AppendSegmentIndex(int64_t reserved_offset,
     AssertInfo(field_meta_.get_data_type() == DataType::VECTOR_FLOAT,
                "Data type of vector field is not VECTOR_FLOAT");
 
+    if (auto graph = dynamic_cast<index::GrowingHnswIndex*>(index_.get())) {
+        // the raw data is never written to the chunks, the rows come from
+        // data_source
+        AppendGraphIndex(graph,
+                         reserved_offset,
+                         size,
+                         static_cast<const float*>(data_source));
+        return;
+    }
+
     auto dim = field_meta_.get_dim();
     auto conf = get_build_params();
     auto source = dynamic_cast<const ConcurrentVector<FloatVector>*>(vec_base);
@@ -172,6 +202,48 @@ VectorFieldIndexing::AppendSegmentIndex(int64_t reserved_offset,
     }
 }
 
+void
+VectorFieldIndexing::AppendGraphIndex(index::GrowingHnswIndex* graph,
+                                      int64_t reserved_offset,
+                                      int64_t size,
+                                      const float* data) {
+    auto dim = field_meta_.get_dim();
+    auto num_tasks = std::min(int64_t(CPU_NUM), size / kMinGraphRowsPerTask);
+    if (num_tasks <= 1) {
+        graph->Add(reserved_offset, size, data);
+    } else {
+        // the caller inserts the first part while the pool takes the others
+        auto& pool =
+            ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
+        auto rows_per_task = upper_div(size, num_tasks);
+        std::vector<std::future<void>> futures;
+        for (auto begin = rows_per_task; begin < size;
+             begin += rows_per_task) {
+            auto n = std::min(rows_per_task, size - begin);
+            futures.push_back(pool.Submit([=] {
+                graph->Add(reserved_offset + begin, n, data + begin * dim);
+            }));
+        }
+        std::exception_ptr error;
+        try {
+            graph->Add(reserved_offset, rows_per_task, data);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // the tasks read data, wait for all of them before throwing
+        for (auto& future : futures) {
+            future.wait();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+    index_cur_.fetch_add(size);
+}
+
 knowhere::Json
 VectorFieldIndexing::get_build_params() const {
     auto config = config_->GetBuildBaseParams();
@@ -205,24 +277,34 @@ void
 ScalarFieldIndexing<T>::BuildIndexRange(int64_t ack_beg,
                                         int64_t ack_end,
                                         const VectorBase* vec_base) {
+    auto num_chunk = vec_base->num_chunk();
+    AssertInfo(ack_end <= num_chunk, "Ack_end is bigger than num_chunk");
+    auto size_per_chunk = vec_base->get_size_per_chunk();
+    AppendSegmentIndex(ack_beg * size_per_chunk,
+                       (ack_end - ack_beg) * size_per_chunk,
+                       vec_base,
+                       nullptr);
+}
+
+template <typename T>
+void
+ScalarFieldIndexing<T>::AppendSegmentIndex(int64_t reserved_offset,
+                                           int64_t size,
+                                           const VectorBase* vec_base,
+                                           const void* data_source) {
     auto source = dynamic_cast<const ConcurrentVector<T>*>(vec_base);
     AssertInfo(source, "vec_base can't cast to ConcurrentVector type");
-    auto num_chunk = source->num_chunk();
-    AssertInfo(ack_end <= num_chunk, "Ack_end is bigger than num_chunk");
-    data_.grow_to_at_least(ack_end);
-    for (int chunk_id = ack_beg; chunk_id < ack_end; chunk_id++) {
+    auto size_per_chunk = source->get_size_per_chunk();
+    // append the rows chunk by chunk, the rows within a chunk are contiguous
+    auto offset = reserved_offset;
+    auto end = reserved_offset + size;
+    while (offset < end) {
+        auto chunk_id = offset / size_per_chunk;
+        auto chunk_offset = offset % size_per_chunk;
+        auto n = std::min(end - offset, size_per_chunk - chunk_offset);
         const auto& chunk = source->get_chunk(chunk_id);
-        // build index for chunk
-        // TODO
-        if constexpr (std::is_same_v<T, std::string>) {
-            auto indexing = index::CreateStringIndexSort();
-            indexing->Build(vec_base->get_size_per_chunk(), chunk.data());
-            data_[chunk_id] = std::move(indexing);
-        } else {
-            auto indexing = index::CreateScalarIndexSort<T>();
-            indexing->Build(vec_base->get_size_per_chunk(), chunk.data());
-            data_[chunk_id] = std::move(indexing);
-        }
+        index_->Append(offset, n, chunk.data() + chunk_offset);
+        offset += n;
     }
 }
 
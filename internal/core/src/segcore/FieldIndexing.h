@@ -17,6 +17,8 @@
 
 #include <tbb/concurrent_vector.h>
 #include <index/Index.h>
+#include <index/GrowingHnswIndex.h>
+#include <index/GrowingScalarIndex.h>
 #include <index/ScalarIndex.h>
 
 #include "AckResponder.h"
@@ -96,23 +98,28 @@ class FieldIndexing {
     const SegcoreConfig& segcore_config_;
 };
 
+// ScalarFieldIndexing keeps one index of all the rows of the growing
+// segment, the rows are appended to it as they are inserted
 template <typename T>
 class ScalarFieldIndexing : public FieldIndexing {
  public:
-    using FieldIndexing::FieldIndexing;
+    explicit ScalarFieldIndexing(const FieldMeta& field_meta,
+                                 const SegcoreConfig& segcore_config)
+        : FieldIndexing(field_meta, segcore_config),
+          index_(std::make_unique<index::GrowingScalarIndex<T>>()) {
+    }
 
     void
     BuildIndexRange(int64_t ack_beg,
                     int64_t ack_end,
                     const VectorBase* vec_base) override;
 
+    // the rows are read from vec_base, where they have been written before
     void
     AppendSegmentIndex(int64_t reserved_offset,
                        int64_t size,
                        const VectorBase* vec_base,
-                       const void* data_source) override {
-        PanicInfo("scalar index don't support append segment index");
-    }
+                       const void* data_source) override;
 
     void
     GetDataFromIndex(const int64_t* seg_offsets,
@@ -136,20 +143,19 @@ class ScalarFieldIndexing : public FieldIndexing {
         return false;
     }
 
-    // concurrent
     index::ScalarIndex<T>*
     get_chunk_indexing(int64_t chunk_id) const override {
-        Assert(!field_meta_.is_vector());
-        return data_.at(chunk_id).get();
+        PanicInfo("scalar index of growing segment isn't built per chunk");
     }
 
+    // concurrent
     index::IndexBase*
     get_segment_indexing() const override {
-        return nullptr;
+        return index_.get();
     }
 
  private:
-    tbb::concurrent_vector<index::ScalarIndexPtr<T>> data_;
+    index::GrowingScalarIndexPtr<T> index_;
 };
 
 class VectorFieldIndexing : public FieldIndexing {
@@ -209,6 +215,17 @@ class VectorFieldIndexing : public FieldIndexing {
     SearchInfo
     get_search_params(const SearchInfo& searchInfo) const;
 
+ private:
+    // insert the rows into the growing hnsw graph, a large batch is split
+    // among the threads of the pool
+    void
+    AppendGraphIndex(index::GrowingHnswIndex* graph,
+                     int64_t reserved_offset,
+                     int64_t size,
+                     const float* data);
+
+    static constexpr int64_t kMinGraphRowsPerTask = 256;
+
  private:
     std::atomic<idx_t> index_cur_ = 0;
     std::atomic<bool> build;
@@ -256,6 +273,18 @@ class IndexingRecord {
                                     index_meta_->GetIndexMaxRowCount(),
                                     segcore_config_));
                 }
+            } else if (is_growing_scalar_index_type(
+                           field_meta.get_data_type()) &&
+                       segcore_config_.get_enable_growing_segment_index() &&
+                       index_meta_->GetIndexMaxRowCount() > 0 &&
+                       index_meta_->HasFiled(field_id)) {
+                // the scalar fields with an index are indexed as inserted
+                field_indexings_.try_emplace(
+                    field_id,
+                    CreateIndex(field_meta,
+                                index_meta_->GetFieldIndexMeta(field_id),
+                                index_meta_->GetIndexMaxRowCount(),
+                                segcore_config_));
             }
         }
         assert(offset_id == schema_.size());
@@ -281,6 +310,12 @@ class IndexingRecord {
                     size,
                     vec_base,
                     stream_data->vectors().float_vector().data().data());
+            } else if (!indexing->get_field_meta().is_vector()) {
+                indexing->AppendSegmentIndex(
+                    reserved_offset,
+                    size,
+                    record.get_field_data_base(fieldId),
+                    nullptr);
             }
         }
     }
@@ -302,6 +337,12 @@ class IndexingRecord {
                 auto vec_base = record.get_field_data_base(fieldId);
                 indexing->AppendSegmentIndex(
                     reserved_offset, size, vec_base, data->Data());
+            } else if (!indexing->get_field_meta().is_vector()) {
+                indexing->AppendSegmentIndex(
+                    reserved_offset,
+                    size,
+                    record.get_field_data_base(fieldId),
+                    nullptr);
             }
         }
     }
@@ -362,6 +403,13 @@ class IndexingRecord {
         return *ptr;
     }
 
+    static bool
+    is_growing_scalar_index_type(DataType data_type) {
+        return data_type == DataType::BOOL || datatype_is_integer(data_type) ||
+               datatype_is_floating(data_type) ||
+               data_type == DataType::VARCHAR;
+    }
+
     bool
     is_in(FieldId field_id) const {
         return field_indexings_.count(field_id);
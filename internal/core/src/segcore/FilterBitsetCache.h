@@ -0,0 +1,163 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/Metrics.h"
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Per-segment LRU cache of evaluated filter bitsets, keyed by the predicate
+// fingerprint (see VectorPlanNode::predicate_fingerprint_), the data
+// generation of the segment, the active count and the timestamp bucket of
+// the query.
+//
+// An entry keeps two bitsets:
+// - predicate: the raw output of ExecExprVisitor, only depends on the key and
+//   stays valid for the life of the segment;
+// - masked: predicate flipped and masked with timestamps and deletions, it's
+//   only valid for the delete barrier it was computed with.
+class FilterBitsetCache {
+ public:
+    struct Entry {
+        // `true` means matched
+        std::shared_ptr<const BitsetType> predicate;
+        // pk offsets collected when the predicate was served by pk index,
+        // see ExecPlanNodeVisitor::SetExprCacheOffsets
+        bool use_pk_index = false;
+        std::shared_ptr<const std::vector<int64_t>> pk_offsets;
+        // `true` means filtered out, nullptr if not computed yet
+        std::shared_ptr<const BitsetType> masked;
+        int64_t del_barrier = -1;
+
+        int64_t
+        size() const {
+            int64_t size = 0;
+            if (predicate != nullptr) {
+                size +=
+                    predicate->num_blocks() * sizeof(BitsetType::block_type);
+            }
+            if (masked != nullptr) {
+                size += masked->num_blocks() * sizeof(BitsetType::block_type);
+            }
+            if (pk_offsets != nullptr) {
+                size += pk_offsets->size() * sizeof(int64_t);
+            }
+            return size;
+        }
+    };
+
+    explicit FilterBitsetCache(int64_t capacity) : capacity_(capacity) {
+    }
+
+    static std::string
+    MakeKey(const std::string& fingerprint,
+            int64_t generation,
+            int64_t active_count,
+            Timestamp timestamp_bucket) {
+        std::string key;
+        key.reserve(fingerprint.size() + 2 * sizeof(int64_t) +
+                    sizeof(Timestamp));
+        key.append(reinterpret_cast<const char*>(&generation),
+                   sizeof(generation));
+        key.append(reinterpret_cast<const char*>(&active_count),
+                   sizeof(active_count));
+        key.append(reinterpret_cast<const char*>(&timestamp_bucket),
+                   sizeof(timestamp_bucket));
+        key.append(fingerprint);
+        return key;
+    }
+
+    bool
+    Enabled() const {
+        return capacity_ > 0;
+    }
+
+    std::optional<Entry>
+    Get(const std::string& key) {
+        static auto& hit =
+            metrics::GetCounter("milvus_segcore_filter_cache_hit_total",
+                                "hit count of segcore filter bitset cache");
+        static auto& miss =
+            metrics::GetCounter("milvus_segcore_filter_cache_miss_total",
+                                "miss count of segcore filter bitset cache");
+        std::lock_guard lck(mutex_);
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            miss.Increment();
+            return std::nullopt;
+        }
+        hit.Increment();
+        lru_.splice(lru_.begin(), lru_, iter->second);
+        return iter->second->second;
+    }
+
+    // insert or replace the entry of key
+    void
+    Put(const std::string& key, Entry entry) {
+        int64_t size = entry.size() + 2 * key.size();
+        if (size > capacity_) {
+            return;
+        }
+        std::lock_guard lck(mutex_);
+        if (auto iter = index_.find(key); iter != index_.end()) {
+            usage_ -= iter->second->second.size() + 2 * key.size();
+            lru_.erase(iter->second);
+            index_.erase(iter);
+        }
+        while (!lru_.empty() && usage_ + size > capacity_) {
+            auto& victim = lru_.back();
+            usage_ -= victim.second.size() + 2 * victim.first.size();
+            index_.erase(victim.first);
+            lru_.pop_back();
+        }
+        lru_.emplace_front(key, std::move(entry));
+        index_.emplace(key, lru_.begin());
+        usage_ += size;
+    }
+
+    void
+    Clear() {
+        std::lock_guard lck(mutex_);
+        index_.clear();
+        lru_.clear();
+        usage_ = 0;
+    }
+
+    int64_t
+    GetMemoryUsage() const {
+        std::lock_guard lck(mutex_);
+        return usage_;
+    }
+
+ private:
+    using EntryList = std::list<std::pair<std::string, Entry>>;
+
+    const int64_t capacity_;
+
+    mutable std::mutex mutex_;
+    int64_t usage_ = 0;
+    // front is the most recently used one
+    EntryList lru_;
+    std::unordered_map<std::string, EntryList::iterator> index_;
+};
+
+}  // namespace milvus::segcore
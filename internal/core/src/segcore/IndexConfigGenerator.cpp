@@ -21,14 +21,29 @@ VecIndexConfig::VecIndexConfig(const int64_t max_index_row_cout,
     origin_index_type_ = index_meta_.GetIndexType();
     metric_type_ = index_meta_.GeMetricType();
 
-    index_type_ = support_index_types[0];
     build_params_[knowhere::meta::METRIC_TYPE] = metric_type_;
-    build_params_[knowhere::indexparam::NLIST] =
-        std::to_string(config_.get_nlist());
-    build_params_[knowhere::indexparam::SSIZE] = std::to_string(
-        std::max((int)(config_.get_chunk_rows() / config_.get_nlist()), 48));
-    search_params_[knowhere::indexparam::NPROBE] =
-        std::to_string(config_.get_nprobe());
+    if (origin_index_type_ == knowhere::IndexEnum::INDEX_HNSW &&
+        config_.get_enable_growing_hnsw()) {
+        // growing segments of hnsw fields keep an hnsw graph of the same
+        // params
+        index_type_ = knowhere::IndexEnum::INDEX_HNSW;
+        auto& params = index_meta_.GetIndexParams();
+        for (auto& key :
+             {knowhere::indexparam::M, knowhere::indexparam::EFCONSTRUCTION}) {
+            if (params.count(key)) {
+                build_params_[key] = params.at(key);
+            }
+        }
+    } else {
+        index_type_ = support_index_types[0];
+        build_params_[knowhere::indexparam::NLIST] =
+            std::to_string(config_.get_nlist());
+        build_params_[knowhere::indexparam::SSIZE] =
+            std::to_string(std::max(
+                (int)(config_.get_chunk_rows() / config_.get_nlist()), 48));
+        search_params_[knowhere::indexparam::NPROBE] =
+            std::to_string(config_.get_nprobe());
+    }
     LOG_SEGCORE_INFO_ << " VecIndexConfig: "
                       << " origin_index_type_:" << origin_index_type_
                       << " index_type_: " << index_type_
@@ -40,6 +55,9 @@ VecIndexConfig::GetBuildThreshold() const noexcept {
     assert(VecIndexConfig::index_build_ratio.count(index_type_));
     auto ratio = VecIndexConfig::index_build_ratio.at(index_type_);
     assert(ratio >= 0.0 && ratio < 1.0);
+    if (index_type_ == knowhere::IndexEnum::INDEX_HNSW) {
+        return 0;
+    }
     return std::max(int64_t(max_index_row_count_ * ratio),
                     config_.get_nlist() * 39);
 }
@@ -69,6 +87,11 @@ VecIndexConfig::GetSearchConf(const SearchInfo& searchInfo) {
             searchParam.search_params_[key] = searchInfo.search_params_[key];
         }
     }
+    if (index_type_ == knowhere::IndexEnum::INDEX_HNSW &&
+        searchInfo.search_params_.contains(knowhere::indexparam::EF)) {
+        searchParam.search_params_[knowhere::indexparam::EF] =
+            searchInfo.search_params_[knowhere::indexparam::EF];
+    }
     return searchParam;
 }
 
@@ -28,10 +28,13 @@ enum class IndexConfigLevel {
 
 class VecIndexConfig {
     inline static const std::vector<std::string> support_index_types = {
-        knowhere::IndexEnum::INDEX_FAISS_IVFFLAT_CC};
+        knowhere::IndexEnum::INDEX_FAISS_IVFFLAT_CC,
+        knowhere::IndexEnum::INDEX_HNSW};
 
+    // hnsw needs no training, it's built from the first row on
     inline static const std::map<std::string, double> index_build_ratio = {
-        {knowhere::IndexEnum::INDEX_FAISS_IVFFLAT_CC, 0.1}};
+        {knowhere::IndexEnum::INDEX_FAISS_IVFFLAT_CC, 0.1},
+        {knowhere::IndexEnum::INDEX_HNSW, 0.0}};
 
     inline static const std::unordered_set<std::string> maintain_params = {
         "radius", "range_filter"};
@@ -26,6 +26,7 @@
 #include "mmap/Column.h"
 #include "segcore/AckResponder.h"
 #include "segcore/ConcurrentVector.h"
+#include "segcore/PkBloomFilter.h"
 #include "segcore/Record.h"
 
 namespace milvus::segcore {
@@ -337,6 +338,9 @@ struct InsertRecord {
     search_pk(const PkType& pk, Timestamp timestamp) const {
         std::shared_lock lck(shared_mutex_);
         std::vector<SegOffset> res_offsets;
+        if (!pk_filter_.MayContain(pk)) {
+            return res_offsets;
+        }
         auto offset_iter = pk2offset_->find(pk);
         for (auto offset : offset_iter) {
             if (timestamps_[offset] <= timestamp) {
@@ -355,7 +359,9 @@ struct InsertRecord {
             case DataType::INT64: {
                 auto column = std::dynamic_pointer_cast<Column>(data);
                 auto pks = reinterpret_cast<const int64_t*>(column->Data());
+                pk_filter_.Reserve(column->NumRows());
                 for (int i = 0; i < column->NumRows(); ++i) {
+                    pk_filter_.Add(pks[i]);
                     pk2offset_->insert(pks[i], offset++);
                 }
                 break;
@@ -364,10 +370,11 @@ struct InsertRecord {
                 auto column =
                     std::dynamic_pointer_cast<VariableColumn<std::string>>(
                         data);
-                auto pks = column->Views();
-
+                pk_filter_.Reserve(column->NumRows());
                 for (int i = 0; i < column->NumRows(); ++i) {
-                    pk2offset_->insert(std::string(pks[i]), offset++);
+                    PkType pk = std::string((*column)[i]);
+                    pk_filter_.Add(pk);
+                    pk2offset_->insert(pk, offset++);
                 }
                 break;
             }
@@ -381,23 +388,30 @@ struct InsertRecord {
     insert_pks(const std::vector<storage::FieldDataPtr>& field_datas) {
         std::lock_guard lck(shared_mutex_);
         int64_t offset = 0;
+        int64_t num_rows = 0;
+        for (auto& data : field_datas) {
+            num_rows += data->get_num_rows();
+        }
+        pk_filter_.Reserve(num_rows);
         for (auto& data : field_datas) {
             int64_t row_count = data->get_num_rows();
             auto data_type = data->get_data_type();
             switch (data_type) {
                 case DataType::INT64: {
                     for (int i = 0; i < row_count; ++i) {
-                        pk2offset_->insert(
-                            *static_cast<const int64_t*>(data->RawValue(i)),
-                            offset++);
+                        PkType pk =
+                            *static_cast<const int64_t*>(data->RawValue(i));
+                        pk_filter_.Add(pk);
+                        pk2offset_->insert(pk, offset++);
                     }
                     break;
                 }
                 case DataType::VARCHAR: {
                     for (int i = 0; i < row_count; ++i) {
-                        pk2offset_->insert(
-                            *static_cast<const std::string*>(data->RawValue(i)),
-                            offset++);
+                        PkType pk =
+                            *static_cast<const std::string*>(data->RawValue(i));
+                        pk_filter_.Add(pk);
+                        pk2offset_->insert(pk, offset++);
                     }
                     break;
                 }
@@ -412,6 +426,9 @@ struct InsertRecord {
     search_pk(const PkType& pk, int64_t insert_barrier) const {
         std::shared_lock lck(shared_mutex_);
         std::vector<SegOffset> res_offsets;
+        if (!pk_filter_.MayContain(pk)) {
+            return res_offsets;
+        }
         auto offset_iter = pk2offset_->find(pk);
         for (auto offset : offset_iter) {
             if (offset < insert_barrier) {
@@ -424,19 +441,49 @@ struct InsertRecord {
     void
     insert_pk(const PkType& pk, int64_t offset) {
         std::lock_guard lck(shared_mutex_);
+        pk_filter_.Add(pk);
         pk2offset_->insert(pk, offset);
     }
 
+    // sizes the pk filter ahead of inserting num_pks pks one by one
+    void
+    reserve_pks(int64_t num_pks) {
+        std::lock_guard lck(shared_mutex_);
+        pk_filter_.Reserve(num_pks);
+    }
+
+    // false if the pk is surely not inserted, no false negative
+    bool
+    may_contain_pk(const PkType& pk) const {
+        std::shared_lock lck(shared_mutex_);
+        return pk_filter_.MayContain(pk);
+    }
+
     bool
     empty_pks() const {
         std::shared_lock lck(shared_mutex_);
         return pk2offset_->empty();
     }
 
+    // whether the pk filter holds all the pks to filter deletions by. A
+    // sealed segment inserts its pks one by one at load, the filter is
+    // partial until they are sealed. A growing one inserts them with the
+    // rows, ahead of their deletions
+    bool
+    pks_loaded() const {
+        std::shared_lock lck(shared_mutex_);
+        if constexpr (is_sealed) {
+            return pks_sealed_;
+        } else {
+            return !pk2offset_->empty();
+        }
+    }
+
     void
     seal_pks() {
         std::lock_guard lck(shared_mutex_);
         pk2offset_->seal();
+        pks_sealed_ = true;
     }
 
     // get field data without knowing the type
@@ -506,6 +553,9 @@ struct InsertRecord {
  private:
     //    std::vector<std::unique_ptr<VectorBase>> fields_data_;
     std::unordered_map<FieldId, std::unique_ptr<VectorBase>> fields_data_{};
+    // the pks of pk2offset_, to skip the lookup of the pks not inserted
+    PkBloomFilter pk_filter_;
+    bool pks_sealed_ = false;
     mutable std::shared_mutex shared_mutex_{};
 };
 
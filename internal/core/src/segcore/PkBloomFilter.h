@@ -0,0 +1,186 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/Types.h"
+#include "exceptions/EasyAssert.h"
+
+namespace milvus::segcore {
+
+// PkBloomFilter is a blocked Bloom filter of the primary keys of a segment.
+// A key sets one bit in each word of a single block of a cache line, so a
+// lookup costs one cache miss, and the words of a block are probed together
+// by a loop the compiler vectorizes. A negative answer is exact: the pk is
+// not in the segment, a positive one is a false positive at about 1%.
+//
+// The keys of a sealed segment are reserved ahead and take a single filter.
+// A growing segment adds filters as the keys come in, each of 4 times the
+// capacity and 2 more bits per key than the last, so there are a handful of
+// them for a lookup to probe and the sum of their false positive rates stays
+// low.
+class PkBloomFilter {
+ public:
+    static constexpr size_t kBlockWords = 8;  // 8 * 64 bits, a cache line
+    static constexpr size_t kBitsPerKey = 10;
+    static constexpr size_t kMinCapacity = 1024;
+    static constexpr size_t kGrowth = 4;
+    static constexpr size_t kMoreBitsPerKey = 2;
+
+    // sizes the filter to add num_keys keys without another filter
+    void
+    Reserve(size_t num_keys) {
+        if (filters_.empty() ||
+            filters_.back().num_keys + num_keys > filters_.back().capacity) {
+            AddFilter(num_keys);
+        }
+    }
+
+    void
+    Add(const PkType& pk) {
+        if (filters_.empty() ||
+            filters_.back().num_keys >= filters_.back().capacity) {
+            AddFilter(filters_.empty() ? kMinCapacity
+                                       : filters_.back().capacity * kGrowth);
+        }
+        auto& filter = filters_.back();
+        auto hash = Hash(pk);
+        auto& block = filter.blocks[BlockOf(hash, filter.blocks.size())];
+        uint64_t masks[kBlockWords];
+        Masks(hash, masks);
+        for (size_t i = 0; i < kBlockWords; ++i) {
+            block.words[i] |= masks[i];
+        }
+        ++filter.num_keys;
+    }
+
+    // false if pk is surely not added
+    bool
+    MayContain(const PkType& pk) const {
+        if (filters_.empty()) {
+            return false;
+        }
+        auto hash = Hash(pk);
+        uint64_t masks[kBlockWords];
+        Masks(hash, masks);
+        for (auto& filter : filters_) {
+            auto& block = filter.blocks[BlockOf(hash, filter.blocks.size())];
+            uint64_t miss = 0;
+            for (size_t i = 0; i < kBlockWords; ++i) {
+                miss |= masks[i] & ~block.words[i];
+            }
+            if (miss == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the count of the added keys
+    size_t
+    Size() const {
+        size_t size = 0;
+        for (auto& filter : filters_) {
+            size += filter.num_keys;
+        }
+        return size;
+    }
+
+    size_t
+    NumFilters() const {
+        return filters_.size();
+    }
+
+    size_t
+    ByteSize() const {
+        size_t size = 0;
+        for (auto& filter : filters_) {
+            size += filter.blocks.size() * sizeof(Block);
+        }
+        return size;
+    }
+
+ private:
+    struct alignas(64) Block {
+        uint64_t words[kBlockWords];
+    };
+    static_assert(sizeof(Block) == 64);
+    static constexpr size_t kBlockBits = sizeof(Block) * 8;
+
+    struct Filter {
+        std::vector<Block> blocks;
+        size_t capacity;
+        size_t num_keys;
+    };
+
+    void
+    AddFilter(size_t capacity) {
+        capacity = std::max(capacity, kMinCapacity);
+        auto bits_per_key = kBitsPerKey + kMoreBitsPerKey * filters_.size();
+        auto num_blocks =
+            (capacity * bits_per_key + kBlockBits - 1) / kBlockBits;
+        filters_.push_back(Filter{std::vector<Block>(num_blocks), capacity, 0});
+    }
+
+    static uint64_t
+    Mix(uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    static uint64_t
+    Hash(const PkType& pk) {
+        if (auto value = std::get_if<int64_t>(&pk)) {
+            return Mix(static_cast<uint64_t>(*value));
+        }
+        if (auto value = std::get_if<std::string>(&pk)) {
+            return Mix(std::hash<std::string_view>{}(*value));
+        }
+        PanicInfo("unsupported primary key type");
+    }
+
+    // the high bits of the hash pick the block
+    static size_t
+    BlockOf(uint64_t hash, size_t num_blocks) {
+        return static_cast<size_t>(
+            (static_cast<unsigned __int128>(hash) * num_blocks) >> 64);
+    }
+
+    // the low bits of the hash pick a bit of every word
+    static void
+    Masks(uint64_t hash, uint64_t (&masks)[kBlockWords]) {
+        static constexpr uint32_t kSalts[kBlockWords] = {0x47b6137bU,
+                                                         0x44974d91U,
+                                                         0x8824ad5bU,
+                                                         0xa2b7289dU,
+                                                         0x705495c7U,
+                                                         0x2df1424bU,
+                                                         0x9efc4947U,
+                                                         0x5c6bfb31U};
+        auto key = static_cast<uint32_t>(hash);
+        for (size_t i = 0; i < kBlockWords; ++i) {
+            masks[i] = uint64_t(1) << ((key * kSalts[i]) >> 26);
+        }
+    }
+
+ private:
+    std::vector<Filter> filters_;
+};
+
+}  // namespace milvus::segcore
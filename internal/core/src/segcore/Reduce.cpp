@@ -14,7 +14,9 @@
 #include <log/Log.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 #include "SegmentInterface.h"
@@ -54,6 +56,7 @@ ReduceHelper::Initialize() {
 
 void
 ReduceHelper::Reduce() {
+    FuseFieldResults();
     FillPrimaryKey();
     ReduceResultData();
     RefreshSearchResult();
@@ -108,6 +111,133 @@ ReduceHelper::FilterInvalidSearchResult(SearchResult* search_result) {
                      search_result->topk_per_nq_prefix_sum_.begin() + 1);
 }
 
+// A hybrid search fused by rank keeps the results of each vector field in
+// the segments, rank them among all segments and replace the results of the
+// segments with the fused top-k, then reduce them like the ones of an IP
+// search.
+void
+ReduceHelper::FuseFieldResults() {
+    auto node =
+        dynamic_cast<query::HybridVectorANNS*>(plan_->plan_node_.get());
+    if (node == nullptr || node->fusion_type_ != query::FusionType::RRF) {
+        return;
+    }
+    auto num_fields = node->anns_.size();
+    auto topk = node->search_info_.topk_;
+    for (auto search_result : search_results_) {
+        auto& field_results = search_result->field_results_;
+        AssertInfo(field_results.empty() || field_results.size() == num_fields,
+                   "wrong number of field results, size = " +
+                       std::to_string(field_results.size()) +
+                       ", expected size = " + std::to_string(num_fields));
+        auto segment = static_cast<SegmentInterface*>(search_result->segment_);
+        for (auto& field_result : field_results) {
+            FilterInvalidSearchResult(&field_result);
+            segment->FillPrimaryKeys(plan_, field_result);
+        }
+    }
+
+    struct Hit {
+        float distance;
+        PkType pk;
+        int64_t segment_index;
+        int64_t seg_offset;
+    };
+    struct Fused {
+        float score;
+        int64_t segment_index;
+        int64_t seg_offset;
+    };
+    std::vector<Hit> hits;
+    std::unordered_set<PkType> ranked;
+    std::unordered_map<PkType, Fused> fused;
+    std::vector<std::pair<PkType, Fused>> candidates;
+    // dim0: num_segments_; dim1: total_nq_ * topk
+    std::vector<std::vector<float>> distances(
+        num_segments_, std::vector<float>(total_nq_ * topk, 0));
+    std::vector<std::vector<int64_t>> seg_offsets(
+        num_segments_,
+        std::vector<int64_t>(total_nq_ * topk, INVALID_SEG_OFFSET));
+    std::vector<int64_t> counts(num_segments_);
+    for (int64_t qi = 0; qi < total_nq_; ++qi) {
+        fused.clear();
+        for (size_t f = 0; f < num_fields; ++f) {
+            hits.clear();
+            for (int64_t i = 0; i < num_segments_; ++i) {
+                auto& field_results = search_results_[i]->field_results_;
+                if (field_results.empty()) {
+                    continue;
+                }
+                auto& result = field_results[f];
+                auto beg = result.topk_per_nq_prefix_sum_[qi];
+                auto end = result.topk_per_nq_prefix_sum_[qi + 1];
+                for (auto j = beg; j < end; ++j) {
+                    hits.push_back(Hit{result.distances_[j],
+                                       result.primary_keys_[j],
+                                       i,
+                                       result.seg_offsets_[j]});
+                }
+            }
+            std::sort(hits.begin(), hits.end(), [](auto& lhs, auto& rhs) {
+                return lhs.distance > rhs.distance ||
+                       (lhs.distance == rhs.distance && lhs.pk < rhs.pk);
+            });
+
+            // score of a result ranked r (from 0) among all segments is
+            // 1 / (rrf_k + r + 1)
+            ranked.clear();
+            auto field_topk = node->anns_[f]->search_info_.topk_;
+            for (auto& hit : hits) {
+                if (static_cast<int64_t>(ranked.size()) >= field_topk) {
+                    break;
+                }
+                if (!ranked.insert(hit.pk).second) {
+                    continue;
+                }
+                float score = 1.0 / (node->rrf_k_ + ranked.size());
+                auto [it, inserted] = fused.try_emplace(
+                    hit.pk, Fused{score, hit.segment_index, hit.seg_offset});
+                if (!inserted) {
+                    it->second.score += score;
+                }
+            }
+        }
+
+        candidates.assign(fused.begin(), fused.end());
+        auto count = std::min<int64_t>(topk, candidates.size());
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + count,
+                          candidates.end(),
+                          [](auto& lhs, auto& rhs) {
+                              return lhs.second.score > rhs.second.score ||
+                                     (lhs.second.score == rhs.second.score &&
+                                      lhs.first < rhs.first);
+                          });
+        std::fill(counts.begin(), counts.end(), 0);
+        for (int64_t j = 0; j < count; ++j) {
+            auto& hit = candidates[j].second;
+            auto loc = qi * topk + counts[hit.segment_index]++;
+            distances[hit.segment_index][loc] = hit.score;
+            seg_offsets[hit.segment_index][loc] = hit.seg_offset;
+        }
+    }
+
+    auto round_decimal = node->search_info_.round_decimal_;
+    for (int64_t i = 0; i < num_segments_; ++i) {
+        auto search_result = search_results_[i];
+        if (round_decimal != -1) {
+            const float multiplier = std::pow(10.0, round_decimal);
+            for (auto& distance : distances[i]) {
+                distance = std::round(distance * multiplier) / multiplier;
+            }
+        }
+        search_result->unity_topK_ = topk;
+        search_result->distances_ = std::move(distances[i]);
+        search_result->seg_offsets_ = std::move(seg_offsets[i]);
+        search_result->field_results_.clear();
+    }
+}
+
 void
 ReduceHelper::FillPrimaryKey() {
     std::vector<SearchResult*> valid_search_results;
@@ -63,6 +63,9 @@ class ReduceHelper {
     void
     FilterInvalidSearchResult(SearchResult* search_result);
 
+    void
+    FuseFieldResults();
+
     void
     FillPrimaryKey();
 
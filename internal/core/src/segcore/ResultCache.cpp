@@ -0,0 +1,325 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/ResultCache.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "common/Metrics.h"
+#include "log/Log.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+const char kSearchKeyTag = 'S';
+const char kRetrieveKeyTag = 'R';
+
+// bytes of list node and index slot of an entry, the key itself is stored
+// twice, in both the entry and the index
+const int64_t kEntryOverhead = 128;
+
+prometheus::Counter&
+hit_counter(const std::string& type) {
+    return metrics::GetCounter("milvus_segcore_result_cache_hit_total",
+                               "hit count of segcore result cache",
+                               {{"type", type}});
+}
+
+prometheus::Counter&
+miss_counter(const std::string& type) {
+    return metrics::GetCounter("milvus_segcore_result_cache_miss_total",
+                               "miss count of segcore result cache",
+                               {{"type", type}});
+}
+
+prometheus::Counter&
+evict_counter() {
+    static auto& counter =
+        metrics::GetCounter("milvus_segcore_result_cache_evict_total",
+                            "evicted entries of segcore result cache");
+    return counter;
+}
+
+prometheus::Gauge&
+memory_gauge() {
+    static auto& gauge =
+        metrics::GetGauge("milvus_segcore_result_cache_memory_bytes",
+                          "memory used by segcore result cache");
+    return gauge;
+}
+
+prometheus::Gauge&
+entries_gauge() {
+    static auto& gauge =
+        metrics::GetGauge("milvus_segcore_result_cache_entries",
+                          "number of entries in segcore result cache");
+    return gauge;
+}
+
+template <typename T>
+void
+append_pod(std::string& key, const T& value) {
+    key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void
+append_bytes(std::string& key, const char* data, size_t size) {
+    append_pod(key, size);
+    key.append(data, size);
+}
+
+int64_t
+search_result_size(const SearchResult& result) {
+    int64_t size = sizeof(SearchResult) +
+                   result.distances_.size() * sizeof(float) +
+                   result.seg_offsets_.size() * sizeof(int64_t);
+    for (auto& field_result : result.field_results_) {
+        size += search_result_size(field_result);
+    }
+    return size;
+}
+
+std::unique_ptr<SearchResult>
+clone_search_result(const SearchResult& src) {
+    auto dst = std::make_unique<SearchResult>();
+    dst->total_nq_ = src.total_nq_;
+    dst->unity_topK_ = src.unity_topK_;
+    dst->segment_ = src.segment_;
+    dst->distances_ = src.distances_;
+    dst->seg_offsets_ = src.seg_offsets_;
+    dst->primary_keys_ = src.primary_keys_;
+    dst->pk_type_ = src.pk_type_;
+    dst->result_offsets_ = src.result_offsets_;
+    dst->topk_per_nq_prefix_sum_ = src.topk_per_nq_prefix_sum_;
+    for (auto& [field_id, data] : src.output_fields_data_) {
+        dst->output_fields_data_[field_id] =
+            std::make_unique<DataArray>(*data);
+    }
+    for (auto& field_result : src.field_results_) {
+        dst->field_results_.push_back(
+            std::move(*clone_search_result(field_result)));
+    }
+    return dst;
+}
+
+}  // namespace
+
+void
+ResultCache::SetCapacity(int64_t capacity) {
+    std::lock_guard lck(mutex_);
+    capacity_ = std::max<int64_t>(capacity, 0);
+    EvictUntil(capacity_.load());
+    LOG_SEGCORE_INFO_ << "set segcore result cache capacity (byte): "
+                      << capacity_.load();
+}
+
+std::unique_ptr<SearchResult>
+ResultCache::GetSearchResult(const void* owner, const std::string& key) {
+    static auto& hit = hit_counter("search");
+    static auto& miss = miss_counter("search");
+    std::shared_ptr<const SearchResult> result;
+    {
+        std::lock_guard lck(mutex_);
+        auto entry = Touch(owner, key);
+        if (entry != nullptr) {
+            result = entry->search_result;
+        }
+    }
+    if (result == nullptr) {
+        miss.Increment();
+        return nullptr;
+    }
+    hit.Increment();
+    return clone_search_result(*result);
+}
+
+void
+ResultCache::PutSearchResult(const void* owner,
+                             std::string key,
+                             const SearchResult& result) {
+    int64_t size = kEntryOverhead + 2 * key.size() + search_result_size(result);
+    Entry entry{owner,
+                std::move(key),
+                std::shared_ptr<const SearchResult>(
+                    clone_search_result(result).release()),
+                nullptr,
+                size};
+    Put(std::move(entry));
+}
+
+std::unique_ptr<proto::segcore::RetrieveResults>
+ResultCache::GetRetrieveResult(const void* owner, const std::string& key) {
+    static auto& hit = hit_counter("retrieve");
+    static auto& miss = miss_counter("retrieve");
+    std::shared_ptr<const proto::segcore::RetrieveResults> result;
+    {
+        std::lock_guard lck(mutex_);
+        auto entry = Touch(owner, key);
+        if (entry != nullptr) {
+            result = entry->retrieve_result;
+        }
+    }
+    if (result == nullptr) {
+        miss.Increment();
+        return nullptr;
+    }
+    hit.Increment();
+    return std::make_unique<proto::segcore::RetrieveResults>(*result);
+}
+
+void
+ResultCache::PutRetrieveResult(const void* owner,
+                               std::string key,
+                               const proto::segcore::RetrieveResults& result) {
+    int64_t size =
+        kEntryOverhead + 2 * key.size() + result.SpaceUsedLong();
+    Entry entry{owner,
+                std::move(key),
+                nullptr,
+                std::make_shared<const proto::segcore::RetrieveResults>(result),
+                size};
+    Put(std::move(entry));
+}
+
+void
+ResultCache::Invalidate(const void* owner) {
+    std::lock_guard lck(mutex_);
+    auto iter = index_.find(owner);
+    if (iter == index_.end()) {
+        return;
+    }
+    for (auto& [_, entry_iter] : iter->second) {
+        usage_ -= entry_iter->size;
+        lru_.erase(entry_iter);
+    }
+    index_.erase(iter);
+    memory_gauge().Set(usage_);
+    entries_gauge().Set(lru_.size());
+}
+
+int64_t
+ResultCache::GetMemoryUsage() const {
+    std::lock_guard lck(mutex_);
+    return usage_;
+}
+
+int64_t
+ResultCache::Size() const {
+    std::lock_guard lck(mutex_);
+    return lru_.size();
+}
+
+const ResultCache::Entry*
+ResultCache::Touch(const void* owner, const std::string& key) {
+    auto owner_iter = index_.find(owner);
+    if (owner_iter == index_.end()) {
+        return nullptr;
+    }
+    auto iter = owner_iter->second.find(key);
+    if (iter == owner_iter->second.end()) {
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, iter->second);
+    return &*iter->second;
+}
+
+void
+ResultCache::Put(Entry&& entry) {
+    auto capacity = capacity_.load();
+    // a single result larger than the whole budget would flush everything
+    if (entry.size > capacity) {
+        return;
+    }
+
+    std::lock_guard lck(mutex_);
+    auto& owner_index = index_[entry.owner];
+    if (auto iter = owner_index.find(entry.key); iter != owner_index.end()) {
+        // computed concurrently by another search, keep the existing one
+        lru_.splice(lru_.begin(), lru_, iter->second);
+        return;
+    }
+
+    EvictUntil(capacity - entry.size);
+    usage_ += entry.size;
+    lru_.push_front(std::move(entry));
+    auto& front = lru_.front();
+    // the owner index may be dropped by eviction, look it up again
+    index_[front.owner].emplace(front.key, lru_.begin());
+    memory_gauge().Set(usage_);
+    entries_gauge().Set(lru_.size());
+}
+
+void
+ResultCache::Erase(EntryList::iterator iter) {
+    auto owner_iter = index_.find(iter->owner);
+    if (owner_iter != index_.end()) {
+        owner_iter->second.erase(iter->key);
+        if (owner_iter->second.empty()) {
+            index_.erase(owner_iter);
+        }
+    }
+    usage_ -= iter->size;
+    lru_.erase(iter);
+}
+
+void
+ResultCache::EvictUntil(int64_t capacity) {
+    while (!lru_.empty() && usage_ > capacity) {
+        Erase(std::prev(lru_.end()));
+        evict_counter().Increment();
+    }
+    memory_gauge().Set(usage_);
+    entries_gauge().Set(lru_.size());
+}
+
+std::string
+MakeSearchCacheKey(const query::Plan* plan,
+                   const query::PlaceholderGroup* placeholder_group,
+                   int64_t generation,
+                   int64_t del_barrier) {
+    std::string key;
+    key.push_back(kSearchKeyTag);
+    append_pod(key, generation);
+    append_pod(key, del_barrier);
+    // metric type may be filled after the plan is created, see SetMetricType
+    auto& metric_type = plan->plan_node_->search_info_.metric_type_;
+    append_bytes(key, metric_type.data(), metric_type.size());
+    append_bytes(
+        key, plan->serialized_plan_.data(), plan->serialized_plan_.size());
+    for (auto& placeholder : *placeholder_group) {
+        append_bytes(key, placeholder.tag_.data(), placeholder.tag_.size());
+        append_pod(key, placeholder.num_of_queries_);
+        append_bytes(
+            key, placeholder.blob_.data(), placeholder.blob_.size());
+    }
+    return key;
+}
+
+std::string
+MakeRetrieveCacheKey(const query::RetrievePlan* plan,
+                     int64_t generation,
+                     int64_t del_barrier,
+                     Timestamp timestamp,
+                     int64_t limit_size) {
+    std::string key;
+    key.push_back(kRetrieveKeyTag);
+    append_pod(key, generation);
+    append_pod(key, del_barrier);
+    append_pod(key, timestamp);
+    append_pod(key, limit_size);
+    append_bytes(
+        key, plan->serialized_plan_.data(), plan->serialized_plan_.size());
+    return key;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,145 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/QueryResult.h"
+#include "common/Types.h"
+#include "pb/segcore.pb.h"
+#include "query/PlanImpl.h"
+
+namespace milvus::segcore {
+
+// Process-wide LRU cache of per-segment search and retrieve results.
+// Only sealed segments use it, since their content doesn't change between
+// calls except through the operations that invalidate the owner's entries
+// (delete, load/drop of field data or index, release).
+// Entries are keyed by owner segment plus a byte key built from the plan,
+// the placeholders and the delete barrier, see MakeSearchCacheKey and
+// MakeRetrieveCacheKey. The full key is compared on lookup, so a hash
+// collision can never return a wrong result.
+class ResultCache {
+ public:
+    static ResultCache&
+    GetInstance() {
+        static ResultCache instance;
+        return instance;
+    }
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache&
+    operator=(const ResultCache&) = delete;
+
+    // set memory budget in bytes, 0 disables the cache and drops all entries
+    void
+    SetCapacity(int64_t capacity);
+
+    int64_t
+    GetCapacity() const {
+        return capacity_.load();
+    }
+
+    bool
+    Enabled() const {
+        return capacity_.load() > 0;
+    }
+
+    // return a copy of the cached result, nullptr if missed
+    std::unique_ptr<SearchResult>
+    GetSearchResult(const void* owner, const std::string& key);
+
+    void
+    PutSearchResult(const void* owner,
+                    std::string key,
+                    const SearchResult& result);
+
+    // return a copy of the cached result, nullptr if missed
+    std::unique_ptr<proto::segcore::RetrieveResults>
+    GetRetrieveResult(const void* owner, const std::string& key);
+
+    void
+    PutRetrieveResult(const void* owner,
+                      std::string key,
+                      const proto::segcore::RetrieveResults& result);
+
+    // drop all entries of owner
+    void
+    Invalidate(const void* owner);
+
+    int64_t
+    GetMemoryUsage() const;
+
+    int64_t
+    Size() const;
+
+ private:
+    ResultCache() = default;
+
+    struct Entry {
+        const void* owner;
+        std::string key;
+        std::shared_ptr<const SearchResult> search_result;
+        std::shared_ptr<const proto::segcore::RetrieveResults> retrieve_result;
+        int64_t size;
+    };
+    using EntryList = std::list<Entry>;
+
+    // return the entry and move it to the front of lru list, must hold mutex_
+    const Entry*
+    Touch(const void* owner, const std::string& key);
+
+    void
+    Put(Entry&& entry);
+
+    // must hold mutex_
+    void
+    Erase(EntryList::iterator iter);
+
+    // must hold mutex_
+    void
+    EvictUntil(int64_t capacity);
+
+ private:
+    std::atomic<int64_t> capacity_ = 0;
+
+    mutable std::mutex mutex_;
+    int64_t usage_ = 0;
+    // front is the most recently used one
+    EntryList lru_;
+    std::unordered_map<const void*,
+                       std::unordered_map<std::string, EntryList::iterator>>
+        index_;
+};
+
+// generation is bumped by the segment whenever its data or index changes,
+// so the result computed before the change is unreachable even if it's put
+// into cache after the invalidation.
+std::string
+MakeSearchCacheKey(const query::Plan* plan,
+                   const query::PlaceholderGroup* placeholder_group,
+                   int64_t generation,
+                   int64_t del_barrier);
+
+std::string
+MakeRetrieveCacheKey(const query::RetrievePlan* plan,
+                     int64_t generation,
+                     int64_t del_barrier,
+                     Timestamp timestamp,
+                     int64_t limit_size);
+
+}  // namespace milvus::segcore
@@ -73,8 +73,73 @@ class SegcoreConfig {
         return enable_growing_segment_index_;
     }
 
+    // growing segments of hnsw fields keep an hnsw graph instead of the
+    // ivf index of the chunks
+    void
+    set_enable_growing_hnsw(bool enable) {
+        enable_growing_hnsw_ = enable;
+    }
+
+    bool
+    get_enable_growing_hnsw() const {
+        return enable_growing_hnsw_;
+    }
+
+    // memory budget in bytes of the filter bitset cache of each sealed
+    // segment, 0 disables it
+    void
+    set_filter_bitset_cache_capacity(int64_t capacity) {
+        filter_bitset_cache_capacity_ = capacity;
+    }
+
+    int64_t
+    get_filter_bitset_cache_capacity() const {
+        return filter_bitset_cache_capacity_;
+    }
+
+    // keep the integer columns of sealed segments compressed in memory
+    void
+    set_enable_column_encoding(bool enable) {
+        enable_column_encoding_ = enable;
+    }
+
+    bool
+    get_enable_column_encoding() const {
+        return enable_column_encoding_;
+    }
+
+    // search with brute force on the rows left by the filter instead of
+    // the index, if they are no more than this ratio of all rows; 0, the
+    // default, disables it
+    void
+    set_brute_force_filter_ratio(float ratio) {
+        brute_force_filter_ratio_ = ratio;
+    }
+
+    float
+    get_brute_force_filter_ratio() const {
+        return brute_force_filter_ratio_;
+    }
+
+    // disk budget in bytes of the column files kept in the mmap dir for
+    // later loads, 0 unlinks the mapped files as soon as they are mapped
+    void
+    set_column_file_cache_capacity(int64_t capacity) {
+        column_file_cache_capacity_ = capacity;
+    }
+
+    int64_t
+    get_column_file_cache_capacity() const {
+        return column_file_cache_capacity_;
+    }
+
  private:
     bool enable_growing_segment_index_ = false;
+    bool enable_growing_hnsw_ = false;
+    int64_t filter_bitset_cache_capacity_ = 0;
+    float brute_force_filter_ratio_ = 0;
+    bool enable_column_encoding_ = false;
+    int64_t column_file_cache_capacity_ = 0;
     int64_t chunk_rows_ = 32 * 1024;
     int64_t nlist_ = 100;
     int64_t nprobe_ = 4;
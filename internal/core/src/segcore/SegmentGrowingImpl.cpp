@@ -246,6 +246,7 @@ SegmentGrowingImpl::Delete(int64_t reserved_begin,
         sort_timestamps[i] = t;
         sort_pks[i] = pk;
     }
+    FilterDeletedPks(insert_record_, sort_pks, sort_timestamps);
 
     // step 2: fill delete record
     deleted_record_.push(sort_pks, sort_timestamps.data());
@@ -277,10 +278,12 @@ SegmentGrowingImpl::LoadDeletedRecord(const LoadDeletedRecordInfo& info) {
     int64_t size = info.row_count;
     std::vector<PkType> pks(size);
     ParsePksFromIDs(pks, field_meta.get_data_type(), *info.primary_keys);
-    auto timestamps = reinterpret_cast<const Timestamp*>(info.timestamps);
+    auto timestamps_raw = reinterpret_cast<const Timestamp*>(info.timestamps);
+    std::vector<Timestamp> timestamps(timestamps_raw, timestamps_raw + size);
+    FilterDeletedPks(insert_record_, pks, timestamps);
 
     // step 2: fill pks and timestamps
-    deleted_record_.push(pks, timestamps);
+    deleted_record_.push(pks, timestamps.data());
 }
 
 SpanBase
@@ -530,6 +533,19 @@ SegmentGrowingImpl::search_ids(const IdArray& id_array,
     return {std::move(res_id_arr), std::move(res_offsets)};
 }
 
+void
+SegmentGrowingImpl::MayContainPks(const IdArray* ids, bool* result) const {
+    auto field_id = schema_->get_primary_field_id().value_or(FieldId(-1));
+    AssertInfo(field_id.get() != -1, "Primary key is -1");
+    auto& field_meta = schema_->operator[](field_id);
+    auto size = GetSizeOfIdArray(*ids);
+    std::vector<PkType> pks(size);
+    ParsePksFromIDs(pks, field_meta.get_data_type(), *ids);
+    for (int64_t i = 0; i < size; ++i) {
+        result[i] = insert_record_.may_contain_pk(pks[i]);
+    }
+}
+
 std::string
 SegmentGrowingImpl::debug() const {
     return "Growing\n";
@@ -547,6 +563,11 @@ SegmentGrowingImpl::get_active_count(Timestamp ts) const {
     return *iter;
 }
 
+int64_t
+SegmentGrowingImpl::get_delete_barrier(Timestamp ts) const {
+    return get_barrier(deleted_record_, ts);
+}
+
 void
 SegmentGrowingImpl::mask_with_timestamps(BitsetType& bitset_chunk,
                                          Timestamp timestamp) const {
@@ -146,6 +146,9 @@ class SegmentGrowingImpl : public SegmentGrowing {
     int64_t
     get_active_count(Timestamp ts) const override;
 
+    int64_t
+    get_delete_barrier(Timestamp ts) const override;
+
     // for scalar vectors
     template <typename S, typename T = S>
     void
@@ -215,7 +218,17 @@ class SegmentGrowingImpl : public SegmentGrowing {
 
     bool
     HasIndex(FieldId field_id) const override {
-        return true;
+        return indexing_record_.is_in(field_id);
+    }
+
+    const index::IndexBase*
+    get_growing_index(FieldId field_id) const override {
+        if (!indexing_record_.is_in(field_id) ||
+            (*schema_)[field_id].is_vector()) {
+            return nullptr;
+        }
+        return indexing_record_.get_field_indexing(field_id)
+            .get_segment_indexing();
     }
 
     bool
@@ -234,6 +247,14 @@ class SegmentGrowingImpl : public SegmentGrowing {
         return true;
     }
 
+    bool
+    has_raw_data(FieldId field_id) const override {
+        return HasRawData(field_id.get());
+    }
+
+    void
+    MayContainPks(const IdArray* pks, bool* result) const override;
+
     std::vector<OffsetMap::OffsetType>
     find_first(int64_t limit,
                const BitsetType& bitset,
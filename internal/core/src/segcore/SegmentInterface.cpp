@@ -14,8 +14,10 @@
 #include <cstdint>
 
 #include "Utils.h"
+#include "common/Consts.h"
 #include "common/SystemProperty.h"
 #include "common/Types.h"
+#include "query/SearchBruteForce.h"
 #include "query/generated/ExecPlanNodeVisitor.h"
 
 namespace milvus::segcore {
@@ -74,6 +76,95 @@ SegmentInternalInterface::Search(
     return results;
 }
 
+void
+SegmentInternalInterface::vector_search_on_offsets(
+    const SearchInfo& search_info,
+    const void* query_data,
+    int64_t query_count,
+    const std::vector<int64_t>& seg_offsets,
+    SearchResult& output) const {
+    auto& field = get_schema()[search_info.field_id_];
+    query::CheckBruteForceSearchParam(field, search_info);
+
+    // gather the rows into a dense buffer, from raw data or index
+    auto count = static_cast<int64_t>(seg_offsets.size());
+    auto vectors =
+        bulk_subscript(search_info.field_id_, seg_offsets.data(), count);
+    const void* data = nullptr;
+    if (field.get_data_type() == DataType::VECTOR_FLOAT) {
+        data = vectors->vectors().float_vector().data().data();
+    } else {
+        data = vectors->vectors().binary_vector().data();
+    }
+
+    query::dataset::SearchDataset dataset{search_info.metric_type_,
+                                          query_count,
+                                          search_info.topk_,
+                                          search_info.round_decimal_,
+                                          field.get_dim(),
+                                          query_data};
+    auto sub_result = query::BruteForceSearch(
+        dataset, data, count, search_info.search_params_, nullptr);
+    for (auto& offset : sub_result.mutable_seg_offsets()) {
+        if (offset != INVALID_SEG_OFFSET) {
+            offset = seg_offsets[offset];
+        }
+    }
+    output.distances_ = std::move(sub_result.mutable_distances());
+    output.seg_offsets_ = std::move(sub_result.mutable_seg_offsets());
+    output.unity_topK_ = search_info.topk_;
+    output.total_nq_ = query_count;
+}
+
+std::vector<index::VectorIteratorPtr>
+SegmentInternalInterface::SearchIterators(
+    const query::Plan* plan,
+    const query::PlaceholderGroup* placeholder_group,
+    Timestamp timestamp) const {
+    std::shared_lock lck(mutex_);
+    check_search(plan);
+    auto& node = *plan->plan_node_;
+    AssertInfo(dynamic_cast<const query::HybridVectorANNS*>(&node) == nullptr,
+               "search iterator doesn't support hybrid search");
+    auto& ph = placeholder_group->at(0);
+    auto num_queries = ph.num_of_queries_;
+
+    // later searches of iterators never see rows beyond the bitset
+    auto active_count = get_active_count(timestamp);
+    auto bitset = std::make_shared<BitsetType>();
+    if (active_count > 0) {
+        query::ExecPlanNodeVisitor visitor(
+            *this, timestamp, placeholder_group);
+        *bitset = visitor.get_filter_bitset(node, active_count);
+    }
+    auto max_count =
+        static_cast<int64_t>(bitset->size() - bitset->count());
+
+    std::vector<index::VectorIteratorPtr> iterators;
+    auto query_size = ph.blob_.size() / std::max<int64_t>(num_queries, 1);
+    for (int64_t i = 0; i < num_queries; ++i) {
+        auto query_data = std::make_shared<const std::vector<char>>(
+            ph.blob_.begin() + i * query_size,
+            ph.blob_.begin() + (i + 1) * query_size);
+        iterators.push_back(std::make_unique<index::RangeSearchIterator>(
+            node.search_info_,
+            max_count,
+            [this, query_data, bitset, timestamp](const SearchInfo& info) {
+                std::shared_lock lck(mutex_);
+                auto search_info = info;
+                auto result = std::make_unique<SearchResult>();
+                vector_search(search_info,
+                              query_data->data(),
+                              1,
+                              timestamp,
+                              *bitset,
+                              *result);
+                return result;
+            }));
+    }
+    return iterators;
+}
+
 std::unique_ptr<proto::segcore::RetrieveResults>
 SegmentInternalInterface::Retrieve(const query::RetrievePlan* plan,
                                    Timestamp timestamp,
@@ -20,6 +20,7 @@
 
 #include "DeletedRecord.h"
 #include "FieldIndexing.h"
+#include "FilterBitsetCache.h"
 #include "common/Schema.h"
 #include "common/Span.h"
 #include "common/SystemProperty.h"
@@ -33,6 +34,11 @@
 #include "pb/schema.pb.h"
 #include "pb/segcore.pb.h"
 #include "index/IndexInfo.h"
+#include "index/VectorIterator.h"
+
+namespace milvus {
+class EncodedColumnBase;
+}
 
 namespace milvus::segcore {
 
@@ -51,6 +57,14 @@ class SegmentInterface {
     Search(const query::Plan* Plan,
            const query::PlaceholderGroup* placeholder_group) const = 0;
 
+    // one iterator per query of placeholder_group, yielding results in
+    // batches, the filter is evaluated once when creating the iterators.
+    // Iterators must not outlive the segment.
+    virtual std::vector<index::VectorIteratorPtr>
+    SearchIterators(const query::Plan* Plan,
+                    const query::PlaceholderGroup* placeholder_group,
+                    Timestamp timestamp) const = 0;
+
     virtual std::unique_ptr<proto::segcore::RetrieveResults>
     Retrieve(const query::RetrievePlan* Plan,
              Timestamp timestamp,
@@ -103,6 +117,11 @@ class SegmentInterface {
 
     virtual bool
     HasRawData(int64_t field_id) const = 0;
+
+    // result[i] is false if the i-th pk is surely not in the segment, the
+    // deletions of the pk may skip the segment
+    virtual void
+    MayContainPks(const IdArray* pks, bool* result) const = 0;
 };
 
 // internal API for DSL calculation
@@ -130,6 +149,11 @@ class SegmentInternalInterface : public SegmentInterface {
     Search(const query::Plan* Plan,
            const query::PlaceholderGroup* placeholder_group) const override;
 
+    std::vector<index::VectorIteratorPtr>
+    SearchIterators(const query::Plan* Plan,
+                    const query::PlaceholderGroup* placeholder_group,
+                    Timestamp timestamp) const override;
+
     void
     FillPrimaryKeys(const query::Plan* plan,
                     SearchResult& results) const override;
@@ -172,6 +196,33 @@ class SegmentInternalInterface : public SegmentInterface {
                   const BitsetView& bitset,
                   SearchResult& output) const = 0;
 
+    // same as HasRawData, but the caller must hold mutex_
+    virtual bool
+    has_raw_data(FieldId field_id) const = 0;
+
+    // the column of a field kept encoded, nullptr if the field isn't,
+    // filters on it are evaluated on the encoded data
+    virtual std::shared_ptr<const EncodedColumnBase>
+    get_encoded_column(FieldId field_id) const {
+        return nullptr;
+    }
+
+    // the index of a field covering all the rows, kept up to date with the
+    // inserts, nullptr if the field has none
+    virtual const index::IndexBase*
+    get_growing_index(FieldId field_id) const {
+        return nullptr;
+    }
+
+    // exact search on the rows at seg_offsets only, used when the filter
+    // leaves so few rows that gathering them is cheaper than the index
+    void
+    vector_search_on_offsets(const SearchInfo& search_info,
+                             const void* query_data,
+                             int64_t query_count,
+                             const std::vector<int64_t>& seg_offsets,
+                             SearchResult& output) const;
+
     virtual void
     mask_with_delete(BitsetType& bitset,
                      int64_t ins_barrier,
@@ -200,6 +251,26 @@ class SegmentInternalInterface : public SegmentInterface {
     virtual int64_t
     get_active_count(Timestamp ts) const = 0;
 
+    // count of deleted records visible at ts
+    virtual int64_t
+    get_delete_barrier(Timestamp ts) const = 0;
+
+    // cache of evaluated filter bitsets, nullptr if the segment doesn't
+    // support it or the cache is disabled
+    virtual FilterBitsetCache*
+    get_filter_bitset_cache() const {
+        return nullptr;
+    }
+
+    // key of the predicate evaluated at ts in the filter bitset cache,
+    // only called when get_filter_bitset_cache() isn't nullptr
+    virtual std::string
+    get_filter_cache_key(const std::string& fingerprint,
+                         int64_t active_count,
+                         Timestamp ts) const {
+        PanicInfo("filter bitset cache is not supported by this segment");
+    }
+
     virtual std::pair<std::unique_ptr<IdArray>, std::vector<SegOffset>>
     search_ids(const IdArray& id_array, Timestamp timestamp) const = 0;
 
@@ -23,9 +23,12 @@
 
 #include "Utils.h"
 #include "Types.h"
+#include "ResultCache.h"
+#include "SegcoreConfig.h"
 #include "common/Json.h"
 #include "exceptions/EasyAssert.h"
 #include "mmap/Column.h"
+#include "mmap/ColumnFile.h"
 #include "common/Consts.h"
 #include "common/FieldMeta.h"
 #include "common/Types.h"
@@ -67,6 +70,8 @@ SegmentSealedImpl::LoadIndex(const LoadIndexInfo& info) {
     } else {
         LoadScalarIndex(info);
     }
+    invalidate_filter_cache();
+    invalidate_result_cache();
 }
 
 void
@@ -134,6 +139,7 @@ SegmentSealedImpl::LoadScalarIndex(const LoadIndexInfo& info) {
     if (schema_->get_primary_field_id() == field_id) {
         AssertInfo(field_id.get() != -1, "Primary key is -1");
         AssertInfo(insert_record_.empty_pks(), "already exists");
+        insert_record_.reserve_pks(row_count);
         switch (field_meta.get_data_type()) {
             case DataType::INT64: {
                 auto int64_index = dynamic_cast<index::ScalarIndex<int64_t>*>(
@@ -183,6 +189,13 @@ SegmentSealedImpl::LoadFieldData(const LoadFieldDataInfo& load_info) {
         auto insert_files = info.insert_files;
         auto field_data_info =
             FieldDataInfo(field_id.get(), num_rows, load_info.mmap_dir_path);
+        field_data_info.insert_files = insert_files;
+
+        if (!load_info.mmap_dir_path.empty() &&
+            !SystemProperty::Instance().IsSystem(field_id) &&
+            LoadColumnFile(field_id, field_data_info)) {
+            continue;
+        }
 
         auto parallel_degree = static_cast<uint64_t>(
             DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
@@ -325,6 +338,20 @@ SegmentSealedImpl::LoadFieldData(FieldId field_id, FieldDataInfo& data) {
                                    num_rows));
         }
 
+        // the primary keys are read raw to build the pk offset map
+        if (SegcoreConfig::default_config().get_enable_column_encoding() &&
+            schema_->get_primary_field_id() != field_id) {
+            if (auto encoded = EncodeColumn(*column, data_type)) {
+                LOG_SEGCORE_INFO_
+                    << "encode column " << field_id.get() << " of segment "
+                    << id_ << ", "
+                    << std::static_pointer_cast<EncodedColumnBase>(encoded)
+                           ->EncodedSize()
+                    << " bytes from " << column->Capacity();
+                column = std::move(encoded);
+            }
+        }
+
         {
             std::unique_lock lck(mutex_);
             fields_.emplace(field_id, column);
@@ -343,96 +370,134 @@ SegmentSealedImpl::LoadFieldData(FieldId field_id, FieldDataInfo& data) {
     }
     std::unique_lock lck(mutex_);
     update_row_count(num_rows);
+    lck.unlock();
+    invalidate_filter_cache();
+    invalidate_result_cache();
+}
+
+static std::filesystem::path
+ColumnFilePath(const std::string& mmap_dir_path,
+               int64_t segment_id,
+               FieldId field_id) {
+    return std::filesystem::path(mmap_dir_path) / std::to_string(segment_id) /
+           (std::to_string(field_id.get()) + kColumnFileExtension);
+}
+
+bool
+SegmentSealedImpl::LoadColumnFile(const FieldId field_id,
+                                  const FieldDataInfo& data) {
+    auto fingerprint = ColumnFileFingerprint(data.insert_files);
+    auto capacity =
+        SegcoreConfig::default_config().get_column_file_cache_capacity();
+    if (fingerprint == 0 || !ColumnFileSupported() || capacity == 0) {
+        return false;
+    }
+    auto filepath =
+        ColumnFilePath(data.mmap_dir_path, get_segment_id(), field_id);
+    if (!std::filesystem::exists(filepath)) {
+        return false;
+    }
+
+    auto& field_meta = (*schema_)[field_id];
+    auto file = File::Open(filepath.string(), O_RDONLY);
+    auto header = ReadColumnFileHeader(
+        file, field_meta.get_data_type(), fingerprint, data.row_count);
+    if (!header.has_value()) {
+        LOG_SEGCORE_WARNING_ << "drop stale column file " << filepath;
+        std::filesystem::remove(filepath);
+        return false;
+    }
+
+    LOG_SEGCORE_INFO_ << "map column file " << filepath << ", "
+                      << header->num_rows << " rows";
+    auto column = MapColumnFile(file, *header, field_meta);
+    // a reused column file is the most recently used one
+    std::error_code ec;
+    std::filesystem::last_write_time(
+        filepath, std::filesystem::file_time_type::clock::now(), ec);
+    add_column_file(field_id, filepath);
+    load_mapped_column(field_id, column);
+    return true;
 }
 
 void
 SegmentSealedImpl::MapFieldData(const FieldId field_id, FieldDataInfo& data) {
-    auto filepath = std::filesystem::path(data.mmap_dir_path) /
-                    std::to_string(get_segment_id()) /
-                    std::to_string(field_id.get());
+    auto filepath =
+        ColumnFilePath(data.mmap_dir_path, get_segment_id(), field_id);
     auto dir = filepath.parent_path();
     std::filesystem::create_directories(dir);
 
-    auto file = File::Open(filepath.string(), O_CREAT | O_TRUNC | O_RDWR);
+    // write to a temporary file and rename it once complete, so a column
+    // file is never seen half written. The column file is kept only within
+    // the disk budget and if it can be mapped at a page offset, otherwise
+    // the data is written at offset 0 and the file unlinked once mapped
+    auto fingerprint = ColumnFileFingerprint(data.insert_files);
+    auto capacity =
+        SegcoreConfig::default_config().get_column_file_cache_capacity();
+    auto keep = fingerprint != 0 && ColumnFileSupported() && capacity > 0;
+    auto tmp_filepath = filepath;
+    tmp_filepath += ".tmp";
+    auto file = File::Open(tmp_filepath.string(), O_CREAT | O_TRUNC | O_RDWR);
 
     auto& field_meta = (*schema_)[field_id];
     auto data_type = field_meta.get_data_type();
 
     // write the field data to disk
-    size_t total_written{0};
-    auto data_size = 0;
-    std::vector<uint64_t> indices{};
+    ColumnFileWriter writer(file, data_type, fingerprint, keep);
+    size_t data_size = 0;
     storage::FieldDataPtr field_data;
     while (data.channel->pop(field_data)) {
         data_size += field_data->Size();
-        auto written = WriteFieldData(file, data_type, field_data);
-        if (written != field_data->Size()) {
-            break;
-        }
-
-        for (auto i = 0; i < field_data->get_num_rows(); i++) {
-            auto size = field_data->Size(i);
-            indices.emplace_back(total_written);
-            total_written += size;
-        }
+        writer.Write(field_data);
     }
+    auto& header = writer.Finish();
     AssertInfo(
-        total_written == data_size,
-        fmt::format(
-            "failed to write data file {}, written {} but total {}, err: {}",
-            filepath.c_str(),
-            total_written,
-            data_size,
-            strerror(errno)));
-
-    auto num_rows = data.row_count;
-    std::shared_ptr<ColumnBase> column{};
-    if (datatype_is_variable(data_type)) {
-        switch (data_type) {
-            case milvus::DataType::STRING:
-            case milvus::DataType::VARCHAR: {
-                auto var_column = std::make_shared<VariableColumn<std::string>>(
-                    file, total_written, field_meta);
-                var_column->Seal(std::move(indices));
-                column = std::move(var_column);
-                break;
-            }
-            case milvus::DataType::JSON: {
-                auto var_column =
-                    std::make_shared<VariableColumn<milvus::Json>>(
-                        file, total_written, field_meta);
-                var_column->Seal(std::move(indices));
-                column = std::move(var_column);
-                break;
-            }
-            default: {
-            }
-        }
+        header.data_size == data_size,
+        fmt::format("failed to write data file {}, written {} but total {}",
+                    filepath.c_str(),
+                    header.data_size,
+                    data_size));
+
+    auto column = MapColumnFile(
+        file, header, field_meta, writer.TakeIndices(), writer.DataOffset());
+
+    if (keep) {
+        std::filesystem::rename(tmp_filepath, filepath);
+        add_column_file(field_id, filepath);
+        GcColumnFiles(data.mmap_dir_path, capacity);
     } else {
-        column = std::make_shared<Column>(file, total_written, field_meta);
+        auto ok = unlink(tmp_filepath.c_str());
+        AssertInfo(ok == 0,
+                   fmt::format("failed to unlink mmap data file {}, err: {}",
+                               tmp_filepath.c_str(),
+                               strerror(errno)));
     }
 
+    load_mapped_column(field_id, column);
+}
+
+void
+SegmentSealedImpl::load_mapped_column(
+    const FieldId field_id, const std::shared_ptr<ColumnBase>& column) {
     {
         std::unique_lock lck(mutex_);
         fields_.emplace(field_id, column);
     }
 
-    auto ok = unlink(filepath.c_str());
-    AssertInfo(ok == 0,
-               fmt::format("failed to unlink mmap data file {}, err: {}",
-                           filepath.c_str(),
-                           strerror(errno)));
-
     // set pks to offset
     if (schema_->get_primary_field_id() == field_id) {
         AssertInfo(field_id.get() != -1, "Primary key is -1");
         AssertInfo(insert_record_.empty_pks(), "already exists");
-        insert_record_.insert_pks(data_type, column);
+        insert_record_.insert_pks((*schema_)[field_id].get_data_type(),
+                                  column);
         insert_record_.seal_pks();
     }
 
     std::unique_lock lck(mutex_);
     set_bit(field_data_ready_bitset_, field_id, true);
+    lck.unlock();
+    invalidate_filter_cache();
+    invalidate_result_cache();
 }
 
 void
@@ -447,10 +512,13 @@ SegmentSealedImpl::LoadDeletedRecord(const LoadDeletedRecordInfo& info) {
     int64_t size = info.row_count;
     std::vector<PkType> pks(size);
     ParsePksFromIDs(pks, field_meta.get_data_type(), *info.primary_keys);
-    auto timestamps = reinterpret_cast<const Timestamp*>(info.timestamps);
+    auto timestamps_raw = reinterpret_cast<const Timestamp*>(info.timestamps);
+    std::vector<Timestamp> timestamps(timestamps_raw, timestamps_raw + size);
+    FilterDeletedPks(insert_record_, pks, timestamps);
 
     // step 2: fill pks and timestamps
-    deleted_record_.push(pks, timestamps);
+    deleted_record_.push(pks, timestamps.data());
+    invalidate_result_cache();
 }
 
 // internal API: support scalar index only
@@ -509,7 +577,17 @@ SegmentSealedImpl::GetMemoryUsageInBytes() const {
     // TODO: add estimate for index
     std::shared_lock lck(mutex_);
     auto row_count = num_rows_.value_or(0);
-    return schema_->get_total_sizeof() * row_count;
+    int64_t usage = schema_->get_total_sizeof() * row_count;
+    // an encoded column takes its encoded size and the copy decoded for the
+    // consumers of the raw values, instead of the raw size
+    for (auto& [field_id, column] : fields_) {
+        if (auto encoded =
+                std::dynamic_pointer_cast<EncodedColumnBase>(column)) {
+            usage += encoded->EncodedSize() + encoded->DecodedSize();
+            usage -= (*schema_)[field_id].get_sizeof() * row_count;
+        }
+    }
+    return usage;
 }
 
 int64_t
@@ -639,8 +717,15 @@ SegmentSealedImpl::DropFieldData(const FieldId field_id) {
         std::unique_lock lck(mutex_);
         set_bit(field_data_ready_bitset_, field_id, false);
         insert_record_.drop_field_data(field_id);
+        auto column_file = column_files_.find(field_id);
+        if (column_file != column_files_.end()) {
+            remove_column_file(column_file->second);
+            column_files_.erase(column_file);
+        }
         lck.unlock();
     }
+    invalidate_filter_cache();
+    invalidate_result_cache();
 }
 
 void
@@ -656,6 +741,9 @@ SegmentSealedImpl::DropIndex(const FieldId field_id) {
     std::unique_lock lck(mutex_);
     vector_indexings_.drop_field_indexing(field_id);
     set_bit(index_ready_bitset_, field_id, false);
+    lck.unlock();
+    invalidate_filter_cache();
+    invalidate_result_cache();
 }
 
 void
@@ -693,7 +781,121 @@ SegmentSealedImpl::SegmentSealedImpl(SchemaPtr schema, int64_t segment_id)
       field_data_ready_bitset_(schema->size()),
       index_ready_bitset_(schema->size()),
       scalar_indexings_(schema->size()),
-      id_(segment_id) {
+      id_(segment_id),
+      filter_bitset_cache_(SegcoreConfig::default_config()
+                               .get_filter_bitset_cache_capacity()) {
+}
+
+SegmentSealedImpl::~SegmentSealedImpl() {
+    ResultCache::GetInstance().Invalidate(this);
+    // the column files of a released segment are of no more use
+    for (auto& [field_id, filepath] : column_files_) {
+        remove_column_file(filepath);
+    }
+}
+
+void
+SegmentSealedImpl::add_column_file(const FieldId field_id,
+                                   const std::filesystem::path& filepath) {
+    std::unique_lock lck(mutex_);
+    column_files_[field_id] = filepath;
+}
+
+void
+SegmentSealedImpl::remove_column_file(const std::filesystem::path& filepath) {
+    std::error_code ec;
+    std::filesystem::remove(filepath, ec);
+    // the segment dir is only removed once empty
+    std::filesystem::remove(filepath.parent_path(), ec);
+}
+
+void
+SegmentSealedImpl::invalidate_result_cache() {
+    ++result_cache_generation_;
+    ResultCache::GetInstance().Invalidate(this);
+}
+
+void
+SegmentSealedImpl::invalidate_filter_cache() {
+    ++filter_cache_generation_;
+    filter_bitset_cache_.Clear();
+}
+
+Timestamp
+SegmentSealedImpl::timestamp_bucket(Timestamp ts) const {
+    auto row_count = num_rows_.value_or(0);
+    auto range = insert_record_.timestamp_index_.get_active_range(ts);
+    if (range.first == range.second && range.first == row_count) {
+        return MAX_TIMESTAMP;
+    }
+    return ts;
+}
+
+std::string
+SegmentSealedImpl::get_filter_cache_key(const std::string& fingerprint,
+                                        int64_t active_count,
+                                        Timestamp ts) const {
+    return FilterBitsetCache::MakeKey(fingerprint,
+                                      filter_cache_generation_.load(),
+                                      active_count,
+                                      timestamp_bucket(ts));
+}
+
+std::unique_ptr<SearchResult>
+SegmentSealedImpl::Search(
+    const query::Plan* plan,
+    const query::PlaceholderGroup* placeholder_group) const {
+    auto& cache = ResultCache::GetInstance();
+    if (!cache.Enabled() || plan->serialized_plan_.empty()) {
+        return SegmentInternalInterface::Search(plan, placeholder_group);
+    }
+
+    // search sees all delete records, see SegmentInternalInterface::Search
+    auto key = MakeSearchCacheKey(plan,
+                                  placeholder_group,
+                                  result_cache_generation_.load(),
+                                  deleted_record_.size());
+    if (auto results = cache.GetSearchResult(this, key)) {
+        results->segment_ = (void*)this;
+        return results;
+    }
+
+    auto results = SegmentInternalInterface::Search(plan, placeholder_group);
+    cache.PutSearchResult(this, std::move(key), *results);
+    return results;
+}
+
+std::unique_ptr<proto::segcore::RetrieveResults>
+SegmentSealedImpl::Retrieve(const query::RetrievePlan* plan,
+                            Timestamp timestamp,
+                            int64_t limit_size) const {
+    auto& cache = ResultCache::GetInstance();
+    if (!cache.Enabled() || plan->serialized_plan_.empty()) {
+        return SegmentInternalInterface::Retrieve(plan, timestamp, limit_size);
+    }
+
+    std::string key;
+    {
+        std::shared_lock lck(mutex_);
+        if (!is_system_field_ready()) {
+            lck.unlock();
+            return SegmentInternalInterface::Retrieve(
+                plan, timestamp, limit_size);
+        }
+        key = MakeRetrieveCacheKey(plan,
+                                   result_cache_generation_.load(),
+                                   get_delete_barrier(timestamp),
+                                   timestamp_bucket(timestamp),
+                                   limit_size);
+    }
+    if (auto results = cache.GetRetrieveResult(this, key)) {
+        return results;
+    }
+
+    auto results =
+        SegmentInternalInterface::Retrieve(plan, timestamp, limit_size);
+    cache.PutRetrieveResult(this, std::move(key), *results);
+    return results;
 }
 
 void
@@ -783,6 +985,49 @@ SegmentSealedImpl::bulk_subscript_impl(int64_t element_sizeof,
     }
 }
 
+template <typename T>
+static std::unique_ptr<DataArray>
+bulk_subscript_encoded_impl(const EncodedColumnBase* column,
+                            const FieldMeta& field_meta,
+                            const int64_t* seg_offsets,
+                            int64_t count) {
+    FixedVector<T> output(count);
+    static_cast<const EncodedColumn<T>*>(column)->BulkValueAt(
+        seg_offsets, count, output.data());
+    return CreateScalarDataArrayFrom(output.data(), count, field_meta);
+}
+
+static std::unique_ptr<DataArray>
+bulk_subscript_encoded(const EncodedColumnBase* column,
+                       const FieldMeta& field_meta,
+                       const int64_t* seg_offsets,
+                       int64_t count) {
+    switch (field_meta.get_data_type()) {
+        case DataType::INT8:
+            return bulk_subscript_encoded_impl<int8_t>(
+                column, field_meta, seg_offsets, count);
+        case DataType::INT16:
+            return bulk_subscript_encoded_impl<int16_t>(
+                column, field_meta, seg_offsets, count);
+        case DataType::INT32:
+            return bulk_subscript_encoded_impl<int32_t>(
+                column, field_meta, seg_offsets, count);
+        case DataType::INT64:
+            return bulk_subscript_encoded_impl<int64_t>(
+                column, field_meta, seg_offsets, count);
+        case DataType::VARCHAR:
+        case DataType::STRING: {
+            FixedVector<std::string> output(count);
+            static_cast<const EncodedStringColumn*>(column)->BulkValueAt(
+                seg_offsets, count, output.data());
+            return CreateScalarDataArrayFrom(output.data(), count, field_meta);
+        }
+        default:
+            PanicInfo(fmt::format("unsupported encoded data type: {}",
+                                  datatype_name(field_meta.get_data_type())));
+    }
+}
+
 std::unique_ptr<DataArray>
 SegmentSealedImpl::fill_with_empty(FieldId field_id, int64_t count) const {
     auto& field_meta = schema_->operator[](field_id);
@@ -821,6 +1066,11 @@ SegmentSealedImpl::bulk_subscript(FieldId field_id,
     // to make sure it won't get released if segment released
     auto column = fields_.at(field_id);
 
+    if (auto encoded = std::dynamic_pointer_cast<EncodedColumnBase>(column)) {
+        return bulk_subscript_encoded(
+            encoded.get(), field_meta, seg_offsets, count);
+    }
+
     if (datatype_is_variable(field_meta.get_data_type())) {
         switch (field_meta.get_data_type()) {
             case DataType::VARCHAR:
@@ -909,6 +1159,15 @@ SegmentSealedImpl::bulk_subscript(FieldId field_id,
     }
 }
 
+std::shared_ptr<const EncodedColumnBase>
+SegmentSealedImpl::get_encoded_column(FieldId field_id) const {
+    std::shared_lock lck(mutex_);
+    if (auto it = fields_.find(field_id); it != fields_.end()) {
+        return std::dynamic_pointer_cast<const EncodedColumnBase>(it->second);
+    }
+    return nullptr;
+}
+
 bool
 SegmentSealedImpl::HasIndex(FieldId field_id) const {
     std::shared_lock lck(mutex_);
@@ -928,7 +1187,11 @@ SegmentSealedImpl::HasFieldData(FieldId field_id) const {
 bool
 SegmentSealedImpl::HasRawData(int64_t field_id) const {
     std::shared_lock lck(mutex_);
-    auto fieldID = FieldId(field_id);
+    return has_raw_data(FieldId(field_id));
+}
+
+bool
+SegmentSealedImpl::has_raw_data(FieldId fieldID) const {
     const auto& field_meta = schema_->operator[](fieldID);
     if (datatype_is_vector(field_meta.get_data_type())) {
         if (get_bit(index_ready_bitset_, fieldID)) {
@@ -980,6 +1243,19 @@ SegmentSealedImpl::search_ids(const IdArray& id_array,
     return {std::move(res_id_arr), std::move(res_offsets)};
 }
 
+void
+SegmentSealedImpl::MayContainPks(const IdArray* ids, bool* result) const {
+    auto field_id = schema_->get_primary_field_id().value_or(FieldId(-1));
+    AssertInfo(field_id.get() != -1, "Primary key is -1");
+    auto& field_meta = schema_->operator[](field_id);
+    auto size = GetSizeOfIdArray(*ids);
+    std::vector<PkType> pks(size);
+    ParsePksFromIDs(pks, field_meta.get_data_type(), *ids);
+    for (int64_t i = 0; i < size; ++i) {
+        result[i] = insert_record_.may_contain_pk(pks[i]);
+    }
+}
+
 Status
 SegmentSealedImpl::Delete(int64_t reserved_offset,  // deprecated
                           int64_t size,
@@ -1005,8 +1281,10 @@ SegmentSealedImpl::Delete(int64_t reserved_offset,  // deprecated
         sort_timestamps[i] = t;
         sort_pks[i] = pk;
     }
+    FilterDeletedPks(insert_record_, sort_pks, sort_timestamps);
 
     deleted_record_.push(sort_pks, sort_timestamps.data());
+    invalidate_result_cache();
     return Status::OK();
 }
 
@@ -1036,6 +1314,11 @@ SegmentSealedImpl::get_active_count(Timestamp ts) const {
     return this->get_row_count();
 }
 
+int64_t
+SegmentSealedImpl::get_delete_barrier(Timestamp ts) const {
+    return get_barrier(deleted_record_, ts);
+}
+
 void
 SegmentSealedImpl::mask_with_timestamps(BitsetType& bitset_chunk,
                                         Timestamp timestamp) const {
@@ -15,6 +15,7 @@
 #include <tbb/concurrent_vector.h>
 
 #include <deque>
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@
 #include "SegmentSealed.h"
 #include "TimestampIndex.h"
 #include "mmap/Column.h"
+#include "mmap/EncodedColumn.h"
 #include "index/ScalarIndex.h"
 #include "sys/mman.h"
 #include "common/Types.h"
@@ -38,7 +40,7 @@ namespace milvus::segcore {
 class SegmentSealedImpl : public SegmentSealed {
  public:
     explicit SegmentSealedImpl(SchemaPtr schema, int64_t segment_id);
-    ~SegmentSealedImpl() override = default;
+    ~SegmentSealedImpl() override;
     void
     LoadIndex(const LoadIndexInfo& info) override;
     void
@@ -70,6 +72,25 @@ class SegmentSealedImpl : public SegmentSealed {
     bool
     HasRawData(int64_t field_id) const override;
 
+    void
+    MayContainPks(const IdArray* pks, bool* result) const override;
+
+    bool
+    has_raw_data(FieldId field_id) const override;
+
+    std::shared_ptr<const EncodedColumnBase>
+    get_encoded_column(FieldId field_id) const override;
+
+    // search and retrieve results are served from ResultCache if enabled
+    std::unique_ptr<SearchResult>
+    Search(const query::Plan* plan,
+           const query::PlaceholderGroup* placeholder_group) const override;
+
+    std::unique_ptr<proto::segcore::RetrieveResults>
+    Retrieve(const query::RetrievePlan* plan,
+             Timestamp timestamp,
+             int64_t limit_size) const override;
+
  public:
     int64_t
     GetMemoryUsageInBytes() const override;
@@ -147,6 +168,20 @@ class SegmentSealedImpl : public SegmentSealed {
     int64_t
     get_active_count(Timestamp ts) const override;
 
+    int64_t
+    get_delete_barrier(Timestamp ts) const override;
+
+    FilterBitsetCache*
+    get_filter_bitset_cache() const override {
+        return filter_bitset_cache_.Enabled() ? &filter_bitset_cache_
+                                              : nullptr;
+    }
+
+    std::string
+    get_filter_cache_key(const std::string& fingerprint,
+                         int64_t active_count,
+                         Timestamp ts) const override;
+
     const ConcurrentVector<Timestamp>&
     get_timestamps() const override {
         return insert_record_.timestamps_;
@@ -216,12 +251,46 @@ class SegmentSealedImpl : public SegmentSealed {
     std::pair<std::unique_ptr<IdArray>, std::vector<SegOffset>>
     search_ids(const IdArray& id_array, Timestamp timestamp) const override;
 
+    // map the column file kept by an earlier load of the same binlogs,
+    // false if there is none
+    bool
+    LoadColumnFile(const FieldId field_id, const FieldDataInfo& data);
+
+    // install a mapped column of a user field
+    void
+    load_mapped_column(const FieldId field_id,
+                       const std::shared_ptr<ColumnBase>& column);
+
+    // the column file of a field, removed with the field or the segment
+    void
+    add_column_file(const FieldId field_id,
+                    const std::filesystem::path& filepath);
+
+    static void
+    remove_column_file(const std::filesystem::path& filepath);
+
     void
     LoadVecIndex(const LoadIndexInfo& info);
 
     void
     LoadScalarIndex(const LoadIndexInfo& info);
 
+    // drop cached results of this segment, must be called after any change
+    // which may affect the search or retrieve results
+    void
+    invalidate_result_cache();
+
+    // drop cached filter bitsets of this segment, must be called after any
+    // change of field data or index, deletions are tracked by delete barrier
+    void
+    invalidate_filter_cache();
+
+    // all rows are visible once the timestamp passes the max insert
+    // timestamp, map all such timestamps to MAX_TIMESTAMP so that they can
+    // share cache entries, must hold mutex_
+    Timestamp
+    timestamp_bucket(Timestamp ts) const;
+
  private:
     // segment loading state
     BitsetType field_data_ready_bitset_;
@@ -246,6 +315,15 @@ class SegmentSealedImpl : public SegmentSealed {
     SchemaPtr schema_;
     int64_t id_;
     std::unordered_map<FieldId, std::shared_ptr<ColumnBase>> fields_;
+
+    // bumped on invalidation, results computed before are unreachable
+    std::atomic<int64_t> result_cache_generation_ = 0;
+
+    mutable FilterBitsetCache filter_bitset_cache_;
+    std::atomic<int64_t> filter_cache_generation_ = 0;
+
+    // column files in the mmap dir of the mapped fields
+    std::unordered_map<FieldId, std::filesystem::path> column_files_;
 };
 
 inline SegmentSealedPtr
@@ -588,7 +588,7 @@ void
 LoadFieldDatasFromRemote(std::vector<std::string>& remote_files,
                          storage::FieldDataChannelPtr channel) {
     auto parallel_degree =
-        static_cast<uint64_t>(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+        static_cast<int64_t>(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
 
     auto rcm = storage::RemoteChunkManagerSingleton::GetInstance()
                    .GetRemoteChunkManager();
@@ -599,28 +599,13 @@ LoadFieldDatasFromRemote(std::vector<std::string>& remote_files,
                          std::stol(b.substr(b.find_last_of('/') + 1));
               });
 
-    std::vector<std::string> batch_files;
-
-    auto FetchRawData = [&]() {
-        auto result = storage::GetObjectData(rcm.get(), batch_files);
-        for (auto& data : result) {
-            channel->push(data);
-        }
-    };
-
-    for (auto& file : remote_files) {
-        if (batch_files.size() >= parallel_degree) {
-            FetchRawData();
-            batch_files.clear();
-        }
-
-        batch_files.emplace_back(file);
-    }
-
-    if (batch_files.size() > 0) {
-        FetchRawData();
+    try {
+        storage::GetObjectDataToChannel(
+            rcm.get(), remote_files, channel, parallel_degree);
+    } catch (...) {
+        channel->close();
+        throw;
     }
-
     channel->close();
 }
 
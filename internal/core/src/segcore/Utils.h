@@ -79,6 +79,32 @@ MergeDataArray(
     std::vector<std::pair<milvus::SearchResult*, int64_t>>& result_offsets,
     const FieldMeta& field_meta);
 
+// drop the deletions of the pks surely not in insert_record, by its pk
+// filter, keeping the order of the others. Nothing is dropped before all the
+// pks are loaded, as the deletions of a sealed segment may be loaded ahead of
+// or along with its pk field.
+template <bool is_sealed>
+void
+FilterDeletedPks(const InsertRecord<is_sealed>& insert_record,
+                 std::vector<PkType>& pks,
+                 std::vector<Timestamp>& timestamps) {
+    if (!insert_record.pks_loaded()) {
+        return;
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < pks.size(); ++i) {
+        if (insert_record.may_contain_pk(pks[i])) {
+            if (n != i) {
+                pks[n] = std::move(pks[i]);
+                timestamps[n] = timestamps[i];
+            }
+            ++n;
+        }
+    }
+    pks.resize(n);
+    timestamps.resize(n);
+}
+
 template <bool is_sealed>
 std::shared_ptr<DeletedRecord::TmpBitmap>
 get_deleted_bitmap(int64_t del_barrier,
@@ -117,6 +143,10 @@ get_deleted_bitmap(int64_t del_barrier,
     for (auto del_index = start; del_index < end; ++del_index) {
         auto pk = delete_record.pks()[del_index];
         auto timestamp = delete_record.timestamps()[del_index];
+        // the pk is not in the segment, skip it in O(1)
+        if (!insert_record.may_contain_pk(pk)) {
+            continue;
+        }
 
         delete_timestamps[pk] = timestamp > delete_timestamps[pk]
                                     ? timestamp
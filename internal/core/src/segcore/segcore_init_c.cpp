@@ -11,6 +11,7 @@
 
 #include "config/ConfigKnowhere.h"
 #include "log/Log.h"
+#include "segcore/ResultCache.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/segcore_init_c.h"
 
@@ -35,6 +36,13 @@ SegcoreSetEnableGrowingSegmentIndex(const bool value) {
     config.set_enable_growing_segment_index(value);
 }
 
+extern "C" void
+SegcoreSetEnableGrowingHnsw(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_growing_hnsw(value);
+}
+
 extern "C" void
 SegcoreSetNlist(const int64_t value) {
     milvus::segcore::SegcoreConfig& config =
@@ -49,6 +57,39 @@ SegcoreSetNprobe(const int64_t value) {
     config.set_nprobe(value);
 }
 
+extern "C" void
+SegcoreSetResultCacheCapacity(const int64_t value) {
+    milvus::segcore::ResultCache::GetInstance().SetCapacity(value);
+}
+
+extern "C" void
+SegcoreSetFilterBitsetCacheCapacity(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_filter_bitset_cache_capacity(value);
+}
+
+extern "C" void
+SegcoreSetBruteForceFilterRatio(const float value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_brute_force_filter_ratio(value);
+}
+
+extern "C" void
+SegcoreSetEnableColumnEncoding(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_column_encoding(value);
+}
+
+extern "C" void
+SegcoreSetColumnFileCacheCapacity(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_column_file_cache_capacity(value);
+}
+
 extern "C" void
 SegcoreSetKnowhereThreadPoolNum(const uint32_t num_threads) {
     milvus::config::KnowhereInitThreadPool(num_threads);
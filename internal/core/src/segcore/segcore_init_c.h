@@ -24,12 +24,30 @@ SegcoreSetChunkRows(const int64_t);
 void
 SegcoreSetEnableGrowingSegmentIndex(const bool);
 
+void
+SegcoreSetEnableGrowingHnsw(const bool);
+
 void
 SegcoreSetNlist(const int64_t);
 
 void
 SegcoreSetNprobe(const int64_t);
 
+void
+SegcoreSetResultCacheCapacity(const int64_t);
+
+void
+SegcoreSetFilterBitsetCacheCapacity(const int64_t);
+
+void
+SegcoreSetBruteForceFilterRatio(const float);
+
+void
+SegcoreSetEnableColumnEncoding(const bool);
+
+void
+SegcoreSetColumnFileCacheCapacity(const int64_t);
+
 // return value must be freed by the caller
 char*
 SegcoreSetSimdType(const char*);
@@ -0,0 +1,449 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/CachedChunkManager.h"
+
+#include <algorithm>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <ctime>
+#include <tuple>
+
+#include "common/Metrics.h"
+#include "exceptions/EasyAssert.h"
+#include "log/Log.h"
+
+namespace milvus::storage {
+
+namespace {
+struct Footer {
+    uint64_t size;
+    uint32_t crc;
+    uint32_t magic;
+};
+static_assert(sizeof(Footer) == 16);
+
+const uint32_t kFooterMagic = 0x4d434346;  // "FCCM"
+const char* kTmpSuffix = ".tmp";
+// Size() may be called for objects never read, keep the sizes bounded
+const size_t kMaxPendingSizes = 4096;
+
+uint32_t
+Crc32(const void* buf, uint64_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(buf, size);
+    return crc.checksum();
+}
+
+prometheus::Counter&
+HitCounter() {
+    static auto& counter = metrics::GetCounter(
+        "milvus_storage_cache_hit_total",
+        "reads of remote objects served by the local disk cache");
+    return counter;
+}
+
+prometheus::Counter&
+MissCounter() {
+    static auto& counter = metrics::GetCounter(
+        "milvus_storage_cache_miss_total",
+        "reads of remote objects not found in the local disk cache");
+    return counter;
+}
+
+prometheus::Counter&
+CorruptedCounter() {
+    static auto& counter = metrics::GetCounter(
+        "milvus_storage_cache_corrupted_total",
+        "local disk cache files dropped for failing verification");
+    return counter;
+}
+
+prometheus::Gauge&
+SizeGauge() {
+    static auto& gauge =
+        metrics::GetGauge("milvus_storage_cache_size_bytes",
+                          "size of the files in the local disk cache");
+    return gauge;
+}
+}  // namespace
+
+CachedChunkManager::CachedChunkManager(ChunkManagerPtr remote,
+                                       const std::string& cache_dir,
+                                       uint64_t capacity)
+    : remote_(std::move(remote)),
+      cache_dir_(cache_dir),
+      capacity_(capacity),
+      local_(cache_dir) {
+    AssertInfo(remote_ != nullptr, "remote chunk manager is null");
+    LoadCacheDir();
+}
+
+std::string
+CachedChunkManager::Key(const std::string& filepath) {
+    auto pos = filepath.find_first_not_of('/');
+    return pos == std::string::npos ? std::string() : filepath.substr(pos);
+}
+
+std::string
+CachedChunkManager::CachePath(const std::string& filepath) const {
+    return cache_dir_ + "/" + Key(filepath);
+}
+
+void
+CachedChunkManager::LoadCacheDir() {
+    namespace fs = boost::filesystem;
+    fs::path root(cache_dir_);
+    fs::create_directories(root);
+
+    std::vector<std::tuple<std::time_t, std::string, uint64_t>> files;
+    // removed after the scan, not to disturb the iterator
+    std::vector<fs::path> dropped;
+    for (fs::recursive_directory_iterator it(root), end; it != end; ++it) {
+        if (!fs::is_regular_file(it->status())) {
+            continue;
+        }
+        auto path = it->path().string();
+        boost::system::error_code err;
+        // left by a fill interrupted by the last exit
+        if (it->path().extension() == kTmpSuffix) {
+            dropped.push_back(it->path());
+            continue;
+        }
+
+        Footer footer{};
+        auto file_size = fs::file_size(it->path(), err);
+        bool valid = !err && file_size >= sizeof(Footer);
+        if (valid) {
+            try {
+                valid = local_.Read(path,
+                                    file_size - sizeof(Footer),
+                                    &footer,
+                                    sizeof(Footer)) == sizeof(Footer) &&
+                        footer.magic == kFooterMagic &&
+                        footer.size == file_size - sizeof(Footer);
+            } catch (std::exception& e) {
+                valid = false;
+            }
+        }
+        if (!valid) {
+            LOG_SEGCORE_WARNING_ << "drop invalid cache file " << path;
+            dropped.push_back(it->path());
+            continue;
+        }
+        auto mtime = fs::last_write_time(it->path(), err);
+        files.emplace_back(mtime,
+                           fs::relative(it->path(), root).string(),
+                           footer.size);
+    }
+
+    for (auto& path : dropped) {
+        try {
+            local_.Remove(path.string());
+        } catch (std::exception& e) {
+            LOG_SEGCORE_WARNING_ << "failed to remove cache file " << path
+                                 << ": " << e.what();
+        }
+    }
+
+    // the most recently used one first
+    std::sort(files.begin(), files.end(), [](auto& lhs, auto& rhs) {
+        return std::get<0>(lhs) > std::get<0>(rhs);
+    });
+
+    std::lock_guard lck(mutex_);
+    for (auto& [mtime, key, size] : files) {
+        lru_.push_back(Entry{key, size, false});
+        entries_.emplace(key, std::prev(lru_.end()));
+        cache_size_ += size + sizeof(Footer);
+    }
+    // the capacity may have been lowered since the last run
+    EvictLocked(0);
+    LOG_SEGCORE_INFO_ << "load " << entries_.size() << " files of "
+                      << cache_size_ << " bytes from cache dir " << cache_dir_;
+}
+
+std::optional<CachedChunkManager::Entry>
+CachedChunkManager::Lookup(const std::string& filepath) {
+    std::optional<Entry> entry;
+    {
+        std::lock_guard lck(mutex_);
+        auto it = entries_.find(Key(filepath));
+        if (it == entries_.end()) {
+            return std::nullopt;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        entry = *it->second;
+    }
+    // keep the order of use for the next start
+    boost::system::error_code err;
+    boost::filesystem::last_write_time(
+        CachePath(filepath), std::time(nullptr), err);
+    return entry;
+}
+
+bool
+CachedChunkManager::CheckFooter(const std::string& filepath,
+                                const void* buf,
+                                uint64_t size) {
+    Footer footer{};
+    bool valid =
+        local_.Read(CachePath(filepath), size, &footer, sizeof(Footer)) ==
+            sizeof(Footer) &&
+        footer.magic == kFooterMagic && footer.size == size &&
+        footer.crc == Crc32(buf, size);
+    if (!valid) {
+        LOG_SEGCORE_WARNING_ << "cache file of " << filepath
+                             << " is corrupted";
+        CorruptedCounter().Increment();
+        Invalidate(filepath);
+        return false;
+    }
+
+    std::lock_guard lck(mutex_);
+    auto it = entries_.find(Key(filepath));
+    if (it != entries_.end() && it->second->size == size) {
+        it->second->verified = true;
+    }
+    return true;
+}
+
+bool
+CachedChunkManager::Verify(const std::string& filepath, uint64_t size) {
+    try {
+        std::vector<uint8_t> data(size);
+        if (local_.Read(CachePath(filepath), 0, data.data(), size) == size) {
+            return CheckFooter(filepath, data.data(), size);
+        }
+    } catch (std::exception& e) {
+        LOG_SEGCORE_WARNING_ << "failed to verify cache file of " << filepath
+                             << ": " << e.what();
+    }
+    Invalidate(filepath);
+    return false;
+}
+
+void
+CachedChunkManager::Fill(const std::string& filepath,
+                         const void* buf,
+                         uint64_t size) {
+    auto file_size = size + sizeof(Footer);
+    if (file_size > capacity_) {
+        return;
+    }
+
+    auto path = CachePath(filepath);
+    auto tmp_path =
+        path + "." + boost::filesystem::unique_path().string() + kTmpSuffix;
+    try {
+        Footer footer{size, Crc32(buf, size), kFooterMagic};
+        local_.Write(tmp_path, const_cast<void*>(buf), size);
+        local_.Write(tmp_path, size, &footer, sizeof(Footer));
+
+        std::lock_guard lck(mutex_);
+        auto key = Key(filepath);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            // filled concurrently, the file is replaced by the rename
+            cache_size_ -= it->second->size + sizeof(Footer);
+            lru_.erase(it->second);
+            entries_.erase(it);
+        }
+        EvictLocked(file_size);
+        local_.Rename(tmp_path, path);
+        lru_.push_front(Entry{key, size, true});
+        entries_.emplace(key, lru_.begin());
+        cache_size_ += file_size;
+        SizeGauge().Set(cache_size_);
+    } catch (std::exception& e) {
+        // the cache is best effort, the object has been read anyway
+        LOG_SEGCORE_WARNING_ << "failed to cache " << filepath << ": "
+                             << e.what();
+        try {
+            local_.Remove(tmp_path);
+        } catch (std::exception& e) {
+            // dropped on the next start otherwise
+        }
+    }
+}
+
+void
+CachedChunkManager::Invalidate(const std::string& filepath) {
+    std::lock_guard lck(mutex_);
+    auto key = Key(filepath);
+    pending_sizes_.erase(key);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        EraseLocked(it->second);
+        SizeGauge().Set(cache_size_);
+    }
+}
+
+void
+CachedChunkManager::EvictLocked(uint64_t need) {
+    while (!lru_.empty() && cache_size_ + need > capacity_) {
+        EraseLocked(std::prev(lru_.end()));
+    }
+    SizeGauge().Set(cache_size_);
+}
+
+void
+CachedChunkManager::EraseLocked(EntryList::iterator it) {
+    try {
+        local_.Remove(CachePath(it->filepath));
+    } catch (std::exception& e) {
+        LOG_SEGCORE_WARNING_ << "failed to remove cache file of "
+                             << it->filepath << ": " << e.what();
+    }
+    cache_size_ -= it->size + sizeof(Footer);
+    entries_.erase(it->filepath);
+    lru_.erase(it);
+}
+
+bool
+CachedChunkManager::Cached(const std::string& filepath) {
+    std::lock_guard lck(mutex_);
+    return entries_.find(Key(filepath)) != entries_.end();
+}
+
+uint64_t
+CachedChunkManager::GetCacheSize() {
+    std::lock_guard lck(mutex_);
+    return cache_size_;
+}
+
+bool
+CachedChunkManager::Exist(const std::string& filepath) {
+    return Cached(filepath) || remote_->Exist(filepath);
+}
+
+uint64_t
+CachedChunkManager::Size(const std::string& filepath) {
+    {
+        std::lock_guard lck(mutex_);
+        auto it = entries_.find(Key(filepath));
+        if (it != entries_.end()) {
+            return it->second->size;
+        }
+    }
+
+    auto size = remote_->Size(filepath);
+    std::lock_guard lck(mutex_);
+    if (pending_sizes_.size() >= kMaxPendingSizes) {
+        pending_sizes_.clear();
+    }
+    pending_sizes_[Key(filepath)] = size;
+    return size;
+}
+
+uint64_t
+CachedChunkManager::Read(const std::string& filepath, void* buf, uint64_t len) {
+    auto entry = Lookup(filepath);
+    // a whole object read is checked in place, a partial read of an entry
+    // not verified yet has to read the whole file first
+    bool check_in_place = entry.has_value() && !entry->verified &&
+                          len >= entry->size;
+    if (entry.has_value() &&
+        (entry->verified || check_in_place ||
+         Verify(filepath, entry->size))) {
+        try {
+            auto n = std::min(len, entry->size);
+            if (local_.Read(CachePath(filepath), 0, buf, n) == n &&
+                (!check_in_place || CheckFooter(filepath, buf, n))) {
+                HitCounter().Increment();
+                return n;
+            }
+        } catch (std::exception& e) {
+            LOG_SEGCORE_WARNING_ << "failed to read cache file of "
+                                 << filepath << ": " << e.what();
+        }
+        Invalidate(filepath);
+    }
+
+    MissCounter().Increment();
+    auto n = remote_->Read(filepath, buf, len);
+    std::optional<uint64_t> object_size;
+    {
+        std::lock_guard lck(mutex_);
+        auto it = pending_sizes_.find(Key(filepath));
+        if (it != pending_sizes_.end()) {
+            object_size = it->second;
+            pending_sizes_.erase(it);
+        }
+    }
+    if (n < len || object_size == n) {
+        Fill(filepath, buf, n);
+    }
+    return n;
+}
+
+uint64_t
+CachedChunkManager::Read(const std::string& filepath,
+                         uint64_t offset,
+                         void* buf,
+                         uint64_t len) {
+    auto entry = Lookup(filepath);
+    if (entry.has_value() &&
+        (entry->verified || Verify(filepath, entry->size))) {
+        if (offset >= entry->size) {
+            return 0;
+        }
+        try {
+            auto n = std::min(len, entry->size - offset);
+            if (local_.Read(CachePath(filepath), offset, buf, n) == n) {
+                HitCounter().Increment();
+                return n;
+            }
+        } catch (std::exception& e) {
+            LOG_SEGCORE_WARNING_ << "failed to read cache file of "
+                                 << filepath << ": " << e.what();
+        }
+        Invalidate(filepath);
+    }
+
+    MissCounter().Increment();
+    return remote_->Read(filepath, offset, buf, len);
+}
+
+void
+CachedChunkManager::Write(const std::string& filepath,
+                          void* buf,
+                          uint64_t len) {
+    remote_->Write(filepath, buf, len);
+    Invalidate(filepath);
+}
+
+void
+CachedChunkManager::Write(const std::string& filepath,
+                          uint64_t offset,
+                          void* buf,
+                          uint64_t len) {
+    remote_->Write(filepath, offset, buf, len);
+    Invalidate(filepath);
+}
+
+std::vector<std::string>
+CachedChunkManager::ListWithPrefix(const std::string& filepath) {
+    return remote_->ListWithPrefix(filepath);
+}
+
+void
+CachedChunkManager::Remove(const std::string& filepath) {
+    remote_->Remove(filepath);
+    Invalidate(filepath);
+}
+
+}  // namespace milvus::storage
@@ -0,0 +1,171 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/ChunkManager.h"
+#include "storage/LocalChunkManager.h"
+
+namespace milvus::storage {
+
+/**
+ * @brief CachedChunkManager keeps whole objects read from a remote chunk
+ * manager on local disk, so that reloading binlogs and index files after
+ * a segment is released or the node restarts doesn't download them again.
+ *
+ * An object is cached at <cache_dir>/<object path>, followed by a footer
+ * of its size and crc32. Files are filled through a temporary file and a
+ * rename, and are verified on the first hit after being loaded from disk,
+ * a corrupted file is dropped and the object read from remote again.
+ * Files are evicted in LRU order once their total size exceeds capacity.
+ *
+ * Only reads of a whole object fill the cache, i.e. the length read is the
+ * one returned by Size(), or less than the buffer length. Write and Remove
+ * go to remote and invalidate the cached object.
+ */
+class CachedChunkManager : public ChunkManager {
+ public:
+    CachedChunkManager(ChunkManagerPtr remote,
+                       const std::string& cache_dir,
+                       uint64_t capacity);
+
+    virtual ~CachedChunkManager() {
+    }
+
+ public:
+    virtual bool
+    Exist(const std::string& filepath);
+
+    virtual uint64_t
+    Size(const std::string& filepath);
+
+    virtual uint64_t
+    Read(const std::string& filepath, void* buf, uint64_t len);
+
+    virtual void
+    Write(const std::string& filepath, void* buf, uint64_t len);
+
+    virtual uint64_t
+    Read(const std::string& filepath, uint64_t offset, void* buf, uint64_t len);
+
+    virtual void
+    Write(const std::string& filepath,
+          uint64_t offset,
+          void* buf,
+          uint64_t len);
+
+    virtual std::vector<std::string>
+    ListWithPrefix(const std::string& filepath);
+
+    virtual void
+    Remove(const std::string& filepath);
+
+    virtual std::string
+    GetName() const {
+        return "CachedChunkManager";
+    }
+
+    virtual std::string
+    GetRootPath() const {
+        return remote_->GetRootPath();
+    }
+
+ public:
+    ChunkManagerPtr
+    GetRemoteChunkManager() const {
+        return remote_;
+    }
+
+    bool
+    Cached(const std::string& filepath);
+
+    // size on disk of all cached files, footers included
+    uint64_t
+    GetCacheSize();
+
+ private:
+    struct Entry {
+        std::string filepath;
+        // size of the object, without the footer
+        uint64_t size;
+        // whether the content has been checked since loaded from disk
+        bool verified;
+    };
+    using EntryList = std::list<Entry>;
+
+    // cache key of an object, the path without leading '/'
+    static std::string
+    Key(const std::string& filepath);
+
+    std::string
+    CachePath(const std::string& filepath) const;
+
+    // scan cache_dir_ for the files left by the last run
+    void
+    LoadCacheDir();
+
+    // the cached object if any, moves it to the head of the LRU list
+    std::optional<Entry>
+    Lookup(const std::string& filepath);
+
+    // read the whole cached object and check it, drop it if corrupted
+    bool
+    Verify(const std::string& filepath, uint64_t size);
+
+    // check the object read from the cache file against its footer
+    bool
+    CheckFooter(const std::string& filepath, const void* buf, uint64_t size);
+
+    void
+    Fill(const std::string& filepath, const void* buf, uint64_t size);
+
+    void
+    Invalidate(const std::string& filepath);
+
+    // remove the least recently used files until need bytes fit,
+    // mutex_ must be held
+    void
+    EvictLocked(uint64_t need);
+
+    void
+    EraseLocked(EntryList::iterator it);
+
+ private:
+    ChunkManagerPtr remote_;
+    std::string cache_dir_;
+    uint64_t capacity_;
+    LocalChunkManager local_;
+
+    std::mutex mutex_;
+    EntryList lru_;
+    std::unordered_map<std::string, EntryList::iterator> entries_;
+    uint64_t cache_size_ = 0;
+    // object sizes returned by Size() for objects not cached,
+    // to tell whether the following Read() gets the whole object
+    std::unordered_map<std::string, uint64_t> pending_sizes_;
+};
+
+using CachedChunkManagerPtr = std::shared_ptr<CachedChunkManager>;
+
+}  // namespace milvus::storage
@@ -228,15 +228,36 @@ DiskFileManagerImpl::CacheBatchIndexFilesToDisk(
     AssertInfo(index_datas.size() == batch_size,
                "inconsistent file num and index data num!");
 
+    std::vector<uint64_t> offsets(batch_size);
     uint64_t offset = local_file_init_offfset;
     for (int i = 0; i < batch_size; ++i) {
-        auto index_data = index_datas[i];
-        auto index_size = index_data->Size();
-        auto uint8_data =
-            reinterpret_cast<uint8_t*>(const_cast<void*>(index_data->Data()));
-        local_chunk_manager->Write(
-            local_file_name, offset, uint8_data, index_size);
-        offset += index_size;
+        offsets[i] = offset;
+        offset += index_datas[i]->Size();
+    }
+    local_chunk_manager->Allocate(local_file_name,
+                                  local_file_init_offfset,
+                                  offset - local_file_init_offfset);
+
+    // slices go to disjoint ranges of the file, write them concurrently
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    futures.reserve(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        futures.push_back(pool.Submit([&, i]() {
+            auto& index_data = index_datas[i];
+            local_chunk_manager->Write(
+                local_file_name,
+                offsets[i],
+                const_cast<void*>(index_data->Data()),
+                index_data->Size());
+        }));
+    }
+    // wait for all of them, the tasks refer to the locals here
+    for (auto& future : futures) {
+        future.wait();
+    }
+    for (auto& future : futures) {
+        future.get();
     }
     return offset;
 }
@@ -260,21 +281,31 @@ DiskFileManagerImpl::CacheRawDataToDisk(std::vector<std::string> remote_files) {
                            "raw_data";
     local_chunk_manager->CreateFile(local_data_path);
 
-    // get batch raw data from s3 and write batch data to disk file
-    // TODO: load and write of different batches at the same time
-    std::vector<std::string> batch_files;
-
     // file format
     // num_rows(uint32) | dim(uint32) | index_data ([]uint8_t)
     uint32_t num_rows = 0;
     uint32_t dim = 0;
     int64_t write_offset = sizeof(num_rows) + sizeof(dim);
 
-    auto FetchRawData = [&]() {
-        auto field_datas = GetObjectData(rcm_.get(), batch_files);
-        int batch_size = batch_files.size();
-        for (int i = 0; i < batch_size; ++i) {
-            auto field_data = field_datas[i];
+    // download the following files while writing the loaded ones to disk
+    auto parallel_degree =
+        int64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+    auto channel = std::make_shared<FieldDataChannel>(parallel_degree);
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    auto load_future = pool.Submit([&]() {
+        try {
+            GetObjectDataToChannel(
+                rcm_.get(), remote_files, channel, parallel_degree);
+        } catch (...) {
+            channel->close();
+            throw;
+        }
+        channel->close();
+    });
+
+    FieldDataPtr field_data;
+    try {
+        while (channel->pop(field_data)) {
             num_rows += uint32_t(field_data->get_num_rows());
             AssertInfo(dim == 0 || dim == field_data->get_dim(),
                        "inconsistent dim value in multi binlogs!");
@@ -287,22 +318,14 @@ DiskFileManagerImpl::CacheRawDataToDisk(std::vector<std::string> remote_files) {
                                        data_size);
             write_offset += data_size;
         }
-    };
-
-    auto parallel_degree =
-        uint64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
-    for (auto& file : remote_files) {
-        if (batch_files.size() >= parallel_degree) {
-            FetchRawData();
-            batch_files.clear();
+    } catch (...) {
+        // the loader refers to the locals here, unblock it and wait
+        while (channel->pop(field_data)) {
         }
-
-        batch_files.emplace_back(file);
-    }
-
-    if (batch_files.size() > 0) {
-        FetchRawData();
+        load_future.wait();
+        throw;
     }
+    load_future.get();
 
     // write num_rows and dim value to file header
     write_offset = 0;
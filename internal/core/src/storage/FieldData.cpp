@@ -110,23 +110,27 @@ FieldDataImpl<Type, is_scalar>::FillFieldData(
                        "inconsistent data type");
             auto string_array =
                 std::dynamic_pointer_cast<arrow::StringArray>(array);
-            std::vector<std::string> values(element_count);
-            for (size_t index = 0; index < element_count; ++index) {
-                values[index] = string_array->GetString(index);
+            if constexpr (std::is_same_v<Type, std::string>) {
+                // build the strings in place, not through a temporary vector
+                return AppendValues(element_count, [&](int64_t index) {
+                    return string_array->GetString(index);
+                });
             }
-            return FillFieldData(values.data(), element_count);
+            break;
         }
         case DataType::JSON: {
             AssertInfo(array->type()->id() == arrow::Type::type::BINARY,
                        "inconsistent data type");
             auto json_array =
                 std::dynamic_pointer_cast<arrow::BinaryArray>(array);
-            std::vector<Json> values(element_count);
-            for (size_t index = 0; index < element_count; ++index) {
-                values[index] =
-                    Json(simdjson::padded_string(json_array->GetString(index)));
+            if constexpr (std::is_same_v<Type, Json>) {
+                return AppendValues(element_count, [&](int64_t index) {
+                    auto view = json_array->GetView(index);
+                    return Json(simdjson::padded_string(view.data(),
+                                                        view.size()));
+                });
             }
-            return FillFieldData(values.data(), element_count);
+            break;
         }
         case DataType::VECTOR_FLOAT:
         case DataType::VECTOR_BINARY: {
@@ -137,11 +141,12 @@ FieldDataImpl<Type, is_scalar>::FillFieldData(
             return FillFieldData(array_info.first, array_info.second);
         }
         default: {
-            throw NotSupportedDataTypeException(GetName() + "::FillFieldData" +
-                                                " not support data type " +
-                                                datatype_name(data_type_));
+            break;
         }
     }
+    throw NotSupportedDataTypeException(GetName() + "::FillFieldData" +
+                                        " not support data type " +
+                                        datatype_name(data_type_));
 }
 
 // scalar data
@@ -189,6 +189,23 @@ class FieldDataImpl : public FieldDataBase {
         return length_;
     }
 
+ protected:
+    // append element_count values, the one at index is get_value(index)
+    template <typename GetValue>
+    void
+    AppendValues(ssize_t element_count, GetValue&& get_value) {
+        std::lock_guard lck(tell_mutex_);
+        if (length_ + element_count > get_num_rows()) {
+            resize_field_data(length_ + element_count);
+        }
+        for (ssize_t index = 0; index < element_count; ++index) {
+            field_data_[length_ + index] = get_value(index);
+        }
+        length_ += element_count;
+    }
+
+ public:
+
     int64_t
     get_dim() const override {
         return dim_;
@@ -257,4 +274,91 @@ class FieldDataJsonImpl : public FieldDataImpl<Json, true> {
     }
 };
 
+// Read only FieldData of fixed width values decoded by arrow. It refers to
+// the values in the arrow array and keeps the array alive, instead of copying
+// them out as FieldDataImpl::FillFieldData does.
+template <typename Type>
+class FieldDataArrowView : public FieldDataBase {
+ public:
+    // row_width is the number of Type values of a row, e.g. dim / 8 bytes
+    // of a binary vector whose dim is in bits
+    FieldDataArrowView(DataType data_type,
+                       int64_t dim,
+                       int64_t row_width,
+                       std::shared_ptr<arrow::Array> array,
+                       const Type* values)
+        : FieldDataBase(data_type),
+          dim_(dim),
+          row_width_(row_width),
+          array_(std::move(array)),
+          values_(values),
+          num_rows_(array_->length()) {
+    }
+
+    void
+    FillFieldData(const void* source, ssize_t element_count) override {
+        PanicInfo("FieldDataArrowView is read only");
+    }
+
+    void
+    FillFieldData(const std::shared_ptr<arrow::Array> array) override {
+        PanicInfo("FieldDataArrowView is read only");
+    }
+
+    const void*
+    Data() const override {
+        return values_;
+    }
+
+    const void*
+    RawValue(ssize_t offset) const override {
+        AssertInfo(offset < num_rows_, "field data subscript out of range");
+        return values_ + offset * row_width_;
+    }
+
+    int64_t
+    Size() const override {
+        return sizeof(Type) * row_width_ * num_rows_;
+    }
+
+    int64_t
+    Size(ssize_t offset) const override {
+        AssertInfo(offset < num_rows_, "field data subscript out of range");
+        return sizeof(Type) * row_width_;
+    }
+
+    size_t
+    Length() const override {
+        return num_rows_;
+    }
+
+    bool
+    IsFull() const override {
+        return true;
+    }
+
+    void
+    Reserve(size_t cap) override {
+        AssertInfo(cap <= num_rows_, "FieldDataArrowView is read only");
+    }
+
+ public:
+    int64_t
+    get_num_rows() const override {
+        return num_rows_;
+    }
+
+    int64_t
+    get_dim() const override {
+        return dim_;
+    }
+
+ private:
+    const int64_t dim_;
+    const int64_t row_width_;
+    const std::shared_ptr<arrow::Array> array_;
+    const Type* values_;
+    const int64_t num_rows_;
+};
+
 }  // namespace milvus::storage
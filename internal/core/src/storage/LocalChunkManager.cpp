@@ -18,8 +18,11 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/system/error_code.hpp>
-#include <fstream>
+#include <cstring>
+#include <fcntl.h>
 #include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "Exception.h"
 
@@ -32,6 +35,44 @@
 
 namespace milvus::storage {
 
+namespace {
+// open files kept by a LocalChunkManager
+const size_t kMaxOpenFiles = 64;
+#ifdef O_DIRECT
+const uint64_t kDirectIOAlignment = 4096;
+#endif
+
+// key of the open file cache, without redundant separators or dots
+std::string
+NormalPath(const std::string& filepath) {
+    auto path = boost::filesystem::path(filepath).lexically_normal().string();
+    if (path.size() > 2 && path.compare(path.size() - 2, 2, "/.") == 0) {
+        path.resize(path.size() - 2);
+    }
+    return path;
+}
+
+// whether fd is still the file at filepath, not one removed or replaced
+// behind the cache, by another chunk manager or another process
+bool
+IsFileAt(int fd, const std::string& filepath) {
+    struct stat path_stat;
+    struct stat fd_stat;
+    return stat(filepath.c_str(), &path_stat) == 0 &&
+           fstat(fd, &fd_stat) == 0 && path_stat.st_dev == fd_stat.st_dev &&
+           path_stat.st_ino == fd_stat.st_ino;
+}
+
+template <typename E>
+[[noreturn]] void
+ThrowFileError(const std::string& action, const std::string& filepath) {
+    std::stringstream err_msg;
+    err_msg << "Error: " << action << " local file '" << filepath
+            << " failed, " << strerror(errno);
+    throw E(err_msg.str());
+}
+}  // namespace
+
 bool
 LocalChunkManager::Exist(const std::string& filepath) {
     boost::filesystem::path absPath(filepath);
@@ -61,11 +102,13 @@ LocalChunkManager::Size(const std::string& filepath) {
 void
 LocalChunkManager::Remove(const std::string& filepath) {
     boost::filesystem::path absPath(filepath);
+    std::lock_guard lck(handles_mutex_);
     boost::system::error_code err;
     boost::filesystem::remove(absPath, err);
     if (err) {
         THROWLOCALERROR(Remove);
     }
+    CloseFileHandlesLocked(filepath, false);
 }
 
 uint64_t
@@ -78,50 +121,36 @@ LocalChunkManager::Read(const std::string& filepath,
                         uint64_t offset,
                         void* buf,
                         uint64_t size) {
-    std::ifstream infile;
-    infile.open(filepath.data(), std::ios_base::binary);
-    if (infile.fail()) {
-        std::stringstream err_msg;
-        err_msg << "Error: open local file '" << filepath << " failed, "
-                << strerror(errno);
-        throw OpenFileException(err_msg.str());
-    }
-
-    infile.seekg(offset, std::ios::beg);
-    if (!infile.read(reinterpret_cast<char*>(buf), size)) {
-        if (!infile.eof()) {
-            std::stringstream err_msg;
-            err_msg << "Error: read local file '" << filepath << " failed, "
-                    << strerror(errno);
-            throw ReadFileException(err_msg.str());
+    auto handle = GetFileHandle(filepath, false);
+    auto data = reinterpret_cast<char*>(buf);
+    uint64_t read = 0;
+    while (read < size) {
+        auto fd = SelectFd(*handle, offset + read, data + read, size - read);
+        auto n = pread(fd, data + read, size - read, offset + read);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ThrowFileError<ReadFileException>("read", filepath);
         }
+        if (n == 0) {
+            break;
+        }
+        read += n;
     }
-    return infile.gcount();
+    return read;
 }
 
 void
 LocalChunkManager::Write(const std::string& absPathStr,
                          void* buf,
                          uint64_t size) {
-    boost::filesystem::path absPath(absPathStr);
     // if filepath not exists, will create this file automatically
-    // ensure upper directory exist firstly
-    boost::filesystem::create_directories(absPath.parent_path());
-
-    std::ofstream outfile;
-    outfile.open(absPathStr.data(), std::ios_base::binary);
-    if (outfile.fail()) {
-        std::stringstream err_msg;
-        err_msg << "Error: open local file '" << absPathStr << " failed, "
-                << strerror(errno);
-        throw OpenFileException(err_msg.str());
-    }
-    if (!outfile.write(reinterpret_cast<char*>(buf), size)) {
-        std::stringstream err_msg;
-        err_msg << "Error: write local file '" << absPathStr << " failed, "
-                << strerror(errno);
-        throw WriteFileException(err_msg.str());
+    auto handle = GetFileHandle(absPathStr, true);
+    if (ftruncate(handle->fd, 0) != 0) {
+        ThrowFileError<WriteFileException>("truncate", absPathStr);
     }
+    LocalChunkManager::Write(absPathStr, 0, buf, size);
 }
 
 void
@@ -129,28 +158,20 @@ LocalChunkManager::Write(const std::string& absPathStr,
                          uint64_t offset,
                          void* buf,
                          uint64_t size) {
-    boost::filesystem::path absPath(absPathStr);
-    // if filepath not exists, will create this file automatically
-    // ensure upper directory exist firstly
-    boost::filesystem::create_directories(absPath.parent_path());
-
-    std::ofstream outfile;
-    outfile.open(
-        absPathStr.data(),
-        std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-    if (outfile.fail()) {
-        std::stringstream err_msg;
-        err_msg << "Error: open local file '" << absPathStr << " failed, "
-                << strerror(errno);
-        throw OpenFileException(err_msg.str());
-    }
-
-    outfile.seekp(offset, std::ios::beg);
-    if (!outfile.write(reinterpret_cast<char*>(buf), size)) {
-        std::stringstream err_msg;
-        err_msg << "Error: write local file '" << absPathStr << " failed, "
-                << strerror(errno);
-        throw WriteFileException(err_msg.str());
+    auto handle = GetFileHandle(absPathStr, false);
+    auto data = reinterpret_cast<const char*>(buf);
+    uint64_t written = 0;
+    while (written < size) {
+        auto fd =
+            SelectFd(*handle, offset + written, data + written, size - written);
+        auto n = pwrite(fd, data + written, size - written, offset + written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ThrowFileError<WriteFileException>("write", absPathStr);
+        }
+        written += n;
     }
 }
 
@@ -162,23 +183,48 @@ LocalChunkManager::ListWithPrefix(const std::string& filepath) {
 
 bool
 LocalChunkManager::CreateFile(const std::string& filepath) {
-    boost::filesystem::path absPath(filepath);
     // if filepath not exists, will create this file automatically
-    // ensure upper directory exist firstly
-    boost::filesystem::create_directories(absPath.parent_path());
-    auto absPathStr = absPath.string();
-    std::ofstream file;
-    file.open(absPathStr, std::ios_base::out);
-    if (!file.is_open()) {
-        std::stringstream err_msg;
-        err_msg << "Error: create new local file '" << absPathStr << " failed, "
-                << strerror(errno);
-        throw CreateFileException(err_msg.str());
-    }
-    file.close();
+    FileHandlePtr handle;
+    try {
+        handle = GetFileHandle(filepath, true);
+    } catch (OpenFileException& e) {
+        throw CreateFileException(e.what());
+    }
+    if (ftruncate(handle->fd, 0) != 0) {
+        ThrowFileError<CreateFileException>("create new", filepath);
+    }
     return true;
 }
 
+void
+LocalChunkManager::Allocate(const std::string& filepath,
+                            uint64_t offset,
+                            uint64_t len) {
+#ifdef __linux__
+    if (len == 0) {
+        return;
+    }
+    auto handle = GetFileHandle(filepath, false);
+    // a hint only, skip if the file system doesn't support it
+    if (fallocate(handle->fd, FALLOC_FL_KEEP_SIZE, offset, len) != 0 &&
+        errno != EOPNOTSUPP && errno != ENOSYS) {
+        ThrowFileError<WriteFileException>("allocate", filepath);
+    }
+#endif
+}
+
+void
+LocalChunkManager::Rename(const std::string& from, const std::string& to) {
+    std::lock_guard lck(handles_mutex_);
+    boost::system::error_code err;
+    boost::filesystem::rename(from, to, err);
+    if (err) {
+        THROWLOCALERROR(Rename);
+    }
+    CloseFileHandlesLocked(from, false);
+    CloseFileHandlesLocked(to, false);
+}
+
 bool
 LocalChunkManager::DirExist(const std::string& dir) {
     boost::filesystem::path dirPath(dir);
@@ -206,11 +252,13 @@ LocalChunkManager::CreateDir(const std::string& dir) {
 void
 LocalChunkManager::RemoveDir(const std::string& dir) {
     boost::filesystem::path dirPath(dir);
+    std::lock_guard lck(handles_mutex_);
     boost::system::error_code err;
     boost::filesystem::remove_all(dirPath, err);
     if (err) {
         THROWLOCALERROR(RemoveDir);
     }
+    CloseFileHandlesLocked(dir, true);
 }
 
 int64_t
@@ -241,4 +289,96 @@ LocalChunkManager::GetSizeOfDir(const std::string& dir) {
     return total_file_size;
 }
 
+LocalChunkManager::FileHandle::~FileHandle() {
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (direct_fd >= 0) {
+        close(direct_fd);
+    }
+}
+
+LocalChunkManager::FileHandlePtr
+LocalChunkManager::GetFileHandle(const std::string& filepath, bool create) {
+    auto key = NormalPath(filepath);
+    std::lock_guard lck(handles_mutex_);
+    auto it = handles_.find(key);
+    if (it != handles_.end()) {
+        if (IsFileAt(it->second.first->fd, filepath)) {
+            handle_lru_.splice(
+                handle_lru_.begin(), handle_lru_, it->second.second);
+            return it->second.first;
+        }
+        handle_lru_.erase(it->second.second);
+        handles_.erase(it);
+    }
+
+    // opened under the lock, so that a file removed or renamed concurrently
+    // is never cached
+    auto parent = boost::filesystem::path(filepath).parent_path();
+    if (create && !parent.empty()) {
+        // ensure upper directory exist firstly
+        boost::filesystem::create_directories(parent);
+    }
+    auto flags = O_CLOEXEC | (create ? O_CREAT : 0);
+    auto handle = std::make_shared<FileHandle>();
+    handle->fd = open(filepath.c_str(), O_RDWR | flags, 0666);
+    if (handle->fd < 0 && errno == EACCES) {
+        handle->fd = open(filepath.c_str(), O_RDONLY | flags, 0666);
+    }
+    if (handle->fd < 0) {
+        ThrowFileError<OpenFileException>("open", filepath);
+    }
+#ifdef O_DIRECT
+    if (direct_io_) {
+        // not supported by all file systems, fall back to buffered io
+        handle->direct_fd =
+            open(filepath.c_str(), O_RDWR | O_DIRECT | O_CLOEXEC);
+    }
+#endif
+
+    if (handles_.size() >= kMaxOpenFiles) {
+        handles_.erase(handle_lru_.back());
+        handle_lru_.pop_back();
+    }
+    handle_lru_.push_front(key);
+    handles_.emplace(key, std::make_pair(handle, handle_lru_.begin()));
+    return handle;
+}
+
+void
+LocalChunkManager::CloseFileHandlesLocked(const std::string& filepath,
+                                          bool recursive) {
+    auto key = NormalPath(filepath);
+    for (auto it = handles_.begin(); it != handles_.end();) {
+        auto& path = it->first;
+        bool matched =
+            path == key ||
+            (recursive && !key.empty() && path.size() > key.size() &&
+             path.compare(0, key.size(), key) == 0 &&
+             (key.back() == '/' || path[key.size()] == '/'));
+        if (matched) {
+            handle_lru_.erase(it->second.second);
+            it = handles_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+int
+LocalChunkManager::SelectFd(const FileHandle& handle,
+                            uint64_t offset,
+                            const void* buf,
+                            uint64_t len) const {
+#ifdef O_DIRECT
+    if (handle.direct_fd >= 0 && offset % kDirectIOAlignment == 0 &&
+        len % kDirectIOAlignment == 0 &&
+        reinterpret_cast<uintptr_t>(buf) % kDirectIOAlignment == 0) {
+        return handle.direct_fd;
+    }
+#endif
+    return handle.fd;
+}
+
 }  // namespace milvus::storage
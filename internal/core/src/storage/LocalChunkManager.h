@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "storage/ChunkManager.h"
@@ -30,12 +33,20 @@ namespace milvus::storage {
  */
 class LocalChunkManager : public ChunkManager {
  public:
-    explicit LocalChunkManager(const std::string& path) : path_prefix_(path) {
+    /**
+     * @brief files are read and written by pread/pwrite through a bounded
+     * cache of open files, instead of opening them on every call
+     * @param path
+     * @param direct_io bypass the page cache by O_DIRECT for the reads and
+     *  writes of which buffer, offset and length are all aligned
+     */
+    explicit LocalChunkManager(const std::string& path, bool direct_io = false)
+        : path_prefix_(path), direct_io_(direct_io) {
     }
 
-    LocalChunkManager(const LocalChunkManager&);
+    LocalChunkManager(const LocalChunkManager&) = delete;
     LocalChunkManager&
-    operator=(const LocalChunkManager&);
+    operator=(const LocalChunkManager&) = delete;
 
  public:
     virtual ~LocalChunkManager() {
@@ -109,6 +120,25 @@ class LocalChunkManager : public ChunkManager {
     bool
     CreateFile(const std::string& filepath);
 
+    /**
+     * @brief Preallocate disk space of [offset, offset + len) without
+     *  changing the file size, so that the following writes of the range
+     *  don't allocate blocks piece by piece, the file must exist
+     * @param filepath
+     * @param offset
+     * @param len
+     */
+    void
+    Allocate(const std::string& filepath, uint64_t offset, uint64_t len);
+
+    /**
+     * @brief Rename file, replace the target if exists
+     * @param from
+     * @param to
+     */
+    void
+    Rename(const std::string& from, const std::string& to);
+
  public:
     bool
     DirExist(const std::string& dir);
@@ -133,8 +163,43 @@ class LocalChunkManager : public ChunkManager {
     int64_t
     GetSizeOfDir(const std::string& dir);
 
+ private:
+    // an open file shared by concurrent reads and writes, closed once
+    // evicted from the cache and no longer in use
+    struct FileHandle {
+        int fd = -1;
+        // opened with O_DIRECT, -1 if not enabled or not supported
+        int direct_fd = -1;
+
+        ~FileHandle();
+    };
+    using FileHandlePtr = std::shared_ptr<FileHandle>;
+
+    FileHandlePtr
+    GetFileHandle(const std::string& filepath, bool create);
+
+    // drop the cached handle of filepath, or of all files under it,
+    // handles_mutex_ must be held
+    void
+    CloseFileHandlesLocked(const std::string& filepath, bool recursive);
+
+    // fd to read or write len bytes at offset of buf
+    int
+    SelectFd(const FileHandle& handle,
+             uint64_t offset,
+             const void* buf,
+             uint64_t len) const;
+
  private:
     std::string path_prefix_;
+    bool direct_io_;
+
+    std::mutex handles_mutex_;
+    std::list<std::string> handle_lru_;
+    std::unordered_map<
+        std::string,
+        std::pair<FileHandlePtr, std::list<std::string>::iterator>>
+        handles_;
 };
 
 using LocalChunkManagerSPtr =
@@ -119,44 +119,52 @@ MemFileManagerImpl::LoadIndexToMemory(
     return file_to_index_data;
 }
 
-std::vector<FieldDataPtr>
-MemFileManagerImpl::CacheRawDataToMemory(
-    std::vector<std::string> remote_files) {
+namespace {
+// the binlogs of a field are named by their log ids, in the order of rows
+void
+SortByLogID(std::vector<std::string>& remote_files) {
     std::sort(remote_files.begin(),
               remote_files.end(),
               [](const std::string& a, const std::string& b) {
                   return std::stol(a.substr(a.find_last_of("/") + 1)) <
                          std::stol(b.substr(b.find_last_of("/") + 1));
               });
+}
+}  // namespace
 
-    auto parallel_degree =
-        uint64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
-    std::vector<std::string> batch_files;
-    std::vector<FieldDataPtr> field_datas;
-
-    auto FetchRawData = [&]() {
-        auto raw_datas = GetObjectData(rcm_.get(), batch_files);
-        for (auto& data : raw_datas) {
-            field_datas.emplace_back(data);
-        }
-    };
+std::vector<FieldDataPtr>
+MemFileManagerImpl::CacheRawDataToMemory(
+    std::vector<std::string> remote_files) {
+    SortByLogID(remote_files);
 
-    for (auto& file : remote_files) {
-        if (batch_files.size() >= parallel_degree) {
-            FetchRawData();
-            batch_files.clear();
-        }
-        batch_files.emplace_back(file);
-    }
-    if (batch_files.size() > 0) {
-        FetchRawData();
-    }
+    auto parallel_degree =
+        int64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+    // all the data is kept, so the channel is unbounded
+    auto channel = std::make_shared<FieldDataChannel>();
+    GetObjectDataToChannel(rcm_.get(), remote_files, channel, parallel_degree);
+    channel->close();
+    auto field_datas = CollectFieldDataChannel(channel);
 
     AssertInfo(field_datas.size() == remote_files.size(),
                "inconsistent file num and raw data num!");
     return field_datas;
 }
 
+void
+MemFileManagerImpl::LoadRawDataToChannel(std::vector<std::string> remote_files,
+                                         FieldDataChannelPtr channel,
+                                         int64_t parallel_degree) {
+    SortByLogID(remote_files);
+    try {
+        GetObjectDataToChannel(
+            rcm_.get(), remote_files, channel, parallel_degree);
+    } catch (...) {
+        channel->close();
+        throw;
+    }
+    channel->close();
+}
+
 std::optional<bool>
 MemFileManagerImpl::IsExisted(const std::string& filename) noexcept {
     // TODO: implement this interface
@@ -22,6 +22,7 @@
 #include <vector>
 #include <memory>
 
+#include "storage/FieldData.h"
 #include "storage/IndexData.h"
 #include "storage/FileManager.h"
 #include "storage/ChunkManager.h"
@@ -58,6 +59,13 @@ class MemFileManagerImpl : public FileManagerImpl {
     std::vector<FieldDataPtr>
     CacheRawDataToMemory(std::vector<std::string> remote_files);
 
+    // push the raw data of remote_files into channel in order and close it,
+    // for the builds consuming the data as it's loaded
+    void
+    LoadRawDataToChannel(std::vector<std::string> remote_files,
+                         FieldDataChannelPtr channel,
+                         int64_t parallel_degree);
+
     bool
     AddFile(const BinarySet& binary_set);
 
@@ -14,7 +14,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <deque>
 #include <fstream>
+#include <optional>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/auth/STSCredentialsProvider.h>
@@ -313,15 +316,18 @@ MinioChunkManager::ListWithPrefix(const std::string& filepath) {
 
 uint64_t
 MinioChunkManager::Read(const std::string& filepath, void* buf, uint64_t size) {
-    if (!ObjectExists(default_bucket_name_, filepath)) {
-        std::stringstream err_msg;
-        err_msg << "object('" << default_bucket_name_ << "', " << filepath
-                << "') not exists";
-        throw ObjectNotExistException(err_msg.str());
-    }
+    // a missing object fails the GET itself, no need of a HEAD before it
     return GetObjectBuffer(default_bucket_name_, filepath, buf, size);
 }
 
+uint64_t
+MinioChunkManager::Read(const std::string& filepath,
+                        uint64_t offset,
+                        void* buf,
+                        uint64_t len) {
+    return GetObjectRange(default_bucket_name_, filepath, offset, buf, len);
+}
+
 void
 MinioChunkManager::Write(const std::string& filepath,
                          void* buf,
@@ -521,15 +527,11 @@ class AwsResponseStream : public Aws::IOStream {
     AwsStreambuf aws_streambuf;
 };
 
-uint64_t
-MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
-                                   const std::string& object_name,
-                                   void* buf,
-                                   uint64_t size) {
-    Aws::S3::Model::GetObjectRequest request;
-    request.SetBucket(bucket_name.c_str());
-    request.SetKey(object_name.c_str());
-
+// let the response body of request be written into buf directly
+static void
+SetResponseBuffer(Aws::S3::Model::GetObjectRequest& request,
+                  void* buf,
+                  uint64_t size) {
     request.SetResponseStreamFactory([buf, size]() {
     // For macOs, pubsetbuf interface not implemented
 #ifdef __linux__
@@ -542,14 +544,94 @@ MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
 #endif
         return stream.release();
     });
+}
+
+static void
+ThrowGetObjectError(const Aws::S3::S3Error& err,
+                    const std::string& bucket_name,
+                    const std::string& object_name) {
+    std::stringstream err_msg;
+    if (err.GetErrorType() == Aws::S3::S3Errors::NO_SUCH_KEY) {
+        err_msg << "object('" << bucket_name << "', " << object_name
+                << "') not exists";
+        throw ObjectNotExistException(err_msg.str());
+    }
+    err_msg << "Error:GetObjectBuffer:" << err.GetExceptionName() << "  "
+            << err.GetMessage();
+    throw S3ErrorException(err_msg.str());
+}
+
+uint64_t
+MinioChunkManager::GetObjectBuffer(const std::string& bucket_name,
+                                   const std::string& object_name,
+                                   void* buf,
+                                   uint64_t size) {
+    if (size >= multipart_read_threshold_) {
+        return GetObjectRange(bucket_name, object_name, 0, buf, size);
+    }
+
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(bucket_name.c_str());
+    request.SetKey(object_name.c_str());
+    SetResponseBuffer(request, buf, size);
     auto outcome = client_->GetObject(request);
 
     if (!outcome.IsSuccess()) {
-        THROWS3ERROR(GetObjectBuffer);
+        ThrowGetObjectError(outcome.GetError(), bucket_name, object_name);
     }
     return size;
 }
 
+uint64_t
+MinioChunkManager::GetObjectRange(const std::string& bucket_name,
+                                  const std::string& object_name,
+                                  uint64_t offset,
+                                  void* buf,
+                                  uint64_t len) {
+    if (len == 0) {
+        return 0;
+    }
+    auto part_size = std::max<uint64_t>(multipart_read_part_size_, 1);
+    auto parallelism = std::max<int64_t>(multipart_read_parallelism_, 1);
+
+    // each part is written into its own slice of buf, a new part is
+    // requested as soon as the oldest one is done
+    std::deque<Aws::S3::Model::GetObjectOutcomeCallable> parts;
+    std::optional<Aws::S3::S3Error> error;
+    auto wait_oldest = [&]() {
+        auto outcome = parts.front().get();
+        parts.pop_front();
+        if (!outcome.IsSuccess() && !error.has_value()) {
+            error = outcome.GetError();
+        }
+    };
+    for (uint64_t part = 0; part < len && !error.has_value();
+         part += part_size) {
+        if (static_cast<int64_t>(parts.size()) >= parallelism) {
+            wait_oldest();
+        }
+        auto part_len = std::min(part_size, len - part);
+        auto first = offset + part;
+        Aws::S3::Model::GetObjectRequest request;
+        request.SetBucket(bucket_name.c_str());
+        request.SetKey(object_name.c_str());
+        request.SetRange(("bytes=" + std::to_string(first) + "-" +
+                          std::to_string(first + part_len - 1))
+                             .c_str());
+        SetResponseBuffer(request, static_cast<char*>(buf) + part, part_len);
+        parts.push_back(client_->GetObjectCallable(request));
+    }
+    // the pending parts write into buf, wait for them even on failure
+    while (!parts.empty()) {
+        wait_oldest();
+    }
+
+    if (error.has_value()) {
+        ThrowGetObjectError(error.value(), bucket_name, object_name);
+    }
+    return len;
+}
+
 std::vector<std::string>
 MinioChunkManager::ListObjects(const char* bucket_name, const char* prefix) {
     std::vector<std::string> objects_vec;
@@ -37,6 +37,7 @@
 #include <string>
 #include <vector>
 
+#include "common/Consts.h"
 #include "storage/ChunkManager.h"
 #include "storage/Exception.h"
 #include "storage/Types.h"
@@ -88,10 +89,7 @@ class MinioChunkManager : public ChunkManager {
     Read(const std::string& filepath,
          uint64_t offset,
          void* buf,
-         uint64_t len) {
-        throw NotImplementedException(GetName() +
-                                      "Read with offset not implement");
-    }
+         uint64_t len);
 
     virtual void
     Write(const std::string& filepath,
@@ -134,6 +132,17 @@ class MinioChunkManager : public ChunkManager {
         default_bucket_name_ = bucket_name;
     }
 
+    // objects of at least threshold bytes are read by range GETs of
+    // part_size bytes, with at most parallelism of them in flight
+    void
+    SetMultipartRead(uint64_t threshold,
+                     uint64_t part_size,
+                     int64_t parallelism) {
+        multipart_read_threshold_ = threshold;
+        multipart_read_part_size_ = part_size;
+        multipart_read_parallelism_ = parallelism;
+    }
+
     bool
     BucketExists(const std::string& bucket_name);
 
@@ -166,6 +175,12 @@ class MinioChunkManager : public ChunkManager {
                     const std::string& object_name,
                     void* buf,
                     uint64_t size);
+    uint64_t
+    GetObjectRange(const std::string& bucket_name,
+                   const std::string& object_name,
+                   uint64_t offset,
+                   void* buf,
+                   uint64_t len);
     std::vector<std::string>
     ListObjects(const char* bucket_name, const char* prefix = nullptr);
     void
@@ -195,6 +210,9 @@ class MinioChunkManager : public ChunkManager {
     std::shared_ptr<Aws::S3::S3Client> client_;
     std::string default_bucket_name_;
     std::string remote_root_path_;
+    uint64_t multipart_read_threshold_ = DEFAULT_MULTIPART_READ_THRESHOLD;
+    uint64_t multipart_read_part_size_ = DEFAULT_MULTIPART_READ_PART_SIZE;
+    int64_t multipart_read_parallelism_ = DEFAULT_MULTIPART_READ_PARALLELISM;
 };
 
 using MinioChunkManagerPtr = std::unique_ptr<MinioChunkManager>;
@@ -43,7 +43,6 @@ PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
 
     // Configure Arrow-specific Parquet reader settings
     auto arrow_reader_props = parquet::ArrowReaderProperties();
-    arrow_reader_props.set_batch_size(128 * 1024);  // default 64 * 1024
     arrow_reader_props.set_pre_buffer(false);
 
     parquet::arrow::FileReaderBuilder reader_builder;
@@ -69,18 +68,24 @@ PayloadReader::init(std::shared_ptr<arrow::io::BufferReader> input) {
                : 1;
     auto total_num_rows = file_meta->num_rows();
 
-    std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
-    st = arrow_reader->GetRecordBatchReader(&rb_reader);
-    AssertInfo(st.ok(), "get record batch reader");
+    // read the whole column at once, it's a single chunk unless too large
+    // for an arrow array, so the decoded buffer can be used in place
+    std::shared_ptr<arrow::ChunkedArray> column;
+    st = arrow_reader->ReadColumn(column_index, &column);
+    AssertInfo(st.ok(), "read column");
 
-    field_data_ = CreateFieldData(column_type_, dim_, total_num_rows);
-    for (arrow::Result<std::shared_ptr<arrow::RecordBatch>> maybe_batch :
-         *rb_reader) {
-        AssertInfo(maybe_batch.ok(), "get batch record success");
-        auto array = maybe_batch.ValueOrDie()->column(column_index);
-        field_data_->FillFieldData(array);
+    if (column->num_chunks() == 1) {
+        field_data_ =
+            CreateFieldDataFromArrowArray(column_type_, dim_, column->chunk(0));
+    } else {
+        field_data_ = CreateFieldData(column_type_, dim_, total_num_rows);
+        for (auto& array : column->chunks()) {
+            field_data_->FillFieldData(array);
+        }
     }
-    AssertInfo(field_data_->IsFull(), "field data hasn't been filled done");
+    AssertInfo(field_data_->get_num_rows() == total_num_rows &&
+                   field_data_->IsFull(),
+               "field data hasn't been filled done");
     // LOG_SEGCORE_INFO_ << "Peak arrow memory pool size " << pool->max_memory();
 }
 
@@ -19,6 +19,8 @@
 #include <memory>
 #include <shared_mutex>
 
+#include "exceptions/EasyAssert.h"
+#include "storage/CachedChunkManager.h"
 #include "storage/Util.h"
 
 namespace milvus::storage {
@@ -47,6 +49,19 @@ class RemoteChunkManagerSingleton {
         }
     }
 
+    // serve reads of the remote chunk manager from a local disk cache of
+    // capacity bytes under cache_dir, must be called after Init
+    void
+    EnableCache(const std::string& cache_dir, uint64_t capacity) {
+        std::unique_lock lck(mutex_);
+        AssertInfo(rcm_ != nullptr,
+                   "remote chunk manager must be initialized before cache");
+        if (dynamic_cast<CachedChunkManager*>(rcm_.get()) == nullptr) {
+            rcm_ = std::make_shared<CachedChunkManager>(
+                rcm_, cache_dir, capacity);
+        }
+    }
+
     void
     Release() {
         std::unique_lock lck(mutex_);
@@ -15,11 +15,14 @@
 // limitations under the License.
 
 #include "storage/Util.h"
+#include <chrono>
+#include <deque>
 #include <memory>
 #include "arrow/array/builder_binary.h"
 #include "arrow/type_fwd.h"
 #include "exceptions/EasyAssert.h"
 #include "common/Consts.h"
+#include "common/Metrics.h"
 #include "storage/FieldData.h"
 #include "storage/FieldDataInterface.h"
 #include "storage/ThreadPools.h"
@@ -349,11 +352,35 @@ GetSegmentRawDataPathPrefix(ChunkManagerPtr cm, int64_t segment_id) {
 std::unique_ptr<DataCodec>
 DownloadAndDecodeRemoteFile(ChunkManager* chunk_manager,
                             const std::string& file) {
+    static auto& download_bytes =
+        metrics::GetCounter("milvus_storage_download_bytes_total",
+                            "bytes of remote files downloaded");
+    static auto& download_seconds =
+        metrics::GetCounter("milvus_storage_download_seconds_total",
+                            "time spent on downloading remote files");
+    static auto& decode_bytes =
+        metrics::GetCounter("milvus_storage_decode_bytes_total",
+                            "bytes of field data decoded from remote files");
+    static auto& decode_seconds =
+        metrics::GetCounter("milvus_storage_decode_seconds_total",
+                            "time spent on decoding remote files");
+
+    auto start = std::chrono::steady_clock::now();
     auto fileSize = chunk_manager->Size(file);
     auto buf = std::shared_ptr<uint8_t[]>(new uint8_t[fileSize]);
     chunk_manager->Read(file, buf.get(), fileSize);
-
-    return DeserializeFileData(buf, fileSize);
+    auto downloaded = std::chrono::steady_clock::now();
+
+    auto codec = DeserializeFileData(buf, fileSize);
+    auto decoded = std::chrono::steady_clock::now();
+
+    download_bytes.Increment(fileSize);
+    download_seconds.Increment(
+        std::chrono::duration<double>(downloaded - start).count());
+    decode_bytes.Increment(codec->GetFieldData()->Size());
+    decode_seconds.Increment(
+        std::chrono::duration<double>(decoded - downloaded).count());
+    return codec;
 }
 
 std::pair<std::string, size_t>
@@ -433,6 +460,55 @@ GetObjectData(ChunkManager* remote_chunk_manager,
     return datas;
 }
 
+void
+GetObjectDataToChannel(ChunkManager* remote_chunk_manager,
+                       const std::vector<std::string>& remote_files,
+                       FieldDataChannelPtr channel,
+                       int64_t parallel_degree) {
+    static auto& wait_seconds = metrics::GetCounter(
+        "milvus_storage_load_channel_wait_seconds_total",
+        "time spent on waiting for the consumer of loaded field data");
+    AssertInfo(parallel_degree > 0, "parallel degree must be positive");
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::HIGH);
+    std::deque<std::future<std::unique_ptr<DataCodec>>> futures;
+    size_t next = 0;
+    auto submit_next = [&]() {
+        futures.emplace_back(pool.Submit(DownloadAndDecodeRemoteFile,
+                                         remote_chunk_manager,
+                                         remote_files[next++]));
+    };
+
+    while (next < remote_files.size() &&
+           static_cast<int64_t>(futures.size()) < parallel_degree) {
+        submit_next();
+    }
+    while (!futures.empty()) {
+        FieldDataPtr field_data;
+        try {
+            field_data = futures.front().get()->GetFieldData();
+        } catch (...) {
+            // the tasks in flight use remote_chunk_manager, wait them out
+            futures.pop_front();
+            for (auto& future : futures) {
+                future.wait();
+            }
+            throw;
+        }
+        futures.pop_front();
+        // keep the window full while the consumer is busy
+        if (next < remote_files.size()) {
+            submit_next();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        channel->push(field_data);
+        wait_seconds.Increment(std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count());
+    }
+    ReleaseArrowUnused();
+}
+
 std::map<std::string, int64_t>
 PutIndexData(ChunkManager* remote_chunk_manager,
              const std::vector<const uint8_t*>& data_slices,
@@ -566,6 +642,67 @@ CreateFieldData(const DataType& type, int64_t dim, int64_t total_num_rows) {
     }
 }
 
+template <typename Type, typename ArrayType>
+FieldDataPtr
+CreateFieldDataArrowView(const DataType& type,
+                         int64_t dim,
+                         int64_t row_width,
+                         const std::shared_ptr<arrow::Array>& array) {
+    auto typed_array = std::dynamic_pointer_cast<ArrayType>(array);
+    AssertInfo(typed_array != nullptr, "inconsistent data type");
+    if constexpr (std::is_same_v<ArrayType, arrow::FixedSizeBinaryArray>) {
+        AssertInfo(typed_array->byte_width() ==
+                       static_cast<int64_t>(row_width * sizeof(Type)),
+                   "inconsistent dim of vector");
+    }
+    auto values = reinterpret_cast<const Type*>(typed_array->raw_values());
+    return std::make_shared<FieldDataArrowView<Type>>(
+        type, dim, row_width, array, values);
+}
+
+FieldDataPtr
+CreateFieldDataFromArrowArray(const DataType& type,
+                              int64_t dim,
+                              const std::shared_ptr<arrow::Array>& array) {
+    // bools are bit packed by arrow, and nulls leave holes in the values
+    if (array->null_count() == 0) {
+        switch (type) {
+            case DataType::INT8:
+                return CreateFieldDataArrowView<int8_t, arrow::Int8Array>(
+                    type, 1, 1, array);
+            case DataType::INT16:
+                return CreateFieldDataArrowView<int16_t, arrow::Int16Array>(
+                    type, 1, 1, array);
+            case DataType::INT32:
+                return CreateFieldDataArrowView<int32_t, arrow::Int32Array>(
+                    type, 1, 1, array);
+            case DataType::INT64:
+                return CreateFieldDataArrowView<int64_t, arrow::Int64Array>(
+                    type, 1, 1, array);
+            case DataType::FLOAT:
+                return CreateFieldDataArrowView<float, arrow::FloatArray>(
+                    type, 1, 1, array);
+            case DataType::DOUBLE:
+                return CreateFieldDataArrowView<double, arrow::DoubleArray>(
+                    type, 1, 1, array);
+            case DataType::VECTOR_FLOAT:
+                return CreateFieldDataArrowView<float,
+                                                arrow::FixedSizeBinaryArray>(
+                    type, dim, dim, array);
+            case DataType::VECTOR_BINARY:
+                return CreateFieldDataArrowView<uint8_t,
+                                                arrow::FixedSizeBinaryArray>(
+                    type, dim, dim / 8, array);
+            default:
+                break;
+        }
+    }
+
+    auto field_data = CreateFieldData(type, dim, array->length());
+    field_data->FillFieldData(array);
+    return field_data;
+}
+
 int64_t
 GetByteSizeOfFieldDatas(const std::vector<FieldDataPtr>& field_datas) {
     int64_t result = 0;
@@ -98,6 +98,18 @@ std::vector<FieldDataPtr>
 GetObjectData(ChunkManager* remote_chunk_manager,
               const std::vector<std::string>& remote_files);
 
+// Download and decode remote_files, and push the field datas into channel in
+// the order of remote_files. At most parallel_degree files are in flight, the
+// next file is requested as soon as the oldest one is done, so downloading,
+// decoding and consuming the channel overlap across files. Pushing blocks
+// while a bounded channel is full, which throttles the downloads to the pace
+// of the consumer. The channel is not closed.
+void
+GetObjectDataToChannel(ChunkManager* remote_chunk_manager,
+                       const std::vector<std::string>& remote_files,
+                       FieldDataChannelPtr channel,
+                       int64_t parallel_degree);
+
 std::map<std::string, int64_t>
 PutIndexData(ChunkManager* remote_chunk_manager,
              const std::vector<const uint8_t*>& data_slices,
@@ -132,6 +144,13 @@ CreateFieldData(const DataType& type,
                 int64_t dim = 1,
                 int64_t total_num_rows = 0);
 
+// FieldData of the values decoded into array, fixed width values without
+// nulls are viewed in place, the others are copied
+FieldDataPtr
+CreateFieldDataFromArrowArray(const DataType& type,
+                              int64_t dim,
+                              const std::shared_ptr<arrow::Array>& array);
+
 int64_t
 GetByteSizeOfFieldDatas(const std::vector<FieldDataPtr>& field_datas);
 
@@ -78,6 +78,19 @@ InitRemoteChunkManagerSingleton(CStorageConfig c_storage_config) {
     }
 }
 
+CStatus
+InitRemoteChunkManagerCache(const char* c_path, int64_t capacity) {
+    try {
+        std::string path(c_path);
+        milvus::storage::RemoteChunkManagerSingleton::GetInstance().EnableCache(
+            path, capacity);
+
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(UnexpectedError, e.what());
+    }
+}
+
 void
 CleanRemoteChunkManagerSingleton() {
     milvus::storage::RemoteChunkManagerSingleton::GetInstance().Release();
@@ -30,6 +30,9 @@ InitLocalChunkManagerSingleton(const char* path);
 CStatus
 InitRemoteChunkManagerSingleton(CStorageConfig c_storage_config);
 
+CStatus
+InitRemoteChunkManagerCache(const char* path, int64_t capacity);
+
 void
 CleanRemoteChunkManagerSingleton();
 
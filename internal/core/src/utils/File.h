@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
 #include <string>
 #include "exceptions/EasyAssert.h"
 #include "fmt/core.h"
@@ -62,4 +66,80 @@ class File {
     }
     int fd_{-1};
 };
+
+// BufferedWriter batches small writes, e.g. the rows of a variable length
+// field, into a large aligned buffer, so that writing a file costs a syscall
+// per buffer instead of one per row. Writes as large as the buffer go to the
+// file directly. Flush() must be called before the file is read or mapped.
+class BufferedWriter {
+ public:
+    static constexpr size_t kDefaultCapacity = 4 << 20;
+    static constexpr size_t kAlignment = 4096;
+
+    explicit BufferedWriter(File& file, size_t capacity = kDefaultCapacity)
+        : file_(file),
+          capacity_((capacity + kAlignment - 1) / kAlignment * kAlignment),
+          buf_(static_cast<char*>(std::aligned_alloc(kAlignment, capacity_)),
+               &std::free) {
+        AssertInfo(buf_ != nullptr,
+                   fmt::format("failed to allocate write buffer of {} bytes",
+                               capacity_));
+    }
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter&
+    operator=(const BufferedWriter&) = delete;
+
+    void
+    Write(const void* data, size_t size) {
+        if (len_ + size > capacity_) {
+            Flush();
+        }
+        if (size >= capacity_) {
+            WriteFully(data, size);
+        } else {
+            memcpy(buf_.get() + len_, data, size);
+            len_ += size;
+        }
+        offset_ += size;
+    }
+
+    void
+    Flush() {
+        if (len_ > 0) {
+            WriteFully(buf_.get(), len_);
+            len_ = 0;
+        }
+    }
+
+    // total bytes written through the writer, buffered ones included
+    size_t
+    Offset() const {
+        return offset_;
+    }
+
+ private:
+    void
+    WriteFully(const void* data, size_t size) {
+        auto ptr = static_cast<const char*>(data);
+        while (size > 0) {
+            auto written = write(file_.Descriptor(), ptr, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                PanicInfo(fmt::format(
+                    "failed to write {} bytes: {}", size, strerror(errno)));
+            }
+            ptr += written;
+            size -= written;
+        }
+    }
+
+    File& file_;
+    size_t capacity_;
+    std::unique_ptr<char, decltype(&std::free)> buf_;
+    size_t len_{0};
+    size_t offset_{0};
+};
 }  // namespace milvus
\ No newline at end of file
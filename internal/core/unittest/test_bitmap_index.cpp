@@ -0,0 +1,210 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "index/BitmapIndex.h"
+#include "storage/MemFileManagerImpl.h"
+#include "storage/Util.h"
+#include "test_utils/AssertUtils.h"
+#include "test_utils/storage_test_utils.h"
+
+using milvus::OpType;
+using milvus::index::BitmapIndex;
+using milvus::index::RowBitmap;
+
+namespace {
+// values of a skewed distribution, so that the index holds both sparse
+// and dense bitmaps
+std::vector<int16_t>
+GenSkewedValues(size_t n) {
+    std::vector<int16_t> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = i % 3 == 0 ? 0 : (i % 7 == 0 ? 1 : int16_t(i % 50 + 2));
+    }
+    return values;
+}
+}  // namespace
+
+TEST(RowBitmap, SparseAndDense) {
+    size_t num_rows = 1000;
+    std::vector<uint32_t> sparse{3, 64, 999};
+    std::vector<uint32_t> dense;
+    for (uint32_t i = 0; i < num_rows; i += 2) {
+        dense.push_back(i);
+    }
+
+    RowBitmap sparse_bitmap(sparse, num_rows);
+    RowBitmap dense_bitmap(dense, num_rows);
+    ASSERT_FALSE(sparse_bitmap.IsDense());
+    ASSERT_TRUE(dense_bitmap.IsDense());
+    ASSERT_EQ(sparse_bitmap.Cardinality(), 3);
+    ASSERT_EQ(dense_bitmap.Cardinality(), num_rows / 2);
+    ASSERT_LT(dense_bitmap.ByteSize(), dense.size() * sizeof(uint32_t));
+
+    milvus::TargetBitmap res(num_rows);
+    dense_bitmap.Apply(res, true);
+    sparse_bitmap.Apply(res, true);
+    for (size_t i = 0; i < num_rows; ++i) {
+        bool expected = i % 2 == 0 || i == 3 || i == 999;
+        ASSERT_EQ(bool(res[i]), expected);
+        ASSERT_EQ(dense_bitmap.Contains(i) || sparse_bitmap.Contains(i),
+                  expected);
+    }
+
+    dense_bitmap.Apply(res, false);
+    for (size_t i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(bool(res[i]), i == 3 || i == 999);
+    }
+}
+
+TEST(BitmapIndex, Query) {
+    auto values = GenSkewedValues(10000);
+    BitmapIndex<int16_t> index;
+    index.Build(values.size(), values.data());
+    ASSERT_EQ(index.Count(), values.size());
+    ASSERT_EQ(index.Cardinality(), 52);
+
+    std::vector<int16_t> terms{0, 7, 100};
+    assert_matches(index.In(terms.size(), terms.data()), values, [](auto v) {
+        return v == 0 || v == 7;
+    });
+    assert_matches(index.NotIn(terms.size(), terms.data()), values, [](auto v) {
+        return v != 0 && v != 7;
+    });
+    assert_matches(index.Range(10, OpType::LessThan), values, [](auto v) {
+        return v < 10;
+    });
+    assert_matches(index.Range(10, OpType::GreaterEqual), values, [](auto v) {
+        return v >= 10;
+    });
+    assert_matches(index.Range(1, false, 20, true), values, [](auto v) {
+        return v > 1 && v <= 20;
+    });
+    assert_matches(index.Range(20, true, 1, true), values, [](auto v) {
+        return false;
+    });
+    for (size_t i = 0; i < values.size(); i += 97) {
+        ASSERT_EQ(index.Reverse_Lookup(i), values[i]);
+    }
+}
+
+TEST(BitmapIndex, Codec) {
+    auto values = GenSkewedValues(10000);
+    BitmapIndex<int16_t> index;
+    index.Build(values.size(), values.data());
+
+    auto binary_set = index.Serialize(nullptr);
+    BitmapIndex<int16_t> copy_index;
+    copy_index.Load(binary_set);
+    ASSERT_EQ(copy_index.Count(), values.size());
+    ASSERT_EQ(copy_index.Cardinality(), index.Cardinality());
+    assert_matches(copy_index.Range(5, true, 30, false), values, [](auto v) {
+        return v >= 5 && v < 30;
+    });
+    for (size_t i = 0; i < values.size(); i += 97) {
+        ASSERT_EQ(copy_index.Reverse_Lookup(i), values[i]);
+    }
+}
+
+TEST(BitmapIndex, String) {
+    std::vector<std::string> values;
+    for (size_t i = 0; i < 1000; ++i) {
+        values.push_back((i % 2 ? "shoe_" : "shirt_") + std::to_string(i % 5));
+    }
+    BitmapIndex<std::string> index;
+    index.Build(values.size(), values.data());
+    ASSERT_EQ(index.Cardinality(), 10);
+
+    assert_matches(index.PrefixMatch("shoe"), values, [](auto& v) {
+        return v.rfind("shoe", 0) == 0;
+    });
+    assert_matches(index.PrefixMatch("sh"), values, [](auto& v) {
+        return true;
+    });
+    assert_matches(index.PrefixMatch("hat"), values, [](auto& v) {
+        return false;
+    });
+
+    auto binary_set = index.Serialize(nullptr);
+    BitmapIndex<std::string> copy_index;
+    copy_index.Load(binary_set);
+    std::string term = "shirt_2";
+    assert_matches(copy_index.In(1, &term), values, [&](auto& v) {
+        return v == term;
+    });
+    ASSERT_EQ(copy_index.Reverse_Lookup(3), values[3]);
+}
+
+TEST(BitmapIndex, CardinalityLimit) {
+    std::vector<int64_t> values(
+        milvus::index::DEFAULT_BITMAP_CARDINALITY_LIMIT + 1);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = i;
+    }
+
+    BitmapIndex<int64_t> index;
+    ASSERT_ANY_THROW(index.Build(values.size(), values.data()));
+    ASSERT_FALSE(index.IsBuilt());
+
+    values.back() = 0;
+    index.Build(values.size(), values.data());
+    ASSERT_TRUE(index.IsBuilt());
+}
+
+TEST(BitmapIndex, CardinalityLimitOfSlices) {
+    auto storage_config = get_default_local_storage_config();
+    auto cm = milvus::storage::CreateChunkManager(storage_config);
+    FieldDataMeta field_data_meta{1, 2, 3, 101};
+    // 3 binlogs of 40 distinct values each, 100 distinct values together
+    std::vector<std::string> insert_files;
+    for (int64_t i = 0; i < 3; ++i) {
+        std::vector<int64_t> values(1000);
+        for (size_t j = 0; j < values.size(); ++j) {
+            values[j] = i * 30 + j % 40;
+        }
+        auto field_data =
+            std::make_shared<milvus::storage::FieldData<int64_t>>(
+                DataType::INT64);
+        field_data->FillFieldData(values.data(), values.size());
+        auto insert_data = std::make_shared<InsertData>(field_data);
+        insert_data->SetFieldDataMeta(field_data_meta);
+        auto serialized = insert_data->serialize_to_remote_file();
+        auto file = storage_config.root_path + "/bitmap_index_binlog/" +
+                    std::to_string(i);
+        cm->Write(file, serialized.data(), serialized.size());
+        insert_files.push_back(file);
+    }
+    milvus::storage::IndexMeta index_meta{3, 101, 2001, 1};
+    auto file_manager = std::make_shared<milvus::storage::MemFileManagerImpl>(
+        field_data_meta, index_meta, cm);
+
+    // every binlog is under the limit, not all of them
+    milvus::Config config{{"insert_files", insert_files},
+                          {milvus::index::BITMAP_CARDINALITY_LIMIT, "99"}};
+    BitmapIndex<int64_t> index(file_manager);
+    ASSERT_ANY_THROW(index.Build(config));
+    ASSERT_FALSE(index.IsBuilt());
+
+    config[milvus::index::BITMAP_CARDINALITY_LIMIT] = "100";
+    BitmapIndex<int64_t> limited_index(file_manager);
+    limited_index.Build(config);
+    ASSERT_TRUE(limited_index.IsBuilt());
+    ASSERT_EQ(limited_index.Cardinality(), 100);
+    ASSERT_EQ(limited_index.Count(), 3000);
+
+    for (auto& file : insert_files) {
+        cm->Remove(file);
+    }
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "storage/CachedChunkManager.h"
+#include "storage/LocalChunkManagerSingleton.h"
+
+using namespace std;
+using namespace milvus;
+using namespace milvus::storage;
+
+class CachedChunkManagerTest : public testing::Test {
+ public:
+    void
+    SetUp() override {
+        lcm_ = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+        test_dir_ = lcm_->GetRootPath() + "/cached-test-dir";
+        if (lcm_->DirExist(test_dir_)) {
+            lcm_->RemoveDir(test_dir_);
+        }
+        // a local chunk manager stands for the remote one
+        remote_ = std::make_shared<LocalChunkManager>(test_dir_ + "/remote");
+        cache_dir_ = test_dir_ + "/cache";
+        for (int i = 0; i < 4; ++i) {
+            string data(kObjectSize, 'a' + i);
+            paths_.push_back(test_dir_ + "/remote/obj" + to_string(i));
+            remote_->Write(paths_.back(), data.data(), data.size());
+        }
+    }
+
+    void
+    TearDown() override {
+        lcm_->RemoveDir(test_dir_);
+    }
+
+    // read the whole object the way segment loading does
+    string
+    ReadObject(ChunkManager& cm, const string& path) {
+        auto size = cm.Size(path);
+        string data(size, '\0');
+        EXPECT_EQ(cm.Read(path, data.data(), size), size);
+        return data;
+    }
+
+ protected:
+    // object plus the size and crc footer
+    static constexpr uint64_t kObjectSize = 1000;
+    static constexpr uint64_t kFileSize = kObjectSize + 16;
+
+    LocalChunkManagerSPtr lcm_;
+    string test_dir_;
+    string cache_dir_;
+    std::shared_ptr<LocalChunkManager> remote_;
+    vector<string> paths_;
+};
+
+TEST_F(CachedChunkManagerTest, LRU) {
+    CachedChunkManager cm(remote_, cache_dir_, 3 * kFileSize);
+    EXPECT_EQ(cm.GetRootPath(), remote_->GetRootPath());
+
+    // a prefix read doesn't know the object is read whole
+    char prefix[10];
+    EXPECT_EQ(cm.Read(paths_[0], prefix, sizeof(prefix)), sizeof(prefix));
+    EXPECT_FALSE(cm.Cached(paths_[0]));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(ReadObject(cm, paths_[i]), string(kObjectSize, 'a' + i));
+    }
+    // obj0 is the least recently used one
+    EXPECT_FALSE(cm.Cached(paths_[0]));
+    EXPECT_TRUE(cm.Cached(paths_[1]));
+    EXPECT_TRUE(cm.Cached(paths_[3]));
+    EXPECT_EQ(cm.GetCacheSize(), 3 * kFileSize);
+
+    // served by the cache after the remote object changed behind it
+    string data(kObjectSize, 'x');
+    remote_->Write(paths_[1], data.data(), data.size());
+    EXPECT_EQ(ReadObject(cm, paths_[1]), string(kObjectSize, 'b'));
+    EXPECT_EQ(cm.Read(paths_[2], kObjectSize - 10, prefix, 100), 10);
+    EXPECT_EQ(prefix[0], 'c');
+
+    // write through the cached chunk manager invalidates
+    cm.Write(paths_[1], data.data(), data.size());
+    EXPECT_FALSE(cm.Cached(paths_[1]));
+    EXPECT_EQ(ReadObject(cm, paths_[1]), data);
+    cm.Remove(paths_[2]);
+    EXPECT_FALSE(cm.Cached(paths_[2]));
+    EXPECT_FALSE(cm.Exist(paths_[2]));
+}
+
+TEST_F(CachedChunkManagerTest, Restart) {
+    {
+        CachedChunkManager cm(remote_, cache_dir_, 3 * kFileSize);
+        for (int i = 0; i < 3; ++i) {
+            ReadObject(cm, paths_[i]);
+        }
+    }
+
+    // corrupt the cached obj1, and leave an interrupted fill
+    auto cache_path = cache_dir_ + "/" + paths_[1].substr(1);
+    {
+        fstream file(cache_path, ios::in | ios::out | ios::binary);
+        file.seekp(5);
+        file.write("x", 1);
+    }
+    string tmp_data(10, 'x');
+    lcm_->Write(cache_path + ".abcd.tmp", tmp_data.data(), tmp_data.size());
+
+    CachedChunkManager cm(remote_, cache_dir_, 3 * kFileSize);
+    EXPECT_FALSE(lcm_->Exist(cache_path + ".abcd.tmp"));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(cm.Cached(paths_[i]));
+    }
+    EXPECT_EQ(cm.Size(paths_[0]), kObjectSize);
+    // remove from remote to be sure it's served from the cache
+    remote_->Remove(paths_[0]);
+    EXPECT_TRUE(cm.Exist(paths_[0]));
+    EXPECT_EQ(ReadObject(cm, paths_[0]), string(kObjectSize, 'a'));
+
+    // the corrupted one is dropped and read from remote again
+    string data(kObjectSize, '\0');
+    EXPECT_EQ(cm.Read(paths_[1], data.data(), data.size()), kObjectSize);
+    EXPECT_EQ(data, string(kObjectSize, 'b'));
+    EXPECT_FALSE(cm.Cached(paths_[1]));
+
+    // a lower capacity evicts on start
+    CachedChunkManager small(remote_, cache_dir_, kFileSize);
+    EXPECT_EQ(small.GetCacheSize(), kFileSize);
+}
@@ -274,6 +274,39 @@ TEST(storage, InsertDataFloatVector) {
     ASSERT_EQ(data, new_data);
 }
 
+TEST(storage, InsertDataDecodeInPlace) {
+    std::vector<float> data = {1, 2, 3, 4, 5, 6, 7, 8};
+    int DIM = 4;
+    auto field_data =
+        milvus::storage::CreateFieldData(storage::DataType::VECTOR_FLOAT, DIM);
+    field_data->FillFieldData(data.data(), data.size() / DIM);
+
+    storage::InsertData insert_data(field_data);
+    storage::FieldDataMeta field_data_meta{100, 101, 102, 103};
+    insert_data.SetFieldDataMeta(field_data_meta);
+    insert_data.SetTimestamps(0, 100);
+
+    auto serialized_bytes = insert_data.Serialize(storage::StorageType::Remote);
+    std::shared_ptr<uint8_t[]> serialized_data_ptr(serialized_bytes.data(),
+                                                   [&](uint8_t*) {});
+    auto new_insert_data = storage::DeserializeFileData(
+        serialized_data_ptr, serialized_bytes.size());
+    auto new_payload = new_insert_data->GetFieldData();
+
+    // the decoded vectors are used in place of the arrow buffer
+    ASSERT_NE(
+        dynamic_cast<storage::FieldDataArrowView<float>*>(new_payload.get()),
+        nullptr);
+    ASSERT_EQ(new_payload->get_num_rows(), data.size() / DIM);
+    ASSERT_EQ(new_payload->get_dim(), DIM);
+    ASSERT_EQ(new_payload->Size(), data.size() * sizeof(float));
+    ASSERT_TRUE(new_payload->IsFull());
+    auto row = static_cast<const float*>(new_payload->RawValue(1));
+    ASSERT_EQ(std::vector<float>(row, row + DIM),
+              std::vector<float>(data.begin() + DIM, data.end()));
+    ASSERT_ANY_THROW(new_payload->FillFieldData(data.data(), 1));
+}
+
 TEST(storage, InsertDataBinaryVector) {
     std::vector<uint8_t> data = {1, 2, 3, 4, 5, 6, 7, 8};
     int DIM = 16;
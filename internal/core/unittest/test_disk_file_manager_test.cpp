@@ -18,6 +18,7 @@
 #include "common/Slice.h"
 #include "common/Common.h"
 #include "storage/ThreadPool.h"
+#include "storage/ThreadPools.h"
 #include "storage/Util.h"
 #include "storage/DiskFileManagerImpl.h"
 #include "storage/LocalChunkManagerSingleton.h"
@@ -146,4 +147,68 @@ TEST_F(DiskAnnFileManagerTest, TestThreadPoolException) {
     } catch (std::exception& e) {
         EXPECT_EQ(std::string(e.what()), "run time error");
     }
-}
\ No newline at end of file
+}
+
+TEST_F(DiskAnnFileManagerTest, GetObjectDataToChannel) {
+    FieldDataMeta field_data_meta = {1, 2, 3, 100};
+    IndexMeta index_meta = {3, 100, 1000, 1, "index"};
+    const int64_t num_files = 10;
+    const int64_t file_size = 1024;
+    std::vector<std::string> remote_files;
+    for (int64_t i = 0; i < num_files; ++i) {
+        std::vector<uint8_t> data(file_size, uint8_t(i));
+        auto file = "/tmp/get_object_data_to_channel/" + std::to_string(i);
+        EncodeAndUploadIndexSlice(cm_.get(),
+                                  data.data(),
+                                  file_size,
+                                  index_meta,
+                                  field_data_meta,
+                                  file);
+        remote_files.push_back(file);
+    }
+
+    // the loader is throttled by the consumer of the small channel, and
+    // the order of files is kept
+    auto channel = std::make_shared<FieldDataChannel>(1);
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
+    auto future = pool.Submit([&]() {
+        try {
+            GetObjectDataToChannel(cm_.get(), remote_files, channel, 3);
+        } catch (...) {
+            channel->close();
+            throw;
+        }
+        channel->close();
+    });
+    auto field_datas = CollectFieldDataChannel(channel);
+    future.get();
+    ASSERT_EQ(field_datas.size(), num_files);
+    for (int64_t i = 0; i < num_files; ++i) {
+        ASSERT_EQ(field_datas[i]->get_num_rows(), file_size);
+        auto data = static_cast<const uint8_t*>(field_datas[i]->Data());
+        ASSERT_EQ(data[0], uint8_t(i));
+        ASSERT_EQ(data[file_size - 1], uint8_t(i));
+    }
+
+    // a file that fails to decode closes the channel, the consumer isn't
+    // left waiting for it
+    std::string garbage = "not a binlog";
+    cm_->Write(remote_files[5], garbage.data(), garbage.size());
+    channel = std::make_shared<FieldDataChannel>(1);
+    future = pool.Submit([&]() {
+        try {
+            GetObjectDataToChannel(cm_.get(), remote_files, channel, 3);
+        } catch (...) {
+            channel->close();
+            throw;
+        }
+        channel->close();
+    });
+    field_datas = CollectFieldDataChannel(channel);
+    ASSERT_ANY_THROW(future.get());
+    ASSERT_EQ(field_datas.size(), 5);
+
+    for (auto& file : remote_files) {
+        cm_->Remove(file);
+    }
+}
@@ -0,0 +1,492 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <boost/format.hpp>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "common/BitPacking.h"
+#include "mmap/EncodedColumn.h"
+#include "query/PlanProto.h"
+#include "query/generated/ExecExprVisitor.h"
+#include "segcore/SegcoreConfig.h"
+#include "test_utils/DataGen.h"
+
+using namespace milvus;
+
+namespace {
+
+template <typename T>
+void
+CheckEncodedColumn(const std::vector<T>& values, ColumnEncoding expected) {
+    auto column = EncodedColumn<T>::Encode(values.data(), values.size());
+    ASSERT_NE(column, nullptr);
+    ASSERT_EQ(column->Encoding(), expected);
+    ASSERT_EQ(column->NumRows(), values.size());
+
+    std::vector<T> decoded(values.size());
+    column->Decode(decoded.data());
+    ASSERT_EQ(decoded, values);
+    for (size_t i = 0; i < values.size(); i += 7) {
+        ASSERT_EQ(column->ValueAt(i), values[i]);
+    }
+    ASSERT_EQ(column->DecodedSize(), 0);
+    auto span = column->Span();
+    ASSERT_EQ(
+        memcmp(span.data(), values.data(), values.size() * sizeof(T)), 0);
+    // the copy is kept and counted
+    ASSERT_EQ(column->DecodedSize(), values.size() * sizeof(T));
+    ASSERT_EQ(column->Span().data(), span.data());
+
+    std::mt19937 rng(1);
+    auto [min, max] = std::minmax_element(values.begin(), values.end());
+    for (int k = 0; k < 50; ++k) {
+        T lower = values[rng() % values.size()];
+        T upper = values[rng() % values.size()];
+        if (k % 5 == 0 && *min != std::numeric_limits<T>::min()) {
+            lower = *min - 1;
+        }
+        if (k % 7 == 0) {
+            upper = *max;
+        }
+        auto in_range = column->InRange(lower, upper);
+        ASSERT_EQ(in_range.size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(bool(in_range[i]),
+                      lower <= values[i] && values[i] <= upper)
+                << i;
+        }
+
+        std::vector<T> terms{lower, upper, static_cast<T>(lower + 1)};
+        auto in = column->In(terms.data(), terms.size());
+        ASSERT_EQ(in.size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(bool(in[i]),
+                      std::find(terms.begin(), terms.end(), values[i]) !=
+                          terms.end())
+                << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BitPacking, RoundTrip) {
+    std::mt19937_64 rng(0);
+    for (int width = 0; width <= 64; ++width) {
+        std::vector<uint64_t> values(kBitPackBlockSize * 3 - 5);
+        for (auto& value : values) {
+            value = width == 64 ? rng()
+                                : rng() & ((uint64_t(1) << width) - 1);
+        }
+        auto packed = BitPack(values.data(), values.size(), width);
+        ASSERT_EQ(packed.size(), BitPackedWords(values.size(), width));
+
+        auto unpack = GetUnpackBlockFunc(width);
+        uint64_t block[kBitPackBlockSize];
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(BitUnpackOne(packed.data(), width, i), values[i]);
+            if (i % kBitPackBlockSize == 0) {
+                unpack(packed.data() + i / kBitPackBlockSize * width, block);
+            }
+            ASSERT_EQ(block[i % kBitPackBlockSize], values[i]);
+        }
+    }
+}
+
+TEST(EncodedColumn, FrameOfReference) {
+    std::mt19937 rng(0);
+    std::vector<int64_t> values(1000);
+    for (auto& value : values) {
+        value = 1000000 + rng() % 5000000;
+    }
+    CheckEncodedColumn(values, ColumnEncoding::FrameOfReference);
+}
+
+TEST(EncodedColumn, Delta) {
+    std::mt19937 rng(0);
+    std::vector<int64_t> values(1001);
+    int64_t current = -5000;
+    for (auto& value : values) {
+        current += rng() % 3;
+        value = current;
+    }
+    CheckEncodedColumn(values, ColumnEncoding::Delta);
+}
+
+TEST(EncodedColumn, Dictionary) {
+    std::mt19937 rng(0);
+    std::vector<int32_t> values(999);
+    for (auto& value : values) {
+        value = static_cast<int32_t>(rng() % 10) * 100000000 - 900000000;
+    }
+    CheckEncodedColumn(values, ColumnEncoding::Dictionary);
+
+    std::vector<int8_t> small(300);
+    for (size_t i = 0; i < small.size(); ++i) {
+        small[i] = i % 3 ? -128 : 127;
+    }
+    CheckEncodedColumn(small, ColumnEncoding::Dictionary);
+}
+
+TEST(EncodedColumn, NotWorthEncoding) {
+    std::vector<int64_t> values{std::numeric_limits<int64_t>::min(),
+                                std::numeric_limits<int64_t>::max(),
+                                0};
+    ASSERT_EQ(EncodedColumn<int64_t>::Encode(values.data(), values.size()),
+              nullptr);
+}
+
+TEST(EncodedColumn, BulkValueAt) {
+    std::vector<int64_t> values(200);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = i * 3;
+    }
+    auto column = EncodedColumn<int64_t>::Encode(values.data(), values.size());
+    ASSERT_NE(column, nullptr);
+
+    int64_t offsets[3] = {5, INVALID_SEG_OFFSET, 199};
+    int64_t dst[3] = {0, 7, 0};
+    column->BulkValueAt(offsets, 3, dst);
+    ASSERT_EQ(dst[0], 15);
+    ASSERT_EQ(dst[1], 7);
+    ASSERT_EQ(dst[2], 597);
+}
+
+TEST(EncodedColumn, StringDictionary) {
+    std::vector<std::string> words{
+        "", "a", "ab", "abc", "b", "ba", "zz", "label_1", "label_2", "label_3"};
+    auto field_meta = FieldMeta(
+        FieldName("label"), FieldId(100), DataType::VARCHAR, 32);
+    int64_t N = 1000;
+    std::mt19937 rng(0);
+    std::vector<std::string> rows;
+    VariableColumn<std::string> raw(N, field_meta);
+    for (int64_t i = 0; i < N; ++i) {
+        rows.push_back(words[rng() % words.size()]);
+        raw.Append(rows.back().data(), rows.back().size());
+    }
+    raw.Seal();
+
+    auto column = EncodedStringColumn::Encode(raw);
+    ASSERT_NE(column, nullptr);
+    ASSERT_EQ(column->NumRows(), N);
+    ASSERT_EQ(column->DecodedSize(), 0);
+    auto views = static_cast<const std::string_view*>(column->Span().data());
+    ASSERT_EQ(column->DecodedSize(), N * sizeof(std::string_view));
+    for (int64_t i = 0; i < N; ++i) {
+        ASSERT_EQ(column->ValueAt(i), rows[i]);
+        ASSERT_EQ(views[i], rows[i]);
+    }
+
+    auto probes = words;
+    probes.insert(probes.end(), {"aa", "label", "zzz"});
+    for (auto& lower : probes) {
+        for (auto& upper : probes) {
+            for (bool lower_inclusive : {false, true}) {
+                for (bool upper_inclusive : {false, true}) {
+                    auto res = column->Range(
+                        lower, lower_inclusive, upper, upper_inclusive);
+                    for (int64_t i = 0; i < N; ++i) {
+                        auto& row = rows[i];
+                        ASSERT_EQ(bool(res[i]),
+                                  (lower_inclusive ? lower <= row
+                                                   : lower < row) &&
+                                      (upper_inclusive ? row <= upper
+                                                       : row < upper));
+                    }
+                }
+            }
+        }
+        auto unbounded = column->Range(lower, true, std::nullopt, false);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(bool(unbounded[i]), lower <= rows[i]);
+        }
+
+        auto prefix = column->PrefixMatch(lower);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(bool(prefix[i]), rows[i].rfind(lower, 0) == 0) << lower;
+        }
+
+        std::string terms[2] = {lower, "label_2"};
+        auto in = column->In(terms, 2);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(bool(in[i]), rows[i] == terms[0] || rows[i] == terms[1]);
+        }
+    }
+
+    int64_t offsets[2] = {3, INVALID_SEG_OFFSET};
+    std::string dst[2];
+    column->BulkValueAt(offsets, 2, dst);
+    ASSERT_EQ(dst[0], rows[3]);
+    ASSERT_EQ(dst[1], "");
+
+    // too many distinct values
+    VariableColumn<std::string> distinct(N, field_meta);
+    for (int64_t i = 0; i < N; ++i) {
+        auto str = std::to_string(i);
+        distinct.Append(str.data(), str.size());
+    }
+    distinct.Seal();
+    ASSERT_EQ(EncodedStringColumn::Encode(distinct), nullptr);
+}
+
+TEST(EncodedColumn, SealedSegment) {
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto counter_fid = schema->AddDebugField("counter", DataType::INT64);
+    auto age_fid = schema->AddDebugField("age", DataType::INT32);
+    schema->set_primary_field_id(pk_fid);
+
+    int64_t N = 10000;
+    auto dataset = DataGen(schema, N);
+    auto counter = dataset.get_col<int64_t>(counter_fid);
+    auto age = dataset.get_col<int32_t>(age_fid);
+
+    SegcoreConfig::default_config().set_enable_column_encoding(true);
+    auto segment = SealedCreator(schema, dataset);
+    SegcoreConfig::default_config().set_enable_column_encoding(false);
+
+    ASSERT_EQ(segment->get_encoded_column(pk_fid), nullptr);
+    auto encoded_counter = segment->get_encoded_column(counter_fid);
+    ASSERT_NE(encoded_counter, nullptr);
+    ASSERT_EQ(encoded_counter->Encoding(), ColumnEncoding::Delta);
+    auto encoded_age = segment->get_encoded_column(age_fid);
+    ASSERT_NE(encoded_age, nullptr);
+    ASSERT_EQ(encoded_age->Encoding(), ColumnEncoding::FrameOfReference);
+
+    // the encoded columns take less than their raw size, until a consumer
+    // of the raw values decodes a copy
+    auto raw_usage = int64_t(schema->get_total_sizeof() * N);
+    auto usage = segment->GetMemoryUsageInBytes();
+    ASSERT_EQ(usage,
+              raw_usage - 8 * N - 4 * N + encoded_counter->EncodedSize() +
+                  encoded_age->EncodedSize());
+    encoded_counter->Span();
+    ASSERT_EQ(segment->GetMemoryUsageInBytes(), usage + 8 * N);
+
+    const char* raw_plan = R"(vector_anns: <
+                                field_id: %1%
+                                predicates: <
+                                  %2%
+                                >
+                                query_info: <
+                                  topk: 10
+                                  round_decimal: 3
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 10}"
+                                >
+                                placeholder_tag: "$0"
+     >)";
+    auto unary = [](FieldId field_id, const char* type, const char* op,
+                    int64_t value) {
+        return boost::str(boost::format(R"(unary_range_expr: <
+                  column_info: < field_id: %1% data_type: %2% >
+                  op: %3%
+                  value: < int64_val: %4% >
+                >)") % field_id.get() %
+                          type % op % value);
+    };
+    auto binary = [](FieldId field_id, const char* type, int64_t lower,
+                     bool lower_inclusive, int64_t upper,
+                     bool upper_inclusive) {
+        return boost::str(boost::format(R"(binary_range_expr: <
+                  column_info: < field_id: %1% data_type: %2% >
+                  lower_inclusive: %3%
+                  upper_inclusive: %4%
+                  lower_value: < int64_val: %5% >
+                  upper_value: < int64_val: %6% >
+                >)") % field_id.get() %
+                          type % (lower_inclusive ? "true" : "false") %
+                          (upper_inclusive ? "true" : "false") % lower %
+                          upper);
+    };
+    auto term = [](FieldId field_id, const char* type,
+                   const std::vector<int64_t>& values) {
+        std::string str;
+        for (auto value : values) {
+            str += boost::str(boost::format("values: < int64_val: %1% > ") %
+                              value);
+        }
+        return boost::str(boost::format(R"(term_expr: <
+                  column_info: < field_id: %1% data_type: %2% >
+                  %3%
+                >)") % field_id.get() %
+                          type % str);
+    };
+
+    auto ref_counter = [&](auto pred) {
+        return [&, pred](int64_t i) { return pred(counter[i]); };
+    };
+    auto ref_age = [&](auto pred) {
+        return [&, pred](int64_t i) { return pred(age[i]); };
+    };
+    std::vector<std::tuple<std::string, std::function<bool(int64_t)>>>
+        testcases = {
+            {unary(counter_fid, "Int64", "GreaterThan", 2000),
+             ref_counter([](int64_t v) { return v > 2000; })},
+            {unary(counter_fid, "Int64", "LessEqual", 100),
+             ref_counter([](int64_t v) { return v <= 100; })},
+            {unary(counter_fid, "Int64", "Equal", 1234),
+             ref_counter([](int64_t v) { return v == 1234; })},
+            {unary(counter_fid, "Int64", "NotEqual", 1234),
+             ref_counter([](int64_t v) { return v != 1234; })},
+            {binary(counter_fid, "Int64", 100, false, 3000, true),
+             ref_counter([](int64_t v) { return 100 < v && v <= 3000; })},
+            {term(counter_fid, "Int64", {0, 77, 9999, 123456}),
+             ref_counter(
+                 [](int64_t v) { return v == 0 || v == 77 || v == 9999; })},
+            {unary(age_fid, "Int32", "LessThan", 5000),
+             ref_age([](int32_t v) { return v < 5000; })},
+            {unary(age_fid, "Int32", "GreaterEqual", 100000),
+             ref_age([](int32_t v) { return v >= 100000; })},
+            {binary(age_fid, "Int32", -10, true, 10, false),
+             ref_age([](int32_t v) { return -10 <= v && v < 10; })},
+            {term(age_fid, "Int32", {age[0], age[1], age[N - 1]}),
+             ref_age([&](int32_t v) {
+                 return v == age[0] || v == age[1] || v == age[N - 1];
+             })},
+        };
+
+    ExecExprVisitor visitor(*segment, segment->get_row_count(), MAX_TIMESTAMP);
+    for (auto& [clause, ref_func] : testcases) {
+        auto dsl_string = boost::format(raw_plan) % vec_fid.get() % clause;
+        auto binary_plan =
+            translate_text_plan_to_binary_plan(dsl_string.str().data());
+        auto plan = CreateSearchPlanByExpr(
+            *schema, binary_plan.data(), binary_plan.size());
+        auto final = visitor.call_child(*plan->plan_node_->predicate_.value());
+        ASSERT_EQ(final.size(), N);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(final[i], ref_func(i)) << clause << "@" << i;
+        }
+    }
+
+    // retrieving rows decodes them one by one
+    std::vector<int64_t> offsets{0, 17, N / 2, N - 1};
+    auto field_data = segment->bulk_subscript(
+        counter_fid, offsets.data(), offsets.size());
+    auto& retrieved = field_data->scalars().long_data().data();
+    ASSERT_EQ(retrieved.size(), offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(retrieved[i], counter[offsets[i]]);
+    }
+}
+
+TEST(EncodedColumn, SealedStringSegment) {
+    using namespace milvus::query;
+    using namespace milvus::segcore;
+
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("pk", DataType::INT64);
+    auto str_fid = schema->AddDebugField("label", DataType::VARCHAR);
+    schema->set_primary_field_id(pk_fid);
+
+    // 10 distinct labels
+    int64_t N = 10000;
+    auto dataset = DataGen(schema, N, 42, 0, N / 10);
+    auto labels = dataset.get_col<std::string>(str_fid);
+
+    SegcoreConfig::default_config().set_enable_column_encoding(true);
+    auto segment = SealedCreator(schema, dataset);
+    SegcoreConfig::default_config().set_enable_column_encoding(false);
+    auto encoded = segment->get_encoded_column(str_fid);
+    ASSERT_NE(encoded, nullptr);
+    ASSERT_EQ(encoded->Encoding(), ColumnEncoding::Dictionary);
+
+    const char* raw_plan = R"(vector_anns: <
+                                field_id: %1%
+                                predicates: <
+                                  %2%
+                                >
+                                query_info: <
+                                  topk: 10
+                                  round_decimal: 3
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 10}"
+                                >
+                                placeholder_tag: "$0"
+     >)";
+    auto column_info = boost::str(
+        boost::format("column_info: < field_id: %1% data_type: VarChar >") %
+        str_fid.get());
+    auto unary = [&](const char* op, const std::string& value) {
+        return boost::str(
+            boost::format(
+                R"(unary_range_expr: < %1% op: %2% value: < string_val: "%3%" > >)") %
+            column_info % op % value);
+    };
+    auto label = labels[N / 2];
+    auto prefix = label.substr(0, 1);
+    std::vector<
+        std::tuple<std::string, std::function<bool(const std::string&)>>>
+        testcases = {
+            {unary("Equal", label),
+             [&](const std::string& v) { return v == label; }},
+            {unary("NotEqual", label),
+             [&](const std::string& v) { return v != label; }},
+            {unary("GreaterThan", label),
+             [&](const std::string& v) { return v > label; }},
+            {unary("LessEqual", label),
+             [&](const std::string& v) { return v <= label; }},
+            {unary("PrefixMatch", prefix),
+             [&](const std::string& v) { return v.rfind(prefix, 0) == 0; }},
+            {boost::str(
+                 boost::format(R"(binary_range_expr: < %1%
+                       lower_inclusive: true upper_inclusive: false
+                       lower_value: < string_val: "%2%" >
+                       upper_value: < string_val: "%3%" > >)") %
+                 column_info % labels[0] % label),
+             [&](const std::string& v) { return labels[0] <= v && v < label; }},
+            {boost::str(boost::format(R"(term_expr: < %1%
+                       values: < string_val: "%2%" >
+                       values: < string_val: "not a label" > >)") %
+                        column_info % label),
+             [&](const std::string& v) { return v == label; }},
+        };
+
+    ExecExprVisitor visitor(*segment, segment->get_row_count(), MAX_TIMESTAMP);
+    for (auto& [clause, ref_func] : testcases) {
+        auto dsl_string = boost::format(raw_plan) % vec_fid.get() % clause;
+        auto binary_plan =
+            translate_text_plan_to_binary_plan(dsl_string.str().data());
+        auto plan = CreateSearchPlanByExpr(
+            *schema, binary_plan.data(), binary_plan.size());
+        auto final = visitor.call_child(*plan->plan_node_->predicate_.value());
+        ASSERT_EQ(final.size(), N);
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(final[i], ref_func(labels[i])) << clause << "@" << i;
+        }
+    }
+
+    std::vector<int64_t> offsets{0, 17, N / 2, N - 1};
+    auto field_data =
+        segment->bulk_subscript(str_fid, offsets.data(), offsets.size());
+    auto& retrieved = field_data->scalars().string_data().data();
+    ASSERT_EQ(retrieved.size(), offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(retrieved[i], labels[offsets[i]]);
+    }
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include "segcore/FilterBitsetCache.h"
+#include "segcore/SegcoreConfig.h"
+#include "segcore/SegmentSealedImpl.h"
+#include "test_utils/DataGen.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+FilterBitsetCache::Entry
+gen_entry(int64_t size) {
+    FilterBitsetCache::Entry entry;
+    entry.predicate = std::make_shared<const BitsetType>(size);
+    entry.pk_offsets = std::make_shared<const std::vector<int64_t>>();
+    return entry;
+}
+}  // namespace
+
+TEST(FilterBitsetCache, LRU) {
+    FilterBitsetCache disabled(0);
+    ASSERT_FALSE(disabled.Enabled());
+    disabled.Put("a", gen_entry(1024));
+    ASSERT_FALSE(disabled.Get("a").has_value());
+
+    auto key_a = FilterBitsetCache::MakeKey("a", 0, 1024, MAX_TIMESTAMP);
+    auto key_b = FilterBitsetCache::MakeKey("b", 0, 1024, MAX_TIMESTAMP);
+    auto key_c = FilterBitsetCache::MakeKey("c", 0, 1024, MAX_TIMESTAMP);
+    // keys of another generation never collide
+    ASSERT_NE(key_a, FilterBitsetCache::MakeKey("a", 1, 1024, MAX_TIMESTAMP));
+
+    // room for two entries
+    FilterBitsetCache cache(2 * (1024 / 8 + 2 * key_a.size()) + 64);
+    ASSERT_TRUE(cache.Enabled());
+    cache.Put(key_a, gen_entry(1024));
+    cache.Put(key_b, gen_entry(1024));
+    ASSERT_TRUE(cache.Get(key_a).has_value());
+
+    // b is the least recently used one
+    cache.Put(key_c, gen_entry(1024));
+    ASSERT_TRUE(cache.Get(key_a).has_value());
+    ASSERT_FALSE(cache.Get(key_b).has_value());
+    ASSERT_TRUE(cache.Get(key_c).has_value());
+
+    // replace keeps the usage accounted once
+    auto usage = cache.GetMemoryUsage();
+    auto entry = cache.Get(key_a).value();
+    entry.masked = std::make_shared<const BitsetType>(8);
+    entry.del_barrier = 3;
+    cache.Put(key_a, entry);
+    ASSERT_EQ(cache.GetMemoryUsage(), usage + 8);
+    ASSERT_EQ(cache.Get(key_a)->del_barrier, 3);
+
+    // larger than the whole budget
+    cache.Put(key_b, gen_entry(1 << 20));
+    ASSERT_FALSE(cache.Get(key_b).has_value());
+
+    cache.Clear();
+    ASSERT_EQ(cache.GetMemoryUsage(), 0);
+    ASSERT_FALSE(cache.Get(key_a).has_value());
+}
+
+TEST(FilterBitsetCache, SealedSearch) {
+    auto& config = SegcoreConfig::default_config();
+    config.set_filter_bitset_cache_capacity(1 << 20);
+
+    auto dim = 16;
+    auto N = 1000;
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    auto dataset = DataGen(schema, N);
+    auto segment = SealedCreator(schema, dataset);
+    config.set_filter_bitset_cache_capacity(0);
+
+    auto sealed = dynamic_cast<SegmentSealedImpl*>(segment.get());
+    auto cache = sealed->get_filter_bitset_cache();
+    ASSERT_NE(cache, nullptr);
+
+    const char* raw_plan = R"(vector_anns: <
+                                    field_id: 100
+                                    predicates: <
+                                      binary_range_expr: <
+                                        column_info: <
+                                          field_id: 101
+                                          data_type: Int64
+                                        >
+                                        lower_inclusive: true,
+                                        upper_inclusive: false,
+                                        lower_value: <
+                                          int64_val: 0
+                                        >
+                                        upper_value: <
+                                          int64_val: 500
+                                        >
+                                      >
+                                    >
+                                    query_info: <
+                                      topk: 5
+                                      round_decimal: 3
+                                      metric_type: "L2"
+                                      search_params: "{\"nprobe\": 10}"
+                                    >
+                                    placeholder_tag: "$0"
+        >)";
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto plan =
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size());
+    ASSERT_FALSE(plan->plan_node_->predicate_fingerprint_.empty());
+    auto ph_group_raw = CreatePlaceholderGroup(1, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+
+    auto sr1 = segment->Search(plan.get(), ph_group.get());
+    auto usage = cache->GetMemoryUsage();
+    ASSERT_GT(usage, 0);
+    auto sr2 = segment->Search(plan.get(), ph_group.get());
+    ASSERT_EQ(cache->GetMemoryUsage(), usage);
+    ASSERT_EQ(sr1->seg_offsets_, sr2->seg_offsets_);
+    ASSERT_EQ(sr1->distances_, sr2->distances_);
+    auto i64_col = dataset.get_col<int64_t>(i64_fid);
+    for (auto offset : sr2->seg_offsets_) {
+        ASSERT_LT(i64_col[offset], 500);
+    }
+
+    // the cached predicate is masked again with the new deletion
+    auto top1_pk = i64_col[sr1->seg_offsets_[0]];
+    auto pks = GenPKs(std::vector<int64_t>{top1_pk});
+    std::vector<Timestamp> tss(1, N * 2);
+    segment->Delete(0, 1, pks.get(), tss.data());
+    auto sr3 = segment->Search(plan.get(), ph_group.get());
+    ASSERT_NE(sr3->seg_offsets_[0], sr1->seg_offsets_[0]);
+    ASSERT_EQ(sr3->seg_offsets_[0], sr1->seg_offsets_[1]);
+
+    // term expr on pk, the cached offsets must be restored on hit
+    auto retrieve_plan = std::make_unique<RetrievePlan>(*schema);
+    retrieve_plan->plan_node_ = std::make_unique<RetrievePlanNode>();
+    retrieve_plan->plan_node_->predicate_ =
+        std::make_unique<TermExprImpl<int64_t>>(
+            ColumnInfo(i64_fid, DataType::INT64, std::vector<std::string>()),
+            std::vector<int64_t>{1, 3, 5},
+            proto::plan::GenericValue::kInt64Val);
+    retrieve_plan->plan_node_->predicate_fingerprint_ = "counter in [1, 3, 5]";
+    retrieve_plan->plan_node_->is_count_ = false;
+    retrieve_plan->plan_node_->limit_ = 100;
+    retrieve_plan->field_ids_ = {i64_fid};
+    for (int i = 0; i < 2; ++i) {
+        auto results = segment->Retrieve(
+            retrieve_plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE);
+        ASSERT_EQ(results->offset_size(), 3);
+        auto& data = results->fields_data(0).scalars().long_data();
+        std::vector<int64_t> values(data.data().begin(), data.data().end());
+        std::sort(values.begin(), values.end());
+        ASSERT_EQ(values, (std::vector<int64_t>{1, 3, 5}));
+    }
+
+    // reloading data drops the cached bitsets
+    sealed->DropFieldData(vec_fid);
+    ASSERT_EQ(cache->GetMemoryUsage(), 0);
+}
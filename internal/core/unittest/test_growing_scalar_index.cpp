@@ -0,0 +1,147 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/Utils.h"
+#include "index/GrowingScalarIndex.h"
+#include "test_utils/AssertUtils.h"
+
+using milvus::OpType;
+using milvus::index::GrowingScalarIndex;
+
+namespace {
+// append the rows in batches of random size, the batches out of order
+template <typename T>
+void
+AppendShuffled(GrowingScalarIndex<T>& index, const std::vector<T>& values) {
+    std::default_random_engine er(42);
+    std::vector<std::pair<size_t, size_t>> batches;
+    for (size_t begin = 0; begin < values.size();) {
+        auto n = std::min<size_t>(er() % 100 + 1, values.size() - begin);
+        batches.emplace_back(begin, n);
+        begin += n;
+    }
+    std::shuffle(batches.begin(), batches.end(), er);
+    for (auto [begin, n] : batches) {
+        std::vector<T> batch(values.begin() + begin,
+                             values.begin() + begin + n);
+        index.Append(begin, n, batch.data());
+    }
+}
+}  // namespace
+
+TEST(GrowingScalarIndex, Int64) {
+    std::default_random_engine er(42);
+    std::vector<int64_t> values(10000);
+    for (auto& v : values) {
+        v = er() % 1000;
+    }
+    GrowingScalarIndex<int64_t> index(64);
+    AppendShuffled(index, values);
+    ASSERT_EQ(index.Count(), values.size());
+    // the runs are merged as they grow, their number stays logarithmic
+    ASSERT_LE(index.NumRuns(), 8);
+
+    std::vector<int64_t> terms{3, 500, 999, 5000};
+    assert_matches(index.In(terms.size(), terms.data()), values, [](auto v) {
+        return v == 3 || v == 500 || v == 999;
+    });
+    assert_matches(index.NotIn(terms.size(), terms.data()), values, [](auto v) {
+        return v != 3 && v != 500 && v != 999;
+    });
+    assert_matches(index.Range(100, OpType::LessThan), values, [](auto v) {
+        return v < 100;
+    });
+    assert_matches(index.Range(100, OpType::LessEqual), values, [](auto v) {
+        return v <= 100;
+    });
+    assert_matches(index.Range(900, OpType::GreaterThan), values, [](auto v) {
+        return v > 900;
+    });
+    assert_matches(index.Range(900, OpType::GreaterEqual), values, [](auto v) {
+        return v >= 900;
+    });
+    assert_matches(index.Range(10, false, 20, true), values, [](auto v) {
+        return v > 10 && v <= 20;
+    });
+    assert_matches(index.Range(20, true, 10, true), values, [](auto v) {
+        return false;
+    });
+
+    // the rows appended later are seen by the queries
+    std::vector<int64_t> more{5000, 5000};
+    index.Append(values.size(), more.size(), more.data());
+    values.insert(values.end(), more.begin(), more.end());
+    assert_matches(index.In(terms.size(), terms.data()), values, [](auto v) {
+        return v == 3 || v == 500 || v == 999 || v == 5000;
+    });
+}
+
+TEST(GrowingScalarIndex, String) {
+    std::vector<std::string> words{"apple", "banana", "grape", "pineapple", ""};
+    std::vector<std::string> values(5000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = words[i % words.size()] + std::to_string(i % 17);
+    }
+    GrowingScalarIndex<std::string> index(100);
+    AppendShuffled(index, values);
+
+    std::vector<std::string> terms{"apple3", "grape16", "missing"};
+    assert_matches(index.In(terms.size(), terms.data()), values, [](auto& v) {
+        return v == "apple3" || v == "grape16";
+    });
+    assert_matches(index.Range("banana", true, "grape", false),
+                   values,
+                   [](auto& v) { return v >= "banana" && v < "grape"; });
+    for (std::string pattern : {"apple", "ple1", "e1", "", "xyz"}) {
+        assert_matches(index.PrefixMatch(pattern), values, [&](auto& v) {
+            return milvus::PrefixMatch(v, pattern);
+        });
+        assert_matches(index.PostfixMatch(pattern), values, [&](auto& v) {
+            return milvus::PostfixMatch(v, pattern);
+        });
+        assert_matches(index.InfixMatch(pattern), values, [&](auto& v) {
+            return milvus::InfixMatch(v, pattern);
+        });
+    }
+
+    auto dataset = std::make_shared<milvus::Dataset>();
+    dataset->Set(milvus::index::OPERATOR_TYPE, OpType::PrefixMatch);
+    dataset->Set(milvus::index::PREFIX_VALUE, std::string("pine"));
+    assert_matches(index.Query(dataset), values, [](auto& v) {
+        return milvus::PrefixMatch(v, "pine");
+    });
+}
+
+TEST(GrowingScalarIndex, Bool) {
+    std::vector<bool> values(3000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = i % 3 == 0;
+    }
+    GrowingScalarIndex<bool> index(128);
+    for (size_t i = 0; i < values.size(); i += 1000) {
+        bool batch[1000];
+        for (size_t j = 0; j < 1000; ++j) {
+            batch[j] = values[i + j];
+        }
+        index.Append(i, 1000, batch);
+    }
+
+    bool term = true;
+    assert_matches(index.In(1, &term), values, [](bool v) { return v; });
+    assert_matches(index.NotIn(1, &term), values, [](bool v) { return !v; });
+}
@@ -0,0 +1,266 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "index/HnswGraph.h"
+
+using milvus::BitsetView;
+using milvus::index::HnswGraph;
+
+namespace {
+constexpr int64_t kDim = 32;
+
+std::vector<float>
+GenVectors(int64_t n, int seed) {
+    std::default_random_engine er(seed);
+    std::normal_distribution<float> dist;
+    std::vector<float> vectors(n * kDim);
+    for (auto& v : vectors) {
+        v = dist(er);
+    }
+    return vectors;
+}
+
+// the exact topk of query among the rows kept
+std::vector<int64_t>
+ExactTopk(const std::vector<float>& vectors,
+          const float* query,
+          int64_t topk,
+          const std::string& metric_type,
+          std::function<bool(int64_t)> keep) {
+    std::vector<std::pair<float, int64_t>> dists;
+    for (int64_t i = 0; i < int64_t(vectors.size()) / kDim; ++i) {
+        if (!keep(i)) {
+            continue;
+        }
+        auto v = vectors.data() + i * kDim;
+        float l2 = 0, ip = 0, norm = 0, qnorm = 0;
+        for (int64_t j = 0; j < kDim; ++j) {
+            l2 += (v[j] - query[j]) * (v[j] - query[j]);
+            ip += v[j] * query[j];
+            norm += v[j] * v[j];
+            qnorm += query[j] * query[j];
+        }
+        float d = metric_type == "L2" ? l2
+                  : metric_type == "IP"
+                      ? -ip
+                      : -ip / std::sqrt(norm) / std::sqrt(qnorm);
+        dists.emplace_back(d, i);
+    }
+    std::sort(dists.begin(), dists.end());
+    std::vector<int64_t> res;
+    for (int64_t i = 0; i < topk && i < int64_t(dists.size()); ++i) {
+        res.push_back(dists[i].second);
+    }
+    return res;
+}
+}  // namespace
+
+class HnswGraphTest : public ::testing::TestWithParam<const char*> {};
+
+INSTANTIATE_TEST_CASE_P(MetricTypes,
+                        HnswGraphTest,
+                        ::testing::Values("L2", "IP", "COSINE"));
+
+TEST_P(HnswGraphTest, ConcurrentInsertAndSearch) {
+    std::string metric_type = GetParam();
+    const int64_t n = 4000;
+    const int64_t topk = 10;
+    auto vectors = GenVectors(n, 42);
+    auto queries = GenVectors(50, 7);
+    HnswGraph graph(kDim, metric_type);
+
+    // 4 writers insert interleaved rows, a reader searches meanwhile
+    std::atomic<bool> done = false;
+    std::thread reader([&] {
+        std::vector<float> distances(topk);
+        std::vector<int64_t> offsets(topk);
+        while (!done.load()) {
+            graph.Search(queries.data(),
+                         topk,
+                         32,
+                         n,
+                         nullptr,
+                         distances.data(),
+                         offsets.data());
+            // only the rows of the inserted prefix are returned
+            auto prefix = graph.InsertedPrefix();
+            for (auto offset : offsets) {
+                ASSERT_TRUE(offset >= -1 && offset < prefix);
+            }
+        }
+    });
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&, t] {
+            for (int64_t i = t; i < n; i += 4) {
+                graph.Add(i, vectors.data() + i * kDim);
+            }
+        });
+    }
+    for (auto& w : writers) {
+        w.join();
+    }
+    done = true;
+    reader.join();
+    ASSERT_EQ(graph.Count(), n);
+    ASSERT_EQ(graph.Size(), n);
+
+    int64_t hits = 0;
+    std::vector<float> distances(topk);
+    std::vector<int64_t> offsets(topk);
+    for (int64_t q = 0; q < 50; ++q) {
+        auto query = queries.data() + q * kDim;
+        graph.Search(query,
+                     topk,
+                     64,
+                     n,
+                     nullptr,
+                     distances.data(),
+                     offsets.data());
+        auto expected = ExactTopk(
+            vectors, query, topk, metric_type, [](int64_t) { return true; });
+        std::set<int64_t> truth(expected.begin(), expected.end());
+        for (int64_t i = 0; i < topk; ++i) {
+            hits += truth.count(offsets[i]);
+            if (i > 0) {
+                // from the most similar
+                if (metric_type == "L2") {
+                    ASSERT_LE(distances[i - 1], distances[i]);
+                } else {
+                    ASSERT_GE(distances[i - 1], distances[i]);
+                }
+            }
+        }
+    }
+    ASSERT_GE(hits, 50 * topk * 9 / 10);
+
+    for (int64_t i = 0; i < n; i += 97) {
+        auto v = graph.GetVector(i);
+        ASSERT_TRUE(std::equal(v, v + kDim, vectors.data() + i * kDim));
+    }
+}
+
+TEST(HnswGraph, SnapshotAndFilter) {
+    const int64_t n = 3000;
+    const int64_t topk = 5;
+    auto vectors = GenVectors(n, 3);
+    HnswGraph graph(kDim, "L2", 8, 64);
+    for (int64_t i = 0; i < n; ++i) {
+        graph.Add(i, vectors.data() + i * kDim);
+    }
+
+    // only the rows below the snapshot and out of the filter are returned
+    const int64_t num_rows = 2000;
+    std::vector<uint8_t> bits((num_rows + 7) / 8);
+    for (int64_t i = 0; i < num_rows; i += 3) {
+        bits[i >> 3] |= 1 << (i & 7);
+    }
+    BitsetView bitset(bits.data(), num_rows);
+    std::vector<float> distances(topk);
+    std::vector<int64_t> offsets(topk);
+    for (int64_t q = 0; q < 20; ++q) {
+        auto query = vectors.data() + (num_rows + q) * kDim;
+        graph.Search(query,
+                     topk,
+                     32,
+                     n,
+                     bitset,
+                     distances.data(),
+                     offsets.data());
+        for (auto offset : offsets) {
+            ASSERT_GE(offset, 0);
+            ASSERT_LT(offset, num_rows);
+            ASSERT_FALSE(bitset.test(offset));
+        }
+    }
+
+    // the filter keeps a few rows, they are searched exactly
+    std::fill(bits.begin(), bits.end(), 0xff);
+    std::vector<int64_t> kept{7, 100, 1500};
+    for (auto i : kept) {
+        bits[i >> 3] &= ~(1 << (i & 7));
+    }
+    auto query = vectors.data() + 100 * kDim;
+    graph.Search(query,
+                 topk,
+                 32,
+                 num_rows,
+                 bitset,
+                 distances.data(),
+                 offsets.data());
+    auto expected = ExactTopk(vectors, query, 3, "L2", [&](int64_t i) {
+        return std::find(kept.begin(), kept.end(), i) != kept.end();
+    });
+    ASSERT_EQ(std::vector<int64_t>(offsets.begin(), offsets.begin() + 3),
+              expected);
+    ASSERT_EQ(offsets[0], 100);
+    ASSERT_EQ(distances[0], 0);
+    ASSERT_EQ(offsets[3], -1);
+    ASSERT_EQ(offsets[4], -1);
+}
+
+TEST(HnswGraph, InsertedPrefix) {
+    const int64_t n = 2000;
+    const int64_t topk = 5;
+    auto vectors = GenVectors(n, 5);
+    HnswGraph graph(kDim, "L2");
+
+    // the upper half first, the rows below are not even allocated
+    for (int64_t i = n / 2; i < n; ++i) {
+        graph.Add(i, vectors.data() + i * kDim);
+    }
+    ASSERT_EQ(graph.Count(), n / 2);
+    ASSERT_EQ(graph.Size(), n);
+    ASSERT_EQ(graph.InsertedPrefix(), 0);
+    std::vector<float> distances(topk);
+    std::vector<int64_t> offsets(topk);
+    graph.Search(vectors.data(),
+                 topk,
+                 32,
+                 n,
+                 nullptr,
+                 distances.data(),
+                 offsets.data());
+    for (auto offset : offsets) {
+        ASSERT_EQ(offset, -1);
+    }
+
+    // a hole at row 10 stops the prefix
+    for (int64_t i = 0; i < n / 2; ++i) {
+        if (i != 10) {
+            graph.Add(i, vectors.data() + i * kDim);
+        }
+    }
+    ASSERT_EQ(graph.InsertedPrefix(), 10);
+    auto query = vectors.data() + 3 * kDim;
+    graph.Search(
+        query, topk, 32, n, nullptr, distances.data(), offsets.data());
+    ASSERT_EQ(offsets[0], 3);
+    for (auto offset : offsets) {
+        ASSERT_LT(offset, 10);
+    }
+
+    graph.Add(10, vectors.data() + 10 * kDim);
+    ASSERT_EQ(graph.InsertedPrefix(), n);
+    query = vectors.data() + 1500 * kDim;
+    graph.Search(
+        query, topk, 32, n, nullptr, distances.data(), offsets.data());
+    ASSERT_EQ(offsets[0], 1500);
+}
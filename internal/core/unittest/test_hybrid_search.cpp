@@ -0,0 +1,292 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include "segcore/Reduce.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "segcore/SegmentSealedImpl.h"
+#include "test_utils/DataGen.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+const int64_t dim = 16;
+const int64_t N = 1000;
+// the query vectors are the ones of this row in both fields
+const int64_t target = 7;
+
+SchemaPtr
+gen_schema() {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    schema->AddDebugField(
+        "fakevec2", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    return schema;
+}
+
+std::string
+gen_plan(const std::string& fusion) {
+    return R"(hybrid_anns: <
+                anns: <
+                  field_id: 100
+                  query_info: <
+                    topk: 20
+                    round_decimal: -1
+                    metric_type: "L2"
+                    search_params: "{\"nprobe\": 10}"
+                  >
+                  placeholder_tag: "$0"
+                >
+                anns: <
+                  field_id: 101
+                  query_info: <
+                    topk: 20
+                    round_decimal: -1
+                    metric_type: "L2"
+                    search_params: "{\"nprobe\": 10}"
+                  >
+                  placeholder_tag: "$1"
+                >
+                predicates: <
+                  binary_range_expr: <
+                    column_info: <
+                      field_id: 102
+                      data_type: Int64
+                    >
+                    lower_inclusive: true,
+                    upper_inclusive: false,
+                    lower_value: <
+                      int64_val: 0
+                    >
+                    upper_value: <
+                      int64_val: 500
+                    >
+                  >
+                >
+                topk: 5
+                round_decimal: -1
+                )" +
+           fusion + ">";
+}
+
+void
+check_hybrid_search(const SegmentInterface& segment,
+                    const Schema& schema,
+                    const GeneratedData& dataset) {
+    auto vec0 = dataset.get_col<float>(FieldId(100));
+    auto vec1 = dataset.get_col<float>(FieldId(101));
+    auto ph_group_raw =
+        CreatePlaceholderGroupFromBlob(1, dim, vec0.data() + target * dim);
+    auto ph1 =
+        CreatePlaceholderGroupFromBlob(1, dim, vec1.data() + target * dim);
+    *ph_group_raw.add_placeholders() = ph1.placeholders(0);
+    ph_group_raw.mutable_placeholders(1)->set_tag("$1");
+
+    // the target row ranks first in both fields
+    auto plan_str = translate_text_plan_to_binary_plan(
+        gen_plan("fusion_type: RRF").c_str());
+    auto plan =
+        CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto sr = segment.Search(plan.get(), ph_group.get());
+    ASSERT_EQ(sr->total_nq_, 1);
+    ASSERT_EQ(sr->unity_topK_, 5);
+    ASSERT_EQ(sr->seg_offsets_[0], target);
+    ASSERT_FLOAT_EQ(sr->distances_[0], 2.0 / 61);
+    auto i64_col = dataset.get_col<int64_t>(FieldId(102));
+    for (int64_t i = 0; i < 5; ++i) {
+        ASSERT_NE(sr->seg_offsets_[i], INVALID_SEG_OFFSET);
+        ASSERT_LT(i64_col[sr->seg_offsets_[i]], 500);
+        if (i > 0) {
+            ASSERT_GE(sr->distances_[i - 1], sr->distances_[i]);
+        }
+    }
+
+    // with all the weight on the first field, the order is the one of
+    // searching the first field alone
+    plan_str = translate_text_plan_to_binary_plan(
+        gen_plan("fusion_type: WeightedSum weights: 1 weights: 0").c_str());
+    plan = CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    sr = segment.Search(plan.get(), ph_group.get());
+
+    const char* raw_plan = R"(vector_anns: <
+                                field_id: 100
+                                predicates: <
+                                  binary_range_expr: <
+                                    column_info: <
+                                      field_id: 102
+                                      data_type: Int64
+                                    >
+                                    lower_inclusive: true,
+                                    upper_inclusive: false,
+                                    lower_value: <
+                                      int64_val: 0
+                                    >
+                                    upper_value: <
+                                      int64_val: 500
+                                    >
+                                  >
+                                >
+                                query_info: <
+                                  topk: 5
+                                  round_decimal: -1
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 10}"
+                                >
+                                placeholder_tag: "$0"
+    >)";
+    auto single_plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto single_plan = CreateSearchPlanByExpr(
+        schema, single_plan_str.data(), single_plan_str.size());
+    auto single_ph_group_raw =
+        CreatePlaceholderGroupFromBlob(1, dim, vec0.data() + target * dim);
+    auto single_ph_group = ParsePlaceholderGroup(
+        single_plan.get(), single_ph_group_raw.SerializeAsString());
+    auto single_sr =
+        segment.Search(single_plan.get(), single_ph_group.get());
+    ASSERT_EQ(sr->seg_offsets_, single_sr->seg_offsets_);
+    ASSERT_FLOAT_EQ(sr->distances_[0], 1.0);
+}
+
+// the pks and scores of the results of segments reduced together
+std::pair<std::vector<int64_t>, std::vector<float>>
+reduce_hybrid_search(Plan* plan,
+                     const PlaceholderGroup& ph_group,
+                     const std::vector<const SegmentInterface*>& segments) {
+    std::vector<std::unique_ptr<SearchResult>> results;
+    std::vector<SearchResult*> result_ptrs;
+    for (auto segment : segments) {
+        results.push_back(segment->Search(plan, &ph_group));
+        result_ptrs.push_back(results.back().get());
+    }
+    int64_t slice_nq = 1;
+    int64_t slice_topk = 5;
+    ReduceHelper reduce_helper(result_ptrs, plan, &slice_nq, &slice_topk, 1);
+    reduce_helper.Reduce();
+    reduce_helper.Marshal();
+    std::unique_ptr<SearchResultDataBlobs> blobs(
+        static_cast<SearchResultDataBlobs*>(
+            reduce_helper.GetSearchResultDataBlobs()));
+    milvus::proto::schema::SearchResultData data;
+    data.ParseFromArray(blobs->blobs[0].data(), blobs->blobs[0].size());
+    return {{data.ids().int_id().data().begin(),
+             data.ids().int_id().data().end()},
+            {data.scores().begin(), data.scores().end()}};
+}
+}  // namespace
+
+TEST(HybridSearch, Sealed) {
+    auto schema = gen_schema();
+    auto dataset = DataGen(schema, N);
+    auto segment = SealedCreator(schema, dataset);
+    check_hybrid_search(*segment, *schema, dataset);
+}
+
+TEST(HybridSearch, Growing) {
+    auto schema = gen_schema();
+    auto dataset = DataGen(schema, N);
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    segment->PreInsert(N);
+    segment->Insert(0,
+                    N,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+    check_hybrid_search(*segment, *schema, dataset);
+}
+
+TEST(HybridSearch, ParsePlan) {
+    auto schema = gen_schema();
+    auto plan_str = translate_text_plan_to_binary_plan(
+        gen_plan("fusion_type: WeightedSum weights: 0.5").c_str());
+    // one weight per vector field
+    ASSERT_ANY_THROW(
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size()));
+
+    plan_str = translate_text_plan_to_binary_plan(
+        gen_plan("fusion_type: RRF rrf_k: 10").c_str());
+    auto plan =
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size());
+    auto node = dynamic_cast<HybridVectorANNS*>(plan->plan_node_.get());
+    ASSERT_NE(node, nullptr);
+    ASSERT_EQ(node->anns_.size(), 2);
+    ASSERT_EQ(node->rrf_k_, 10);
+    ASSERT_TRUE(node->predicate_.has_value());
+    ASSERT_FALSE(node->anns_[0]->predicate_.has_value());
+    ASSERT_EQ(plan->tag2field_.at("$1"), FieldId(101));
+    ASSERT_EQ(GetTopK(plan.get()), 5);
+}
+
+// the ranks of fields are the ones among all segments, so the results of
+// two segments reduced are the ones of a segment of all their rows
+TEST(HybridSearch, ReduceRRF) {
+    auto schema = gen_schema();
+    auto dataset = DataGen(schema, N);
+    auto dataset2 = DataGen(schema, N, 43);
+    // other pks, all pass the predicate
+    for (auto& field_data : *dataset2.raw_->mutable_fields_data()) {
+        if (field_data.field_id() == 102) {
+            for (auto& pk : *field_data.mutable_scalars()
+                                 ->mutable_long_data()
+                                 ->mutable_data()) {
+                pk = -pk - 1;
+            }
+        }
+    }
+
+    auto insert = [&](SegmentGrowing& segment, const GeneratedData& data) {
+        auto offset = segment.PreInsert(N);
+        segment.Insert(offset,
+                       N,
+                       data.row_ids_.data(),
+                       data.timestamps_.data(),
+                       data.raw_);
+    };
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    insert(*segment, dataset);
+    auto segment2 = CreateGrowingSegment(schema, empty_index_meta);
+    insert(*segment2, dataset2);
+    auto merged = CreateGrowingSegment(schema, empty_index_meta);
+    insert(*merged, dataset);
+    insert(*merged, dataset2);
+
+    auto vec0 = dataset.get_col<float>(FieldId(100));
+    auto vec1 = dataset2.get_col<float>(FieldId(101));
+    auto ph_group_raw =
+        CreatePlaceholderGroupFromBlob(1, dim, vec0.data() + target * dim);
+    auto ph1 =
+        CreatePlaceholderGroupFromBlob(1, dim, vec1.data() + target * dim);
+    *ph_group_raw.add_placeholders() = ph1.placeholders(0);
+    ph_group_raw.mutable_placeholders(1)->set_tag("$1");
+    auto plan_str = translate_text_plan_to_binary_plan(
+        gen_plan("fusion_type: RRF").c_str());
+    auto plan =
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size());
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+
+    auto [pks, scores] = reduce_hybrid_search(
+        plan.get(), *ph_group, {segment.get(), segment2.get()});
+    auto [expected_pks, expected_scores] =
+        reduce_hybrid_search(plan.get(), *ph_group, {merged.get()});
+    ASSERT_EQ(pks.size(), 5);
+    ASSERT_EQ(pks, expected_pks);
+    ASSERT_EQ(scores, expected_scores);
+    // the query vectors rank first in a field of a segment each
+    ASSERT_GE(scores[0], 1.0 / 61);
+}
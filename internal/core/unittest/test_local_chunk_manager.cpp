@@ -11,6 +11,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <random>
 #include <string>
@@ -250,3 +252,97 @@ TEST_F(LocalChunkManagerTest, GetSizeOfDir) {
     exist = lcm->DirExist(test_dir);
     EXPECT_EQ(exist, false);
 }
+
+TEST_F(LocalChunkManagerTest, OpenFileCache) {
+    auto lcm = LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto test_dir = lcm->GetRootPath() + "/local-test-dir";
+    auto file = test_dir + "/test-open-file-cache";
+
+    uint8_t data[] = {0x17, 0x32, 0x00, 0x34};
+    uint8_t read_data[8] = {0};
+    lcm->CreateFile(file);
+    lcm->Write(file, 0, data, sizeof(data));
+    EXPECT_EQ(lcm->Read(file, read_data, sizeof(read_data)), sizeof(data));
+
+    // the cached file is dropped on remove, not read again
+    lcm->Remove(file);
+    EXPECT_ANY_THROW(lcm->Read(file, read_data, sizeof(read_data)));
+    EXPECT_ANY_THROW(lcm->Write(file, 0, data, sizeof(data)));
+
+    // nor the file replaced by rename
+    uint8_t other[] = {0x98, 0x87};
+    lcm->Write(file, data, sizeof(data));
+    lcm->Write(file + ".tmp", other, sizeof(other));
+    lcm->Rename(file + ".tmp", file);
+    EXPECT_EQ(lcm->Read(file, read_data, sizeof(read_data)), sizeof(other));
+    EXPECT_EQ(read_data[0], 0x98);
+
+    // nor the files of a removed dir
+    lcm->RemoveDir(test_dir + "/");
+    EXPECT_ANY_THROW(lcm->Read(file, read_data, sizeof(read_data)));
+
+    // nor the file removed or replaced by another chunk manager
+    LocalChunkManager other_lcm(lcm->GetRootPath());
+    lcm->Write(file, data, sizeof(data));
+    other_lcm.Remove(file);
+    EXPECT_ANY_THROW(lcm->Read(file, read_data, sizeof(read_data)));
+    lcm->Write(file, data, sizeof(data));
+    other_lcm.Write(file + ".tmp", other, sizeof(other));
+    other_lcm.Rename(file + ".tmp", file);
+    memset(read_data, 0, sizeof(read_data));
+    EXPECT_EQ(lcm->Read(file, read_data, sizeof(read_data)), sizeof(other));
+    EXPECT_EQ(read_data[0], 0x98);
+
+    // more files than the cache keeps open
+    for (int i = 0; i < 100; ++i) {
+        auto path = test_dir + "/file-" + to_string(i);
+        lcm->Write(path, &i, sizeof(i));
+    }
+    for (int i = 0; i < 100; ++i) {
+        int value = -1;
+        auto path = test_dir + "/file-" + to_string(i);
+        EXPECT_EQ(lcm->Read(path, &value, sizeof(value)), sizeof(value));
+        EXPECT_EQ(value, i);
+    }
+
+    lcm->RemoveDir(test_dir);
+    EXPECT_EQ(lcm->DirExist(test_dir), false);
+}
+
+TEST_F(LocalChunkManagerTest, AllocateAndDirectIO) {
+    auto root = LocalChunkManagerSingleton::GetInstance()
+                    .GetChunkManager()
+                    ->GetRootPath();
+    LocalChunkManager lcm(root, true);
+    auto test_dir = root + "/local-test-dir";
+    auto file = test_dir + "/test-direct-io";
+
+    // preallocation doesn't change the size
+    lcm.CreateFile(file);
+    lcm.Allocate(file, 0, 1 << 20);
+    EXPECT_EQ(lcm.Size(file), 0);
+
+    // aligned io goes through O_DIRECT if supported, the other through
+    // the page cache, both see the same content
+    const size_t alignment = 4096;
+    auto buf = static_cast<uint8_t*>(aligned_alloc(alignment, 2 * alignment));
+    for (size_t i = 0; i < 2 * alignment; ++i) {
+        buf[i] = i % 251;
+    }
+    lcm.Write(file, 0, buf, 2 * alignment);
+    lcm.Write(file, 2 * alignment, buf + 1, 100);
+    EXPECT_EQ(lcm.Size(file), 2 * alignment + 100);
+
+    std::vector<uint8_t> read_data(3 * alignment);
+    EXPECT_EQ(lcm.Read(file, read_data.data(), read_data.size()),
+              2 * alignment + 100);
+    EXPECT_EQ(read_data[alignment + 7], buf[alignment + 7]);
+    EXPECT_EQ(read_data[2 * alignment], buf[1]);
+    memset(buf, 0, 2 * alignment);
+    EXPECT_EQ(lcm.Read(file, alignment, buf, alignment), alignment);
+    EXPECT_EQ(buf[7], (alignment + 7) % 251);
+    free(buf);
+
+    lcm.RemoveDir(test_dir);
+    EXPECT_EQ(lcm.DirExist(test_dir), false);
+}
@@ -225,6 +225,48 @@ TEST_F(MinioChunkManagerTest, ReadPositive) {
     chunk_manager_->DeleteBucket(testBucketName);
 }
 
+TEST_F(MinioChunkManagerTest, ReadRange) {
+    string testBucketName = configs_.bucket_name;
+    chunk_manager_->SetBucketName(testBucketName);
+    if (!chunk_manager_->BucketExists(testBucketName)) {
+        chunk_manager_->CreateBucket(testBucketName);
+    }
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = uint8_t(i * 7);
+    }
+    string path = "1/4/7";
+    chunk_manager_->Write(path, data.data(), data.size());
+
+    // parts of 64 bytes, the last one is shorter
+    chunk_manager_->SetMultipartRead(100, 64, 3);
+    std::vector<uint8_t> readdata(data.size());
+    auto size = chunk_manager_->Read(path, readdata.data(), data.size());
+    EXPECT_EQ(size, data.size());
+    EXPECT_EQ(readdata, data);
+
+    std::fill(readdata.begin(), readdata.end(), 0);
+    size = chunk_manager_->Read(path, 130, readdata.data(), 300);
+    EXPECT_EQ(size, 300);
+    EXPECT_TRUE(
+        std::equal(data.begin() + 130, data.begin() + 430, readdata.begin()));
+
+    // shorter than a part, a single GET
+    std::fill(readdata.begin(), readdata.end(), 0);
+    size = chunk_manager_->Read(path, 10, readdata.data(), 20);
+    EXPECT_EQ(size, 20);
+    EXPECT_TRUE(
+        std::equal(data.begin() + 10, data.begin() + 30, readdata.begin()));
+
+    EXPECT_THROW(chunk_manager_->Read("1/4/not_exist", readdata.data(), 10),
+                 ObjectNotExistException);
+    EXPECT_THROW(chunk_manager_->Read("1/4/not_exist", readdata.data(), 200),
+                 ObjectNotExistException);
+
+    chunk_manager_->Remove(path);
+    chunk_manager_->DeleteBucket(testBucketName);
+}
+
 TEST_F(MinioChunkManagerTest, RemovePositive) {
     string testBucketName = "test-remove";
     chunk_manager_->SetBucketName(testBucketName);
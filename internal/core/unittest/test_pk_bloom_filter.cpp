@@ -0,0 +1,97 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "segcore/PkBloomFilter.h"
+
+using milvus::PkType;
+using milvus::segcore::PkBloomFilter;
+
+namespace {
+// the count of the pks in [begin, end) the filter may contain
+template <typename Gen>
+size_t
+CountPositives(const PkBloomFilter& filter,
+               int64_t begin,
+               int64_t end,
+               Gen gen) {
+    size_t count = 0;
+    for (auto i = begin; i < end; ++i) {
+        count += filter.MayContain(gen(i));
+    }
+    return count;
+}
+}  // namespace
+
+TEST(PkBloomFilter, Empty) {
+    PkBloomFilter filter;
+    ASSERT_FALSE(filter.MayContain(PkType(int64_t(0))));
+    ASSERT_FALSE(filter.MayContain(PkType(std::string("a"))));
+    ASSERT_EQ(filter.Size(), 0);
+    ASSERT_EQ(filter.ByteSize(), 0);
+}
+
+TEST(PkBloomFilter, Reserved) {
+    int64_t n = 100000;
+    auto gen = [](int64_t i) { return PkType(i * 7); };
+    PkBloomFilter filter;
+    filter.Reserve(n);
+    for (int64_t i = 0; i < n; ++i) {
+        filter.Add(gen(i));
+    }
+    ASSERT_EQ(filter.Size(), n);
+    ASSERT_EQ(filter.NumFilters(), 1);
+    ASSERT_LE(filter.ByteSize(), n * PkBloomFilter::kBitsPerKey / 8 + 64);
+
+    // no false negative
+    ASSERT_EQ(CountPositives(filter, 0, n, gen), n);
+    // few false positives
+    ASSERT_LT(CountPositives(filter, n, 2 * n, gen), n / 50);
+}
+
+TEST(PkBloomFilter, Growing) {
+    int64_t n = 50000;
+    auto gen = [](int64_t i) { return PkType("pk_" + std::to_string(i)); };
+    PkBloomFilter filter;
+    for (int64_t i = 0; i < n; ++i) {
+        filter.Add(gen(i));
+    }
+    ASSERT_EQ(filter.Size(), n);
+    // of 1024, 4096, 16384 and 65536 keys
+    ASSERT_EQ(filter.NumFilters(), 4);
+
+    ASSERT_EQ(CountPositives(filter, 0, n, gen), n);
+    ASSERT_LT(CountPositives(filter, n, 2 * n, gen), n / 50);
+}
+
+TEST(PkBloomFilter, ReserveAfterAdd) {
+    PkBloomFilter filter;
+    for (int64_t i = 0; i < 10; ++i) {
+        filter.Add(PkType(i));
+    }
+    // the first filter has room for them
+    filter.Reserve(100);
+    ASSERT_EQ(filter.NumFilters(), 1);
+    // and not for them
+    filter.Reserve(PkBloomFilter::kMinCapacity);
+    ASSERT_EQ(filter.NumFilters(), 2);
+    for (int64_t i = 10; i < 10 + PkBloomFilter::kMinCapacity; ++i) {
+        filter.Add(PkType(i));
+    }
+    ASSERT_EQ(filter.NumFilters(), 2);
+    for (int64_t i = 0; i < 10 + PkBloomFilter::kMinCapacity; ++i) {
+        ASSERT_TRUE(filter.MayContain(PkType(i)));
+    }
+}
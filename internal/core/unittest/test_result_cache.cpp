@@ -0,0 +1,144 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include "segcore/ResultCache.h"
+#include "segcore/SegmentSealedImpl.h"
+#include "test_utils/DataGen.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+SearchResult
+gen_search_result(int64_t nq, int64_t topk) {
+    SearchResult result;
+    result.total_nq_ = nq;
+    result.unity_topK_ = topk;
+    result.distances_.resize(nq * topk, 1.0);
+    result.seg_offsets_.resize(nq * topk);
+    std::iota(result.seg_offsets_.begin(), result.seg_offsets_.end(), 0);
+    return result;
+}
+}  // namespace
+
+TEST(ResultCache, LRU) {
+    auto& cache = ResultCache::GetInstance();
+    cache.SetCapacity(0);
+    int owner1 = 0;
+    int owner2 = 0;
+
+    // disabled
+    cache.PutSearchResult(&owner1, "a", gen_search_result(1, 10));
+    ASSERT_EQ(cache.Size(), 0);
+    ASSERT_EQ(cache.GetSearchResult(&owner1, "a"), nullptr);
+
+    cache.SetCapacity(64 << 10);
+    cache.PutSearchResult(&owner1, "a", gen_search_result(1, 10));
+    cache.PutSearchResult(&owner2, "a", gen_search_result(2, 10));
+    ASSERT_EQ(cache.Size(), 2);
+
+    auto result = cache.GetSearchResult(&owner1, "a");
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(result->total_nq_, 1);
+    ASSERT_EQ(result->seg_offsets_.size(), 10);
+    ASSERT_EQ(cache.GetSearchResult(&owner1, "b"), nullptr);
+
+    // owner1's entry is the most recently used, owner2's one gets evicted
+    cache.SetCapacity(cache.GetMemoryUsage() - 1);
+    ASSERT_EQ(cache.Size(), 1);
+    ASSERT_NE(cache.GetSearchResult(&owner1, "a"), nullptr);
+    ASSERT_EQ(cache.GetSearchResult(&owner2, "a"), nullptr);
+
+    // a single entry larger than the budget is never cached
+    cache.PutSearchResult(&owner2, "big", gen_search_result(100, 100));
+    ASSERT_EQ(cache.GetSearchResult(&owner2, "big"), nullptr);
+
+    cache.Invalidate(&owner1);
+    ASSERT_EQ(cache.Size(), 0);
+    ASSERT_EQ(cache.GetMemoryUsage(), 0);
+
+    proto::segcore::RetrieveResults retrieve_result;
+    retrieve_result.mutable_offset()->Add(42);
+    cache.PutRetrieveResult(&owner1, "r", retrieve_result);
+    auto cached = cache.GetRetrieveResult(&owner1, "r");
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(cached->offset(0), 42);
+    // search and retrieve results are not mixed up
+    ASSERT_EQ(cache.GetSearchResult(&owner1, "r"), nullptr);
+
+    cache.SetCapacity(0);
+    ASSERT_EQ(cache.Size(), 0);
+}
+
+TEST(ResultCache, SealedSearch) {
+    auto& cache = ResultCache::GetInstance();
+    cache.SetCapacity(64 << 20);
+
+    auto dim = 16;
+    auto N = 1000;
+    auto schema = std::make_shared<Schema>();
+    auto vec_fid = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    auto dataset = DataGen(schema, N);
+    auto segment = SealedCreator(schema, dataset);
+
+    const char* raw_plan = R"(vector_anns: <
+                                    field_id: 100
+                                    query_info: <
+                                      topk: 5
+                                      round_decimal: 3
+                                      metric_type: "L2"
+                                      search_params: "{\"nprobe\": 10}"
+                                    >
+                                    placeholder_tag: "$0"
+        >)";
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto plan =
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size());
+    auto ph_group_raw = CreatePlaceholderGroup(1, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+
+    auto sr1 = segment->Search(plan.get(), ph_group.get());
+    ASSERT_EQ(cache.Size(), 1);
+    auto sr2 = segment->Search(plan.get(), ph_group.get());
+    ASSERT_EQ(cache.Size(), 1);
+    ASSERT_EQ(sr1->seg_offsets_, sr2->seg_offsets_);
+    ASSERT_EQ(sr1->distances_, sr2->distances_);
+    ASSERT_EQ(sr2->segment_, segment.get());
+
+    // a different query vector doesn't hit
+    auto ph_group_raw2 = CreatePlaceholderGroup(1, dim, 2048);
+    auto ph_group2 =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw2.SerializeAsString());
+    segment->Search(plan.get(), ph_group2.get());
+    ASSERT_EQ(cache.Size(), 2);
+
+    // delete the top1 entity, it must disappear from the result
+    auto top1_pk = dataset.get_col<int64_t>(i64_fid)[sr1->seg_offsets_[0]];
+    auto pks = GenPKs(std::vector<int64_t>{top1_pk});
+    std::vector<Timestamp> tss(1, N * 2);
+    segment->Delete(0, 1, pks.get(), tss.data());
+    ASSERT_EQ(cache.Size(), 0);
+
+    auto sr3 = segment->Search(plan.get(), ph_group.get());
+    ASSERT_NE(sr3->seg_offsets_[0], sr1->seg_offsets_[0]);
+
+    // entries are dropped with the segment
+    segment.reset();
+    ASSERT_EQ(cache.Size(), 0);
+    cache.SetCapacity(0);
+}
@@ -11,7 +11,10 @@
 
 #include <gtest/gtest.h>
 
+#include <unordered_set>
+
 #include "index/IndexFactory.h"
+#include "index/ScalarIndexSort.h"
 #include "common/CDataType.h"
 #include "test_utils/indexbuilder_test_utils.h"
 #include "test_utils/AssertUtils.h"
@@ -196,3 +199,104 @@ REGISTER_TYPED_TEST_CASE_P(TypedScalarIndexTest,
                            Reverse);
 
 INSTANTIATE_TYPED_TEST_CASE_P(ArithmeticCheck, TypedScalarIndexTest, ScalarT);
+
+TEST(ScalarIndexSort, ManyTerms) {
+    int64_t n = 10000;
+    std::vector<int64_t> arr(n);
+    for (int64_t i = 0; i < n; ++i) {
+        arr[i] = rand() % 5000;
+    }
+    auto index = milvus::index::CreateScalarIndexSort<int64_t>();
+    index->Build(n, arr.data());
+
+    // few terms are searched through the directory, many terms are merged
+    // with the sorted keys
+    for (int64_t num_terms : {3, 10000}) {
+        std::vector<int64_t> terms(num_terms);
+        for (auto& term : terms) {
+            term = rand() % 6000;
+        }
+        std::unordered_set<int64_t> term_set(terms.begin(), terms.end());
+        auto in = index->In(terms.size(), terms.data());
+        auto not_in = index->NotIn(terms.size(), terms.data());
+        for (int64_t i = 0; i < n; ++i) {
+            auto expected = term_set.count(arr[i]) > 0;
+            ASSERT_EQ(in[i], expected);
+            ASSERT_EQ(not_in[i], !expected);
+        }
+    }
+
+    auto range = index->Range(1000, true, 1017, false);
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(range[i], arr[i] >= 1000 && arr[i] < 1017);
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(index->Reverse_Lookup(i), arr[i]);
+    }
+}
+
+TEST(ScalarIndexSort, LoadLayoutInPlace) {
+    int64_t n = 10000;
+    std::vector<int64_t> arr(n);
+    for (int64_t i = 0; i < n; ++i) {
+        arr[i] = rand() % 5000;
+    }
+    auto index = milvus::index::CreateScalarIndexSort<int64_t>();
+    index->Build(n, arr.data());
+    auto binary_set = index->Serialize({});
+    ASSERT_TRUE(binary_set.Contains(milvus::index::SORT_INDEX_LAYOUT));
+    auto layout = binary_set.GetByName(milvus::index::SORT_INDEX_LAYOUT);
+    ASSERT_EQ(layout->size % milvus::index::IndexLayout::kPageSize, 0);
+
+    milvus::index::ScalarIndexSort<int64_t> copy_index;
+    copy_index.Load(binary_set);
+    // the keys are those of the layout, not a copy
+    auto keys = reinterpret_cast<const uint8_t*>(copy_index.GetKeys());
+    ASSERT_EQ((keys - layout->data.get()) %
+                  milvus::index::IndexLayout::kPageSize,
+              0);
+    ASSERT_LT(keys, layout->data.get() + layout->size);
+    ASSERT_EQ(copy_index.Count(), n);
+    auto range = copy_index.Range(1000, true, 1017, false);
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(range[i], arr[i] >= 1000 && arr[i] < 1017);
+        ASSERT_EQ(copy_index.Reverse_Lookup(i), arr[i]);
+    }
+}
+
+TEST(ScalarIndexSort, LoadFormerFormat) {
+    int64_t n = 1000;
+    std::vector<int64_t> arr(n);
+    for (int64_t i = 0; i < n; ++i) {
+        arr[i] = rand() % 500;
+    }
+    auto index = milvus::index::CreateScalarIndexSort<int64_t>();
+    index->Build(n, arr.data());
+
+    // the array of IndexStructure and its length, as serialized before the
+    // layout
+    size_t index_size = n;
+    auto index_data_size =
+        index_size * sizeof(milvus::index::IndexStructure<int64_t>);
+    std::shared_ptr<uint8_t[]> index_data(new uint8_t[index_data_size]);
+    auto data = reinterpret_cast<milvus::index::IndexStructure<int64_t>*>(
+        index_data.get());
+    for (size_t i = 0; i < index_size; ++i) {
+        new (data + i) milvus::index::IndexStructure<int64_t>(
+            index->GetKeys()[i], index->GetOffsets()[i]);
+    }
+    std::shared_ptr<uint8_t[]> index_length(new uint8_t[sizeof(size_t)]);
+    memcpy(index_length.get(), &index_size, sizeof(size_t));
+    milvus::BinarySet binary_set;
+    binary_set.Append("index_data", index_data, index_data_size);
+    binary_set.Append("index_length", index_length, sizeof(size_t));
+
+    milvus::index::ScalarIndexSort<int64_t> copy_index;
+    copy_index.Load(binary_set);
+    ASSERT_EQ(copy_index.Count(), n);
+    auto range = copy_index.Range(100, false, 317, true);
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(range[i], arr[i] > 100 && arr[i] <= 317);
+        ASSERT_EQ(copy_index.Reverse_Lookup(i), arr[i]);
+    }
+}
@@ -0,0 +1,168 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Slice.h"
+#include "index/Index.h"
+#include "index/ScalarIndexSort.h"
+#include "index/StringIndexMarisa.h"
+#include "index/ZoneMapIndex.h"
+#include "storage/MemFileManagerImpl.h"
+#include "storage/Util.h"
+#include "test_utils/storage_test_utils.h"
+
+using milvus::Config;
+using milvus::index::kMmapFilepath;
+
+// the layouts are uploaded in slices through a MemFileManagerImpl, and
+// loaded back into the mmap file, slice after slice
+class ScalarIndexMmapTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        chunk_manager_ = milvus::storage::CreateChunkManager(
+            get_default_local_storage_config());
+        // a page a slice, so that the layouts are sliced
+        slice_size_ = milvus::FILE_SLICE_SIZE;
+        milvus::FILE_SLICE_SIZE = 4096;
+    }
+
+    void
+    TearDown() override {
+        milvus::FILE_SLICE_SIZE = slice_size_;
+    }
+
+    milvus::storage::FileManagerImplPtr
+    CreateFileManager(int64_t build_id) {
+        milvus::storage::FieldDataMeta field_data_meta{1, 2, 3, 101};
+        milvus::storage::IndexMeta index_meta{3, 101, build_id, 1};
+        return std::make_shared<milvus::storage::MemFileManagerImpl>(
+            field_data_meta, index_meta, chunk_manager_);
+    }
+
+    // the load config of the files of binary_set, to map at mmap_filepath
+    Config
+    LoadConfig(const milvus::BinarySet& binary_set,
+               const std::string& mmap_filepath) {
+        std::vector<std::string> index_files;
+        bool sliced = false;
+        for (auto& [file, _] : binary_set.binary_map_) {
+            index_files.push_back(file);
+            auto file_name = file.substr(file.find_last_of('/') + 1);
+            sliced |= file_name == milvus::INDEX_FILE_SLICE_META;
+        }
+        EXPECT_TRUE(sliced);
+        EXPECT_GT(index_files.size(), 2);
+        return Config{{"index_files", index_files},
+                      {kMmapFilepath, mmap_filepath}};
+    }
+
+    milvus::storage::ChunkManagerPtr chunk_manager_;
+    int64_t slice_size_;
+};
+
+TEST_F(ScalarIndexMmapTest, ScalarIndexSort) {
+    int64_t n = 10000;
+    std::vector<int64_t> arr(n);
+    std::default_random_engine er(42);
+    for (int64_t i = 0; i < n; ++i) {
+        arr[i] = er() % 5000;
+    }
+    auto file_manager = CreateFileManager(1001);
+    auto index = milvus::index::CreateScalarIndexSort<int64_t>(file_manager);
+    index->Build(n, arr.data());
+    auto binary_set = index->Upload();
+    index.reset();
+
+    auto mmap_filepath = "mmap/test_scalar_index_mmap_sort";
+    auto loaded = milvus::index::CreateScalarIndexSort<int64_t>(file_manager);
+    loaded->Load(LoadConfig(binary_set, mmap_filepath));
+    // mapped and unlinked
+    ASSERT_FALSE(std::filesystem::exists(mmap_filepath));
+    ASSERT_EQ(loaded->Count(), n);
+    auto range = loaded->Range(1000, true, 1017, false);
+    std::vector<int64_t> terms{7, 4999, 5000};
+    auto in = loaded->In(terms.size(), terms.data());
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(range[i], arr[i] >= 1000 && arr[i] < 1017);
+        ASSERT_EQ(in[i], arr[i] == 7 || arr[i] == 4999);
+        ASSERT_EQ(loaded->Reverse_Lookup(i), arr[i]);
+    }
+}
+
+TEST_F(ScalarIndexMmapTest, StringIndexMarisa) {
+    int64_t n = 10000;
+    std::vector<std::string> strs(n);
+    std::default_random_engine er(42);
+    for (int64_t i = 0; i < n; ++i) {
+        strs[i] = "str_" + std::to_string(er() % 3000);
+    }
+    auto file_manager = CreateFileManager(1002);
+    auto index = milvus::index::CreateStringIndexMarisa(file_manager);
+    index->Build(n, strs.data());
+    auto binary_set = index->Upload();
+    index.reset();
+
+    auto mmap_filepath = "mmap/test_scalar_index_mmap_marisa";
+    auto loaded = milvus::index::CreateStringIndexMarisa(file_manager);
+    loaded->Load(LoadConfig(binary_set, mmap_filepath));
+    ASSERT_FALSE(std::filesystem::exists(mmap_filepath));
+    ASSERT_EQ(loaded->Count(), n);
+    auto prefix = loaded->PrefixMatch("str_12");
+    std::vector<std::string> terms{strs[0], strs[n - 1], "str_missing"};
+    auto in = loaded->In(terms.size(), terms.data());
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(prefix[i], strs[i].rfind("str_12", 0) == 0);
+        ASSERT_EQ(in[i], strs[i] == strs[0] || strs[i] == strs[n - 1]);
+        ASSERT_EQ(loaded->Reverse_Lookup(i), strs[i]);
+    }
+}
+
+TEST_F(ScalarIndexMmapTest, ZoneMapIndex) {
+    int64_t n = 10000;
+    std::vector<double> values(n);
+    std::default_random_engine er(42);
+    for (int64_t i = 0; i < n; ++i) {
+        values[i] = double(i / 10) + double(er() % 50);
+    }
+    auto file_manager = CreateFileManager(1003);
+    auto index = milvus::index::CreateZoneMapIndex<double>(file_manager);
+    index->BuildWithRawData(
+        n,
+        values.data(),
+        {{milvus::index::ZONE_MAP_BLOCK_ROWS, "256"},
+         {milvus::index::ZONE_MAP_BLOOM_FILTER, "true"}});
+    auto binary_set = index->Upload();
+    index.reset();
+
+    auto mmap_filepath = "mmap/test_scalar_index_mmap_zone_map";
+    auto loaded = milvus::index::CreateZoneMapIndex<double>(file_manager);
+    loaded->Load(LoadConfig(binary_set, mmap_filepath));
+    ASSERT_FALSE(std::filesystem::exists(mmap_filepath));
+    ASSERT_EQ(loaded->Count(), n);
+    ASSERT_EQ(loaded->NumBlocks(), (n + 255) / 256);
+    ASSERT_TRUE(loaded->HasBloomFilter());
+    auto range = loaded->Range(100, true, 120, false);
+    std::vector<double> terms{7, 400, 100000};
+    auto in = loaded->In(terms.size(), terms.data());
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(range[i], values[i] >= 100 && values[i] < 120);
+        ASSERT_EQ(in[i], values[i] == 7 || values[i] == 400);
+        ASSERT_EQ(loaded->Reverse_Lookup(i), values[i]);
+    }
+}
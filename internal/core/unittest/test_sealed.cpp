@@ -12,7 +12,12 @@
 #include <gtest/gtest.h>
 #include <boost/format.hpp>
 
+#include <chrono>
+#include <fstream>
+
 #include "common/Types.h"
+#include "mmap/ColumnFile.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentSealedImpl.h"
 #include "test_utils/DataGen.h"
 #include "index/IndexFactory.h"
@@ -581,6 +586,177 @@ TEST(Sealed, LoadFieldDataMmap) {
     ASSERT_ANY_THROW(segment->Search(plan.get(), ph_group.get()));
 }
 
+TEST(Sealed, LoadColumnFile) {
+    auto dim = 16;
+    auto N = ROW_COUNT;
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto counter_id = schema->AddDebugField("counter", DataType::INT64);
+    auto double_id = schema->AddDebugField("double", DataType::DOUBLE);
+    auto str_id = schema->AddDebugField("str", DataType::VARCHAR);
+    auto json_id = schema->AddDebugField("json", DataType::JSON);
+    schema->set_primary_field_id(counter_id);
+    auto dataset = DataGen(schema, N);
+
+    std::string mmap_dir_path = "./data/mmap-column-file-test";
+    std::filesystem::remove_all(mmap_dir_path);
+    auto insert_files = [](int64_t field_id) {
+        return std::vector<std::string>{"binlog/" + std::to_string(field_id)};
+    };
+    auto column_file = [&](int64_t field_id) {
+        return std::filesystem::path(mmap_dir_path) / "1" /
+               (std::to_string(field_id) + kColumnFileExtension);
+    };
+    auto& config = SegcoreConfig::default_config();
+    config.set_column_file_cache_capacity(1 << 30);
+
+    // the first load writes the column files
+    auto segment = CreateSealedSegment(schema, 1);
+    auto fields = schema->get_fields();
+    LoadFieldDataInfo load_info;
+    load_info.mmap_dir_path = mmap_dir_path;
+    for (auto& field_data : dataset.raw_->fields_data()) {
+        int64_t field_id = field_data.field_id();
+        FieldDataInfo info(field_id, N, mmap_dir_path);
+        info.insert_files = insert_files(field_id);
+        info.channel->push(CreateFieldDataFromDataArray(
+            N, &field_data, fields.at(FieldId(field_id))));
+        info.channel->close();
+        segment->MapFieldData(FieldId(field_id), info);
+        load_info.field_infos[field_id] =
+            FieldBinlogInfo{field_id, N, insert_files(field_id)};
+        ASSERT_TRUE(std::filesystem::exists(column_file(field_id)));
+    }
+
+    // the binlogs don't exist, the second load can only map the column files
+    auto segment2 = CreateSealedSegment(schema, 1);
+    segment2->LoadFieldData(load_info);
+    for (auto& field_data : dataset.raw_->fields_data()) {
+        ASSERT_TRUE(segment2->HasFieldData(FieldId(field_data.field_id())));
+    }
+    auto chunk_span1 = segment2->chunk_data<int64_t>(counter_id, 0);
+    auto chunk_span2 = segment2->chunk_data<double>(double_id, 0);
+    auto chunk_span3 = segment2->chunk_data<std::string_view>(str_id, 0);
+    auto chunk_span4 = segment2->chunk_data<Json>(json_id, 0);
+    auto ref1 = dataset.get_col<int64_t>(counter_id);
+    auto ref2 = dataset.get_col<double>(double_id);
+    auto ref3 = dataset.get_col(str_id)->scalars().string_data().data();
+    auto ref4 = dataset.get_col(json_id)->scalars().json_data().data();
+    for (int i = 0; i < N; ++i) {
+        ASSERT_EQ(chunk_span1[i], ref1[i]);
+        ASSERT_EQ(chunk_span2[i], ref2[i]);
+        ASSERT_EQ(chunk_span3[i], ref3[i]);
+        ASSERT_EQ(chunk_span4[i].data(), ref4[i]);
+    }
+
+    // the header tells the binlogs and the zone map of the column
+    auto file = File::Open(column_file(counter_id.get()).string(), O_RDONLY);
+    auto fingerprint = ColumnFileFingerprint(insert_files(counter_id.get()));
+    auto header = ReadColumnFileHeader(file, DataType::INT64, fingerprint, N);
+    ASSERT_TRUE(header.has_value());
+    ASSERT_TRUE(header->has_zone_map);
+    ASSERT_EQ(header->min_int, *std::min_element(ref1.begin(), ref1.end()));
+    ASSERT_EQ(header->max_int, *std::max_element(ref1.begin(), ref1.end()));
+    ASSERT_FALSE(ReadColumnFileHeader(file,
+                                      DataType::INT64,
+                                      ColumnFileFingerprint({"binlog/other"}),
+                                      N)
+                     .has_value());
+    ASSERT_FALSE(
+        ReadColumnFileHeader(file, DataType::INT64, fingerprint, N + 1)
+            .has_value());
+
+    // the column files go with the released segments
+    segment.reset();
+    segment2.reset();
+    for (auto& field_data : dataset.raw_->fields_data()) {
+        auto field_id = field_data.field_id();
+        ASSERT_FALSE(std::filesystem::exists(column_file(field_id)));
+    }
+    config.set_column_file_cache_capacity(0);
+    std::filesystem::remove_all(mmap_dir_path);
+}
+
+TEST(Sealed, MapFieldDataWithoutColumnFile) {
+    auto N = ROW_COUNT;
+    auto schema = std::make_shared<Schema>();
+    auto counter_id = schema->AddDebugField("counter", DataType::INT64);
+    auto str_id = schema->AddDebugField("str", DataType::VARCHAR);
+    schema->set_primary_field_id(counter_id);
+    auto dataset = DataGen(schema, N);
+
+    std::string mmap_dir_path = "./data/mmap-without-column-file-test";
+    std::filesystem::remove_all(mmap_dir_path);
+    auto& config = SegcoreConfig::default_config();
+    config.set_column_file_cache_capacity(1 << 30);
+    // pages larger than the column file layout, as on some arm64 hosts
+    auto page_size = SystemPageSize();
+    SystemPageSize() = 64 * 1024;
+    ASSERT_FALSE(ColumnFileSupported());
+
+    auto segment = CreateSealedSegment(schema, 1);
+    auto fields = schema->get_fields();
+    for (auto& field_data : dataset.raw_->fields_data()) {
+        int64_t field_id = field_data.field_id();
+        FieldDataInfo info(field_id, N, mmap_dir_path);
+        info.insert_files = {"binlog/" + std::to_string(field_id)};
+        info.channel->push(CreateFieldDataFromDataArray(
+            N, &field_data, fields.at(FieldId(field_id))));
+        info.channel->close();
+        segment->MapFieldData(FieldId(field_id), info);
+    }
+    SystemPageSize() = page_size;
+    config.set_column_file_cache_capacity(0);
+
+    // mapped at offset 0 and unlinked, as before column files
+    auto segment_dir = std::filesystem::path(mmap_dir_path) / "1";
+    ASSERT_TRUE(std::filesystem::is_empty(segment_dir));
+    auto chunk_span1 = segment->chunk_data<int64_t>(counter_id, 0);
+    auto chunk_span2 = segment->chunk_data<std::string_view>(str_id, 0);
+    auto ref1 = dataset.get_col<int64_t>(counter_id);
+    auto ref2 = dataset.get_col(str_id)->scalars().string_data().data();
+    for (int i = 0; i < N; ++i) {
+        ASSERT_EQ(chunk_span1[i], ref1[i]);
+        ASSERT_EQ(chunk_span2[i], ref2[i]);
+    }
+    std::filesystem::remove_all(mmap_dir_path);
+}
+
+TEST(Sealed, ColumnFileGc) {
+    namespace fs = std::filesystem;
+    fs::path mmap_dir_path = "./data/mmap-column-file-gc-test";
+    fs::remove_all(mmap_dir_path);
+    auto now = fs::file_time_type::clock::now();
+    std::vector<fs::path> files;
+    for (int i = 0; i < 4; ++i) {
+        auto dir = mmap_dir_path / std::to_string(i);
+        fs::create_directories(dir);
+        files.push_back(dir / (std::to_string(100 + i) + kColumnFileExtension));
+        std::ofstream(files.back()) << std::string(1000, 'x');
+        fs::last_write_time(files.back(), now - std::chrono::hours(4 - i));
+    }
+    // not a column file, such as a mapped index file
+    auto other = mmap_dir_path / "0" / "100";
+    fs::create_directories(other);
+    std::ofstream(other / "1") << std::string(10000, 'x');
+
+    GcColumnFiles(mmap_dir_path, 5000);
+    for (auto& file : files) {
+        ASSERT_TRUE(fs::exists(file));
+    }
+
+    // the least recently used first, their empty segment dirs too
+    GcColumnFiles(mmap_dir_path, 2500);
+    ASSERT_FALSE(fs::exists(files[0]));
+    ASSERT_FALSE(fs::exists(files[1]));
+    ASSERT_FALSE(fs::exists(mmap_dir_path / "1"));
+    ASSERT_TRUE(fs::exists(files[2]));
+    ASSERT_TRUE(fs::exists(files[3]));
+    ASSERT_TRUE(fs::exists(other / "1"));
+    fs::remove_all(mmap_dir_path);
+}
+
 TEST(Sealed, LoadScalarIndex) {
     auto dim = 16;
     size_t N = ROW_COUNT;
@@ -1102,6 +1278,55 @@ TEST(Sealed, RealCount) {
     ASSERT_EQ(0, segment->get_real_count());
 }
 
+TEST(Sealed, DeleteMissingPks) {
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk);
+    auto segment = CreateSealedSegment(schema);
+
+    int64_t c = 10;
+    int64_t missing = 1000;
+    auto dataset = DataGen(schema, c);
+    auto pks = dataset.get_col<int64_t>(pk);
+
+    // the deltas loaded ahead of the pks are all kept
+    std::vector<int64_t> missing_pks;
+    for (int64_t i = 0; i < missing; ++i) {
+        missing_pks.push_back(1000000 + i);
+    }
+    auto missing_ids = GenPKs(missing_pks);
+    auto missing_tss = GenTss(missing, c);
+    LoadDeletedRecordInfo info = {
+        missing_tss.data(), missing_ids.get(), missing};
+    segment->LoadDeletedRecord(info);
+    ASSERT_EQ(segment->get_deleted_count(), missing);
+    SealedLoadFieldData(dataset, *segment);
+
+    // the pks of the segment and the pks not in it
+    std::vector<int64_t> del_pks(pks.begin(), pks.end());
+    del_pks.insert(del_pks.end(), missing_pks.begin(), missing_pks.end());
+    auto del_ids = GenPKs(del_pks);
+    std::unique_ptr<bool[]> may_contain(new bool[del_pks.size()]);
+    segment->MayContainPks(del_ids.get(), may_contain.get());
+    for (int64_t i = 0; i < c; ++i) {
+        ASSERT_TRUE(may_contain[i]);
+    }
+    // but for the false positives of the pk filter, about 1%
+    int64_t false_positives = 0;
+    for (int64_t i = c; i < c + missing; ++i) {
+        false_positives += may_contain[i];
+    }
+    ASSERT_LT(false_positives, missing / 50);
+
+    // the deletions of the missing pks are dropped once the pks are loaded
+    auto del_tss = GenTss(del_pks.size(), c + missing);
+    auto status =
+        segment->Delete(0, del_pks.size(), del_ids.get(), del_tss.data());
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(segment->get_deleted_count(), missing + c + false_positives);
+    ASSERT_EQ(0, segment->get_real_count());
+}
+
 TEST(Sealed, GetVector) {
     auto dim = 16;
     auto N = ROW_COUNT;
@@ -1146,3 +1371,92 @@ TEST(Sealed, GetVector) {
         }
     }
 }
+
+TEST(Sealed, SelectiveFilterBruteForce) {
+    auto dim = 16;
+    auto topK = 5;
+    auto N = ROW_COUNT;
+    auto metric_type = knowhere::metric::L2;
+    auto schema = std::make_shared<Schema>();
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, metric_type);
+    auto counter_id = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(counter_id);
+
+    auto dataset = DataGen(schema, N);
+    auto fakevec = dataset.get_col<float>(fakevec_id);
+    auto segment = SealedCreator(schema, dataset);
+    segment->DropFieldData(fakevec_id);
+    LoadIndexInfo vec_info;
+    vec_info.field_id = fakevec_id.get();
+    vec_info.index = GenVecIndexing(N, dim, fakevec.data());
+    vec_info.index_params["metric_type"] = knowhere::metric::L2;
+    segment->LoadIndex(vec_info);
+
+    // 20 rows left by the filter, far below the brute force ratio
+    const char* raw_plan = R"(vector_anns: <
+                                field_id: 100
+                                predicates: <
+                                  binary_range_expr: <
+                                    column_info: <
+                                      field_id: 101
+                                      data_type: Int64
+                                    >
+                                    lower_inclusive: true,
+                                    upper_inclusive: false,
+                                    lower_value: <
+                                      int64_val: 100
+                                    >
+                                    upper_value: <
+                                      int64_val: 120
+                                    >
+                                  >
+                                >
+                                query_info: <
+                                  topk: 5
+                                  round_decimal: -1
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 1}"
+                                >
+                                placeholder_tag: "$0"
+     >)";
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto plan =
+        CreateSearchPlanByExpr(*schema, plan_str.data(), plan_str.size());
+    auto ph_group_raw = CreatePlaceholderGroup(1, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto query = ph_group->at(0).get_blob<float>();
+
+    std::vector<std::pair<float, int64_t>> expected;
+    for (int64_t offset = 100; offset < 120; ++offset) {
+        float distance = 0;
+        for (int64_t j = 0; j < dim; ++j) {
+            auto diff = query[j] - fakevec[offset * dim + j];
+            distance += diff * diff;
+        }
+        expected.emplace_back(distance, offset);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    // exact results even with nprobe 1, once enabled
+    auto& config = SegcoreConfig::default_config();
+    auto ratio = config.get_brute_force_filter_ratio();
+    config.set_brute_force_filter_ratio(0.01);
+    auto sr = segment->Search(plan.get(), ph_group.get());
+    ASSERT_EQ(sr->seg_offsets_.size(), topK);
+    for (int i = 0; i < topK; ++i) {
+        ASSERT_EQ(sr->seg_offsets_[i], expected[i].second);
+        ASSERT_NEAR(sr->distances_[i], expected[i].first, 1e-3);
+    }
+
+    // the index is used if disabled
+    config.set_brute_force_filter_ratio(0);
+    sr = segment->Search(plan.get(), ph_group.get());
+    ASSERT_EQ(sr->seg_offsets_.size(), topK);
+    for (auto offset : sr->seg_offsets_) {
+        ASSERT_TRUE(offset == INVALID_SEG_OFFSET ||
+                    (offset >= 100 && offset < 120));
+    }
+    config.set_brute_force_filter_ratio(ratio);
+}
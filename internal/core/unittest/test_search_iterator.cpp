@@ -0,0 +1,251 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <unordered_set>
+
+#include "index/VectorIterator.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "segcore/SegmentSealedImpl.h"
+#include "test_utils/DataGen.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+const int64_t dim = 16;
+const int64_t N = 1000;
+
+const char* raw_plan = R"(vector_anns: <
+                                field_id: 100
+                                query_info: <
+                                  topk: 100
+                                  round_decimal: -1
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 10}"
+                                >
+                                placeholder_tag: "$0"
+    >)";
+
+const char* raw_filtered_plan = R"(vector_anns: <
+                                field_id: 100
+                                predicates: <
+                                  binary_range_expr: <
+                                    column_info: <
+                                      field_id: 101
+                                      data_type: Int64
+                                    >
+                                    lower_inclusive: true,
+                                    upper_inclusive: false,
+                                    lower_value: <
+                                      int64_val: 0
+                                    >
+                                    upper_value: <
+                                      int64_val: 150
+                                    >
+                                  >
+                                >
+                                query_info: <
+                                  topk: 100
+                                  round_decimal: -1
+                                  metric_type: "L2"
+                                  search_params: "{\"nprobe\": 10}"
+                                >
+                                placeholder_tag: "$0"
+    >)";
+
+SchemaPtr
+gen_schema() {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    return schema;
+}
+
+std::vector<std::pair<int64_t, float>>
+drain(index::VectorIterator& iterator, int64_t batch_size) {
+    std::vector<std::pair<int64_t, float>> results;
+    while (iterator.HasNext()) {
+        auto batch = iterator.Next(batch_size);
+        if (iterator.HasNext()) {
+            EXPECT_EQ(batch.size(), batch_size);
+        }
+        results.insert(results.end(), batch.begin(), batch.end());
+    }
+    return results;
+}
+
+void
+check_iterator(const SegmentInterface& segment, const Schema& schema) {
+    auto plan_str = translate_text_plan_to_binary_plan(raw_plan);
+    auto plan =
+        CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    auto ph_group_raw = CreatePlaceholderGroup(2, dim, 1024);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+
+    auto sr = segment.Search(plan.get(), ph_group.get());
+    auto iterators =
+        segment.SearchIterators(plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    ASSERT_EQ(iterators.size(), 2);
+    for (int64_t i = 0; i < 2; ++i) {
+        auto& iterator = *iterators[i];
+        std::vector<int64_t> offsets;
+        // pages of different size continue where the last one stopped
+        for (auto batch_size : {7, 1, 30, 62}) {
+            for (auto& [offset, distance] : iterator.Next(batch_size)) {
+                offsets.push_back(offset);
+            }
+        }
+        ASSERT_EQ(offsets.size(), 100);
+        std::vector<int64_t> expected(sr->seg_offsets_.begin() + i * 100,
+                                      sr->seg_offsets_.begin() + (i + 1) * 100);
+        ASSERT_EQ(offsets, expected);
+    }
+
+    // the iterator ends after all rows not filtered out
+    auto filtered_plan_str = translate_text_plan_to_binary_plan(
+        raw_filtered_plan);
+    auto filtered_plan = CreateSearchPlanByExpr(
+        schema, filtered_plan_str.data(), filtered_plan_str.size());
+    iterators = segment.SearchIterators(
+        filtered_plan.get(), ph_group.get(), MAX_TIMESTAMP);
+    auto results = drain(*iterators[0], 16);
+    ASSERT_EQ(results.size(), 150);
+    std::unordered_set<int64_t> unique;
+    for (int64_t i = 0; i < results.size(); ++i) {
+        ASSERT_LT(results[i].first, 150);
+        unique.insert(results[i].first);
+        if (i > 0) {
+            ASSERT_LE(results[i - 1].second, results[i].second);
+        }
+    }
+    ASSERT_EQ(unique.size(), 150);
+    ASSERT_TRUE(iterators[0]->Next(16).empty());
+}
+}  // namespace
+
+TEST(SearchIterator, Sealed) {
+    auto schema = gen_schema();
+    auto dataset = DataGen(schema, N);
+    auto segment = SealedCreator(schema, dataset);
+    check_iterator(*segment, *schema);
+}
+
+TEST(SearchIterator, Growing) {
+    auto schema = gen_schema();
+    auto dataset = DataGen(schema, N);
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    segment->PreInsert(N);
+    segment->Insert(0,
+                    N,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+    check_iterator(*segment, *schema);
+}
+
+TEST(SearchIterator, RangeSearchIterator) {
+    // distance of offset i is i / 4, so that bands start at ties
+    const int64_t count = 64;
+    SearchInfo search_info;
+    search_info.metric_type_ = knowhere::metric::L2;
+    int64_t calls = 0;
+    index::RangeSearchIterator iterator(
+        search_info, count, [&](const SearchInfo& info) {
+            ++calls;
+            std::vector<std::pair<float, int64_t>> rows;
+            for (int64_t i = 0; i < count; ++i) {
+                float distance = i / 4;
+                if (info.search_params_.contains(RADIUS)) {
+                    float radius = info.search_params_[RADIUS];
+                    float range_filter = info.search_params_[RANGE_FILTER];
+                    if (distance < range_filter || distance >= radius) {
+                        continue;
+                    }
+                }
+                rows.emplace_back(distance, i);
+            }
+            auto result = std::make_unique<SearchResult>();
+            for (int64_t i = 0; i < info.topk_; ++i) {
+                if (i < rows.size()) {
+                    result->distances_.push_back(rows[i].first);
+                    result->seg_offsets_.push_back(rows[i].second);
+                } else {
+                    result->distances_.push_back(0);
+                    result->seg_offsets_.push_back(INVALID_SEG_OFFSET);
+                }
+            }
+            return result;
+        });
+
+    auto results = drain(iterator, 3);
+    ASSERT_EQ(results.size(), count);
+    for (int64_t i = 0; i < count; ++i) {
+        ASSERT_EQ(results[i].first, i);
+    }
+    ASSERT_FALSE(iterator.HasNext());
+    ASSERT_LT(calls, count);
+}
+
+TEST(SearchIterator, RangeSearchIteratorMissingFrontier) {
+    // distance of offset i is i / 4, and the range searches don't return the
+    // returned rows at range filter, as an approximate index may miss them
+    const int64_t count = 64;
+    SearchInfo search_info;
+    search_info.metric_type_ = knowhere::metric::L2;
+    std::unordered_set<int64_t> returned;
+    index::RangeSearchIterator iterator(
+        search_info, count, [&](const SearchInfo& info) {
+            std::vector<std::pair<float, int64_t>> rows;
+            for (int64_t i = 0; i < count; ++i) {
+                float distance = i / 4;
+                if (info.search_params_.contains(RADIUS)) {
+                    float radius = info.search_params_[RADIUS];
+                    float range_filter = info.search_params_[RANGE_FILTER];
+                    if (distance < range_filter || distance >= radius ||
+                        (distance == range_filter && returned.count(i) > 0)) {
+                        continue;
+                    }
+                }
+                rows.emplace_back(distance, i);
+            }
+            auto result = std::make_unique<SearchResult>();
+            for (int64_t i = 0; i < info.topk_; ++i) {
+                if (i < rows.size()) {
+                    result->distances_.push_back(rows[i].first);
+                    result->seg_offsets_.push_back(rows[i].second);
+                } else {
+                    result->distances_.push_back(0);
+                    result->seg_offsets_.push_back(INVALID_SEG_OFFSET);
+                }
+            }
+            return result;
+        });
+
+    std::vector<int64_t> offsets;
+    auto batch_size = 8;
+    while (iterator.HasNext()) {
+        for (auto& [offset, _] : iterator.Next(batch_size)) {
+            offsets.push_back(offset);
+            returned.insert(offset);
+        }
+        batch_size = 3;
+    }
+    ASSERT_EQ(offsets.size(), count);
+    for (int64_t i = 0; i < count; ++i) {
+        ASSERT_EQ(offsets[i], i);
+    }
+}
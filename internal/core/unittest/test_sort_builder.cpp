@@ -0,0 +1,146 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "index/SortBuilder.h"
+
+using milvus::index::SortBuilder;
+
+namespace {
+// in an array rather than a vector, for bool
+template <typename T>
+struct Values {
+    explicit Values(size_t n) : data(new T[n]), size(n) {
+    }
+    T&
+    operator[](size_t i) const {
+        return data[i];
+    }
+    std::unique_ptr<T[]> data;
+    size_t size;
+};
+
+template <typename T>
+Values<T>
+GenValues(size_t n, int seed) {
+    std::default_random_engine er(seed);
+    Values<T> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        auto& v = values[i];
+        if constexpr (std::is_same_v<T, std::string>) {
+            v = std::to_string(er() % 100000);
+        } else if constexpr (std::is_same_v<T, bool>) {
+            v = er() % 2;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            v = T(int64_t(er() % 200000) - 100000) / 7;
+        } else {
+            // duplicates, negative values and the extremes
+            v = T(er());
+            if (er() % 4 == 0) {
+                v = T(er() % 100);
+            }
+        }
+    }
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        values[0] = std::numeric_limits<T>::min();
+        values[1] = std::numeric_limits<T>::max();
+    }
+    return values;
+}
+
+// the keys and rows of a stable sort of the values
+template <typename T>
+void
+ExpectSorted(const Values<T>& values,
+             const std::vector<T>& keys,
+             const std::vector<int32_t>& offsets) {
+    std::vector<int32_t> expected(values.size);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(
+        expected.begin(), expected.end(), [&](int32_t a, int32_t b) {
+            return values[a] < values[b];
+        });
+    ASSERT_EQ(offsets, expected);
+    ASSERT_EQ(keys.size(), values.size);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(keys[i], values[offsets[i]]);
+    }
+}
+}  // namespace
+
+template <typename T>
+class SortBuilderTest : public ::testing::Test {};
+
+using SortTypes =
+    ::testing::Types<bool, int8_t, int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE_P(SortBuilderTest);
+
+TYPED_TEST_P(SortBuilderTest, ParallelSort) {
+    // several tasks and an odd chunk out in the merge rounds
+    auto values = GenValues<TypeParam>(5 * 64 * 1024 + 123, 42);
+    SortBuilder<TypeParam> builder;
+    auto half = values.size / 2;
+    builder.Add(half, values.data.get());
+    builder.Add(values.size - half, values.data.get() + half);
+    ASSERT_EQ(builder.NumRows(), int64_t(values.size));
+
+    std::vector<TypeParam> keys;
+    std::vector<int32_t> offsets;
+    builder.Finish(keys, offsets);
+    ExpectSorted(values, keys, offsets);
+}
+
+TYPED_TEST_P(SortBuilderTest, SpillRuns) {
+    auto dir = std::filesystem::temp_directory_path() / "test_sort_builder";
+    auto values = GenValues<TypeParam>(100000, 7);
+    std::vector<TypeParam> keys;
+    std::vector<int32_t> offsets;
+    {
+        // a run of about 10000 rows
+        SortBuilder<TypeParam> builder(
+            10000 * 2 * (sizeof(TypeParam) + sizeof(int32_t)), dir);
+        builder.Add(values.size, values.data.get());
+        ASSERT_TRUE(std::filesystem::exists(dir));
+        builder.Finish(keys, offsets);
+    }
+    ASSERT_FALSE(std::filesystem::exists(dir));
+    ExpectSorted(values, keys, offsets);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortBuilderTest, ParallelSort, SpillRuns);
+INSTANTIATE_TYPED_TEST_SUITE_P(Sort, SortBuilderTest, SortTypes);
+
+TEST(SortBuilder, String) {
+    auto values = GenValues<std::string>(3 * 64 * 1024, 3);
+    std::vector<std::string> keys;
+    std::vector<int32_t> offsets;
+
+    SortBuilder<std::string> builder;
+    builder.Add(values.size, values.data.get());
+    builder.Finish(keys, offsets);
+    ExpectSorted(values, keys, offsets);
+
+    auto dir = std::filesystem::temp_directory_path() / "test_sort_builder";
+    SortBuilder<std::string> spilled(1 << 20, dir);
+    spilled.Add(values.size, values.data.get());
+    spilled.Finish(keys, offsets);
+    ExpectSorted(values, keys, offsets);
+}
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include "mmap/Column.h"
 #include "segcore/SegmentGrowing.h"
 #include "test_utils/DataGen.h"
 
@@ -68,3 +69,32 @@ TEST(Span, Naive) {
         }
     }
 }
+
+TEST(Span, VariableColumn) {
+    using namespace milvus;
+    auto field_meta =
+        FieldMeta(FieldName("str"), FieldId(100), DataType::VARCHAR, 64);
+    std::vector<std::string> rows{"", "a", "hello", "", "world!"};
+    VariableColumn<std::string> column(rows.size(), field_meta);
+    for (auto& row : rows) {
+        column.Append(row.data(), row.size());
+    }
+    column.Seal();
+    ASSERT_EQ(column.NumRows(), rows.size());
+
+    // the views of the rows are built from the offsets on access
+    auto span = Span<std::string_view>(column.Span());
+    ASSERT_EQ(span.row_count(), rows.size());
+    ASSERT_EQ(SpanBase(span).offset_sizeof(), sizeof(uint32_t));
+    for (size_t i = 0; i < rows.size(); ++i) {
+        ASSERT_EQ(span[i], rows[i]);
+        ASSERT_EQ(column[i], rows[i]);
+        ASSERT_EQ(column.RawAt(i), rows[i]);
+    }
+
+    std::vector<std::string_view> views(rows.begin(), rows.end());
+    auto view_span = Span<std::string_view>(views.data(), views.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        ASSERT_EQ(view_span[i], rows[i]);
+    }
+}
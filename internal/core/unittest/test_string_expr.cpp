@@ -486,6 +486,12 @@ TEST(StringExpr, UnaryRange) {
             {proto::plan::OpType::PrefixMatch,
              "a",
              [](std::string& val) { return PrefixMatch(val, "a"); }},
+            {proto::plan::OpType::PostfixMatch,
+             "a",
+             [](std::string& val) { return PostfixMatch(val, "a"); }},
+            {proto::plan::OpType::InfixMatch,
+             "ab",
+             [](std::string& val) { return InfixMatch(val, "ab"); }},
         };
 
     auto seg = CreateGrowingSegment(schema, empty_index_meta);
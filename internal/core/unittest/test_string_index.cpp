@@ -10,7 +10,11 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 
+#include <cstdio>
+
+#include "common/Utils.h"
 #include "index/Index.h"
 #include "index/ScalarIndex.h"
 
@@ -130,6 +134,30 @@ TEST_F(StringIndexMarisaTest, PrefixMatch) {
     }
 }
 
+TEST_F(StringIndexMarisaTest, RangeWithDuplicates) {
+    // few distinct keys, so that a range takes both the postings and the
+    // rank scan paths
+    std::vector<std::string> values(1000);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = std::to_string(std::rand() % 40);
+    }
+    auto index = milvus::index::CreateStringIndexMarisa();
+    index->Build(values.size(), values.data());
+
+    for (std::string bound : {"", "1", "17", "25", "39", "5", "9", "z"}) {
+        auto less = index->Range(bound, milvus::OpType::LessThan);
+        auto greater_equal = index->Range(bound, milvus::OpType::GreaterEqual);
+        auto between = index->Range("17", false, bound, true);
+        auto prefix = index->PrefixMatch(bound);
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(less[i], values[i] < bound);
+            ASSERT_EQ(greater_equal[i], values[i] >= bound);
+            ASSERT_EQ(between[i], values[i] > "17" && values[i] <= bound);
+            ASSERT_EQ(prefix[i], milvus::PrefixMatch(values[i], bound));
+        }
+    }
+}
+
 TEST_F(StringIndexMarisaTest, Query) {
     auto index = milvus::index::CreateStringIndexMarisa();
     index->Build(nb, strs.data());
@@ -261,6 +289,60 @@ TEST_F(StringIndexMarisaTest, Codec) {
     }
 }
 
+TEST_F(StringIndexMarisaTest, LoadLayoutInPlace) {
+    milvus::index::StringIndexMarisa index;
+    index.Build(nb, strs.data());
+    auto binary_set = index.Serialize(nullptr);
+    ASSERT_TRUE(binary_set.Contains(milvus::index::MARISA_INDEX_LAYOUT));
+    auto layout = binary_set.GetByName(milvus::index::MARISA_INDEX_LAYOUT);
+    ASSERT_EQ(layout->size % milvus::index::IndexLayout::kPageSize, 0);
+
+    milvus::index::StringIndexMarisa copy_index;
+    copy_index.Load(binary_set);
+    ASSERT_EQ(copy_index.Count(), nb);
+    // the arrays are those of the layout, not copies
+    auto begin = reinterpret_cast<const uint8_t*>(copy_index.str_ids_);
+    ASSERT_GE(begin, layout->data.get());
+    ASSERT_LT(begin, layout->data.get() + layout->size);
+    for (size_t i = 0; i < nb; i++) {
+        ASSERT_EQ(copy_index.Reverse_Lookup(i), strs[i]);
+        auto bitset = copy_index.In(1, &strs[i]);
+        ASSERT_TRUE(bitset[i]);
+    }
+}
+
+TEST_F(StringIndexMarisaTest, LoadFormerFormat) {
+    milvus::index::StringIndexMarisa index;
+    index.Build(nb, strs.data());
+
+    // the trie and the str_ids, as serialized before the layout
+    auto file = std::tmpfile();
+    auto fd = fileno(file);
+    index.trie_.write(fd);
+    auto trie_len = lseek(fd, 0, SEEK_END);
+    std::shared_ptr<uint8_t[]> trie(new uint8_t[trie_len]);
+    lseek(fd, 0, SEEK_SET);
+    ASSERT_EQ(read(fd, trie.get(), trie_len), trie_len);
+    std::fclose(file);
+    auto str_ids_len = nb * sizeof(size_t);
+    std::shared_ptr<uint8_t[]> str_ids(new uint8_t[str_ids_len]);
+    memcpy(str_ids.get(), index.str_ids_, str_ids_len);
+    milvus::BinarySet binary_set;
+    binary_set.Append(milvus::index::MARISA_TRIE_INDEX, trie, trie_len);
+    binary_set.Append(milvus::index::MARISA_STR_IDS, str_ids, str_ids_len);
+
+    milvus::index::StringIndexMarisa copy_index;
+    copy_index.Load(binary_set);
+    ASSERT_EQ(copy_index.Count(), nb);
+    for (size_t i = 0; i < nb; i++) {
+        ASSERT_EQ(copy_index.Reverse_Lookup(i), strs[i]);
+    }
+    auto bitset = copy_index.Range(strs[0], milvus::OpType::LessEqual);
+    for (size_t i = 0; i < nb; i++) {
+        ASSERT_EQ(bool(bitset[i]), strs[i] <= strs[0]);
+    }
+}
+
 TEST_F(StringIndexMarisaTest, BaseIndexCodec) {
     milvus::index::IndexBasePtr index =
         milvus::index::CreateStringIndexMarisa();
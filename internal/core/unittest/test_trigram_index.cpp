@@ -0,0 +1,107 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/Utils.h"
+#include "index/StringIndexTrigram.h"
+#include "test_utils/AssertUtils.h"
+
+using milvus::OpType;
+using milvus::index::StringIndexTrigram;
+
+namespace {
+std::vector<std::string>
+GenValues(size_t n) {
+    std::vector<std::string> words{
+        "apple", "banana", "grape", "pineapple", "applesauce", "ab", ""};
+    std::vector<std::string> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = words[i % words.size()] + std::to_string(i % 13);
+    }
+    return values;
+}
+}  // namespace
+
+TEST(StringIndexTrigram, Match) {
+    auto values = GenValues(10000);
+    StringIndexTrigram index;
+    index.Build(values.size(), values.data());
+    ASSERT_EQ(index.Count(), values.size());
+
+    for (std::string pattern :
+         {"apple", "pple1", "nan", "e1", "a", "", "xyz", "ppleapp"}) {
+        assert_matches(index.InfixMatch(pattern), values, [&](auto& v) {
+            return milvus::InfixMatch(v, pattern);
+        });
+        assert_matches(index.PostfixMatch(pattern), values, [&](auto& v) {
+            return milvus::PostfixMatch(v, pattern);
+        });
+        assert_matches(index.PrefixMatch(pattern), values, [&](auto& v) {
+            return milvus::PrefixMatch(v, pattern);
+        });
+    }
+
+    // the trigrams narrow the keys down to the ones holding the pattern
+    auto candidates = index.Candidates("pineapple");
+    ASSERT_TRUE(candidates.has_value());
+    ASSERT_EQ(candidates->size(), 13);
+    ASSERT_FALSE(index.Candidates("ab").has_value());
+}
+
+TEST(StringIndexTrigram, Query) {
+    auto values = GenValues(5000);
+    StringIndexTrigram index;
+    index.Build(values.size(), values.data());
+
+    std::vector<std::string> terms{"apple1", "ab12", "missing"};
+    assert_matches(index.In(terms.size(), terms.data()), values, [&](auto& v) {
+        return v == terms[0] || v == terms[1];
+    });
+    assert_matches(
+        index.NotIn(terms.size(), terms.data()), values, [&](auto& v) {
+            return v != terms[0] && v != terms[1];
+        });
+    assert_matches(index.Range("banana", OpType::GreaterEqual),
+                   values,
+                   [](auto& v) { return v >= "banana"; });
+    assert_matches(index.Range("apple", true, "grape5", false),
+                   values,
+                   [](auto& v) { return v >= "apple" && v < "grape5"; });
+
+    auto dataset = std::make_shared<milvus::Dataset>();
+    dataset->Set(milvus::index::OPERATOR_TYPE, OpType::InfixMatch);
+    dataset->Set(milvus::index::MATCH_VALUE, std::string("rap"));
+    assert_matches(index.Query(dataset), values, [](auto& v) {
+        return milvus::InfixMatch(v, "rap");
+    });
+}
+
+TEST(StringIndexTrigram, Codec) {
+    auto values = GenValues(5000);
+    StringIndexTrigram index;
+    index.Build(values.size(), values.data());
+
+    auto binary_set = index.Serialize(nullptr);
+    StringIndexTrigram copy_index;
+    copy_index.Load(binary_set);
+    ASSERT_EQ(copy_index.Count(), values.size());
+    ASSERT_EQ(copy_index.Size(), index.Size());
+    assert_matches(copy_index.InfixMatch("eapp"), values, [](auto& v) {
+        return milvus::InfixMatch(v, "eapp");
+    });
+    for (size_t i = 0; i < values.size(); i += 97) {
+        ASSERT_EQ(copy_index.Reverse_Lookup(i), values[i]);
+    }
+}
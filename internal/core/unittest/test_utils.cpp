@@ -16,6 +16,7 @@
 #include "query/Utils.h"
 #include "test_utils/DataGen.h"
 #include "common/Types.h"
+#include "utils/File.h"
 
 TEST(Util, StringMatch) {
     using namespace milvus;
@@ -38,6 +39,12 @@ TEST(Util, StringMatch) {
 
     ASSERT_FALSE(PrefixMatch("dontmatch", "prefix"));
     ASSERT_FALSE(PostfixMatch("dontmatch", "postfix"));
+
+    ASSERT_TRUE(InfixMatch("1infix2", "infix"));
+    ASSERT_TRUE(InfixMatch("anything", ""));
+    ASSERT_FALSE(InfixMatch("infi", "infix"));
+    ASSERT_TRUE(Match(
+        std::string("1infix2"), std::string("infix"), OpType::InfixMatch));
 }
 
 TEST(Util, GetDeleteBitmap) {
@@ -133,3 +140,29 @@ TEST(Util, upper_bound) {
     ASSERT_EQ(5, upper_bound(timestamps, 0, data.size(), 4));
     ASSERT_EQ(10, upper_bound(timestamps, 0, data.size(), 10));
 }
+
+TEST(Util, BufferedWriter) {
+    using namespace milvus;
+
+    std::string filepath = "/tmp/test_buffered_writer";
+    auto file = File::Open(filepath, O_CREAT | O_TRUNC | O_RDWR);
+    std::string expected;
+    {
+        BufferedWriter writer(file, 1);
+        // small writes are buffered, the large one goes to the file directly
+        std::string large(3 * BufferedWriter::kAlignment, 'x');
+        for (auto& str : {std::string("abc"), large, std::string("de")}) {
+            writer.Write(str.data(), str.size());
+            expected += str;
+            ASSERT_EQ(writer.Offset(), expected.size());
+        }
+        writer.Flush();
+    }
+
+    std::string content(expected.size() + 1, '\0');
+    auto n = pread(file.Descriptor(), content.data(), content.size(), 0);
+    ASSERT_EQ(n, expected.size());
+    content.resize(n);
+    ASSERT_EQ(content, expected);
+    unlink(filepath.c_str());
+}
@@ -15,7 +15,10 @@
 #include <vector>
 #include <memory>
 
+#include "common/QueryResult.h"
 #include "common/Types.h"
+#include "common/Utils.h"
+#include "index/ScalarIndex.h"
 
 using milvus::index::ScalarIndex;
 
@@ -94,6 +97,18 @@ assert_order(const milvus::SearchResult& result,
     }
 }
 
+// the rows set in bitset are the ones of the values matching pred
+template <typename T, typename Pred>
+inline void
+assert_matches(const milvus::TargetBitmap& bitset,
+               const std::vector<T>& values,
+               Pred pred) {
+    ASSERT_EQ(bitset.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(bool(bitset[i]), bool(pred(values[i]))) << "row " << i;
+    }
+}
+
 template <typename T>
 inline void
 assert_in(ScalarIndex<T>* index, const std::vector<T>& arr) {
@@ -0,0 +1,173 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "index/ZoneMapIndex.h"
+#include "test_utils/AssertUtils.h"
+
+using milvus::OpType;
+using milvus::index::ZoneMapIndex;
+
+namespace {
+// values growing with the row, as the values of a field clustered by the
+// insert time, with some noise
+template <typename T>
+std::vector<T>
+GenClusteredValues(size_t n, int seed) {
+    std::default_random_engine er(seed);
+    std::vector<T> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = T(i / 10) + T(er() % 50);
+    }
+    return values;
+}
+
+template <typename T>
+void
+AssertQueries(ZoneMapIndex<T>& index, const std::vector<T>& values) {
+    for (T value : {T(-1), T(0), T(333), T(500), T(1049), T(5000)}) {
+        assert_matches(index.Range(value, OpType::LessThan), values, [&](T v) {
+            return v < value;
+        });
+        assert_matches(index.Range(value, OpType::LessEqual), values, [&](T v) {
+            return v <= value;
+        });
+        assert_matches(
+            index.Range(value, OpType::GreaterThan), values, [&](T v) {
+                return v > value;
+            });
+        assert_matches(
+            index.Range(value, OpType::GreaterEqual), values, [&](T v) {
+                return v >= value;
+            });
+    }
+    assert_matches(index.Range(T(100), true, T(120), false), values, [](T v) {
+        return v >= 100 && v < 120;
+    });
+    assert_matches(index.Range(T(100), false, T(100), true), values, [](T v) {
+        return false;
+    });
+    assert_matches(index.Range(T(-5), false, T(2000), true), values, [](T v) {
+        return v > -5 && v <= 2000;
+    });
+
+    std::vector<T> terms{T(7), T(400), T(401), T(400), T(100000)};
+    auto in_terms = [&](T v) {
+        return std::find(terms.begin(), terms.end(), v) != terms.end();
+    };
+    assert_matches(index.In(terms.size(), terms.data()), values, in_terms);
+    assert_matches(index.NotIn(terms.size(), terms.data()), values, [&](T v) {
+        return !in_terms(v);
+    });
+    for (size_t i = 0; i < values.size(); i += 97) {
+        ASSERT_EQ(index.Reverse_Lookup(i), values[i]);
+    }
+}
+}  // namespace
+
+template <typename T>
+class ZoneMapIndexTest : public ::testing::Test {};
+
+using ZoneMapTypes =
+    ::testing::Types<int16_t, int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE_P(ZoneMapIndexTest);
+
+TYPED_TEST_P(ZoneMapIndexTest, Query) {
+    auto values = GenClusteredValues<TypeParam>(10000, 42);
+    for (auto bloom_filter : {false, true}) {
+        ZoneMapIndex<TypeParam> index;
+        milvus::Config config{{milvus::index::ZONE_MAP_BLOCK_ROWS, "100"},
+                              {milvus::index::ZONE_MAP_BLOOM_FILTER,
+                               bloom_filter ? "true" : "false"}};
+        index.BuildWithRawData(values.size(), values.data(), config);
+        ASSERT_EQ(index.Count(), values.size());
+        ASSERT_EQ(index.NumBlocks(), 100);
+        ASSERT_EQ(index.HasBloomFilter(), bloom_filter);
+        AssertQueries(index, values);
+    }
+}
+
+TYPED_TEST_P(ZoneMapIndexTest, Codec) {
+    // a last block of fewer rows
+    auto values = GenClusteredValues<TypeParam>(10050, 7);
+    ZoneMapIndex<TypeParam> index;
+    milvus::Config config{{milvus::index::ZONE_MAP_BLOCK_ROWS, "512"},
+                          {milvus::index::ZONE_MAP_BLOOM_FILTER, "true"}};
+    index.BuildWithRawData(values.size(), values.data(), config);
+
+    auto binary_set = index.Serialize(nullptr);
+    ZoneMapIndex<TypeParam> copy_index;
+    copy_index.Load(binary_set);
+    ASSERT_EQ(copy_index.Count(), values.size());
+    ASSERT_EQ(copy_index.NumBlocks(), 20);
+    ASSERT_TRUE(copy_index.HasBloomFilter());
+    AssertQueries(copy_index, values);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ZoneMapIndexTest, Query, Codec);
+INSTANTIATE_TYPED_TEST_SUITE_P(ZoneMap, ZoneMapIndexTest, ZoneMapTypes);
+
+TEST(ZoneMapIndex, Candidates) {
+    size_t n = 100000;
+    std::vector<int64_t> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = i;
+    }
+    ZoneMapIndex<int64_t> index;
+    index.Build(n, values.data());
+    ASSERT_EQ(index.NumBlocks(),
+              (n + milvus::index::DEFAULT_ZONE_MAP_BLOCK_ROWS - 1) /
+                  milvus::index::DEFAULT_ZONE_MAP_BLOCK_ROWS);
+    ASSERT_FALSE(index.HasBloomFilter());
+
+    // clustered rows, the min and max of the blocks prune
+    std::vector<int64_t> terms{5, 2000, 2001, -1, int64_t(n)};
+    auto candidates = index.InCandidates(terms.size(), terms.data());
+    ASSERT_EQ(candidates, (std::vector<size_t>{0, 1}));
+
+    // shuffled rows, only the Bloom filters prune
+    std::shuffle(values.begin(), values.end(), std::default_random_engine(3));
+    ZoneMapIndex<int64_t> shuffled;
+    shuffled.BuildWithRawData(
+        n, values.data(), {{milvus::index::ZONE_MAP_BLOOM_FILTER, true}});
+    candidates = shuffled.InCandidates(terms.size(), terms.data());
+    ASSERT_LE(candidates.size(), 3 + shuffled.NumBlocks() / 10);
+    auto bitset = shuffled.In(terms.size(), terms.data());
+    assert_matches(bitset, values, [](int64_t v) {
+        return v == 5 || v == 2000 || v == 2001;
+    });
+}
+
+TEST(ZoneMapIndex, NaN) {
+    auto nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> values{1, nan, 3, 4, 5, 6, nan, 8, 9, 10};
+    ZoneMapIndex<double> index;
+    index.BuildWithRawData(values.size(),
+                           values.data(),
+                           {{milvus::index::ZONE_MAP_BLOCK_ROWS, 3},
+                            {milvus::index::ZONE_MAP_BLOOM_FILTER, true}});
+    assert_matches(index.Range(100, OpType::LessThan), values, [](double v) {
+        return v < 100;
+    });
+    assert_matches(index.Range(0, false, 5, true), values, [](double v) {
+        return v > 0 && v <= 5;
+    });
+    std::vector<double> terms{nan, 3, 8};
+    assert_matches(index.In(terms.size(), terms.data()), values, [](double v) {
+        return v == 3 || v == 8;
+    });
+}
@@ -47,6 +47,18 @@ func findLastNotOfWildcards(pattern string) int {
 	return loc
 }
 
+// findFirstNotOfWildcards find the first location not of leading wildcards.
+func findFirstNotOfWildcards(pattern string) int {
+	loc := 0
+	for ; loc < len(pattern); loc++ {
+		_, ok := wildcards[pattern[loc]]
+		if !ok {
+			break
+		}
+	}
+	return loc
+}
+
 // translatePatternMatch translates pattern to related op type and operand.
 func translatePatternMatch(pattern string) (op planpb.OpType, operand string, err error) {
 	l := len(pattern)
@@ -67,9 +79,19 @@ func translatePatternMatch(pattern string) (op planpb.OpType, operand string, er
 		return planpb.OpType_PrefixMatch, pattern[:loc+1], nil
 	}
 
+	first := findFirstNotOfWildcards(pattern)
+	if first > 0 && !hasWildcards(pattern[first:loc+1]) {
+		if loc >= l-1 {
+			// postfix match.
+			return planpb.OpType_PostfixMatch, pattern[first:], nil
+		}
+		// infix match.
+		return planpb.OpType_InfixMatch, pattern[first : loc+1], nil
+	}
+
 	return planpb.OpType_Invalid, "", fmt.Errorf(
 		"unsupported pattern: %s, "+
-			"only prefix pattern match like %s "+
-			"and equal match like %s(no wildcards) are supported",
-		pattern, "ab%", "ab")
+			"only prefix match like %s, postfix match like %s, "+
+			"infix match like %s and equal match like %s(no wildcards) are supported",
+		pattern, "ab%", "%ab", "%ab%", "ab")
 }
@@ -1,8 +1,11 @@
 package planparserv2
 
 import (
+	"strings"
 	"testing"
 
+	"github.com/golang/protobuf/proto"
+
 	"github.com/milvus-io/milvus/internal/proto/planpb"
 )
 
@@ -115,6 +118,24 @@ func Test_translatePatternMatch(t *testing.T) {
 			wantOperand: "",
 			wantErr:     false,
 		},
+		{
+			args:        args{pattern: "%postfix"},
+			wantOp:      planpb.OpType_PostfixMatch,
+			wantOperand: "postfix",
+			wantErr:     false,
+		},
+		{
+			args:        args{pattern: "%%infix%%"},
+			wantOp:      planpb.OpType_InfixMatch,
+			wantOperand: "infix",
+			wantErr:     false,
+		},
+		{
+			args:        args{pattern: "%not%infix%"},
+			wantOp:      planpb.OpType_Invalid,
+			wantOperand: "",
+			wantErr:     true,
+		},
 		{
 			args:        args{pattern: "prefix%suffix"},
 			wantOp:      planpb.OpType_Invalid,
@@ -138,3 +159,19 @@ func Test_translatePatternMatch(t *testing.T) {
 		})
 	}
 }
+
+// the descriptor embedded in planpb must be generated from plan.proto, an op
+// added to the generated maps alone is unknown to reflection
+func Test_patternMatchOpDescriptor(t *testing.T) {
+	ops := []planpb.OpType{
+		planpb.OpType_PrefixMatch,
+		planpb.OpType_PostfixMatch,
+		planpb.OpType_InfixMatch,
+	}
+	for _, op := range ops {
+		text := proto.CompactTextString(&planpb.UnaryRangeExpr{Op: op})
+		if !strings.Contains(text, op.String()) {
+			t.Errorf("text of %s op = %s, want its name", op, text)
+		}
+	}
+}
@@ -37,6 +37,7 @@ const (
 	OpType_Range        OpType = 10
 	OpType_In           OpType = 11
 	OpType_NotIn        OpType = 12
+	OpType_InfixMatch   OpType = 13
 )
 
 var OpType_name = map[int32]string{
@@ -53,6 +54,7 @@ var OpType_name = map[int32]string{
 	10: "Range",
 	11: "In",
 	12: "NotIn",
+	13: "InfixMatch",
 }
 
 var OpType_value = map[string]int32{
@@ -69,6 +71,7 @@ var OpType_value = map[string]int32{
 	"Range":        10,
 	"In":           11,
 	"NotIn":        12,
+	"InfixMatch":   13,
 }
 
 func (x OpType) String() string {
@@ -116,6 +119,31 @@ func (ArithOpType) EnumDescriptor() ([]byte, []int) {
 	return fileDescriptor_2d655ab2f7683c23, []int{1}
 }
 
+type FusionType int32
+
+const (
+	FusionType_WeightedSum FusionType = 0
+	FusionType_RRF         FusionType = 1
+)
+
+var FusionType_name = map[int32]string{
+	0: "WeightedSum",
+	1: "RRF",
+}
+
+var FusionType_value = map[string]int32{
+	"WeightedSum": 0,
+	"RRF":         1,
+}
+
+func (x FusionType) String() string {
+	return proto.EnumName(FusionType_name, int32(x))
+}
+
+func (FusionType) EnumDescriptor() ([]byte, []int) {
+	return fileDescriptor_2d655ab2f7683c23, []int{2}
+}
+
 // 0: invalid
 // 1: json_contains
 // 2: json_contains_all
@@ -1564,6 +1592,96 @@ func (m *VectorANNS) GetPlaceholderTag() string {
 	return ""
 }
 
+// search several vector fields with shared predicates in one segment pass,
+// the results of all fields are fused into a single score in segcore, RRF
+// ranks the results of a field among all the segments reduced together
+type HybridVectorANNS struct {
+	Anns                 []*VectorANNS `protobuf:"bytes,1,rep,name=anns,proto3" json:"anns,omitempty"`
+	Predicates           *Expr         `protobuf:"bytes,2,opt,name=predicates,proto3" json:"predicates,omitempty"`
+	FusionType           FusionType    `protobuf:"varint,3,opt,name=fusion_type,json=fusionType,proto3,enum=milvus.proto.plan.FusionType" json:"fusion_type,omitempty"`
+	Weights              []float32     `protobuf:"fixed32,4,rep,packed,name=weights,proto3" json:"weights,omitempty"`
+	RrfK                 int64         `protobuf:"varint,5,opt,name=rrf_k,json=rrfK,proto3" json:"rrf_k,omitempty"`
+	Topk                 int64         `protobuf:"varint,6,opt,name=topk,proto3" json:"topk,omitempty"`
+	RoundDecimal         int64         `protobuf:"varint,7,opt,name=round_decimal,json=roundDecimal,proto3" json:"round_decimal,omitempty"`
+	XXX_NoUnkeyedLiteral struct{}      `json:"-"`
+	XXX_unrecognized     []byte        `json:"-"`
+	XXX_sizecache        int32         `json:"-"`
+}
+
+func (m *HybridVectorANNS) Reset()         { *m = HybridVectorANNS{} }
+func (m *HybridVectorANNS) String() string { return proto.CompactTextString(m) }
+func (*HybridVectorANNS) ProtoMessage()    {}
+func (*HybridVectorANNS) Descriptor() ([]byte, []int) {
+	return fileDescriptor_2d655ab2f7683c23, []int{20}
+}
+
+func (m *HybridVectorANNS) XXX_Unmarshal(b []byte) error {
+	return xxx_messageInfo_HybridVectorANNS.Unmarshal(m, b)
+}
+func (m *HybridVectorANNS) XXX_Marshal(b []byte, deterministic bool) ([]byte, error) {
+	return xxx_messageInfo_HybridVectorANNS.Marshal(b, m, deterministic)
+}
+func (m *HybridVectorANNS) XXX_Merge(src proto.Message) {
+	xxx_messageInfo_HybridVectorANNS.Merge(m, src)
+}
+func (m *HybridVectorANNS) XXX_Size() int {
+	return xxx_messageInfo_HybridVectorANNS.Size(m)
+}
+func (m *HybridVectorANNS) XXX_DiscardUnknown() {
+	xxx_messageInfo_HybridVectorANNS.DiscardUnknown(m)
+}
+
+var xxx_messageInfo_HybridVectorANNS proto.InternalMessageInfo
+
+func (m *HybridVectorANNS) GetAnns() []*VectorANNS {
+	if m != nil {
+		return m.Anns
+	}
+	return nil
+}
+
+func (m *HybridVectorANNS) GetPredicates() *Expr {
+	if m != nil {
+		return m.Predicates
+	}
+	return nil
+}
+
+func (m *HybridVectorANNS) GetFusionType() FusionType {
+	if m != nil {
+		return m.FusionType
+	}
+	return FusionType_WeightedSum
+}
+
+func (m *HybridVectorANNS) GetWeights() []float32 {
+	if m != nil {
+		return m.Weights
+	}
+	return nil
+}
+
+func (m *HybridVectorANNS) GetRrfK() int64 {
+	if m != nil {
+		return m.RrfK
+	}
+	return 0
+}
+
+func (m *HybridVectorANNS) GetTopk() int64 {
+	if m != nil {
+		return m.Topk
+	}
+	return 0
+}
+
+func (m *HybridVectorANNS) GetRoundDecimal() int64 {
+	if m != nil {
+		return m.RoundDecimal
+	}
+	return 0
+}
+
 type QueryPlanNode struct {
 	Predicates           *Expr    `protobuf:"bytes,1,opt,name=predicates,proto3" json:"predicates,omitempty"`
 	IsCount              bool     `protobuf:"varint,2,opt,name=is_count,json=isCount,proto3" json:"is_count,omitempty"`
@@ -1577,7 +1695,7 @@ func (m *QueryPlanNode) Reset()         { *m = QueryPlanNode{} }
 func (m *QueryPlanNode) String() string { return proto.CompactTextString(m) }
 func (*QueryPlanNode) ProtoMessage()    {}
 func (*QueryPlanNode) Descriptor() ([]byte, []int) {
-	return fileDescriptor_2d655ab2f7683c23, []int{20}
+	return fileDescriptor_2d655ab2f7683c23, []int{21}
 }
 
 func (m *QueryPlanNode) XXX_Unmarshal(b []byte) error {
@@ -1624,6 +1742,7 @@ type PlanNode struct {
 	//	*PlanNode_VectorAnns
 	//	*PlanNode_Predicates
 	//	*PlanNode_Query
+	//	*PlanNode_HybridAnns
 	Node                 isPlanNode_Node `protobuf_oneof:"node"`
 	OutputFieldIds       []int64         `protobuf:"varint,3,rep,packed,name=output_field_ids,json=outputFieldIds,proto3" json:"output_field_ids,omitempty"`
 	XXX_NoUnkeyedLiteral struct{}        `json:"-"`
@@ -1635,7 +1754,7 @@ func (m *PlanNode) Reset()         { *m = PlanNode{} }
 func (m *PlanNode) String() string { return proto.CompactTextString(m) }
 func (*PlanNode) ProtoMessage()    {}
 func (*PlanNode) Descriptor() ([]byte, []int) {
-	return fileDescriptor_2d655ab2f7683c23, []int{21}
+	return fileDescriptor_2d655ab2f7683c23, []int{22}
 }
 
 func (m *PlanNode) XXX_Unmarshal(b []byte) error {
@@ -1672,12 +1791,18 @@ type PlanNode_Query struct {
 	Query *QueryPlanNode `protobuf:"bytes,4,opt,name=query,proto3,oneof"`
 }
 
+type PlanNode_HybridAnns struct {
+	HybridAnns *HybridVectorANNS `protobuf:"bytes,5,opt,name=hybrid_anns,json=hybridAnns,proto3,oneof"`
+}
+
 func (*PlanNode_VectorAnns) isPlanNode_Node() {}
 
 func (*PlanNode_Predicates) isPlanNode_Node() {}
 
 func (*PlanNode_Query) isPlanNode_Node() {}
 
+func (*PlanNode_HybridAnns) isPlanNode_Node() {}
+
 func (m *PlanNode) GetNode() isPlanNode_Node {
 	if m != nil {
 		return m.Node
@@ -1706,6 +1831,13 @@ func (m *PlanNode) GetQuery() *QueryPlanNode {
 	return nil
 }
 
+func (m *PlanNode) GetHybridAnns() *HybridVectorANNS {
+	if x, ok := m.GetNode().(*PlanNode_HybridAnns); ok {
+		return x.HybridAnns
+	}
+	return nil
+}
+
 func (m *PlanNode) GetOutputFieldIds() []int64 {
 	if m != nil {
 		return m.OutputFieldIds
@@ -1719,12 +1851,14 @@ func (*PlanNode) XXX_OneofWrappers() []interface{} {
 		(*PlanNode_VectorAnns)(nil),
 		(*PlanNode_Predicates)(nil),
 		(*PlanNode_Query)(nil),
+		(*PlanNode_HybridAnns)(nil),
 	}
 }
 
 func init() {
 	proto.RegisterEnum("milvus.proto.plan.OpType", OpType_name, OpType_value)
 	proto.RegisterEnum("milvus.proto.plan.ArithOpType", ArithOpType_name, ArithOpType_value)
+	proto.RegisterEnum("milvus.proto.plan.FusionType", FusionType_name, FusionType_value)
 	proto.RegisterEnum("milvus.proto.plan.JSONContainsExpr_JSONOp", JSONContainsExpr_JSONOp_name, JSONContainsExpr_JSONOp_value)
 	proto.RegisterEnum("milvus.proto.plan.UnaryExpr_UnaryOp", UnaryExpr_UnaryOp_name, UnaryExpr_UnaryOp_value)
 	proto.RegisterEnum("milvus.proto.plan.BinaryExpr_BinaryOp", BinaryExpr_BinaryOp_name, BinaryExpr_BinaryOp_value)
@@ -1748,6 +1882,7 @@ func init() {
 	proto.RegisterType((*AlwaysTrueExpr)(nil), "milvus.proto.plan.AlwaysTrueExpr")
 	proto.RegisterType((*Expr)(nil), "milvus.proto.plan.Expr")
 	proto.RegisterType((*VectorANNS)(nil), "milvus.proto.plan.VectorANNS")
+	proto.RegisterType((*HybridVectorANNS)(nil), "milvus.proto.plan.HybridVectorANNS")
 	proto.RegisterType((*QueryPlanNode)(nil), "milvus.proto.plan.QueryPlanNode")
 	proto.RegisterType((*PlanNode)(nil), "milvus.proto.plan.PlanNode")
 }
@@ -1755,116 +1890,124 @@ func init() {
 func init() { proto.RegisterFile("plan.proto", fileDescriptor_2d655ab2f7683c23) }
 
 var fileDescriptor_2d655ab2f7683c23 = []byte{
-	// 1762 bytes of a gzipped FileDescriptorProto
+	// 1901 bytes of a gzipped FileDescriptorProto
 	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xc4, 0x58, 0x4f, 0x93, 0xdb, 0x48,
-	0x15, 0xb7, 0x2c, 0x7b, 0x2c, 0x3d, 0x79, 0x3c, 0x8a, 0x8a, 0x2a, 0x26, 0x09, 0x9b, 0x19, 0xb4,
-	0x5b, 0xec, 0x10, 0xc8, 0xa4, 0x36, 0xbb, 0x9b, 0xb0, 0xd9, 0x5a, 0x18, 0xcf, 0x9f, 0x8d, 0xcd,
-	0x6e, 0x66, 0x06, 0xcd, 0x6c, 0x0e, 0x70, 0x50, 0xb5, 0xa5, 0x9e, 0x71, 0x13, 0xb9, 0xa5, 0x48,
-	0x2d, 0x27, 0xfe, 0x0a, 0xdc, 0xf8, 0x00, 0x9c, 0x38, 0x70, 0xe7, 0xc8, 0x05, 0xce, 0x14, 0x07,
-	0x8e, 0x1c, 0xa9, 0xe2, 0x13, 0x50, 0x7c, 0x01, 0xaa, 0x5f, 0x4b, 0x96, 0x3d, 0xd8, 0x19, 0x0f,
-	0xa4, 0x8a, 0x5b, 0xeb, 0xf5, 0x7b, 0xbf, 0x7e, 0xff, 0xfa, 0xbd, 0xd7, 0x02, 0x48, 0x22, 0xc2,
-	0x77, 0x93, 0x34, 0x16, 0xb1, 0x73, 0x6b, 0xc4, 0xa2, 0x71, 0x9e, 0xa9, 0xaf, 0x5d, 0xb9, 0x71,
-	0xa7, 0x9d, 0x05, 0x43, 0x3a, 0x22, 0x8a, 0xe4, 0xfe, 0x59, 0x83, 0xf6, 0x33, 0xca, 0x69, 0xca,
-	0x82, 0x17, 0x24, 0xca, 0xa9, 0x73, 0x17, 0x8c, 0x41, 0x1c, 0x47, 0xfe, 0x98, 0x44, 0x9b, 0xda,
-	0xb6, 0xb6, 0x63, 0xf4, 0x6a, 0x5e, 0x4b, 0x52, 0x5e, 0x90, 0xc8, 0x79, 0x0f, 0x4c, 0xc6, 0xc5,
-	0xe3, 0x4f, 0x70, 0xb7, 0xbe, 0xad, 0xed, 0xe8, 0xbd, 0x9a, 0x67, 0x20, 0xa9, 0xd8, 0xbe, 0x88,
-	0x62, 0x22, 0x70, 0x5b, 0xdf, 0xd6, 0x76, 0x34, 0xb9, 0x8d, 0x24, 0xb9, 0xbd, 0x05, 0x90, 0x89,
-	0x94, 0xf1, 0x4b, 0xdc, 0x6f, 0x6c, 0x6b, 0x3b, 0x66, 0xaf, 0xe6, 0x99, 0x8a, 0x26, 0x19, 0x9e,
-	0x80, 0x49, 0xd2, 0x94, 0x4c, 0x70, 0xbf, 0xb9, 0xad, 0xed, 0x58, 0x8f, 0x36, 0x77, 0xff, 0xc3,
-	0x82, 0xdd, 0xae, 0xe4, 0x91, 0xc8, 0xc8, 0xfc, 0x82, 0x44, 0xfb, 0x4d, 0xd0, 0xc7, 0x24, 0x72,
-	0x7f, 0x01, 0x4d, 0xdc, 0x73, 0x3e, 0x85, 0x26, 0xee, 0x6d, 0x6a, 0xdb, 0xfa, 0x8e, 0xf5, 0x68,
-	0x6b, 0x01, 0xc8, 0xac, 0xd1, 0x9e, 0xe2, 0x76, 0xee, 0x82, 0x99, 0x91, 0x11, 0xf5, 0xc5, 0x24,
-	0xa1, 0x68, 0x9e, 0xe1, 0x19, 0x92, 0x70, 0x3e, 0x49, 0xa8, 0xfb, 0x2b, 0x0d, 0xcc, 0x9f, 0xe5,
-	0x34, 0x9d, 0xf4, 0xf9, 0x45, 0xec, 0x38, 0xd0, 0x10, 0x71, 0xf2, 0x12, 0x5d, 0xa4, 0x7b, 0xb8,
-	0x76, 0xb6, 0xc0, 0x1a, 0x51, 0x91, 0xb2, 0x40, 0x01, 0x48, 0x07, 0x98, 0x1e, 0x28, 0x92, 0x84,
-	0x70, 0xde, 0x87, 0xf5, 0x8c, 0x92, 0x34, 0x18, 0xfa, 0x09, 0x49, 0xc9, 0x28, 0x53, 0x3e, 0xf0,
-	0xda, 0x8a, 0x78, 0x8a, 0x34, 0xc9, 0x94, 0xc6, 0x39, 0x0f, 0xfd, 0x90, 0x06, 0x6c, 0x54, 0x38,
-	0x42, 0xf7, 0xda, 0x48, 0x3c, 0x54, 0x34, 0xf7, 0x9f, 0x1a, 0xc0, 0x41, 0x1c, 0xe5, 0x23, 0x8e,
-	0xda, 0xdc, 0x06, 0xe3, 0x82, 0xd1, 0x28, 0xf4, 0x59, 0x58, 0x68, 0xd4, 0xc2, 0xef, 0x7e, 0xe8,
-	0x3c, 0x05, 0x33, 0x24, 0x82, 0x54, 0x36, 0x75, 0x1e, 0xbd, 0x37, 0xef, 0x8e, 0x22, 0x1f, 0x0e,
-	0x89, 0x20, 0x52, 0x4b, 0xcf, 0x08, 0x8b, 0x95, 0xf3, 0x01, 0x74, 0x58, 0xe6, 0x27, 0x29, 0x1b,
-	0x91, 0x74, 0xe2, 0xbf, 0xa4, 0x13, 0xb4, 0xc9, 0xf0, 0xda, 0x2c, 0x3b, 0x55, 0xc4, 0xaf, 0x28,
-	0x7a, 0x8d, 0x65, 0x3e, 0xc9, 0x45, 0xdc, 0x3f, 0x44, 0x8b, 0x0c, 0xcf, 0x60, 0x59, 0x17, 0xbf,
-	0xa5, 0x4f, 0x38, 0xcd, 0x04, 0x0d, 0xfd, 0x84, 0x88, 0xe1, 0x66, 0x73, 0x5b, 0x97, 0x3e, 0x51,
-	0xa4, 0x53, 0x22, 0x86, 0xce, 0x0e, 0xd8, 0xf2, 0x0c, 0x92, 0x0a, 0x26, 0x58, 0xcc, 0xf1, 0x94,
-	0x35, 0x04, 0xe9, 0xb0, 0xec, 0xb4, 0x24, 0x7f, 0x45, 0x27, 0xee, 0x4f, 0x4a, 0x93, 0x8f, 0xde,
-	0x24, 0xa9, 0xf3, 0x11, 0x34, 0x18, 0xbf, 0x88, 0xd1, 0x5c, 0xeb, 0xaa, 0x49, 0x18, 0xe1, 0xca,
-	0x3f, 0x1e, 0xb2, 0x4a, 0x80, 0xa3, 0x37, 0x2c, 0x13, 0xd9, 0x7f, 0x0b, 0xb0, 0x0f, 0x26, 0xe6,
-	0x0b, 0xca, 0x7f, 0x0a, 0xcd, 0xb1, 0xfc, 0x28, 0x00, 0xae, 0xcf, 0x31, 0xe4, 0x76, 0x7f, 0xaf,
-	0x41, 0xe7, 0x1b, 0x4e, 0xd2, 0x89, 0x47, 0xf8, 0xa5, 0x42, 0xfa, 0x31, 0x58, 0x01, 0x1e, 0xe5,
-	0xaf, 0xae, 0x10, 0x04, 0x55, 0xf4, 0xbf, 0x0f, 0xf5, 0x38, 0x29, 0x62, 0x7b, 0x7b, 0x81, 0xd8,
-	0x49, 0x82, 0x71, 0xad, 0xc7, 0x49, 0xa5, 0xb4, 0x7e, 0x23, 0xa5, 0x7f, 0x57, 0x87, 0x8d, 0x7d,
-	0xf6, 0x6e, 0xb5, 0xfe, 0x10, 0x36, 0xa2, 0xf8, 0x35, 0x4d, 0x7d, 0xc6, 0x83, 0x28, 0xcf, 0xd8,
-	0xb8, 0xbc, 0x72, 0x1d, 0x24, 0xf7, 0x4b, 0xaa, 0x64, 0xcc, 0x93, 0x64, 0x8e, 0x51, 0xa5, 0x61,
-	0x07, 0xc9, 0x15, 0xe3, 0x1e, 0x58, 0x0a, 0x51, 0x99, 0xd8, 0x58, 0xcd, 0x44, 0x40, 0x19, 0x55,
-	0xfc, 0xf6, 0xc0, 0x52, 0x47, 0x29, 0x84, 0xe6, 0x8a, 0x08, 0x28, 0x83, 0x6b, 0xf7, 0x2f, 0x1a,
-	0x58, 0x07, 0xf1, 0x28, 0x21, 0xa9, 0xf2, 0xd2, 0x33, 0xb0, 0x23, 0x7a, 0x21, 0xfc, 0x1b, 0xbb,
-	0xaa, 0x23, 0xc5, 0x66, 0xae, 0x78, 0x1f, 0x6e, 0xa5, 0xec, 0x72, 0x38, 0x8f, 0x54, 0x5f, 0x05,
-	0x69, 0x03, 0xe5, 0x0e, 0xae, 0xe6, 0x8b, 0xbe, 0x42, 0xbe, 0xb8, 0xbf, 0xd5, 0xc0, 0x38, 0xa7,
-	0xe9, 0xe8, 0x9d, 0x44, 0xfc, 0x09, 0xac, 0xa1, 0x5f, 0xb3, 0xcd, 0xfa, 0x6a, 0x65, 0xb9, 0x60,
-	0x77, 0xee, 0x81, 0xc5, 0x32, 0x9f, 0x71, 0x1f, 0x8b, 0x5a, 0x11, 0x7d, 0x93, 0x65, 0x7d, 0xfe,
-	0xa5, 0x24, 0xb8, 0x7f, 0xaa, 0x83, 0xfd, 0xd3, 0xb3, 0x93, 0xe3, 0x83, 0x98, 0x0b, 0xc2, 0x78,
-	0xf6, 0x4e, 0xb4, 0xfd, 0x1c, 0x0c, 0x1a, 0xd1, 0x11, 0xe5, 0x62, 0x65, 0x7d, 0xa7, 0x02, 0xce,
-	0xd3, 0x19, 0x17, 0xdf, 0x5f, 0x20, 0x76, 0x55, 0x5b, 0x24, 0x9c, 0x24, 0x78, 0x47, 0x7f, 0x08,
-	0x4e, 0x89, 0xe3, 0x57, 0xed, 0x48, 0x15, 0x56, 0xbb, 0xdc, 0x39, 0x2b, 0xdb, 0xd2, 0x11, 0xac,
-	0x29, 0x59, 0xc7, 0x82, 0x56, 0x9f, 0x8f, 0x49, 0xc4, 0x42, 0xbb, 0xe6, 0xb4, 0xc1, 0x28, 0xf1,
-	0x6d, 0xcd, 0xd9, 0x90, 0x49, 0xa9, 0xbe, 0xba, 0x51, 0x64, 0xd7, 0xe7, 0x08, 0x7c, 0x62, 0xeb,
-	0xee, 0xaf, 0x35, 0x30, 0xb1, 0x2c, 0xa1, 0xef, 0x3e, 0x41, 0xf5, 0x35, 0x54, 0xff, 0x83, 0x05,
-	0xea, 0x4f, 0x39, 0xd5, 0xaa, 0x50, 0xfc, 0x01, 0x34, 0x83, 0x21, 0x8b, 0xc2, 0x22, 0x2d, 0xbf,
-	0xbd, 0x40, 0x50, 0xca, 0x78, 0x8a, 0xcb, 0xdd, 0x82, 0x56, 0x21, 0x3d, 0xaf, 0x7a, 0x0b, 0xf4,
-	0xe3, 0x58, 0xd8, 0x9a, 0xfb, 0x37, 0x0d, 0x40, 0x55, 0x1d, 0x54, 0xea, 0xf1, 0x8c, 0x52, 0xdf,
-	0x5b, 0x80, 0x5d, 0xb1, 0x16, 0xcb, 0x42, 0xad, 0x1f, 0x40, 0x43, 0xde, 0xa5, 0xeb, 0xb4, 0x42,
-	0x26, 0x69, 0x03, 0x5e, 0x97, 0xa2, 0x40, 0x2e, 0xb7, 0x01, 0xb9, 0xdc, 0xc7, 0x60, 0x94, 0x67,
-	0xcd, 0x1b, 0xd1, 0x01, 0xf8, 0x3a, 0xbe, 0x64, 0x01, 0x89, 0xba, 0x3c, 0xb4, 0x35, 0x67, 0x1d,
-	0xcc, 0xe2, 0xfb, 0x24, 0xb5, 0xeb, 0xee, 0x5f, 0x35, 0x58, 0x57, 0x82, 0xdd, 0x94, 0x89, 0xe1,
-	0x49, 0xf2, 0x3f, 0xa7, 0xeb, 0x67, 0x60, 0x10, 0x09, 0xe5, 0x4f, 0x5b, 0xc1, 0xbd, 0x85, 0xa3,
-	0x13, 0x9e, 0x86, 0xf7, 0xbb, 0x45, 0x8a, 0xa3, 0x0f, 0x61, 0x5d, 0x95, 0x96, 0x38, 0xa1, 0x29,
-	0xe1, 0xe1, 0xaa, 0xcd, 0xa1, 0x8d, 0x52, 0x27, 0x4a, 0xc8, 0xfd, 0x8d, 0x56, 0xf6, 0x08, 0x3c,
-	0x04, 0x43, 0x56, 0xba, 0x5e, 0xbb, 0x91, 0xeb, 0xeb, 0xab, 0xb8, 0xde, 0xd9, 0x9d, 0xb9, 0x62,
-	0xd7, 0x99, 0x2a, 0x4b, 0xd9, 0x1f, 0xeb, 0x70, 0x67, 0xce, 0xe5, 0x47, 0x63, 0x12, 0xbd, 0xbb,
-	0x76, 0xf6, 0xff, 0xf6, 0x7f, 0x51, 0xd5, 0x1b, 0x37, 0x9a, 0x02, 0x9a, 0x37, 0x9a, 0x02, 0x6c,
-	0xe8, 0x74, 0xa3, 0xd7, 0x64, 0x92, 0x9d, 0xa7, 0x6a, 0x06, 0x72, 0xff, 0xde, 0x82, 0x06, 0x7a,
-	0xef, 0x29, 0x98, 0x82, 0xa6, 0x23, 0x9f, 0xbe, 0x49, 0xd2, 0xc2, 0x77, 0x77, 0x17, 0xa0, 0x96,
-	0xad, 0x44, 0x0e, 0xef, 0xa2, 0x6c, 0x2b, 0x5f, 0x00, 0xe4, 0x32, 0x2c, 0x4a, 0x58, 0x05, 0xff,
-	0x3b, 0x6f, 0x2b, 0x3a, 0xf2, 0xd1, 0x90, 0x4f, 0xcb, 0xc2, 0x1e, 0x58, 0x03, 0x56, 0xc9, 0xeb,
-	0x4b, 0x03, 0x57, 0xd5, 0x87, 0x5e, 0xcd, 0x83, 0x41, 0x55, 0x58, 0x0e, 0xa0, 0x1d, 0xa8, 0x96,
-	0xad, 0x20, 0xd4, 0xe0, 0x70, 0x6f, 0x61, 0xec, 0xa7, 0x9d, 0xbd, 0x57, 0xf3, 0xac, 0x60, 0xa6,
-	0xd1, 0x3f, 0x07, 0x5b, 0x59, 0x91, 0xca, 0x94, 0x52, 0x40, 0xca, 0xbd, 0xdf, 0x5d, 0x66, 0xcb,
-	0x34, 0xf9, 0x7a, 0x35, 0xaf, 0x93, 0xcf, 0x4f, 0x57, 0xa7, 0x70, 0xab, 0xb0, 0x6a, 0x06, 0x6f,
-	0x0d, 0xf1, 0xdc, 0xa5, 0xb6, 0xcd, 0x02, 0x6e, 0x0c, 0xae, 0xcc, 0x6b, 0x02, 0xb6, 0x0a, 0xc4,
-	0x32, 0x4f, 0x7d, 0x3a, 0x26, 0xd1, 0x2c, 0x7e, 0x0b, 0xf1, 0x1f, 0x2c, 0xc5, 0x5f, 0x74, 0x71,
-	0x7a, 0x35, 0xef, 0xce, 0x60, 0xf9, 0xb5, 0xaa, 0xec, 0x50, 0xa7, 0xe2, 0x39, 0xc6, 0x35, 0x76,
-	0x4c, 0x0b, 0x48, 0x65, 0x47, 0x55, 0x53, 0xbe, 0x00, 0xc0, 0x74, 0x54, 0x50, 0xe6, 0xd2, 0x74,
-	0x99, 0x4e, 0xea, 0x32, 0x5d, 0xc6, 0xd3, 0xb1, 0x7d, 0x6f, 0x7a, 0xcf, 0x51, 0x1e, 0xae, 0xb9,
-	0xe7, 0x65, 0xba, 0x04, 0xd5, 0xcb, 0x63, 0x0f, 0x2c, 0x8a, 0xcf, 0x08, 0x85, 0x60, 0x2d, 0x45,
-	0xa8, 0x1e, 0x1b, 0x12, 0x81, 0x56, 0x4f, 0x8f, 0xe7, 0x60, 0x13, 0xbc, 0x48, 0xbe, 0x48, 0x4b,
-	0x43, 0xda, 0x4b, 0x73, 0x65, 0xfe, 0xce, 0xc9, 0x5c, 0x21, 0x73, 0x14, 0xe7, 0x0c, 0x9c, 0x5f,
-	0x66, 0x31, 0xf7, 0x83, 0xa2, 0xa3, 0x2b, 0xc0, 0x75, 0x04, 0x7c, 0x7f, 0x85, 0xe1, 0xa3, 0x57,
-	0xf3, 0x6c, 0x09, 0x30, 0x4b, 0xdb, 0x5f, 0x83, 0x86, 0x84, 0x71, 0xff, 0xa1, 0x01, 0xbc, 0xa0,
-	0x81, 0x88, 0xd3, 0xee, 0xf1, 0xf1, 0x59, 0xf1, 0xd8, 0x53, 0x31, 0x51, 0xff, 0x07, 0xe4, 0x63,
-	0x4f, 0x85, 0x6d, 0xee, 0x19, 0x5a, 0x9f, 0x7f, 0x86, 0x3e, 0x01, 0x48, 0x52, 0x1a, 0xb2, 0x80,
-	0x08, 0x9a, 0x5d, 0xd7, 0x5c, 0x67, 0x58, 0x9d, 0xcf, 0x01, 0x5e, 0xc9, 0x57, 0xb7, 0x2a, 0xcb,
-	0x8d, 0xa5, 0xe1, 0x9e, 0x3e, 0xcd, 0x3d, 0xf3, 0xd5, 0xf4, 0x95, 0xfe, 0x21, 0x6c, 0x24, 0x11,
-	0x09, 0xe8, 0x30, 0x8e, 0x42, 0x9a, 0xfa, 0x82, 0x5c, 0xe2, 0x9d, 0x34, 0xbd, 0xce, 0x0c, 0xf9,
-	0x9c, 0x5c, 0xba, 0x13, 0x58, 0x47, 0x80, 0xd3, 0x88, 0xf0, 0xe3, 0x38, 0xa4, 0x57, 0xf4, 0xd5,
-	0x56, 0xd7, 0xf7, 0x36, 0x18, 0x2c, 0xf3, 0x83, 0x38, 0xe7, 0xa2, 0x78, 0xcf, 0xb4, 0x58, 0x76,
-	0x20, 0x3f, 0x9d, 0x6f, 0x41, 0x33, 0x62, 0x23, 0xa6, 0x66, 0x0b, 0xdd, 0x53, 0x1f, 0xee, 0xbf,
-	0x34, 0x30, 0xa6, 0xc7, 0xee, 0x81, 0x35, 0x46, 0x67, 0xfb, 0x84, 0xf3, 0xec, 0x2d, 0x5d, 0xa8,
-	0x0a, 0x89, 0xcc, 0x2d, 0x25, 0xd3, 0xe5, 0x3c, 0x73, 0x3e, 0x9b, 0x53, 0xfc, 0xed, 0xad, 0x54,
-	0x8a, 0xce, 0xa8, 0xfe, 0x23, 0x68, 0xa2, 0xeb, 0x0a, 0x2f, 0x6f, 0x2f, 0xf3, 0x72, 0xa9, 0x6d,
-	0xaf, 0xe6, 0x29, 0x01, 0xf9, 0x88, 0x8f, 0x73, 0x91, 0xe4, 0xc2, 0x2f, 0xe3, 0x2f, 0x63, 0xac,
-	0xef, 0xe8, 0x5e, 0x47, 0xd1, 0xbf, 0x54, 0x69, 0x90, 0xc9, 0xb4, 0xe2, 0x71, 0x48, 0xef, 0xff,
-	0x41, 0x83, 0x35, 0xd5, 0x91, 0xe6, 0xe7, 0xa6, 0x0d, 0xb0, 0x9e, 0xa5, 0x94, 0x08, 0x9a, 0x9e,
-	0x0f, 0x09, 0xb7, 0x35, 0xc7, 0x86, 0x76, 0x41, 0x38, 0x7a, 0x95, 0x13, 0x39, 0xbb, 0xb6, 0xc1,
-	0xf8, 0x9a, 0x66, 0x19, 0xee, 0xeb, 0x38, 0x58, 0xd1, 0x2c, 0x53, 0x9b, 0x0d, 0xc7, 0x84, 0xa6,
-	0x5a, 0x36, 0x25, 0xdf, 0x71, 0x2c, 0xd4, 0xd7, 0x9a, 0x04, 0x3e, 0x4d, 0xe9, 0x05, 0x7b, 0xf3,
-	0x9c, 0x88, 0x60, 0x68, 0xb7, 0x24, 0xf0, 0x69, 0x9c, 0x89, 0x29, 0xc5, 0x90, 0xb2, 0x6a, 0x69,
-	0xca, 0x25, 0xd6, 0x30, 0x1b, 0x9c, 0x35, 0xa8, 0xf7, 0xb9, 0x6d, 0x49, 0xd2, 0x71, 0x2c, 0xfa,
-	0xdc, 0x6e, 0xdf, 0x7f, 0x06, 0xd6, 0x4c, 0x23, 0x97, 0x06, 0x7c, 0xc3, 0x5f, 0xf2, 0xf8, 0x35,
-	0x57, 0xd3, 0x6b, 0x37, 0x94, 0x13, 0x5f, 0x0b, 0xf4, 0xb3, 0x7c, 0x60, 0xd7, 0xe5, 0xe2, 0x79,
-	0x1e, 0xd9, 0xba, 0x5c, 0x1c, 0xb2, 0xb1, 0xdd, 0x40, 0x4a, 0x1c, 0xda, 0xcd, 0xfd, 0x8f, 0x7f,
-	0xfe, 0xd1, 0x25, 0x13, 0xc3, 0x7c, 0xb0, 0x1b, 0xc4, 0xa3, 0x87, 0xca, 0xdd, 0x0f, 0x58, 0x5c,
-	0xac, 0x1e, 0x32, 0x2e, 0x68, 0xca, 0x49, 0xf4, 0x10, 0x23, 0xf0, 0x50, 0x46, 0x20, 0x19, 0x0c,
-	0xd6, 0xf0, 0xeb, 0xe3, 0x7f, 0x07, 0x00, 0x00, 0xff, 0xff, 0x48, 0x4f, 0x55, 0x7b, 0xe8, 0x13,
-	0x00, 0x00,
+	0x15, 0xb7, 0x2c, 0xff, 0x91, 0x9f, 0x3c, 0x1e, 0x45, 0x50, 0xc5, 0x24, 0x61, 0x33, 0x83, 0x76,
+	0x6b, 0xd7, 0x04, 0x32, 0xa9, 0x64, 0x77, 0x13, 0x36, 0x5b, 0xbb, 0xcc, 0xff, 0xd8, 0x64, 0x33,
+	0x33, 0x68, 0x66, 0x43, 0x15, 0x1c, 0x54, 0x6d, 0xa9, 0x3d, 0x6e, 0x22, 0x4b, 0x4a, 0xab, 0xe5,
+	0xc4, 0x5f, 0x81, 0x1b, 0x1f, 0x80, 0x13, 0x55, 0x70, 0xe7, 0xca, 0x01, 0xce, 0x5b, 0x1c, 0x38,
+	0x72, 0xa4, 0x8a, 0x4f, 0xc0, 0x37, 0xa0, 0xfa, 0xb5, 0xe4, 0x3f, 0x13, 0x9b, 0xf1, 0x40, 0xaa,
+	0xf6, 0xd6, 0xfd, 0xfa, 0xbd, 0x5f, 0xbf, 0xbf, 0xdd, 0xaf, 0x1b, 0x20, 0x09, 0x49, 0xb4, 0x9d,
+	0xf0, 0x58, 0xc4, 0xf6, 0x8d, 0x21, 0x0b, 0x47, 0x59, 0xaa, 0x66, 0xdb, 0x72, 0xe1, 0x56, 0x33,
+	0xf5, 0x07, 0x74, 0x48, 0x14, 0xc9, 0xf9, 0x46, 0x83, 0xe6, 0x53, 0x1a, 0x51, 0xce, 0xfc, 0x17,
+	0x24, 0xcc, 0xa8, 0x7d, 0x1b, 0x8c, 0x5e, 0x1c, 0x87, 0xde, 0x88, 0x84, 0x1b, 0xda, 0x96, 0xd6,
+	0x36, 0x3a, 0x25, 0xb7, 0x2e, 0x29, 0x2f, 0x48, 0x68, 0xbf, 0x07, 0x0d, 0x16, 0x89, 0x47, 0x9f,
+	0xe0, 0x6a, 0x79, 0x4b, 0x6b, 0xeb, 0x9d, 0x92, 0x6b, 0x20, 0x29, 0x5f, 0xee, 0x87, 0x31, 0x11,
+	0xb8, 0xac, 0x6f, 0x69, 0x6d, 0x4d, 0x2e, 0x23, 0x49, 0x2e, 0x6f, 0x02, 0xa4, 0x82, 0xb3, 0xe8,
+	0x02, 0xd7, 0x2b, 0x5b, 0x5a, 0xbb, 0xd1, 0x29, 0xb9, 0x0d, 0x45, 0x93, 0x0c, 0x8f, 0xa1, 0x41,
+	0x38, 0x27, 0x63, 0x5c, 0xaf, 0x6e, 0x69, 0x6d, 0xf3, 0xe1, 0xc6, 0xf6, 0x5b, 0x16, 0x6c, 0xef,
+	0x4a, 0x1e, 0x89, 0x8c, 0xcc, 0x2f, 0x48, 0xb8, 0x57, 0x05, 0x7d, 0x44, 0x42, 0xe7, 0x57, 0x50,
+	0xc5, 0x35, 0xfb, 0x53, 0xa8, 0xe2, 0xda, 0x86, 0xb6, 0xa5, 0xb7, 0xcd, 0x87, 0x9b, 0x0b, 0x40,
+	0x66, 0x8d, 0x76, 0x15, 0xb7, 0x7d, 0x1b, 0x1a, 0x29, 0x19, 0x52, 0x4f, 0x8c, 0x13, 0x8a, 0xe6,
+	0x19, 0xae, 0x21, 0x09, 0xe7, 0xe3, 0x84, 0x3a, 0xbf, 0xd1, 0xa0, 0xf1, 0xf3, 0x8c, 0xf2, 0x71,
+	0x37, 0xea, 0xc7, 0xb6, 0x0d, 0x15, 0x11, 0x27, 0x2f, 0xd1, 0x45, 0xba, 0x8b, 0x63, 0x7b, 0x13,
+	0xcc, 0x21, 0x15, 0x9c, 0xf9, 0x0a, 0x40, 0x3a, 0xa0, 0xe1, 0x82, 0x22, 0x49, 0x08, 0xfb, 0x7d,
+	0x58, 0x4b, 0x29, 0xe1, 0xfe, 0xc0, 0x4b, 0x08, 0x27, 0xc3, 0x54, 0xf9, 0xc0, 0x6d, 0x2a, 0xe2,
+	0x29, 0xd2, 0x24, 0x13, 0x8f, 0xb3, 0x28, 0xf0, 0x02, 0xea, 0xb3, 0x61, 0xee, 0x08, 0xdd, 0x6d,
+	0x22, 0xf1, 0x40, 0xd1, 0x9c, 0x7f, 0x6b, 0x00, 0xfb, 0x71, 0x98, 0x0d, 0x23, 0xd4, 0xe6, 0x26,
+	0x18, 0x7d, 0x46, 0xc3, 0xc0, 0x63, 0x41, 0xae, 0x51, 0x1d, 0xe7, 0xdd, 0xc0, 0x7e, 0x02, 0x8d,
+	0x80, 0x08, 0x32, 0xb5, 0xa9, 0xf5, 0xf0, 0xbd, 0x79, 0x77, 0xe4, 0xf9, 0x70, 0x40, 0x04, 0x91,
+	0x5a, 0xba, 0x46, 0x90, 0x8f, 0xec, 0x0f, 0xa0, 0xc5, 0x52, 0x2f, 0xe1, 0x6c, 0x48, 0xf8, 0xd8,
+	0x7b, 0x49, 0xc7, 0x68, 0x93, 0xe1, 0x36, 0x59, 0x7a, 0xaa, 0x88, 0xcf, 0x28, 0x7a, 0x8d, 0xa5,
+	0x1e, 0xc9, 0x44, 0xdc, 0x3d, 0x40, 0x8b, 0x0c, 0xd7, 0x60, 0xe9, 0x2e, 0xce, 0xa5, 0x4f, 0x22,
+	0x9a, 0x0a, 0x1a, 0x78, 0x09, 0x11, 0x83, 0x8d, 0xea, 0x96, 0x2e, 0x7d, 0xa2, 0x48, 0xa7, 0x44,
+	0x0c, 0xec, 0x36, 0x58, 0x72, 0x0f, 0xc2, 0x05, 0x13, 0x2c, 0x8e, 0x70, 0x97, 0x1a, 0x82, 0xb4,
+	0x58, 0x7a, 0x5a, 0x90, 0x9f, 0xd1, 0xb1, 0xf3, 0xd3, 0xc2, 0xe4, 0xc3, 0x37, 0x09, 0xb7, 0x1f,
+	0x40, 0x85, 0x45, 0xfd, 0x18, 0xcd, 0x35, 0x2f, 0x9b, 0x84, 0x11, 0x9e, 0xfa, 0xc7, 0x45, 0x56,
+	0x09, 0x70, 0xf8, 0x86, 0xa5, 0x22, 0xfd, 0x5f, 0x01, 0xf6, 0xa0, 0x81, 0xf9, 0x82, 0xf2, 0x9f,
+	0x42, 0x75, 0x24, 0x27, 0x39, 0xc0, 0xd5, 0x39, 0x86, 0xdc, 0xce, 0x9f, 0x34, 0x68, 0x7d, 0x1d,
+	0x11, 0x3e, 0x76, 0x49, 0x74, 0xa1, 0x90, 0xbe, 0x04, 0xd3, 0xc7, 0xad, 0xbc, 0xd5, 0x15, 0x02,
+	0x7f, 0x1a, 0xfd, 0x1f, 0x42, 0x39, 0x4e, 0xf2, 0xd8, 0xde, 0x5c, 0x20, 0x76, 0x92, 0x60, 0x5c,
+	0xcb, 0x71, 0x32, 0x55, 0x5a, 0xbf, 0x96, 0xd2, 0x7f, 0x2c, 0xc3, 0xfa, 0x1e, 0x7b, 0xb7, 0x5a,
+	0x7f, 0x04, 0xeb, 0x61, 0xfc, 0x9a, 0x72, 0x8f, 0x45, 0x7e, 0x98, 0xa5, 0x6c, 0x54, 0x94, 0x5c,
+	0x0b, 0xc9, 0xdd, 0x82, 0x2a, 0x19, 0xb3, 0x24, 0x99, 0x63, 0x54, 0x69, 0xd8, 0x42, 0xf2, 0x94,
+	0x71, 0x07, 0x4c, 0x85, 0xa8, 0x4c, 0xac, 0xac, 0x66, 0x22, 0xa0, 0x8c, 0x3a, 0xfc, 0x76, 0xc0,
+	0x54, 0x5b, 0x29, 0x84, 0xea, 0x8a, 0x08, 0x28, 0x83, 0x63, 0xe7, 0x6f, 0x1a, 0x98, 0xfb, 0xf1,
+	0x30, 0x21, 0x5c, 0x79, 0xe9, 0x29, 0x58, 0x21, 0xed, 0x0b, 0xef, 0xda, 0xae, 0x6a, 0x49, 0xb1,
+	0x99, 0x12, 0xef, 0xc2, 0x0d, 0xce, 0x2e, 0x06, 0xf3, 0x48, 0xe5, 0x55, 0x90, 0xd6, 0x51, 0x6e,
+	0xff, 0x72, 0xbe, 0xe8, 0x2b, 0xe4, 0x8b, 0xf3, 0x7b, 0x0d, 0x8c, 0x73, 0xca, 0x87, 0xef, 0x24,
+	0xe2, 0x8f, 0xa1, 0x86, 0x7e, 0x4d, 0x37, 0xca, 0xab, 0x1d, 0xcb, 0x39, 0xbb, 0x7d, 0x07, 0x4c,
+	0x96, 0x7a, 0x2c, 0xf2, 0xf0, 0x50, 0xcb, 0xa3, 0xdf, 0x60, 0x69, 0x37, 0x3a, 0x92, 0x04, 0xe7,
+	0xaf, 0x65, 0xb0, 0x7e, 0x76, 0x76, 0x72, 0xbc, 0x1f, 0x47, 0x82, 0xb0, 0x28, 0x7d, 0x27, 0xda,
+	0x7e, 0x0e, 0x06, 0x0d, 0xe9, 0x90, 0x46, 0x62, 0x65, 0x7d, 0x27, 0x02, 0xf6, 0x93, 0x19, 0x17,
+	0xdf, 0x5d, 0x20, 0x76, 0x59, 0x5b, 0x24, 0x9c, 0x24, 0x58, 0xa3, 0x3f, 0x06, 0xbb, 0xc0, 0xf1,
+	0xa6, 0xd7, 0x91, 0x3a, 0x58, 0xad, 0x62, 0xe5, 0xac, 0xb8, 0x96, 0x0e, 0xa1, 0xa6, 0x64, 0x6d,
+	0x13, 0xea, 0xdd, 0x68, 0x44, 0x42, 0x16, 0x58, 0x25, 0xbb, 0x09, 0x46, 0x81, 0x6f, 0x69, 0xf6,
+	0xba, 0x4c, 0x4a, 0x35, 0xdb, 0x0d, 0x43, 0xab, 0x3c, 0x47, 0x88, 0xc6, 0x96, 0xee, 0xfc, 0x56,
+	0x83, 0x06, 0x1e, 0x4b, 0xe8, 0xbb, 0x4f, 0x50, 0x7d, 0x0d, 0xd5, 0xff, 0x60, 0x81, 0xfa, 0x13,
+	0x4e, 0x35, 0xca, 0x15, 0xbf, 0x07, 0x55, 0x7f, 0xc0, 0xc2, 0x20, 0x4f, 0xcb, 0xef, 0x2d, 0x10,
+	0x94, 0x32, 0xae, 0xe2, 0x72, 0x36, 0xa1, 0x9e, 0x4b, 0xcf, 0xab, 0x5e, 0x07, 0xfd, 0x38, 0x16,
+	0x96, 0xe6, 0xfc, 0x43, 0x03, 0x50, 0xa7, 0x0e, 0x2a, 0xf5, 0x68, 0x46, 0xa9, 0x0f, 0x17, 0x60,
+	0x4f, 0x59, 0xf3, 0x61, 0xae, 0xd6, 0x8f, 0xa0, 0x22, 0x6b, 0xe9, 0x2a, 0xad, 0x90, 0x49, 0xda,
+	0x80, 0xe5, 0x92, 0x1f, 0x90, 0xcb, 0x6d, 0x40, 0x2e, 0xe7, 0x11, 0x18, 0xc5, 0x5e, 0xf3, 0x46,
+	0xb4, 0x00, 0xbe, 0x8a, 0x2f, 0x98, 0x4f, 0xc2, 0xdd, 0x28, 0xb0, 0x34, 0x7b, 0x0d, 0x1a, 0xf9,
+	0xfc, 0x84, 0x5b, 0x65, 0xe7, 0xef, 0x1a, 0xac, 0x29, 0xc1, 0x5d, 0xce, 0xc4, 0xe0, 0x24, 0xf9,
+	0xbf, 0xd3, 0xf5, 0x33, 0x30, 0x88, 0x84, 0xf2, 0x26, 0x57, 0xc1, 0x9d, 0x85, 0xad, 0x13, 0xee,
+	0x86, 0xf5, 0x5d, 0x27, 0xf9, 0xd6, 0x07, 0xb0, 0xa6, 0x8e, 0x96, 0x38, 0xa1, 0x9c, 0x44, 0xc1,
+	0xaa, 0x97, 0x43, 0x13, 0xa5, 0x4e, 0x94, 0x90, 0xf3, 0x3b, 0xad, 0xb8, 0x23, 0x70, 0x13, 0x0c,
+	0x59, 0xe1, 0x7a, 0xed, 0x5a, 0xae, 0x2f, 0xaf, 0xe2, 0x7a, 0x7b, 0x7b, 0xa6, 0xc4, 0xae, 0x32,
+	0x55, 0x1e, 0x65, 0x7f, 0x29, 0xc3, 0xad, 0x39, 0x97, 0x1f, 0x8e, 0x48, 0xf8, 0xee, 0xae, 0xb3,
+	0x6f, 0xdb, 0xff, 0xf9, 0xa9, 0x5e, 0xb9, 0x56, 0x17, 0x50, 0xbd, 0x56, 0x17, 0x60, 0x41, 0x6b,
+	0x37, 0x7c, 0x4d, 0xc6, 0xe9, 0x39, 0x57, 0x3d, 0x90, 0xf3, 0xcf, 0x3a, 0x54, 0xd0, 0x7b, 0x4f,
+	0xa0, 0x21, 0x28, 0x1f, 0x7a, 0xf4, 0x4d, 0xc2, 0x73, 0xdf, 0xdd, 0x5e, 0x80, 0x5a, 0x5c, 0x25,
+	0xb2, 0x79, 0x17, 0xc5, 0xb5, 0xf2, 0x05, 0x40, 0x26, 0xc3, 0xa2, 0x84, 0x55, 0xf0, 0xbf, 0xff,
+	0xdf, 0x0e, 0x1d, 0xf9, 0x68, 0xc8, 0x26, 0xc7, 0xc2, 0x0e, 0x98, 0x3d, 0x36, 0x95, 0xd7, 0x97,
+	0x06, 0x6e, 0x7a, 0x3e, 0x74, 0x4a, 0x2e, 0xf4, 0xa6, 0x07, 0xcb, 0x3e, 0x34, 0x7d, 0x75, 0x65,
+	0x2b, 0x08, 0xd5, 0x38, 0xdc, 0x59, 0x18, 0xfb, 0xc9, 0xcd, 0xde, 0x29, 0xb9, 0xa6, 0x3f, 0x73,
+	0xd1, 0x3f, 0x07, 0x4b, 0x59, 0xc1, 0x65, 0x4a, 0x29, 0x20, 0xe5, 0xde, 0x1f, 0x2c, 0xb3, 0x65,
+	0x92, 0x7c, 0x9d, 0x92, 0xdb, 0xca, 0xe6, 0xbb, 0xab, 0x53, 0xb8, 0x91, 0x5b, 0x35, 0x83, 0x57,
+	0x43, 0x3c, 0x67, 0xa9, 0x6d, 0xb3, 0x80, 0xeb, 0xbd, 0x4b, 0xfd, 0x9a, 0x80, 0xcd, 0x1c, 0xb1,
+	0xc8, 0x53, 0x8f, 0x8e, 0x48, 0x38, 0x8b, 0x5f, 0x47, 0xfc, 0x7b, 0x4b, 0xf1, 0x17, 0x15, 0x4e,
+	0xa7, 0xe4, 0xde, 0xea, 0x2d, 0x2f, 0xab, 0xa9, 0x1d, 0x6a, 0x57, 0xdc, 0xc7, 0xb8, 0xc2, 0x8e,
+	0xc9, 0x01, 0x32, 0xb5, 0x63, 0x7a, 0xa6, 0x7c, 0x01, 0x80, 0xe9, 0xa8, 0xa0, 0x1a, 0x4b, 0xd3,
+	0x65, 0xd2, 0xa9, 0xcb, 0x74, 0x19, 0x4d, 0xda, 0xf6, 0x9d, 0x49, 0x9d, 0xa3, 0x3c, 0x5c, 0x51,
+	0xe7, 0x45, 0xba, 0xf8, 0xd3, 0x97, 0xc7, 0x0e, 0x98, 0x14, 0x9f, 0x11, 0x0a, 0xc1, 0x5c, 0x8a,
+	0x30, 0x7d, 0x6c, 0x48, 0x04, 0x3a, 0x7d, 0x7a, 0x3c, 0x07, 0x8b, 0x60, 0x21, 0x79, 0x82, 0x17,
+	0x86, 0x34, 0x97, 0xe6, 0xca, 0x7c, 0xcd, 0xc9, 0x5c, 0x21, 0x73, 0x14, 0xfb, 0x0c, 0xec, 0x5f,
+	0xa7, 0x71, 0xe4, 0xf9, 0xf9, 0x8d, 0xae, 0x00, 0xd7, 0x10, 0xf0, 0xfd, 0x15, 0x9a, 0x8f, 0x4e,
+	0xc9, 0xb5, 0x24, 0xc0, 0x2c, 0x6d, 0xaf, 0x06, 0x15, 0x09, 0xe3, 0xfc, 0x4b, 0x03, 0x78, 0x41,
+	0x7d, 0x11, 0xf3, 0xdd, 0xe3, 0xe3, 0xb3, 0xfc, 0xb1, 0xa7, 0x62, 0xa2, 0xfe, 0x07, 0xe4, 0x63,
+	0x4f, 0x85, 0x6d, 0xee, 0x19, 0x5a, 0x9e, 0x7f, 0x86, 0x3e, 0x06, 0x48, 0x38, 0x0d, 0x98, 0x4f,
+	0x04, 0x4d, 0xaf, 0xba, 0x5c, 0x67, 0x58, 0xed, 0xcf, 0x01, 0x5e, 0xc9, 0x57, 0xb7, 0x3a, 0x96,
+	0x2b, 0x4b, 0xc3, 0x3d, 0x79, 0x9a, 0xbb, 0x8d, 0x57, 0x93, 0x57, 0xfa, 0x47, 0xb0, 0x9e, 0x84,
+	0xc4, 0xa7, 0x83, 0x38, 0x0c, 0x28, 0xf7, 0x04, 0xb9, 0xc0, 0x9a, 0x6c, 0xb8, 0xad, 0x19, 0xf2,
+	0x39, 0xb9, 0x70, 0xfe, 0x50, 0x06, 0xab, 0x33, 0xee, 0x71, 0x16, 0xcc, 0xd8, 0xfa, 0x00, 0x2a,
+	0x24, 0x8a, 0xd2, 0xfc, 0x13, 0x61, 0x51, 0x84, 0xa7, 0xcc, 0x2e, 0xb2, 0x5e, 0x32, 0xb3, 0xbc,
+	0xba, 0x99, 0x5f, 0x82, 0xd9, 0xcf, 0x52, 0xf9, 0x00, 0x9e, 0xfc, 0x1d, 0xb4, 0x16, 0x6e, 0x79,
+	0x84, 0x5c, 0x78, 0x94, 0x43, 0x7f, 0x32, 0xb6, 0x37, 0xa0, 0xfe, 0x9a, 0xca, 0xeb, 0x20, 0xdd,
+	0xa8, 0x6c, 0xe9, 0xed, 0xb2, 0x5b, 0x4c, 0xed, 0xef, 0x40, 0x95, 0xf3, 0xbe, 0xf7, 0x32, 0xff,
+	0x47, 0xa8, 0x70, 0xde, 0x7f, 0x36, 0xf9, 0xbe, 0xa8, 0xcd, 0x7c, 0x5f, 0xbc, 0xf5, 0xf1, 0x50,
+	0x5f, 0xf0, 0xf1, 0x30, 0x86, 0x35, 0xf4, 0xf4, 0x69, 0x48, 0xa2, 0xe3, 0x38, 0xa0, 0x97, 0x2c,
+	0xd6, 0x56, 0xb7, 0xf8, 0x26, 0x18, 0x2c, 0xf5, 0xfc, 0x38, 0x8b, 0x44, 0xfe, 0xf0, 0xab, 0xb3,
+	0x74, 0x5f, 0x4e, 0xed, 0xef, 0x42, 0x35, 0x64, 0x43, 0xa6, 0x9a, 0x30, 0xdd, 0x55, 0x13, 0xe7,
+	0xcf, 0x65, 0x30, 0x26, 0xdb, 0xee, 0x80, 0x39, 0x42, 0xe7, 0x7b, 0x79, 0x88, 0xb4, 0x2b, 0x43,
+	0x24, 0x8b, 0x50, 0xc9, 0xec, 0xca, 0x50, 0x7d, 0x76, 0x8d, 0x50, 0x49, 0xd1, 0x19, 0xd5, 0x7f,
+	0x02, 0x55, 0xcc, 0xb1, 0x3c, 0x1d, 0xb7, 0x96, 0xa5, 0x63, 0xa1, 0x6d, 0xa7, 0xe4, 0x2a, 0x01,
+	0xfb, 0x08, 0xcc, 0x01, 0xa6, 0x99, 0x52, 0xbb, 0xba, 0xb4, 0x46, 0x2f, 0x27, 0xa3, 0xd4, 0x40,
+	0x49, 0xa2, 0xf2, 0x6d, 0xb0, 0xe2, 0x4c, 0x24, 0x99, 0xf0, 0x8a, 0x82, 0x93, 0x45, 0xa5, 0xb7,
+	0x75, 0xb7, 0xa5, 0xe8, 0x47, 0xaa, 0xee, 0x52, 0x59, 0xc7, 0x51, 0x1c, 0xd0, 0xbb, 0xdf, 0x68,
+	0x50, 0x53, 0x2d, 0xc0, 0x7c, 0xa3, 0xba, 0x0e, 0xe6, 0x53, 0x4e, 0x89, 0xa0, 0xfc, 0x7c, 0x40,
+	0x22, 0x4b, 0xb3, 0x2d, 0x68, 0xe6, 0x84, 0xc3, 0x57, 0x19, 0x91, 0x8f, 0x85, 0x26, 0x18, 0x5f,
+	0xd1, 0x34, 0xc5, 0x75, 0x1d, 0x3b, 0x59, 0x9a, 0xa6, 0x6a, 0xb1, 0x62, 0x37, 0xa0, 0xaa, 0x86,
+	0x55, 0xc9, 0x77, 0x1c, 0x0b, 0x35, 0xab, 0x49, 0xe0, 0x53, 0x4e, 0xfb, 0xec, 0xcd, 0x73, 0x22,
+	0xfc, 0x81, 0x55, 0x97, 0xc0, 0xa7, 0x71, 0x2a, 0x26, 0x14, 0x43, 0xca, 0xaa, 0x61, 0x43, 0x0e,
+	0xf1, 0xd2, 0xb0, 0xc0, 0xae, 0x41, 0xb9, 0x1b, 0x59, 0xa6, 0x24, 0x1d, 0xc7, 0xa2, 0x1b, 0x59,
+	0x4d, 0xd9, 0x4d, 0x77, 0xa3, 0x89, 0xe0, 0xda, 0xdd, 0xa7, 0x60, 0xce, 0x74, 0x52, 0xd2, 0xa0,
+	0xaf, 0xa3, 0x97, 0x51, 0xfc, 0x3a, 0x52, 0xcf, 0x87, 0xdd, 0x40, 0xb6, 0xdc, 0x75, 0xd0, 0xcf,
+	0xb2, 0x9e, 0x55, 0x96, 0x83, 0xe7, 0x59, 0x68, 0xe9, 0x72, 0x70, 0xc0, 0x46, 0x56, 0x05, 0x29,
+	0x71, 0x60, 0x55, 0xef, 0x7e, 0x08, 0x30, 0x2d, 0x28, 0xa9, 0xf2, 0x2f, 0xb0, 0x6a, 0x68, 0x70,
+	0x96, 0x0d, 0x15, 0x96, 0xeb, 0x1e, 0x59, 0xda, 0xde, 0xc7, 0xbf, 0x7c, 0x70, 0xc1, 0xc4, 0x20,
+	0xeb, 0x6d, 0xfb, 0xf1, 0xf0, 0xbe, 0x0a, 0xd7, 0x3d, 0x16, 0xe7, 0xa3, 0xfb, 0x2c, 0x12, 0x94,
+	0x47, 0x24, 0xbc, 0x8f, 0x11, 0xbc, 0x2f, 0x23, 0x98, 0xf4, 0x7a, 0x35, 0x9c, 0x7d, 0xfc, 0x9f,
+	0x00, 0x00, 0x00, 0xff, 0xff, 0xb7, 0xe3, 0x43, 0x27, 0x91, 0x15, 0x00, 0x00,
 }
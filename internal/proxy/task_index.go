@@ -139,7 +139,19 @@ func (cit *createIndexTask) parseIndexParams() error {
 	}
 	if !isVecIndex {
 		specifyIndexType, exist := indexParamsMap[common.IndexTypeKey]
-		if cit.fieldSchema.DataType == schemapb.DataType_VarChar {
+		if exist && (specifyIndexType == indexparamcheck.IndexBitmap || specifyIndexType == indexparamcheck.IndexTrigram ||
+			specifyIndexType == indexparamcheck.IndexZoneMap) {
+			if err := checkTrain(cit.fieldSchema, indexParamsMap); err != nil {
+				return merr.WrapErrParameterInvalid("valid scalar index params", specifyIndexType, err.Error())
+			}
+		} else if cit.fieldSchema.DataType == schemapb.DataType_Bool {
+			if exist && specifyIndexType != DefaultIndexType {
+				return merr.WrapErrParameterInvalid(DefaultBoolIndexType, specifyIndexType, "index type not match")
+			}
+			if !exist {
+				indexParamsMap[common.IndexTypeKey] = DefaultBoolIndexType
+			}
+		} else if cit.fieldSchema.DataType == schemapb.DataType_VarChar {
 			if exist && specifyIndexType != DefaultStringIndexType {
 				return merr.WrapErrParameterInvalid(DefaultStringIndexType, specifyIndexType, "index type not match")
 			}
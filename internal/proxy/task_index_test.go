@@ -35,6 +35,7 @@ import (
 	"github.com/milvus-io/milvus/pkg/common"
 	"github.com/milvus-io/milvus/pkg/config"
 	"github.com/milvus-io/milvus/pkg/util/funcutil"
+	"github.com/milvus-io/milvus/pkg/util/indexparamcheck"
 	"github.com/milvus-io/milvus/pkg/util/merr"
 	"github.com/milvus-io/milvus/pkg/util/paramtable"
 )
@@ -595,6 +596,101 @@ func Test_parseIndexParams(t *testing.T) {
 		err = cit5.parseIndexParams()
 		assert.ErrorIs(t, err, merr.ErrParameterInvalid)
 	})
+
+	t.Run("bitmap index on scalar field", func(t *testing.T) {
+		newTask := func(dataType schemapb.DataType, params ...*commonpb.KeyValuePair) *createIndexTask {
+			return &createIndexTask{
+				req: &milvuspb.CreateIndexRequest{
+					ExtraParams: params,
+				},
+				fieldSchema: &schemapb.FieldSchema{
+					FieldID:  101,
+					Name:     "FieldID",
+					DataType: dataType,
+				},
+			}
+		}
+
+		// bool fields get a bitmap index by default
+		cit := newTask(schemapb.DataType_Bool)
+		assert.NoError(t, cit.parseIndexParams())
+		indexType, err := funcutil.GetAttrByKeyFromRepeatedKV(common.IndexTypeKey, cit.newIndexParams)
+		assert.NoError(t, err)
+		assert.Equal(t, DefaultBoolIndexType, indexType)
+
+		cit = newTask(schemapb.DataType_Bool, &commonpb.KeyValuePair{Key: common.IndexTypeKey, Value: DefaultIndexType})
+		assert.NoError(t, cit.parseIndexParams())
+
+		cit = newTask(schemapb.DataType_VarChar,
+			&commonpb.KeyValuePair{Key: common.IndexTypeKey, Value: indexparamcheck.IndexBitmap},
+			&commonpb.KeyValuePair{Key: indexparamcheck.BitmapCardinalityLimitKey, Value: "100"})
+		assert.NoError(t, cit.parseIndexParams())
+
+		cit = newTask(schemapb.DataType_Int64, &commonpb.KeyValuePair{Key: common.IndexTypeKey, Value: indexparamcheck.IndexBitmap})
+		assert.ErrorIs(t, cit.parseIndexParams(), merr.ErrParameterInvalid)
+
+		cit = newTask(schemapb.DataType_Int8,
+			&commonpb.KeyValuePair{Key: common.IndexTypeKey, Value: indexparamcheck.IndexBitmap},
+			&commonpb.KeyValuePair{Key: indexparamcheck.BitmapCardinalityLimitKey, Value: "-1"})
+		assert.ErrorIs(t, cit.parseIndexParams(), merr.ErrParameterInvalid)
+	})
+
+	t.Run("trigram index on varchar field", func(t *testing.T) {
+		newTask := func(dataType schemapb.DataType) *createIndexTask {
+			return &createIndexTask{
+				req: &milvuspb.CreateIndexRequest{
+					ExtraParams: []*commonpb.KeyValuePair{
+						{Key: common.IndexTypeKey, Value: indexparamcheck.IndexTrigram},
+					},
+				},
+				fieldSchema: &schemapb.FieldSchema{
+					FieldID:  101,
+					Name:     "FieldID",
+					DataType: dataType,
+				},
+			}
+		}
+
+		cit := newTask(schemapb.DataType_VarChar)
+		assert.NoError(t, cit.parseIndexParams())
+		indexType, err := funcutil.GetAttrByKeyFromRepeatedKV(common.IndexTypeKey, cit.newIndexParams)
+		assert.NoError(t, err)
+		assert.Equal(t, indexparamcheck.IndexTrigram, indexType)
+
+		cit = newTask(schemapb.DataType_Int64)
+		assert.ErrorIs(t, cit.parseIndexParams(), merr.ErrParameterInvalid)
+	})
+
+	t.Run("zone map index on numeric field", func(t *testing.T) {
+		newTask := func(dataType schemapb.DataType, params ...*commonpb.KeyValuePair) *createIndexTask {
+			return &createIndexTask{
+				req: &milvuspb.CreateIndexRequest{
+					ExtraParams: append([]*commonpb.KeyValuePair{
+						{Key: common.IndexTypeKey, Value: indexparamcheck.IndexZoneMap},
+					}, params...),
+				},
+				fieldSchema: &schemapb.FieldSchema{
+					FieldID:  101,
+					Name:     "FieldID",
+					DataType: dataType,
+				},
+			}
+		}
+
+		cit := newTask(schemapb.DataType_Int64,
+			&commonpb.KeyValuePair{Key: indexparamcheck.ZoneMapBloomFilterKey, Value: "true"})
+		assert.NoError(t, cit.parseIndexParams())
+		indexType, err := funcutil.GetAttrByKeyFromRepeatedKV(common.IndexTypeKey, cit.newIndexParams)
+		assert.NoError(t, err)
+		assert.Equal(t, indexparamcheck.IndexZoneMap, indexType)
+
+		cit = newTask(schemapb.DataType_VarChar)
+		assert.ErrorIs(t, cit.parseIndexParams(), merr.ErrParameterInvalid)
+
+		cit = newTask(schemapb.DataType_Float,
+			&commonpb.KeyValuePair{Key: indexparamcheck.ZoneMapBlockRowsKey, Value: "-1"})
+		assert.ErrorIs(t, cit.parseIndexParams(), merr.ErrParameterInvalid)
+	})
 }
 
 func Test_wrapUserIndexParams(t *testing.T) {
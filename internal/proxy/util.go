@@ -63,6 +63,9 @@ const (
 
 	// DefaultStringIndexType name of default index type for varChar/string field
 	DefaultStringIndexType = "Trie"
+
+	// DefaultBoolIndexType name of default index type for bool field
+	DefaultBoolIndexType = "BITMAP"
 )
 
 var logger = log.L().WithOptions(zap.Fields(zap.String("role", typeutil.ProxyRole)))
@@ -194,12 +194,30 @@ func (node *QueryNode) InitSegcore() error {
 	enableGrowingIndex := C.bool(paramtable.Get().QueryNodeCfg.EnableGrowingSegmentIndex.GetAsBool())
 	C.SegcoreSetEnableGrowingSegmentIndex(enableGrowingIndex)
 
+	enableGrowingHnsw := C.bool(paramtable.Get().QueryNodeCfg.EnableGrowingHnsw.GetAsBool())
+	C.SegcoreSetEnableGrowingHnsw(enableGrowingHnsw)
+
 	nlist := C.int64_t(paramtable.Get().QueryNodeCfg.GrowingIndexNlist.GetAsInt64())
 	C.SegcoreSetNlist(nlist)
 
 	nprobe := C.int64_t(paramtable.Get().QueryNodeCfg.GrowingIndexNProbe.GetAsInt64())
 	C.SegcoreSetNprobe(nprobe)
 
+	resultCacheCapacity := C.int64_t(paramtable.Get().QueryNodeCfg.ResultCacheCapacity.GetAsInt64() * 1024 * 1024)
+	C.SegcoreSetResultCacheCapacity(resultCacheCapacity)
+
+	filterCacheCapacity := C.int64_t(paramtable.Get().QueryNodeCfg.FilterCacheCapacity.GetAsInt64() * 1024 * 1024)
+	C.SegcoreSetFilterBitsetCacheCapacity(filterCacheCapacity)
+
+	bruteForceFilterRatio := C.float(paramtable.Get().QueryNodeCfg.BruteForceFilterRatio.GetAsFloat())
+	C.SegcoreSetBruteForceFilterRatio(bruteForceFilterRatio)
+
+	enableColumnEncoding := C.bool(paramtable.Get().QueryNodeCfg.EnableColumnEncoding.GetAsBool())
+	C.SegcoreSetEnableColumnEncoding(enableColumnEncoding)
+
+	columnFileCacheCapacity := C.int64_t(paramtable.Get().QueryNodeCfg.ColumnFileCacheCapacity.GetAsInt64() * 1024 * 1024)
+	C.SegcoreSetColumnFileCacheCapacity(columnFileCacheCapacity)
+
 	// override segcore SIMD type
 	cSimdType := C.CString(paramtable.Get().CommonCfg.SimdType.GetValue())
 	C.SegcoreSetSimdType(cSimdType)
@@ -224,7 +242,15 @@ func (node *QueryNode) InitSegcore() error {
 	initcore.InitLocalChunkManager(localDataRootPath)
 
 	initcore.InitTraceConfig(paramtable.Get())
-	return initcore.InitRemoteChunkManager(paramtable.Get())
+	if err := initcore.InitRemoteChunkManager(paramtable.Get()); err != nil {
+		return err
+	}
+
+	remoteCacheCapacity := paramtable.Get().QueryNodeCfg.RemoteCacheCapacity.GetAsInt64() * 1024 * 1024
+	if remoteCacheCapacity > 0 {
+		return initcore.InitRemoteChunkManagerCache(filepath.Join(localDataRootPath, "remote_cache"), remoteCacheCapacity)
+	}
+	return nil
 }
 
 func (node *QueryNode) CloseSegcore() {
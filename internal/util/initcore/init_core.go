@@ -93,6 +93,15 @@ func InitRemoteChunkManager(params *paramtable.ComponentParam) error {
 	return HandleCStatus(&status, "InitRemoteChunkManagerSingleton failed")
 }
 
+// InitRemoteChunkManagerCache serves reads of the remote chunk manager from
+// a local disk cache of capacity bytes under path.
+func InitRemoteChunkManagerCache(path string, capacity int64) error {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	status := C.InitRemoteChunkManagerCache(cPath, C.int64_t(capacity))
+	return HandleCStatus(&status, "InitRemoteChunkManagerCache failed")
+}
+
 func CleanRemoteChunkManager() {
 	C.CleanRemoteChunkManagerSingleton()
 }
@@ -27,4 +27,8 @@ const (
 	IndexFaissBinIvfFlat IndexType = "BIN_IVF_FLAT"
 	IndexHNSW            IndexType = "HNSW"
 	IndexDISKANN         IndexType = "DISKANN"
+
+	IndexBitmap  IndexType = "BITMAP"
+	IndexTrigram IndexType = "TRIGRAM"
+	IndexZoneMap IndexType = "ZONE_MAP"
 )
@@ -1,8 +1,92 @@
 package indexparamcheck
 
-import "github.com/milvus-io/milvus-proto/go-api/v2/schemapb"
+import (
+	"fmt"
+	"strconv"
+
+	"github.com/milvus-io/milvus-proto/go-api/v2/schemapb"
+)
+
+// BitmapCardinalityLimitKey is the max number of distinct values of a field with a bitmap index.
+const BitmapCardinalityLimitKey = "bitmap_cardinality_limit"
+
+// ZoneMapBlockRowsKey is the number of rows of a block of a zone map index.
+const ZoneMapBlockRowsKey = "zone_map_block_rows"
+
+// ZoneMapBloomFilterKey tells whether every block of a zone map index gets a Bloom filter.
+const ZoneMapBloomFilterKey = "zone_map_bloom_filter"
+
+// bitmapIndexTypes are the field types of few distinct values which a bitmap index suits.
+var bitmapIndexTypes = []schemapb.DataType{
+	schemapb.DataType_Bool,
+	schemapb.DataType_Int8,
+	schemapb.DataType_Int16,
+	schemapb.DataType_VarChar,
+}
+
+// zoneMapIndexTypes are the numeric field types which a zone map index supports.
+var zoneMapIndexTypes = []schemapb.DataType{
+	schemapb.DataType_Int8,
+	schemapb.DataType_Int16,
+	schemapb.DataType_Int32,
+	schemapb.DataType_Int64,
+	schemapb.DataType_Float,
+	schemapb.DataType_Double,
+}
 
 // TODO: check index parameters according to the index type & data type.
 func CheckIndexValid(dType schemapb.DataType, indexType IndexType, indexParams map[string]string) error {
+	if indexType == IndexBitmap {
+		return checkBitmapIndex(dType, indexParams)
+	}
+	if indexType == IndexZoneMap {
+		return checkZoneMapIndex(dType, indexParams)
+	}
+	if indexType == IndexTrigram && dType != schemapb.DataType_VarChar {
+		return fmt.Errorf("%s index is only supported on %s field, got %s", IndexTrigram, schemapb.DataType_VarChar.String(), dType.String())
+	}
+	return nil
+}
+
+func checkBitmapIndex(dType schemapb.DataType, indexParams map[string]string) error {
+	supported := false
+	for _, t := range bitmapIndexTypes {
+		if dType == t {
+			supported = true
+			break
+		}
+	}
+	if !supported {
+		return fmt.Errorf("%s index is not supported on %s field, supported: %v", IndexBitmap, dType.String(), bitmapIndexTypes)
+	}
+	if limit, ok := indexParams[BitmapCardinalityLimitKey]; ok {
+		value, err := strconv.ParseInt(limit, 10, 64)
+		if err != nil || value <= 0 {
+			return fmt.Errorf("%s must be a positive integer, got %s", BitmapCardinalityLimitKey, limit)
+		}
+	}
+	return nil
+}
+
+func checkZoneMapIndex(dType schemapb.DataType, indexParams map[string]string) error {
+	supported := false
+	for _, t := range zoneMapIndexTypes {
+		if dType == t {
+			supported = true
+			break
+		}
+	}
+	if !supported {
+		return fmt.Errorf("%s index is not supported on %s field, supported: %v", IndexZoneMap, dType.String(), zoneMapIndexTypes)
+	}
+	if rows, ok := indexParams[ZoneMapBlockRowsKey]; ok {
+		value, err := strconv.ParseInt(rows, 10, 64)
+		if err != nil || value <= 0 {
+			return fmt.Errorf("%s must be a positive integer, got %s", ZoneMapBlockRowsKey, rows)
+		}
+	}
+	if bloom, ok := indexParams[ZoneMapBloomFilterKey]; ok && bloom != "true" && bloom != "false" {
+		return fmt.Errorf("%s must be true or false, got %s", ZoneMapBloomFilterKey, bloom)
+	}
 	return nil
 }
@@ -10,3 +10,43 @@ import (
 func TestCheckIndexValid(t *testing.T) {
 	assert.NoError(t, CheckIndexValid(schemapb.DataType_Int64, "inverted_index", nil))
 }
+
+func TestCheckBitmapIndexValid(t *testing.T) {
+	assert.NoError(t, CheckIndexValid(schemapb.DataType_Bool, IndexBitmap, nil))
+	assert.NoError(t, CheckIndexValid(schemapb.DataType_Int8, IndexBitmap, nil))
+	assert.NoError(t, CheckIndexValid(schemapb.DataType_VarChar, IndexBitmap, map[string]string{
+		BitmapCardinalityLimitKey: "100",
+	}))
+
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Int64, IndexBitmap, nil))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Float, IndexBitmap, nil))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Int16, IndexBitmap, map[string]string{
+		BitmapCardinalityLimitKey: "0",
+	}))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Int16, IndexBitmap, map[string]string{
+		BitmapCardinalityLimitKey: "many",
+	}))
+}
+
+func TestCheckTrigramIndexValid(t *testing.T) {
+	assert.NoError(t, CheckIndexValid(schemapb.DataType_VarChar, IndexTrigram, nil))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Int64, IndexTrigram, nil))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_JSON, IndexTrigram, nil))
+}
+
+func TestCheckZoneMapIndexValid(t *testing.T) {
+	assert.NoError(t, CheckIndexValid(schemapb.DataType_Int64, IndexZoneMap, nil))
+	assert.NoError(t, CheckIndexValid(schemapb.DataType_Double, IndexZoneMap, map[string]string{
+		ZoneMapBlockRowsKey:   "4096",
+		ZoneMapBloomFilterKey: "true",
+	}))
+
+	assert.Error(t, CheckIndexValid(schemapb.DataType_VarChar, IndexZoneMap, nil))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Bool, IndexZoneMap, nil))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Int32, IndexZoneMap, map[string]string{
+		ZoneMapBlockRowsKey: "0",
+	}))
+	assert.Error(t, CheckIndexValid(schemapb.DataType_Int32, IndexZoneMap, map[string]string{
+		ZoneMapBloomFilterKey: "yes",
+	}))
+}
@@ -1517,8 +1517,14 @@ type queryNodeConfig struct {
 	KnowhereThreadPoolSize    ParamItem `refreshable:"false"`
 	ChunkRows                 ParamItem `refreshable:"false"`
 	EnableGrowingSegmentIndex ParamItem `refreshable:"false"`
+	EnableGrowingHnsw         ParamItem `refreshable:"false"`
 	GrowingIndexNlist         ParamItem `refreshable:"false"`
 	GrowingIndexNProbe        ParamItem `refreshable:"false"`
+	ResultCacheCapacity       ParamItem `refreshable:"false"`
+	FilterCacheCapacity       ParamItem `refreshable:"false"`
+	BruteForceFilterRatio     ParamItem `refreshable:"false"`
+	EnableColumnEncoding      ParamItem `refreshable:"false"`
+	ColumnFileCacheCapacity   ParamItem `refreshable:"false"`
 
 	// memory limit
 	LoadMemoryUsageFactor               ParamItem `refreshable:"true"`
@@ -1528,6 +1534,7 @@ type queryNodeConfig struct {
 	EnableDisk             ParamItem `refreshable:"true"`
 	DiskCapacityLimit      ParamItem `refreshable:"true"`
 	MaxDiskUsagePercentage ParamItem `refreshable:"true"`
+	RemoteCacheCapacity    ParamItem `refreshable:"false"`
 
 	// cache limit
 	CacheEnabled     ParamItem `refreshable:"false"`
@@ -1645,6 +1652,15 @@ func (p *queryNodeConfig) init(base *BaseTable) {
 	}
 	p.EnableGrowingSegmentIndex.Init(base.mgr)
 
+	p.EnableGrowingHnsw = ParamItem{
+		Key:          "queryNode.segcore.growing.enableHnsw",
+		Version:      "2.3.0",
+		DefaultValue: "false",
+		Doc:          "growing segments of HNSW indexed fields keep an HNSW graph of the same params, instead of the IVF index of the chunks",
+		Export:       true,
+	}
+	p.EnableGrowingHnsw.Init(base.mgr)
+
 	p.GrowingIndexNlist = ParamItem{
 		Key:          "queryNode.segcore.growing.nlist",
 		Version:      "2.0.0",
@@ -1673,6 +1689,51 @@ func (p *queryNodeConfig) init(base *BaseTable) {
 	}
 	p.GrowingIndexNProbe.Init(base.mgr)
 
+	p.ResultCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.resultCache.capacity",
+		Version:      "2.3.0",
+		DefaultValue: "0",
+		Doc:          "memory budget (in MB) to cache search and retrieve results of sealed segments, 0 to disable",
+		Export:       true,
+	}
+	p.ResultCacheCapacity.Init(base.mgr)
+
+	p.FilterCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.filterCache.capacity",
+		Version:      "2.3.0",
+		DefaultValue: "0",
+		Doc:          "memory budget (in MB) of each sealed segment to cache evaluated filter bitsets, 0 to disable",
+		Export:       true,
+	}
+	p.FilterCacheCapacity.Init(base.mgr)
+
+	p.BruteForceFilterRatio = ParamItem{
+		Key:          "queryNode.segcore.bruteForceFilterRatio",
+		Version:      "2.3.0",
+		DefaultValue: "0",
+		Doc:          "search with brute force on the rows left by the filter instead of the index, if they are no more than this ratio of the segment rows, 0 to disable",
+		Export:       true,
+	}
+	p.BruteForceFilterRatio.Init(base.mgr)
+
+	p.EnableColumnEncoding = ParamItem{
+		Key:          "queryNode.segcore.enableColumnEncoding",
+		Version:      "2.3.0",
+		DefaultValue: "false",
+		Doc:          "keep the integer and low cardinality varchar fields of sealed segments loaded in memory compressed, with frame of reference, delta or dictionary encoding, filters on them are evaluated on the encoded data",
+		Export:       true,
+	}
+	p.EnableColumnEncoding.Init(base.mgr)
+
+	p.ColumnFileCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.columnFileCache.capacity",
+		Version:      "2.3.0",
+		DefaultValue: "0",
+		Doc:          "disk budget (in MB) of the column files kept in the mmap dir for later loads of the same segments, the least recently used are removed beyond it, 0 to unlink them once mapped",
+		Export:       true,
+	}
+	p.ColumnFileCacheCapacity.Init(base.mgr)
+
 	p.LoadMemoryUsageFactor = ParamItem{
 		Key:          "queryNode.loadMemoryUsageFactor",
 		Version:      "2.0.0",
@@ -1831,6 +1892,15 @@ Max read concurrency must greater than or equal to 1, and less than or equal to
 	}
 	p.MaxDiskUsagePercentage.Init(base.mgr)
 
+	p.RemoteCacheCapacity = ParamItem{
+		Key:          "queryNode.remoteCache.capacity",
+		Version:      "2.3.0",
+		DefaultValue: "0",
+		Doc:          "local disk budget (in MB) to cache binlogs and index files read from object storage across segment reloads and restarts, 0 to disable",
+		Export:       true,
+	}
+	p.RemoteCacheCapacity.Init(base.mgr)
+
 	p.MaxTimestampLag = ParamItem{
 		Key:          "queryNode.scheduler.maxTimestampLag",
 		Version:      "2.2.3",